@@ -450,6 +450,16 @@ bool nrf_802154_receive(void);
  * If the requested reception time is in the past, the function returns false and does not
  * schedule reception.
  *
+ * Up to @ref NRF_802154_DELAYED_TRX_QUEUE_SIZE receive windows can be scheduled in addition to
+ * the one for which the timeslot is already requested. The windows are entered in the order
+ * of their start time. If a scheduled window cannot be entered on time,
+ * @ref nrf_802154_receive_failed is called with the
+ * @ref NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED argument.
+ *
+ * @note A call made while another delayed reception is scheduled queues the new receive window.
+ *       Earlier versions of the driver returned false in that case. The function returns false
+ *       only if the requested time is in the past or the queue is full.
+ *
  * A scheduled reception can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
  *
  * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
@@ -466,12 +476,43 @@ bool nrf_802154_receive_at(uint32_t t0,
                            uint32_t timeout,
                            uint8_t  channel);
 
+/**
+ * @brief Requests reception in periodic receive windows.
+ *
+ * This function works as a periodic version of @ref nrf_802154_receive_at. The first receive
+ * window starts at @p t0 + @p dt and each subsequent window starts @p period after the previous
+ * one. Each window is reported in the same way as a window requested by
+ * @ref nrf_802154_receive_at. If a window cannot be entered on time, because the previous one
+ * was extended by a frame reception, it is skipped.
+ *
+ * The periodic reception lasts until it is cancelled by a call to
+ * @ref nrf_802154_receive_at_cancel.
+ *
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]  period   Period of the receive windows, in microseconds (us). It must be longer
+ *                      than @p timeout.
+ * @param[in]  timeout  Reception timeout (counted from the start of each window),
+ *                      in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frames are to be received.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure.
+ */
+bool nrf_802154_receive_at_periodic(uint32_t t0,
+                                    uint32_t dt,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel);
+
 /**
  * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
  *
  * If the receive window has been scheduled but has not started yet, this function prevents
  * entering the receive window. If the receive window has been scheduled and has already started,
  * the radio remains in the receive state, but a window timeout will not be reported.
+ * All queued receive windows are cancelled as well.
  *
  * @retval  true    The delayed reception was scheduled and successfully cancelled.
  * @retval  false   No delayed reception was scheduled.
@@ -518,6 +559,36 @@ bool nrf_802154_receive_at_cancel(void);
  */
 bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
 
+/**
+ * @brief Adds a frame to the transmit queue of the driver.
+ *
+ * @note This function is implemented in zero-copy fashion. The buffer pointed to by @p p_data must
+ *       not be modified until the transmission result of the frame is reported.
+ *
+ * This function works as @ref nrf_802154_transmit_raw, but it can also be called while another
+ * frame is being transmitted. In that case, the frame is transmitted right after the transmission
+ * of the previous frame succeeds, without waiting for the higher layer to process the result.
+ * If the interframe spacing feature is enabled, the required interframe space is inserted between
+ * the frames. Up to @ref NRF_802154_TX_QUEUE_SIZE frames can wait in the queue.
+ *
+ * The transmission result of each frame is reported to the higher layer separately by calls to
+ * @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed. If the transmission of a frame
+ * fails or another operation is requested, the frames waiting in the queue are not transmitted
+ * and @ref nrf_802154_transmit_failed is called for each of them with
+ * @ref NRF_802154_TX_ERROR_ABORTED.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. The first byte must contain frame
+ *                     length (including PHR and FCS). The following bytes contain data. The CRC is
+ *                     computed automatically by the radio hardware. Therefore, the FCS field can
+ *                     contain any bytes.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval  true   The frame was added to the transmit queue.
+ * @retval  false  The transmit queue is full or the driver could not schedule the transmission
+ *                 procedure.
+ */
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -582,6 +653,15 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
  * If the requested transmission time is in the past, the function returns false and does not
  * schedule transmission.
  *
+ * Up to @ref NRF_802154_DELAYED_TRX_QUEUE_SIZE transmissions can be scheduled in addition to
+ * the one for which the timeslot is already requested. The transmissions are performed in
+ * the order of their start time.
+ *
+ * @note A call made while another delayed transmission is scheduled queues the new transmission.
+ *       Earlier versions of the driver returned false in that case. The function returns false
+ *       only if the requested time is in the past or the queue is full. The buffer of each queued
+ *       transmission must remain valid until the transmission is reported.
+ *
  * A successfully scheduled transmission can be cancelled by a call
  * to @ref nrf_802154_transmit_at_cancel.
  *
@@ -608,8 +688,8 @@ bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
  * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
  *
  * If a delayed transmission has been scheduled but the transmission has not been started yet,
- * a call to this function prevents the transmission. If the transmission is ongoing,
- * it will not be aborted.
+ * a call to this function prevents the transmission. All scheduled transmissions are cancelled.
+ * If the transmission is ongoing, it will not be aborted.
  *
  * If a delayed transmission has not been scheduled (or has already finished), this function does
  * not change state and returns false.
@@ -1302,6 +1382,91 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
  */
 void nrf_802154_pending_bit_for_addr_reset(bool extended);
 
+/**
+ * @brief Adds addresses of peer nodes to the pending bit list in a single operation.
+ *
+ * This function is equivalent to calling @ref nrf_802154_pending_bit_for_addr_set for every
+ * address in @p p_addrs, but updates the list at once. If the addresses are sorted in strictly
+ * ascending order of their numeric value, they are merged into the list in a single pass, and the
+ * list is left unmodified if the result does not fit.
+ *
+ * The new list is built aside and put in use at once, so an ACK frame transmitted in the meantime
+ * uses either the old or the new list, never a partially updated one. In particular, a node that
+ * stays on the list when @p replace is true does not miss its pending bit.
+ *
+ * When the driver is serialized, a list that does not fit in a single serialization frame is sent
+ * in several parts. In that case, the whole list is checked up front against
+ * @ref nrf_802154_pending_bit_for_addr_list_capacity_get, and the function returns false without
+ * modifying the list if the list is longer than the capacity, even if some of its addresses are
+ * already on the list.
+ *
+ * The pending bit list works differently, depending on the upper layer for which the source
+ * address matching method is selected:
+ *   - For Thread, @ref NRF_802154_SRC_ADDR_MATCH_THREAD
+ *   - For Zigbee, @ref NRF_802154_SRC_ADDR_MATCH_ZIGBEE
+ *   - For Standard-compliant, @ref NRF_802154_SRC_ADDR_MATCH_ALWAYS_1
+ * For more information, see @ref nrf_802154_src_addr_match_t.
+ *
+ * The method can be set during initialization phase by calling @ref nrf_802154_src_matching_method.
+ *
+ * @param[in]  p_addrs    Array of bytes containing consecutive addresses of the nodes
+ *                        (little-endian).
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]  replace    If all addresses of a given type are to be removed from the list before
+ *                        adding @p p_addrs.
+ *
+ * @retval True   All addresses are successfully added to the list.
+ * @retval False  Not enough memory to store all addresses in the list.
+ */
+bool nrf_802154_pending_bit_for_addr_list_set(const uint8_t * p_addrs,
+                                              uint32_t        num_addrs,
+                                              bool            extended,
+                                              bool            replace);
+
+/**
+ * @brief Gets the number of addresses that are guaranteed to fit in the pending bit list.
+ *
+ * A call to @ref nrf_802154_pending_bit_for_addr_list_set with the same @p extended and
+ * @p replace arguments succeeds for any list of at most this many addresses, provided that the
+ * pending bit list is not modified in between.
+ *
+ * @param[in]  extended  If the capacity for extended MAC addresses or short MAC addresses is
+ *                       requested.
+ * @param[in]  replace   If the addresses are to replace all addresses of a given type.
+ *
+ * @returns  Number of addresses that can be added to the list.
+ */
+uint32_t nrf_802154_pending_bit_for_addr_list_capacity_get(bool extended, bool replace);
+
+/**
+ * @brief Removes addresses of peer nodes from the pending bit list in a single operation.
+ *
+ * This function is equivalent to calling @ref nrf_802154_pending_bit_for_addr_clear for every
+ * address in @p p_addrs. If the addresses are sorted in strictly ascending order of their numeric
+ * value, they are removed from the list in a single pass.
+ *
+ * The pending bit list works differently, depending on the upper layer for which the source
+ * address matching method is selected:
+ *   - For Thread, @ref NRF_802154_SRC_ADDR_MATCH_THREAD
+ *   - For Zigbee, @ref NRF_802154_SRC_ADDR_MATCH_ZIGBEE
+ *   - For Standard-compliant, @ref NRF_802154_SRC_ADDR_MATCH_ALWAYS_1
+ * For more information, see @ref nrf_802154_src_addr_match_t.
+ *
+ * The method can be set during initialization phase by calling @ref nrf_802154_src_matching_method.
+ *
+ * @param[in]  p_addrs    Array of bytes containing consecutive addresses of the nodes
+ *                        (little-endian).
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ *
+ * @retval True   All addresses are successfully removed from the list.
+ * @retval False  At least one of the addresses is not in the list.
+ */
+bool nrf_802154_pending_bit_for_addr_list_clear(const uint8_t * p_addrs,
+                                                uint32_t        num_addrs,
+                                                bool            extended);
+
 /**
  * @}
  * @defgroup nrf_802154_cca CCA configuration management
@@ -1577,6 +1742,40 @@ void nrf_802154_stat_counters_reset(void);
  */
 void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals);
 
+/**
+ * @brief Get histograms of time intervals of certain operations.
+ *
+ * The histograms are gathered only if @ref NRF_802154_STATS_HISTOGRAMS_ENABLED is set to 1.
+ *
+ * @param[out] p_stat_histograms Structure that will be filled with current histograms.
+ */
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms);
+
+/**
+ * @brief Resets all buckets of the histograms of time intervals to 0.
+ */
+void nrf_802154_stat_histograms_reset(void);
+
+/**
+ * @brief Get hold times of critical sections per call site.
+ *
+ * The hold times are gathered only if @ref NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED is set
+ * to 1. Call sites are identified by code addresses, which can be resolved with the symbols of
+ * the application image.
+ *
+ * @param[out] p_sites    Array that will be filled with the call sites.
+ * @param[in]  max_sites  Number of elements of @p p_sites.
+ *
+ * @returns  Number of call sites written to @p p_sites.
+ */
+uint32_t nrf_802154_stat_crit_sect_sites_get(nrf_802154_stat_crit_sect_site_t * p_sites,
+                                             uint32_t                           max_sites);
+
+/**
+ * @brief Resets hold times of critical sections of all call sites.
+ */
+void nrf_802154_stat_crit_sect_sites_reset(void);
+
 /**
  * @}
  * @defgroup nrf_802154_ifs Inter-frame spacing feature
@@ -1631,6 +1830,112 @@ void nrf_802154_ifs_min_lifs_period_set(uint16_t period);
 
 #endif // NRF_802154_IFS_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_security Frame security feature
+ * @{
+ */
+#if NRF_802154_SECURITY_ENABLED
+
+/**
+ * @brief Stores a frame security key in the driver.
+ *
+ * Frames and Enh-Acks secured with a stored key are secured by the driver just before they are
+ * transmitted. Refer to @ref NRF_802154_SECURITY_ENABLED for details.
+ *
+ * @param[in]  p_key  Pointer to the key to store. The key and its identifier are copied.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key was stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There is no free entry in the key storage.
+ * @retval NRF_802154_SECURITY_ERROR_ALREADY_PRESENT     A key with the same identifier is stored.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not supported.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_store(const nrf_802154_key_t * p_key);
+
+/**
+ * @brief Removes a frame security key from the driver.
+ *
+ * @param[in]  p_id  Pointer to the identifier of the key to remove.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key was removed.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND       There is no key with the given identifier.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not supported.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_remove(const nrf_802154_key_id_t * p_id);
+
+/**
+ * @brief Sets the global frame counter used by the frames secured by the driver.
+ *
+ * @param[in]  frame_counter  Value of the frame counter to use for the next secured frame.
+ */
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter);
+
+/**
+ * @brief Gets the global frame counter used by the frames secured by the driver.
+ *
+ * @returns  Value of the frame counter that is to be used for the next secured frame.
+ */
+uint32_t nrf_802154_security_global_frame_counter_get(void);
+
+#endif // NRF_802154_SECURITY_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_background_scan Background channel scan feature
+ * @{
+ */
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+
+/**
+ * @brief Starts the background channel scan.
+ *
+ * While the scan is running, every @p interval_us the driver measures the energy on the next
+ * channel from @p channel_mask for @p ed_time_us and updates the channel map. A measurement is
+ * taken only if the driver is in the receive state and is not receiving a frame.
+ * Otherwise, it is postponed to the next interval. Measurements never delay other operations: any
+ * request terminates an ongoing measurement, and its termination is not notified. Measurements
+ * are not reported by @ref nrf_802154_energy_detected.
+ *
+ * The fraction of the radio time spent on the scan is about @p ed_time_us / @p interval_us.
+ * While a channel is measured, frames are not received on the channel set in PIB.
+ *
+ * If the scan is already running, it is restarted with the new parameters.
+ *
+ * @param[in]  channel_mask  Mask of channels to scan. Bit n corresponds to channel n.
+ * @param[in]  ed_time_us    Duration of the energy detection on a single channel.
+ * @param[in]  interval_us   Interval between the starts of consecutive energy detections.
+ *
+ * @retval true   The scan was started.
+ * @retval false  The scan was not started because the mask does not contain any supported channel
+ *                or @p interval_us is not longer than @p ed_time_us.
+ */
+bool nrf_802154_background_scan_start(uint32_t channel_mask,
+                                      uint32_t ed_time_us,
+                                      uint32_t interval_us);
+
+/**
+ * @brief Stops the background channel scan.
+ *
+ * The channel map is preserved.
+ */
+void nrf_802154_background_scan_stop(void);
+
+/**
+ * @brief Gets the channel map collected by the background channel scan.
+ *
+ * This function does not perform any radio operation.
+ *
+ * @param[out] p_map  Pointer to the buffer for the channel map.
+ */
+void nrf_802154_channel_map_get(nrf_802154_channel_map_t * p_map);
+
+/**
+ * @brief Clears the channel map collected by the background channel scan.
+ */
+void nrf_802154_channel_map_reset(void);
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_capabilities Radio driver run-time capabilities feature.
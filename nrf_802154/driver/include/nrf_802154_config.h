@@ -265,6 +265,17 @@ extern "C" {
 #define NRF_802154_DELAYED_TRX_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_DELAYED_TRX_QUEUE_SIZE
+ *
+ * Number of delayed transmissions and the number of receive windows that can be scheduled
+ * in addition to the ones for which the timeslot is already requested.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_QUEUE_SIZE
+#define NRF_802154_DELAYED_TRX_QUEUE_SIZE 4
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
@@ -397,6 +408,73 @@ extern "C" {
 #define NRF_802154_MAX_ACK_IE_SIZE 8
 #endif
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_security Frame security feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_SECURITY_ENABLED
+ *
+ * Indicates whether the driver applies the 802.15.4 CCM* security to transmitted frames
+ * and Enh-Acks.
+ *
+ * When enabled, a frame with the Security Enabled bit set whose key is found in the key storage
+ * gets the frame counter written into its auxiliary security header and is authenticated and
+ * encrypted by the driver just before transmission. The higher layer must leave room for the MIC
+ * in the frame and must not secure such frames itself. Frames whose key is not stored, frames with
+ * Key Identifier Mode 0 and frames with a suppressed frame counter are transmitted unmodified.
+ * If a frame cannot be secured, e.g. because the frame counter is exhausted, its transmission
+ * fails with @ref NRF_802154_TX_ERROR_SECURITY without any further attempts.
+ *
+ */
+#ifndef NRF_802154_SECURITY_ENABLED
+#define NRF_802154_SECURITY_ENABLED          0
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_KEY_STORAGE_SIZE
+ *
+ * The number of frame security keys that can be stored in the driver.
+ *
+ */
+#ifndef NRF_802154_SECURITY_KEY_STORAGE_SIZE
+#define NRF_802154_SECURITY_KEY_STORAGE_SIZE 3
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_channel_scan Background channel scan feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CHANNEL_SCAN_ENABLED
+ *
+ * Indicates whether the background channel scan feature is to be enabled in the driver.
+ *
+ * When the background channel scan is started, the driver periodically measures the energy on
+ * the channels from a channel mask while it is idle listening, and keeps a map of the channel
+ * quality that the higher layer can read at any time.
+ *
+ */
+#ifndef NRF_802154_CHANNEL_SCAN_ENABLED
+#define NRF_802154_CHANNEL_SCAN_ENABLED         0
+#endif
+
+/**
+ * @def NRF_802154_CHANNEL_SCAN_AVERAGING_SHIFT
+ *
+ * Weight of a new measurement in the rolling averages of the channel map, expressed as a power
+ * of 2. Each new measurement contributes 1 / 2^NRF_802154_CHANNEL_SCAN_AVERAGING_SHIFT to
+ * the average.
+ *
+ */
+#ifndef NRF_802154_CHANNEL_SCAN_AVERAGING_SHIFT
+#define NRF_802154_CHANNEL_SCAN_AVERAGING_SHIFT 3
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_ifs Interframe spacing feature configuration
@@ -435,6 +513,17 @@ extern "C" {
 #endif
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 
+/**
+ * @def NRF_802154_TX_QUEUE_SIZE
+ *
+ * The number of frames that can wait in the transmit queue for transmission after the frame
+ * that is currently transmitted. Refer to @ref nrf_802154_transmit_raw_enqueue.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_SIZE
+#define NRF_802154_TX_QUEUE_SIZE 4
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_coex WiFi coexistence feature configuration
@@ -482,6 +571,54 @@ extern "C" {
 #define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
 #endif
 
+/**
+ * @def NRF_802154_STATS_HISTOGRAMS_ENABLED
+ *
+ * Configures if histograms of CSMA/CA access delay, ACK round-trip time, request-to-air latency
+ * and notification delay are gathered. The histograms can be retrieved by a call to
+ * @ref nrf_802154_stat_histograms_get. The ACK round-trip time is gathered only when
+ * @ref NRF_802154_FRAME_TIMESTAMP_ENABLED is 1. The CSMA/CA access delay and the request-to-air
+ * latency are gathered only when @ref NRF_802154_TX_STARTED_NOTIFY_ENABLED is 1.
+ */
+#ifndef NRF_802154_STATS_HISTOGRAMS_ENABLED
+#define NRF_802154_STATS_HISTOGRAMS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+ *
+ * Configures if hold times of critical sections are measured. When enabled, every driver
+ * critical section and every MCU critical section records its hold time and nesting depth
+ * per call site. The results can be retrieved by a call to
+ * @ref nrf_802154_stat_crit_sect_sites_get.
+ *
+ * Hold times are measured with @c NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_GET(), which
+ * defaults to the DWT cycle counter. The profiler adds overhead to every critical section, so
+ * it is intended for debugging only.
+ */
+#ifndef NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+#define NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED   0
+#endif
+
+/**
+ * @def NRF_802154_STATS_CRIT_SECT_PROFILER_SITES
+ *
+ * Configures the number of call sites the critical section profiler can track.
+ * Critical sections entered at call sites that do not fit are not measured.
+ */
+#ifndef NRF_802154_STATS_CRIT_SECT_PROFILER_SITES
+#define NRF_802154_STATS_CRIT_SECT_PROFILER_SITES     32
+#endif
+
+/**
+ * @def NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH
+ *
+ * Configures the deepest nesting level of critical sections that the profiler measures.
+ */
+#ifndef NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH
+#define NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH 8
+#endif
+
 #ifdef __cplusplus
 }
 #endif
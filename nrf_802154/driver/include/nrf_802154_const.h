@@ -83,6 +83,11 @@
 #define FRAME_VERSION_3              0x30                                         ///< Bits containing the frame version 0b11.
 
 #define IE_HEADER_LENGTH_MASK        0x3f                                         ///< Mask of bits containing the length of an IE header content.
+#define IE_HEADER_DESCRIPTOR_SIZE    2                                            ///< Size of the Header IE descriptor.
+#define IE_DESCRIPTOR_LENGTH_MASK    0x7f                                         ///< Mask of bits containing the Header IE content length in the first byte of the descriptor.
+#define IE_HEADER_TYPE_BIT           0x80                                         ///< Bit containing the IE type in the second byte of the descriptor.
+#define IE_HT1_ELEMENT_ID            0x7e                                         ///< Element ID of the Header Termination 1 IE, followed by Payload IEs.
+#define IE_HT2_ELEMENT_ID            0x7f                                         ///< Element ID of the Header Termination 2 IE, followed by the Frame Payload.
 #define IE_PRESENT_OFFSET            2                                            ///< Byte containing the IE Present bit.
 #define IE_PRESENT_BIT               0x02                                         ///< Bits containing the IE Present field.
 
@@ -181,6 +186,9 @@ typedef enum
 #if NRF_802154_IFS_ENABLED
     REQ_ORIG_IFS,
 #endif // NRF_802154_IFS_ENABLED
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+    REQ_ORIG_CHANNEL_SCAN,
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
 } req_originator_t;
 
 #endif // NRF_802154_CONST_H_
@@ -81,6 +81,7 @@ typedef uint8_t nrf_802154_tx_error_t;
 #define NRF_802154_TX_ERROR_NO_ACK          0x05 // !< ACK frame was not received during the timeout period.
 #define NRF_802154_TX_ERROR_ABORTED         0x06 // !< Procedure was aborted by another operation.
 #define NRF_802154_TX_ERROR_TIMESLOT_DENIED 0x07 // !< Transmission did not start due to a denied timeslot request.
+#define NRF_802154_TX_ERROR_SECURITY        0x09 // !< Frame security could not be applied to the frame.
 
 /**
  * @brief Possible errors during the frame reception.
@@ -226,7 +227,8 @@ typedef uint8_t nrf_802154_ifs_mode_t;
  * - @ref NRF_802154_CAPABILITY_ACK_TIMEOUT,
  * - @ref NRF_802154_CAPABILITY_ANT_DIVERSITY,
  * - @ref NRF_802154_CAPABILITY_IFS,
- * - @ref NRF_802154_CAPABILITY_TIMESTAMP
+ * - @ref NRF_802154_CAPABILITY_TIMESTAMP,
+ * - @ref NRF_802154_CAPABILITY_SECURITY
  *
  */
 typedef uint32_t nrf_802154_capabilities_t;
@@ -238,6 +240,7 @@ typedef uint32_t nrf_802154_capabilities_t;
 #define NRF_802154_CAPABILITY_ANT_DIVERSITY (1UL << 4UL) // !< Antenna diversity supported
 #define NRF_802154_CAPABILITY_IFS           (1UL << 5UL) // !< Inter-frame spacing supported
 #define NRF_802154_CAPABILITY_TIMESTAMP     (1UL << 6UL) // !< Frame timestamping supported
+#define NRF_802154_CAPABILITY_SECURITY      (1UL << 7UL) // !< Frame security supported
 
 /**
  * @brief Type of structure holding statistic counters.
@@ -262,6 +265,9 @@ typedef struct
     uint32_t coex_denied_requests;
     /**@brief Number of coex grant activations that have been not requested. */
     uint32_t coex_unsolicited_grants;
+    /**@brief Number of notifications of received frames and reception failures dropped because
+     *        the notification queue was full. */
+    uint32_t dropped_notifications;
 } nrf_802154_stat_counters_t;
 
 /**
@@ -298,6 +304,162 @@ typedef struct
     uint64_t total_transmit_time;
 } nrf_802154_stat_totals_t;
 
+/**
+ * @brief Number of buckets in a histogram of time intervals.
+ */
+#define NRF_802154_STAT_HISTOGRAM_BUCKETS 20
+
+/**
+ * @brief Type of structure holding a histogram of time intervals.
+ *
+ * Bucket 0 counts intervals of 0 us. Bucket @c n counts intervals from 2^(n-1) us
+ * to 2^n - 1 us. The last bucket counts all longer intervals as well.
+ */
+typedef struct
+{
+    /**@brief Number of intervals counted in each bucket. */
+    uint32_t buckets[NRF_802154_STAT_HISTOGRAM_BUCKETS];
+} nrf_802154_stat_histogram_t;
+
+/**
+ * @brief Type of structure holding histograms of time intervals of certain operations.
+ */
+typedef struct
+{
+    /**@brief Time from the start of CSMA/CA procedure to the start of the transmission. */
+    nrf_802154_stat_histogram_t csmaca_access_delay;
+    /**@brief Time from the end of the transmitted frame to the end of the received ACK. */
+    nrf_802154_stat_histogram_t ack_round_trip_time;
+    /**@brief Time from the start of the transmit procedure to the start of the transmission. */
+    nrf_802154_stat_histogram_t request_to_air_latency;
+    /**@brief Time from an event to the delivery of its notification to the higher layer. */
+    nrf_802154_stat_histogram_t notification_delay;
+} nrf_802154_stat_histograms_t;
+
+/**
+ * @brief Type of structure holding hold times of critical sections entered at one call site.
+ *
+ * Times are expressed in ticks of the timestamp source used by the profiler, which by default
+ * is the CPU cycle counter. The average hold time is @c total_time divided by @c count.
+ */
+typedef struct
+{
+    /**@brief Address of the code that entered the critical section. */
+    const void * p_site;
+    /**@brief Number of times the critical section was exited. */
+    uint32_t     count;
+    /**@brief Longest hold time. */
+    uint32_t     max_time;
+    /**@brief Sum of all hold times. */
+    uint64_t     total_time;
+    /**@brief Deepest nesting level at which the critical section was entered, starting at 1. */
+    uint8_t      max_depth;
+} nrf_802154_stat_crit_sect_site_t;
+
+/**
+ * @brief Type of structure holding usage of the receive buffers.
+ */
+typedef struct
+{
+    /**@brief Number of receive buffers that are currently in use. */
+    uint32_t used;
+    /**@brief Maximum number of receive buffers that were in use at the same time. */
+    uint32_t high_water_mark;
+} nrf_802154_stat_rx_buffers_t;
+
+/**
+ * @brief Size of the key used by the 802.15.4 frame security, in bytes.
+ */
+#define NRF_802154_SECURITY_KEY_SIZE 16
+
+/**
+ * @brief Errors reported by the functions that manage the frame security keys.
+ *
+ * Possible values:
+ * - @ref NRF_802154_SECURITY_ERROR_NONE,
+ * - @ref NRF_802154_SECURITY_ERROR_STORAGE_FULL,
+ * - @ref NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND,
+ * - @ref NRF_802154_SECURITY_ERROR_ALREADY_PRESENT,
+ * - @ref NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED
+ */
+typedef uint8_t nrf_802154_security_error_t;
+
+#define NRF_802154_SECURITY_ERROR_NONE               0x00 // !< The operation succeeded.
+#define NRF_802154_SECURITY_ERROR_STORAGE_FULL       0x01 // !< There is no free entry in the key storage.
+#define NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND      0x02 // !< There is no key with the given identifier.
+#define NRF_802154_SECURITY_ERROR_ALREADY_PRESENT    0x03 // !< A key with the given identifier is already stored.
+#define NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED 0x04 // !< The Key Identifier Mode is not supported.
+
+/**
+ * @brief Structure that identifies a frame security key.
+ */
+typedef struct
+{
+    /**@brief Key Identifier Mode of the key. Only modes 1, 2 and 3 are supported. */
+    uint8_t         mode;
+    /**@brief Key Source followed by Key Index, in the order in which they are transmitted in the
+     *        auxiliary security header. The field is 1, 5 or 9 bytes long for modes 1, 2 and 3. */
+    const uint8_t * p_key_id;
+} nrf_802154_key_id_t;
+
+/**
+ * @brief Structure that holds a frame security key.
+ */
+typedef struct
+{
+    /**@brief Value of the key. */
+    uint8_t             value[NRF_802154_SECURITY_KEY_SIZE];
+    /**@brief Identifier of the key. */
+    nrf_802154_key_id_t id;
+} nrf_802154_key_t;
+
+/**
+ * @brief Lowest channel number supported by the driver.
+ */
+#define NRF_802154_CHANNEL_MIN   11
+
+/**
+ * @brief Highest channel number supported by the driver.
+ */
+#define NRF_802154_CHANNEL_MAX   26
+
+/**
+ * @brief Number of channels supported by the driver.
+ */
+#define NRF_802154_CHANNEL_COUNT (NRF_802154_CHANNEL_MAX - NRF_802154_CHANNEL_MIN + 1)
+
+/**
+ * @brief Structure that holds the quality of a channel measured by the background channel scan.
+ */
+typedef struct
+{
+    /**@brief Number of measurements taken since the map was reset. */
+    uint32_t samples;
+    /**@brief Time of the last measurement in microseconds. */
+    uint32_t timestamp;
+    /**@brief Energy level of the last measurement. */
+    uint8_t  energy_last;
+    /**@brief Rolling average of the energy level. */
+    uint8_t  energy_avg;
+    /**@brief Maximum energy level measured since the map was reset. */
+    uint8_t  energy_max;
+    /**@brief Rolling percentage of measurements with energy above the CCA energy busy
+     *        threshold. */
+    uint8_t  occupancy;
+} nrf_802154_channel_quality_t;
+
+/**
+ * @brief Structure that holds the quality of all channels measured by the background channel scan.
+ *
+ * The energy levels use the same scale as @ref nrf_802154_energy_detected. To convert them to dBm,
+ * use @ref nrf_802154_dbm_from_energy_level_calculate.
+ */
+typedef struct
+{
+    /**@brief Quality of the channels. Element 0 holds channel @ref NRF_802154_CHANNEL_MIN. */
+    nrf_802154_channel_quality_t channels[NRF_802154_CHANNEL_COUNT];
+} nrf_802154_channel_map_t;
+
 /**
  * @brief Type of structure holding statistics about the Radio Driver behavior.
  */
@@ -308,6 +470,9 @@ typedef struct
 
     /**@brief Time stamps of events */
     nrf_802154_stat_timestamps_t timestamps;
+
+    /**@brief Usage of the receive buffers */
+    nrf_802154_stat_rx_buffers_t rx_buffers;
 } nrf_802154_stats_t;
 
 /**
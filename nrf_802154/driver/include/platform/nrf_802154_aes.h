@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Module that defines the AES Abstraction Layer.
+ *
+ */
+
+#ifndef NRF_802154_AES_H_
+#define NRF_802154_AES_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_aes AES Abstraction Layer for the 802.15.4 driver
+ * @{
+ * @ingroup nrf_802154_aes
+ * @brief The AES Abstraction Layer interface for the 802.15.4 driver.
+ *
+ * The AES Abstraction Layer is an abstraction layer of an AES-128 block cipher that is used
+ * to apply the 802.15.4 CCM* security to transmitted frames and Enh-Acks. The block cipher can be
+ * implemented in software or by a hardware peripheral.
+ *
+ * Enh-Acks are secured in the RADIO interrupt handler within the ACK turnaround time, so
+ * the implementation using the ECB peripheral (nrf_802154_aes_ecb.c) is the default one.
+ * The software implementation (nrf_802154_aes_sw.c) is to be used only when the ECB peripheral
+ * is not reserved for the driver.
+ *
+ */
+
+/**@brief Size of the AES-128 key in bytes. */
+#define NRF_802154_AES_KEY_SIZE   16
+
+/**@brief Size of the AES block in bytes. */
+#define NRF_802154_AES_BLOCK_SIZE 16
+
+/**
+ * @brief Initializes the AES block cipher.
+ */
+void nrf_802154_aes_init(void);
+
+/**
+ * @brief Deinitializes the AES block cipher.
+ */
+void nrf_802154_aes_deinit(void);
+
+/**
+ * @brief Encrypts one block with AES-128 in ECB mode.
+ *
+ * This function may be called from any priority, including the RADIO interrupt handler,
+ * and must be reentrant.
+ *
+ * @param[in]  p_key         Pointer to the @ref NRF_802154_AES_KEY_SIZE bytes long key.
+ * @param[in]  p_cleartext   Pointer to the block to encrypt.
+ * @param[out] p_ciphertext  Pointer to the buffer for the encrypted block. It may point to the
+ *                           same buffer as @p p_cleartext.
+ */
+void nrf_802154_aes_ecb_encrypt(const uint8_t * p_key,
+                                const uint8_t * p_cleartext,
+                                uint8_t       * p_ciphertext);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_AES_H_ */
@@ -32,6 +32,7 @@
  *
  */
 
+
 /**
  * @file
  *   This file implements procedures to set pending bit and 802.15.4-2015 information
@@ -45,6 +46,7 @@
 #include <string.h>
 
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "nrf.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
@@ -53,49 +55,103 @@
 /// Maximum number of Extended Addresses of nodes for which there is ACK data to set.
 #define NUM_EXTENDED_ADDRESSES NRF_802154_PENDING_EXTENDED_ADDRESSES
 
-/// Structure representing pending bit setting variables.
-typedef struct
-{
-    bool     enabled;                                                      /// If setting pending bit is enabled.
-    uint8_t  short_addr[NUM_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];          /// Array of short addresses of nodes for which there is pending data in the buffer.
-    uint8_t  extended_addr[NUM_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE]; /// Array of extended addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_short_addr;                                            /// Current number of short addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_ext_addr;                                              /// Current number of extended addresses of nodes for which there is pending data in the buffer.
-} pending_bit_arrays_t;
+/// Maximum number of Short Address records. Each pending bit and each IE record can belong to a different node.
+#define NUM_SHORT_RECORDS      (2 * NUM_SHORT_ADDRESSES)
+/// Maximum number of Extended Address records. Each pending bit and each IE record can belong to a different node.
+#define NUM_EXTENDED_RECORDS   (2 * NUM_EXTENDED_ADDRESSES)
+
+/// Index of IE data indicating that there is no IE data set for a given address.
+#define IE_INDEX_NONE          UINT16_MAX
 
 // Structure representing a single IE record.
 typedef struct
 {
     uint8_t p_data[NRF_802154_MAX_ACK_IE_SIZE]; /// Pointer to IE data buffer.
     uint8_t len;                                /// Length of the buffer.
+    bool    in_use;                             /// If the record is assigned to an address.
 } ie_data_t;
 
-// Structure representing IE records sent in an ACK message to a given short address.
+// Structure representing ACK data set for a single address.
 typedef struct
 {
-    uint8_t   addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
-    ie_data_t ie_data;                  /// Pointer to IE records.
-} ack_short_ie_data_t;
+    bool     pending_bit; /// If pending bit is set for the address.
+    uint16_t ie_index;    /// Index of IE data sent to the address or IE_INDEX_NONE.
+} ack_data_record_t;
 
-// Structure representing IE records sent in an ACK message to a given extended address.
+// Structure representing ACK data set for all addresses of a given length.
 typedef struct
 {
-    uint8_t   addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
-    ie_data_t ie_data;                     /// Pointer to IE records.
-} ack_ext_ie_data_t;
-
-// Structure representing IE data setting variables.
-typedef struct
+    uint8_t           * p_addr;              /// Array of addresses sorted in ascending order.
+    ack_data_record_t * p_record;            /// Array of ACK data records in the same order as @p p_addr.
+    ie_data_t         * p_ie;                /// Array of IE records referenced by @p p_record.
+    uint32_t            num_of_records;      /// Current number of addresses stored in @p p_addr.
+    uint32_t            num_of_pending_bits; /// Current number of records with the pending bit set.
+    uint32_t            num_of_ie;           /// Current number of IE records in use.
+    uint32_t            max_records;         /// Size of @p p_addr and @p p_record arrays.
+    uint32_t            max_addresses;       /// Maximum number of pending bits and size of @p p_ie array.
+    uint8_t             addr_size;           /// Size of a single address.
+    bool                extended;            /// If the table stores extended addresses.
+} ack_data_table_t;
+
+// Addresses are kept apart from the records, so that the binary search walks a dense array.
+// Both arrays are double-buffered. The bulk functions build the new list in the inactive bank and
+// swap it in by a single pointer store, so the RADIO IRQ never looks an address up in a list that
+// is half updated. The IE records are shared by both banks.
+static uint8_t           m_short_addr[2][NUM_SHORT_RECORDS][SHORT_ADDRESS_SIZE];
+static ack_data_record_t m_short_record[2][NUM_SHORT_RECORDS];
+static ie_data_t         m_short_ie[NUM_SHORT_ADDRESSES];
+static uint8_t           m_ext_addr[2][NUM_EXTENDED_RECORDS][EXTENDED_ADDRESS_SIZE];
+static ack_data_record_t m_ext_record[2][NUM_EXTENDED_RECORDS];
+static ie_data_t         m_ext_ie[NUM_EXTENDED_ADDRESSES];
+
+static ack_data_table_t m_short_table[2] =
 {
-    ack_short_ie_data_t short_data[NUM_SHORT_ADDRESSES];  /// Array of short addresses and IE records sent to these addresses.
-    ack_ext_ie_data_t   ext_data[NUM_EXTENDED_ADDRESSES]; /// Array of extended addresses and IE records sent to these addresses.
-    uint32_t            num_of_short_data;                /// Current number of short addresses stored in @p short_data.
-    uint32_t            num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
-} ie_arrays_t;
-
-// TODO: Combine below arrays to perform binary search only once per Ack generation.
-static pending_bit_arrays_t        m_pending_bit;
-static ie_arrays_t                 m_ie;
+    {
+        .p_addr        = &m_short_addr[0][0][0],
+        .p_record      = m_short_record[0],
+        .p_ie          = m_short_ie,
+        .max_records   = NUM_SHORT_RECORDS,
+        .max_addresses = NUM_SHORT_ADDRESSES,
+        .addr_size     = SHORT_ADDRESS_SIZE,
+        .extended      = false,
+    },
+    {
+        .p_addr        = &m_short_addr[1][0][0],
+        .p_record      = m_short_record[1],
+        .p_ie          = m_short_ie,
+        .max_records   = NUM_SHORT_RECORDS,
+        .max_addresses = NUM_SHORT_ADDRESSES,
+        .addr_size     = SHORT_ADDRESS_SIZE,
+        .extended      = false,
+    },
+};
+
+static ack_data_table_t m_ext_table[2] =
+{
+    {
+        .p_addr        = &m_ext_addr[0][0][0],
+        .p_record      = m_ext_record[0],
+        .p_ie          = m_ext_ie,
+        .max_records   = NUM_EXTENDED_RECORDS,
+        .max_addresses = NUM_EXTENDED_ADDRESSES,
+        .addr_size     = EXTENDED_ADDRESS_SIZE,
+        .extended      = true,
+    },
+    {
+        .p_addr        = &m_ext_addr[1][0][0],
+        .p_record      = m_ext_record[1],
+        .p_ie          = m_ext_ie,
+        .max_records   = NUM_EXTENDED_RECORDS,
+        .max_addresses = NUM_EXTENDED_ADDRESSES,
+        .addr_size     = EXTENDED_ADDRESS_SIZE,
+        .extended      = true,
+    },
+};
+
+static ack_data_table_t * volatile mp_short_table = &m_short_table[0]; ///< Bank of short addresses in use.
+static ack_data_table_t * volatile mp_ext_table   = &m_ext_table[0];   ///< Bank of extended addresses in use.
+
+static bool                        m_pending_bit_enabled;
 static nrf_802154_src_addr_match_t m_src_matching_method;
 
 /***************************************************************************************************
@@ -105,6 +161,9 @@ static nrf_802154_src_addr_match_t m_src_matching_method;
 /**
  * @brief Compare two extended addresses.
  *
+ * Addresses are ordered by their numeric value, with the most significant word compared first.
+ * This lets the upper layer pass address lists sorted in natural order to the bulk functions.
+ *
  * @param[in]  p_first_addr     Pointer to a first address that should be compared.
  * @param[in]  p_second_addr    Pointer to a second address that should be compared.
  *
@@ -118,7 +177,7 @@ static int8_t extended_addr_compare(const uint8_t * p_first_addr, const uint8_t
     uint32_t second_addr;
 
     // Compare extended address in two steps to prevent unaligned access error.
-    for (uint32_t i = 0; i < EXTENDED_ADDRESS_SIZE / sizeof(uint32_t); i++)
+    for (uint32_t i = EXTENDED_ADDRESS_SIZE / sizeof(uint32_t); i-- > 0;)
     {
         first_addr  = *(uint32_t *)(p_first_addr + (i * sizeof(uint32_t)));
         second_addr = *(uint32_t *)(p_second_addr + (i * sizeof(uint32_t)));
@@ -191,181 +250,378 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
 }
 
 /**
- * @brief Perform a binary search for an address in a list of addresses.
+ * @brief Get the ACK data table for addresses of a given length.
  *
- * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[in]  p_addr_array     Pointer to a list of addresses to be searched.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @param[in]  extended  Indication if the table of extended or short addresses is requested.
  *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @returns  Pointer to the requested table.
  */
-static bool addr_binary_search(const uint8_t       * p_addr,
-                               const uint8_t       * p_addr_array,
-                               uint32_t            * p_location,
-                               nrf_802154_ack_data_t data_type,
-                               bool                  extended)
+static ack_data_table_t * table_get(bool extended)
 {
-    uint32_t addr_array_len = 0;
-    uint8_t  entry_size     = 0;
+    return extended ? mp_ext_table : mp_short_table;
+}
 
-    switch (data_type)
+/**
+ * @brief Copy the table in use to its inactive bank, so that a new list can be built there.
+ *
+ * @param[in]  extended      Indication if the table of extended or short addresses is requested.
+ * @param[in]  pending_bits  If the pending bits are to be copied. Otherwise, only the records
+ *                           with IE data are copied and their pending bits are cleared.
+ *
+ * @returns  Pointer to the inactive bank of the table.
+ */
+static ack_data_table_t * table_shadow_get(bool extended, bool pending_bits)
+{
+    const ack_data_table_t * p_table   = table_get(extended);
+    ack_data_table_t       * p_shadow  = extended ? &m_ext_table[0] : &m_short_table[0];
+    uint8_t                  addr_size = p_table->addr_size;
+    uint32_t                 k         = 0;
+
+    if (p_shadow == p_table)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            entry_size     = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
-            addr_array_len = extended ?
-                             m_pending_bit.num_of_ext_addr : m_pending_bit.num_of_short_addr;
-            break;
+        p_shadow++;
+    }
 
-        case NRF_802154_ACK_DATA_IE:
-            entry_size     = extended ? sizeof(ack_ext_ie_data_t) : sizeof(ack_short_ie_data_t);
-            addr_array_len = extended ? m_ie.num_of_ext_data : m_ie.num_of_short_data;
-            break;
+    for (uint32_t i = 0; i < p_table->num_of_records; i++)
+    {
+        if (!pending_bits && (p_table->p_record[i].ie_index == IE_INDEX_NONE))
+        {
+            continue;
+        }
 
-        default:
-            assert(false);
-            break;
+        memcpy(p_shadow->p_addr + addr_size * k, p_table->p_addr + addr_size * i, addr_size);
+        p_shadow->p_record[k] = p_table->p_record[i];
+
+        if (!pending_bits)
+        {
+            p_shadow->p_record[k].pending_bit = false;
+        }
+
+        k++;
     }
 
-    // The actual algorithm
-    int32_t  low      = 0;
-    uint32_t midpoint = 0;
-    int32_t  high     = addr_array_len;
+    p_shadow->num_of_records      = k;
+    p_shadow->num_of_pending_bits = pending_bits ? p_table->num_of_pending_bits : 0;
+    p_shadow->num_of_ie           = p_table->num_of_ie;
 
-    while (high >= low)
+    return p_shadow;
+}
+
+/**
+ * @brief Put the inactive bank of a table in use.
+ *
+ * @param[in]  p_shadow  Pointer to the bank returned by @ref table_shadow_get.
+ */
+static void table_swap(ack_data_table_t * p_shadow)
+{
+    // The bank must be complete before the RADIO IRQ can see it.
+    __DMB();
+
+    if (p_shadow->extended)
     {
-        midpoint = (uint32_t)(low + (high - low) / 2);
+        mp_ext_table = p_shadow;
+    }
+    else
+    {
+        mp_short_table = p_shadow;
+    }
+}
 
-        if (midpoint >= addr_array_len)
+/**
+ * @brief Perform a binary search for an address in an ACK data table.
+ *
+ * @param[in]  p_table          Pointer to the table to be searched.
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[out] p_location       If the address @p p_addr appears in the table, this is its index in the table.
+ *                              Otherwise, it is the index which @p p_addr would have if it was placed in the table
+ *                              (ascending order assumed).
+ *
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
+ */
+static bool record_find(const ack_data_table_t * p_table,
+                        const uint8_t          * p_addr,
+                        uint32_t               * p_location)
+{
+    uint32_t low  = 0;
+    uint32_t high = p_table->num_of_records;
+    uint32_t midpoint;
+    int8_t   cmp;
+
+    while (low < high)
+    {
+        midpoint = low + (high - low) / 2;
+        cmp      = addr_compare(p_addr,
+                                p_table->p_addr + p_table->addr_size * midpoint,
+                                p_table->extended);
+
+        if (cmp == 0)
         {
-            break;
+            *p_location = midpoint;
+            return true;
         }
-
-        switch (addr_compare(p_addr, p_addr_array + entry_size * midpoint, extended))
+        else if (cmp < 0)
         {
-            case -1:
-                high = (int32_t)(midpoint - 1);
-                break;
+            high = midpoint;
+        }
+        else
+        {
+            low = midpoint + 1;
+        }
+    }
 
-            case 0:
-                *p_location = midpoint;
-                return true;
+    *p_location = low;
+    return false;
+}
 
-            case 1:
-                low = (int32_t)(midpoint + 1);
-                break;
+/**
+ * @brief Get the ACK data record for an address.
+ *
+ * @param[in]  p_table  Pointer to the table to be searched.
+ * @param[in]  p_addr   Pointer to an address that is searched for. May be NULL.
+ *
+ * @returns  Pointer to the record for @p p_addr or NULL if there is no such record.
+ */
+static const ack_data_record_t * record_get(const ack_data_table_t * p_table,
+                                            const uint8_t          * p_addr)
+{
+    uint32_t location;
 
-            default:
-                break;
-        }
+    if ((NULL == p_addr) || !record_find(p_table, p_addr, &location))
+    {
+        return NULL;
     }
 
-    /* If in the last iteration of the loop the last case was utilized, it means that the midpoint
-     * found by the algorithm is less than the address to be added. The midpoint should be therefore
-     * shifted to the next position. As a simplified example, a { 1, 3, 4 } array can be considered.
-     * Suppose that a number equal to 2 is about to be added to the array. At the beginning of the
-     * last iteration, midpoint is equal to 1 and low and high are equal to 0. Midpoint is then set
-     * to 0 and with last case being utilized, low is set to 1. However, midpoint equal to 0 is
-     * incorrect, as in the last iteration first element of the array proves to be less than the
-     * element to be added to the array. With the below code, midpoint is then shifted to 1. */
-    if ((uint32_t)low == midpoint + 1)
+    return &p_table->p_record[location];
+}
+
+/**
+ * @brief Get the source address of a frame.
+ *
+ * @param[in]  p_frame_data  Pointer to a descriptor of the frame.
+ * @param[in]  p_mhr_data    Pointer to the MHR fields of the frame or NULL if the MHR is invalid.
+ * @param[out] p_extended    If the source address is extended.
+ *
+ * @returns  Pointer to the source address or NULL if the frame has no source address.
+ */
+static const uint8_t * src_addr_get(const nrf_802154_frame_parser_data_t     * p_frame_data,
+                                    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                                    bool                                     * p_extended)
+{
+    if (NULL == p_mhr_data)
     {
-        midpoint++;
+        // The MHR uses a reserved addressing mode. Look the source address up as before.
+        return nrf_802154_frame_parser_src_addr_get(p_frame_data->p_frame, p_extended);
     }
 
-    *p_location = midpoint;
-    return false;
+    *p_extended = (p_mhr_data->src_addr_size == EXTENDED_ADDRESS_SIZE);
+
+    return p_mhr_data->p_src_addr;
 }
 
 /**
- * @brief Find an address in a list of addresses.
+ * @brief Insert an empty record for an address into an ACK data table keeping it in ascending order.
  *
- * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @param[in]  p_table          Pointer to the table.
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  location         Index of the location where @p p_addr should be added.
  *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @retval true   Record for @p p_addr has been added to the table successfully.
+ * @retval false  Record for @p p_addr could not be added to the table.
  */
-static bool addr_index_find(const uint8_t       * p_addr,
-                            uint32_t            * p_location,
-                            nrf_802154_ack_data_t data_type,
-                            bool                  extended)
+static bool record_insert(ack_data_table_t * p_table, const uint8_t * p_addr, uint32_t location)
 {
-    uint8_t * p_addr_array;
-    bool      valid_data_type = true;
+    uint8_t addr_size = p_table->addr_size;
 
-    switch (data_type)
+    if (p_table->num_of_records == p_table->max_records)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            p_addr_array = extended ? (uint8_t *)m_pending_bit.extended_addr :
-                           (uint8_t *)m_pending_bit.short_addr;
-            break;
+        return false;
+    }
 
-        case NRF_802154_ACK_DATA_IE:
-            p_addr_array = extended ? (uint8_t *)m_ie.ext_data : (uint8_t *)m_ie.short_data;
-            break;
+    memmove(p_table->p_addr + addr_size * (location + 1),
+            p_table->p_addr + addr_size * location,
+            (p_table->num_of_records - location) * addr_size);
+    memmove(&p_table->p_record[location + 1],
+            &p_table->p_record[location],
+            (p_table->num_of_records - location) * sizeof(ack_data_record_t));
 
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+    memcpy(p_table->p_addr + addr_size * location, p_addr, addr_size);
+    p_table->p_record[location].pending_bit = false;
+    p_table->p_record[location].ie_index    = IE_INDEX_NONE;
+
+    p_table->num_of_records++;
+
+    return true;
+}
+
+/**
+ * @brief Remove a record from an ACK data table if it holds no ACK data anymore.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  location     Index of the record to be checked.
+ */
+static void record_remove_if_empty(ack_data_table_t * p_table, uint32_t location)
+{
+    uint8_t addr_size = p_table->addr_size;
+
+    if (p_table->p_record[location].pending_bit ||
+        (p_table->p_record[location].ie_index != IE_INDEX_NONE))
+    {
+        return;
     }
 
-    if (!valid_data_type)
+    memmove(p_table->p_addr + addr_size * location,
+            p_table->p_addr + addr_size * (location + 1),
+            (p_table->num_of_records - location - 1) * addr_size);
+    memmove(&p_table->p_record[location],
+            &p_table->p_record[location + 1],
+            (p_table->num_of_records - location - 1) * sizeof(ack_data_record_t));
+
+    p_table->num_of_records--;
+}
+
+/**
+ * @brief Remove all records that hold no ACK data from an ACK data table in a single pass.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ */
+static void table_compact(ack_data_table_t * p_table)
+{
+    uint8_t  addr_size = p_table->addr_size;
+    uint32_t k         = 0;
+
+    for (uint32_t i = 0; i < p_table->num_of_records; i++)
     {
-        return false;
+        if (!p_table->p_record[i].pending_bit && (p_table->p_record[i].ie_index == IE_INDEX_NONE))
+        {
+            continue;
+        }
+
+        if (k != i)
+        {
+            memcpy(p_table->p_addr + addr_size * k, p_table->p_addr + addr_size * i, addr_size);
+            p_table->p_record[k] = p_table->p_record[i];
+        }
+
+        k++;
     }
 
-    return addr_binary_search(p_addr, p_addr_array, p_location, data_type, extended);
+    p_table->num_of_records = k;
+}
+
+/**
+ * @brief Set IE data for a record.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  location     Index of the record.
+ * @param[in]  p_data       Pointer to the IE data.
+ * @param[in]  data_len     Length of @p p_data.
+ */
+static void ie_data_add(ack_data_table_t * p_table,
+                        uint32_t           location,
+                        const uint8_t    * p_data,
+                        uint8_t            data_len)
+{
+    ack_data_record_t * p_record = &p_table->p_record[location];
+
+    if (p_record->ie_index == IE_INDEX_NONE)
+    {
+        uint16_t ie_index = 0;
+
+        while (p_table->p_ie[ie_index].in_use)
+        {
+            ie_index++;
+        }
+
+        assert(ie_index < p_table->max_addresses);
+
+        p_table->p_ie[ie_index].in_use = true;
+        p_record->ie_index             = ie_index;
+        p_table->num_of_ie++;
+    }
+
+    memcpy(p_table->p_ie[p_record->ie_index].p_data, p_data, data_len);
+    p_table->p_ie[p_record->ie_index].len = data_len;
+}
+
+/**
+ * @brief Release IE data of a record.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  p_record     Pointer to the record with IE data set.
+ */
+static void ie_data_remove(ack_data_table_t * p_table, ack_data_record_t * p_record)
+{
+    p_table->p_ie[p_record->ie_index].in_use = false;
+    p_record->ie_index                       = IE_INDEX_NONE;
+    p_table->num_of_ie--;
+}
+
+/**
+ * @brief Get IE data of a record.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  p_record     Pointer to the record. May be NULL.
+ * @param[out] p_ie_length  Length of the IE data.
+ *
+ * @returns  Either pointer to the IE data or NULL if there is no IE data for the record.
+ */
+static const uint8_t * ie_data_get(const ack_data_table_t  * p_table,
+                                   const ack_data_record_t * p_record,
+                                   uint8_t                 * p_ie_length)
+{
+    if ((NULL == p_record) || (p_record->ie_index == IE_INDEX_NONE))
+    {
+        *p_ie_length = 0;
+        return NULL;
+    }
+
+    *p_ie_length = p_table->p_ie[p_record->ie_index].len;
+    return p_table->p_ie[p_record->ie_index].p_data;
 }
 
 /**
  * @brief Thread implementation of the address matching algorithm.
  *
- * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_src_addr  Pointer to the source address of the frame for which the ACK frame
+ *                         is being prepared. May be NULL.
+ * @param[in]  p_record    Pointer to the ACK data record for @p p_src_addr or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_thread(const uint8_t * p_frame)
+static bool addr_match_thread(const uint8_t * p_src_addr, const ack_data_record_t * p_record)
 {
-    bool            extended;
-    uint32_t        location;
-    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
-
     // The pending bit is set by default.
-    if (!m_pending_bit.enabled || (NULL == p_src_addr))
+    if (!m_pending_bit_enabled || (NULL == p_src_addr))
     {
         return true;
     }
 
-    return addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_PENDING_BIT, extended);
+    return (NULL != p_record) && p_record->pending_bit;
 }
 
 /**
  * @brief Zigbee implementation of the address matching algorithm.
  *
- * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_frame     Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_mhr_data  Pointer to the MHR fields of @p p_frame or NULL if the MHR is invalid.
+ * @param[in]  p_record    Pointer to the ACK data record for the source address of @p p_frame
+ *                         or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_zigbee(const uint8_t * p_frame)
+static bool addr_match_zigbee(const uint8_t                            * p_frame,
+                              const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                              const ack_data_record_t                  * p_record)
 {
-    uint8_t                            frame_type;
-    nrf_802154_frame_parser_mhr_data_t mhr_fields;
-    uint32_t                           location;
-    const uint8_t                    * p_cmd = p_frame;
-    bool                               ret   = false;
+    uint8_t         frame_type;
+    const uint8_t * p_cmd = p_frame;
+    bool            ret   = false;
 
     // If ack data generator module is disabled do not perform check, return true by default.
-    if (!m_pending_bit.enabled)
+    if (!m_pending_bit_enabled)
     {
         return true;
     }
@@ -373,13 +629,13 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     // Check the frame type.
     frame_type = (p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK);
 
-    // Parse the MAC header and retrieve the command type.
-    if (nrf_802154_frame_parser_mhr_parse(p_frame, &mhr_fields))
+    // Retrieve the command type using the parsed MAC header.
+    if (p_mhr_data != NULL)
     {
         // Note: Security header is not included in the offset.
         // If security is to be used at any point, additional calculation
         // in nrf_802154_frame_parser_mhr_parse needs to be implemented.
-        p_cmd += mhr_fields.addressing_end_offset;
+        p_cmd += p_mhr_data->addressing_end_offset;
     }
     else
     {
@@ -392,13 +648,10 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     if ((frame_type == FRAME_TYPE_COMMAND) && (*p_cmd == MAC_CMD_DATA_REQ))
     {
         // Check addressing type - in long case address, pb should always be 1.
-        if (mhr_fields.src_addr_size == SHORT_ADDRESS_SIZE)
+        if (p_mhr_data->src_addr_size == SHORT_ADDRESS_SIZE)
         {
             // Return true if address is not found on the m_pending_bits list.
-            ret = !addr_index_find(mhr_fields.p_src_addr,
-                                   &location,
-                                   NRF_802154_ACK_DATA_PENDING_BIT,
-                                   false);
+            ret = !((NULL != p_record) && p_record->pending_bit);
         }
         else
         {
@@ -426,166 +679,272 @@ static bool addr_match_standard_compliant(const uint8_t * p_frame)
 }
 
 /**
- * @brief Add an address to the address list in ascending order.
+ * @brief Check if the pending bit is to be set using the selected address matching algorithm.
  *
- * @param[in]  p_addr           Pointer to the address to be added.
- * @param[in]  location         Index of the location where @p p_addr should be added.
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @param[in]  p_frame     Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_src_addr  Pointer to the source address of @p p_frame. May be NULL.
+ * @param[in]  p_mhr_data  Pointer to the MHR fields of @p p_frame or NULL if the MHR is invalid.
+ * @param[in]  p_record    Pointer to the ACK data record for @p p_src_addr or NULL if there is none.
  *
- * @retval true   Address @p p_addr has been added to the list successfully.
- * @retval false  Address @p p_addr could not be added to the list.
+ * @retval true   Pending bit is to be set.
+ * @retval false  Pending bit is to be cleared.
  */
-static bool addr_add(const uint8_t       * p_addr,
-                     uint32_t              location,
-                     nrf_802154_ack_data_t data_type,
-                     bool                  extended)
+static bool pending_bit_should_be_set(const uint8_t                            * p_frame,
+                                      const uint8_t                            * p_src_addr,
+                                      const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                                      const ack_data_record_t                  * p_record)
 {
-    uint32_t * p_addr_array_len;
-    uint32_t   max_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
+    bool ret;
 
-    switch (data_type)
+    switch (m_src_matching_method)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.extended_addr;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_ext_addr;
-                entry_size         = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.short_addr;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_short_addr;
-                entry_size         = SHORT_ADDRESS_SIZE;
-            }
+        case NRF_802154_SRC_ADDR_MATCH_THREAD:
+            ret = addr_match_thread(p_src_addr, p_record);
             break;
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_ie.ext_data;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_ext_data;
-                entry_size         = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_ie.short_data;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_short_data;
-                entry_size         = sizeof(ack_short_ie_data_t);
-            }
+        case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
+            ret = addr_match_zigbee(p_frame, p_mhr_data, p_record);
             break;
 
-        default:
-            valid_data_type = false;
-            assert(false);
+        case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
+            ret = addr_match_standard_compliant(p_frame);
             break;
-    }
 
-    if (!valid_data_type || (*p_addr_array_len == max_addr_array_len))
-    {
-        return false;
+        default:
+            ret = false;
+            assert(false);
     }
 
-    memmove(p_addr_array + entry_size * (location + 1),
-            p_addr_array + entry_size * (location),
-            (*p_addr_array_len - location) * entry_size);
+    return ret;
+}
 
-    memcpy(p_addr_array + entry_size * location,
-           p_addr,
-           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+/**
+ * @brief Check if a list of addresses is sorted in strictly ascending order.
+ *
+ * @param[in]  p_addrs      Pointer to the list of addresses.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
+ * @param[in]  extended     Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @retval true   The list is sorted and contains no duplicates.
+ * @retval false  The list is not sorted or contains duplicates.
+ */
+static bool addr_list_is_sorted(const uint8_t * p_addrs, uint32_t num_addrs, bool extended)
+{
+    uint8_t entry_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
 
-    (*p_addr_array_len)++;
+    for (uint32_t i = 1; i < num_addrs; i++)
+    {
+        if (addr_compare(p_addrs + entry_size * (i - 1), p_addrs + entry_size * i, extended) >= 0)
+        {
+            return false;
+        }
+    }
 
     return true;
 }
 
 /**
- * @brief Remove an address from the address list keeping it in ascending order.
+ * @brief Merge a sorted list of addresses with the pending bit set into an ACK data table.
+ *
+ * The number of new records and pending bits is counted first, so the table is left untouched if
+ * the result does not fit. The merge is then performed from the end of the table, so every record
+ * is moved at most once.
  *
- * @param[in]  location     Index of the element to be removed from the list.
- * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  p_addrs      Pointer to the list of addresses sorted in strictly ascending order.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
  *
- * @retval true   Address @p p_addr has been removed from the list successfully.
- * @retval false  Address @p p_addr could not removed from the list.
+ * @retval true   Pending bit is set for all addresses.
+ * @retval false  The merged table would not fit in memory. The table has not been modified.
  */
-static bool addr_remove(uint32_t location, nrf_802154_ack_data_t data_type, bool extended)
+static bool pending_bit_addr_list_merge(ack_data_table_t * p_table,
+                                        const uint8_t    * p_addrs,
+                                        uint32_t           num_addrs)
 {
-    uint32_t * p_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
+    uint8_t  addr_size           = p_table->addr_size;
+    uint32_t num_of_records      = p_table->num_of_records;
+    uint32_t num_of_pending_bits = p_table->num_of_pending_bits;
+    uint32_t i                   = 0;
+    uint32_t j                   = 0;
+    uint32_t k;
+    int8_t   cmp;
+
+    while (j < num_addrs)
+    {
+        cmp = (i < p_table->num_of_records) ?
+              addr_compare(p_table->p_addr + addr_size * i,
+                           p_addrs + addr_size * j,
+                           p_table->extended) : 1;
 
-    switch (data_type)
+        if (cmp < 0)
+        {
+            i++;
+        }
+        else if (cmp == 0)
+        {
+            num_of_pending_bits += p_table->p_record[i].pending_bit ? 0 : 1;
+            i++;
+            j++;
+        }
+        else
+        {
+            num_of_records++;
+            num_of_pending_bits++;
+            j++;
+        }
+    }
+
+    if ((num_of_records > p_table->max_records) ||
+        (num_of_pending_bits > p_table->max_addresses))
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
+        return false;
+    }
+
+    i = p_table->num_of_records;
+    j = num_addrs;
+    k = num_of_records;
+
+    while (j > 0)
+    {
+        k--;
+
+        cmp = (i > 0) ?
+              addr_compare(p_table->p_addr + addr_size * (i - 1),
+                           p_addrs + addr_size * (j - 1),
+                           p_table->extended) : -1;
+
+        if (cmp > 0)
+        {
+            i--;
+            memmove(p_table->p_addr + addr_size * k, p_table->p_addr + addr_size * i, addr_size);
+            p_table->p_record[k] = p_table->p_record[i];
+        }
+        else
+        {
+            j--;
+            memcpy(p_table->p_addr + addr_size * k, p_addrs + addr_size * j, addr_size);
+
+            if (cmp == 0)
             {
-                p_addr_array     = (uint8_t *)m_pending_bit.extended_addr;
-                p_addr_array_len = &m_pending_bit.num_of_ext_addr;
-                entry_size       = EXTENDED_ADDRESS_SIZE;
+                i--;
+                p_table->p_record[k] = p_table->p_record[i];
             }
             else
             {
-                p_addr_array     = (uint8_t *)m_pending_bit.short_addr;
-                p_addr_array_len = &m_pending_bit.num_of_short_addr;
-                entry_size       = SHORT_ADDRESS_SIZE;
+                p_table->p_record[k].ie_index = IE_INDEX_NONE;
             }
-            break;
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_ie.ext_data;
-                p_addr_array_len = &m_ie.num_of_ext_data;
-                entry_size       = sizeof(ack_ext_ie_data_t);
-            }
-            else
+            p_table->p_record[k].pending_bit = true;
+        }
+    }
+
+    p_table->num_of_records      = num_of_records;
+    p_table->num_of_pending_bits = num_of_pending_bits;
+
+    return true;
+}
+
+/**
+ * @brief Clear the pending bit for a sorted list of addresses in an ACK data table in a single pass.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  p_addrs      Pointer to the list of addresses sorted in strictly ascending order.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
+ *
+ * @retval true   Pending bit has been cleared for all addresses.
+ * @retval false  Pending bit was not set for at least one address.
+ */
+static bool pending_bit_addr_list_remove(ack_data_table_t * p_table,
+                                         const uint8_t    * p_addrs,
+                                         uint32_t           num_addrs)
+{
+    uint8_t  addr_size = p_table->addr_size;
+    uint32_t removed   = 0;
+    uint32_t i         = 0;
+    uint32_t j         = 0;
+
+    while ((i < p_table->num_of_records) && (j < num_addrs))
+    {
+        int8_t cmp = addr_compare(p_table->p_addr + addr_size * i,
+                                  p_addrs + addr_size * j,
+                                  p_table->extended);
+
+        if (cmp <= 0)
+        {
+            if ((cmp == 0) && p_table->p_record[i].pending_bit)
             {
-                p_addr_array     = (uint8_t *)m_ie.short_data;
-                p_addr_array_len = &m_ie.num_of_short_data;
-                entry_size       = sizeof(ack_short_ie_data_t);
+                p_table->p_record[i].pending_bit = false;
+                p_table->num_of_pending_bits--;
+                removed++;
             }
-            break;
 
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+            i++;
+        }
+
+        if (cmp >= 0)
+        {
+            j++;
+        }
     }
 
-    if (!valid_data_type || (*p_addr_array_len == 0))
+    table_compact(p_table);
+
+    return removed == num_addrs;
+}
+
+/**
+ * @brief Set the pending bit for an address in an ACK data table.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  p_addr       Pointer to the address.
+ *
+ * @retval true   Pending bit is set for @p p_addr.
+ * @retval false  There is no room for the pending bit of @p p_addr.
+ */
+static bool pending_bit_set(ack_data_table_t * p_table, const uint8_t * p_addr)
+{
+    uint32_t location = 0;
+    bool     found    = record_find(p_table, p_addr, &location);
+
+    if (found && p_table->p_record[location].pending_bit)
     {
-        return false;
+        return true;
     }
 
-    memmove(p_addr_array + entry_size * location,
-            p_addr_array + entry_size * (location + 1),
-            (*p_addr_array_len - location - 1) * entry_size);
-
-    (*p_addr_array_len)--;
+    if ((p_table->num_of_pending_bits == p_table->max_addresses) ||
+        (!found && !record_insert(p_table, p_addr, location)))
+    {
+        return false;
+    }
 
+    p_table->p_record[location].pending_bit = true;
+    p_table->num_of_pending_bits++;
     return true;
 }
 
-static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data, uint8_t data_len)
+/**
+ * @brief Clear the pending bit for an address in an ACK data table.
+ *
+ * @param[in]  p_table      Pointer to the table.
+ * @param[in]  p_addr       Pointer to the address.
+ *
+ * @retval true   Pending bit has been cleared for @p p_addr.
+ * @retval false  Pending bit was not set for @p p_addr.
+ */
+static bool pending_bit_clear(ack_data_table_t * p_table, const uint8_t * p_addr)
 {
-    if (extended)
-    {
-        memcpy(m_ie.ext_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.ext_data[location].ie_data.len = data_len;
-    }
-    else
+    uint32_t location = 0;
+
+    if (!record_find(p_table, p_addr, &location) || !p_table->p_record[location].pending_bit)
     {
-        memcpy(m_ie.short_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.short_data[location].ie_data.len = data_len;
+        return false;
     }
+
+    p_table->p_record[location].pending_bit = false;
+    p_table->num_of_pending_bits--;
+    record_remove_if_empty(p_table, location);
+
+    return true;
 }
 
 /***************************************************************************************************
@@ -594,16 +953,18 @@ static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data
 
 void nrf_802154_ack_data_init(void)
 {
-    memset(&m_pending_bit, 0, sizeof(m_pending_bit));
-    memset(&m_ie, 0, sizeof(m_ie));
+    nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
+    nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_IE);
+    nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
+    nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_IE);
 
-    m_pending_bit.enabled = true;
+    m_pending_bit_enabled = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
 
 void nrf_802154_ack_data_enable(bool enabled)
 {
-    m_pending_bit.enabled = enabled;
+    m_pending_bit_enabled = enabled;
 }
 
 bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
@@ -612,64 +973,169 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
                                       const void          * p_data,
                                       uint8_t               data_len)
 {
-    uint32_t location = 0;
+    ack_data_table_t * p_table  = table_get(extended);
+    uint32_t           location = 0;
+    bool               found;
+
+    switch (data_type)
+    {
+        case NRF_802154_ACK_DATA_PENDING_BIT:
+            return pending_bit_set(p_table, p_addr);
+
+        case NRF_802154_ACK_DATA_IE:
+            found = record_find(p_table, p_addr, &location);
+
+            if ((!found || (p_table->p_record[location].ie_index == IE_INDEX_NONE)) &&
+                ((p_table->num_of_ie == p_table->max_addresses) ||
+                 (!found && !record_insert(p_table, p_addr, location))))
+            {
+                return false;
+            }
+
+            ie_data_add(p_table, location, p_data, data_len);
+            return true;
+
+        default:
+            assert(false);
+            return false;
+    }
+}
+
+bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
+                                        bool                  extended,
+                                        nrf_802154_ack_data_t data_type)
+{
+    ack_data_table_t  * p_table  = table_get(extended);
+    uint32_t            location = 0;
+    ack_data_record_t * p_record;
 
-    if (addr_index_find(p_addr, &location, data_type, extended) ||
-        addr_add(p_addr, location, data_type, extended))
+    switch (data_type)
     {
-        if (data_type == NRF_802154_ACK_DATA_IE)
+        case NRF_802154_ACK_DATA_PENDING_BIT:
+            return pending_bit_clear(p_table, p_addr);
+
+        case NRF_802154_ACK_DATA_IE:
+            if (!record_find(p_table, p_addr, &location))
+            {
+                return false;
+            }
+
+            p_record = &p_table->p_record[location];
+
+            if (p_record->ie_index == IE_INDEX_NONE)
+            {
+                return false;
+            }
+
+            ie_data_remove(p_table, p_record);
+            record_remove_if_empty(p_table, location);
+            return true;
+
+        default:
+            assert(false);
+            return false;
+    }
+}
+
+bool nrf_802154_ack_data_pending_bit_for_addr_list_set(const uint8_t * p_addrs,
+                                                       uint32_t        num_addrs,
+                                                       bool            extended,
+                                                       bool            replace)
+{
+    ack_data_table_t * p_table;
+    bool               result = true;
+
+    if (replace && (num_addrs > table_get(extended)->max_addresses))
+    {
+        return false;
+    }
+
+    p_table = table_shadow_get(extended, !replace);
+
+    if (addr_list_is_sorted(p_addrs, num_addrs, extended))
+    {
+        result = pending_bit_addr_list_merge(p_table, p_addrs, num_addrs);
+
+        if (!result)
         {
-            ie_data_add(location, extended, p_data, data_len);
+            // The table in use has not been modified.
+            return false;
         }
-
-        return true;
     }
     else
     {
-        return false;
+        for (uint32_t i = 0; i < num_addrs; i++)
+        {
+            result &= pending_bit_set(p_table, p_addrs + p_table->addr_size * i);
+        }
     }
+
+    table_swap(p_table);
+
+    return result;
 }
 
-bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
-                                        bool                  extended,
-                                        nrf_802154_ack_data_t data_type)
+uint32_t nrf_802154_ack_data_pending_bit_for_addr_list_capacity_get(bool extended, bool replace)
 {
-    uint32_t location = 0;
+    ack_data_table_t * p_table = table_get(extended);
+
+    // There are twice as many records as pending bits, so a free pending bit always comes with
+    // a free record for a new address.
+    if (replace)
+    {
+        return p_table->max_addresses;
+    }
+
+    return p_table->max_addresses - p_table->num_of_pending_bits;
+}
+
+bool nrf_802154_ack_data_pending_bit_for_addr_list_clear(const uint8_t * p_addrs,
+                                                         uint32_t        num_addrs,
+                                                         bool            extended)
+{
+    ack_data_table_t * p_table = table_shadow_get(extended, true);
+    bool               result  = true;
 
-    if (addr_index_find(p_addr, &location, data_type, extended))
+    if (addr_list_is_sorted(p_addrs, num_addrs, extended))
     {
-        return addr_remove(location, data_type, extended);
+        result = pending_bit_addr_list_remove(p_table, p_addrs, num_addrs);
     }
     else
     {
-        return false;
+        for (uint32_t i = 0; i < num_addrs; i++)
+        {
+            result &= pending_bit_clear(p_table, p_addrs + p_table->addr_size * i);
+        }
     }
+
+    table_swap(p_table);
+
+    return result;
 }
 
 void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
 {
+    ack_data_table_t * p_table = table_get(extended);
+
     switch (data_type)
     {
         case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                m_pending_bit.num_of_ext_addr = 0;
-            }
-            else
-            {
-                m_pending_bit.num_of_short_addr = 0;
-            }
+            table_swap(table_shadow_get(extended, false));
             break;
 
         case NRF_802154_ACK_DATA_IE:
-            if (extended)
+            for (uint32_t i = 0; i < p_table->num_of_records; i++)
             {
-                m_ie.num_of_ext_data = 0;
+                p_table->p_record[i].ie_index = IE_INDEX_NONE;
             }
-            else
+
+            for (uint32_t i = 0; i < p_table->max_addresses; i++)
             {
-                m_ie.num_of_short_data = 0;
+                p_table->p_ie[i].in_use = false;
             }
+
+            p_table->num_of_ie = 0;
+            table_compact(p_table);
             break;
 
         default:
@@ -693,59 +1159,50 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 
 }
 
-bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
+bool nrf_802154_ack_data_pending_bit_should_be_set(nrf_802154_frame_parser_data_t * p_frame_data)
 {
-    bool ret;
-
-    switch (m_src_matching_method)
-    {
-        case NRF_802154_SRC_ADDR_MATCH_THREAD:
-            ret = addr_match_thread(p_frame);
-            break;
-
-        case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
-            ret = addr_match_zigbee(p_frame);
-            break;
-
-        case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
-            ret = addr_match_standard_compliant(p_frame);
-            break;
-
-        default:
-            ret = false;
-            assert(false);
-    }
-
-    return ret;
+    bool                                       extended;
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_get(p_frame_data);
+    const uint8_t                            * p_src_addr =
+        src_addr_get(p_frame_data, p_mhr_data, &extended);
+
+    return pending_bit_should_be_set(p_frame_data->p_frame,
+                                     p_src_addr,
+                                     p_mhr_data,
+                                     record_get(table_get(extended), p_src_addr));
 }
 
 const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_extended,
                                            uint8_t       * p_ie_length)
 {
-    uint32_t location;
+    const ack_data_table_t * p_table = table_get(src_addr_extended);
 
     if (NULL == p_src_addr)
     {
         return NULL;
     }
 
-    if (addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_IE, src_addr_extended))
-    {
-        if (src_addr_extended)
-        {
-            *p_ie_length = m_ie.ext_data[location].ie_data.len;
-            return m_ie.ext_data[location].ie_data.p_data;
-        }
-        else
-        {
-            *p_ie_length = m_ie.short_data[location].ie_data.len;
-            return m_ie.short_data[location].ie_data.p_data;
-        }
-    }
-    else
-    {
-        *p_ie_length = 0;
-        return NULL;
-    }
+    return ie_data_get(p_table, record_get(p_table, p_src_addr), p_ie_length);
+}
+
+const uint8_t * nrf_802154_ack_data_for_frame_get(nrf_802154_frame_parser_data_t * p_frame_data,
+                                                  bool                           * p_pending_bit,
+                                                  uint8_t                        * p_ie_length)
+{
+    bool                                       extended;
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_get(p_frame_data);
+    const uint8_t                            * p_src_addr =
+        src_addr_get(p_frame_data, p_mhr_data, &extended);
+    const ack_data_table_t                   * p_table  = table_get(extended);
+    const ack_data_record_t                  * p_record = record_get(p_table, p_src_addr);
+
+    *p_pending_bit = pending_bit_should_be_set(p_frame_data->p_frame,
+                                               p_src_addr,
+                                               p_mhr_data,
+                                               p_record);
+
+    return ie_data_get(p_table, p_record, p_ie_length);
 }
@@ -45,6 +45,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
 
 /**
  * @brief Initializes the ACK data generator module.
@@ -98,6 +99,57 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
                                         bool                  extended,
                                         nrf_802154_ack_data_t data_type);
 
+/**
+ * @brief Adds a list of addresses to the pending bit list.
+ *
+ * If the addresses in @p p_addrs are sorted in strictly ascending order of their numeric value,
+ * they are merged into the list in a single pass and the list is left unmodified if the result
+ * does not fit. Otherwise, the addresses are added one by one and the ones that fit are kept.
+ * The new list is built in the inactive bank of the table and swapped in at once.
+ *
+ * @param[in]  p_addrs    Pointer to the addresses that are to be added to the list.
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  extended   Indication if @p p_addrs contains extended addresses or short addresses.
+ * @param[in]  replace    If true, all addresses of a given length are removed from the list first.
+ *
+ * @retval true   All addresses successfully added to the list.
+ * @retval false  Not all addresses added to the list (list is full).
+ */
+bool nrf_802154_ack_data_pending_bit_for_addr_list_set(const uint8_t * p_addrs,
+                                                       uint32_t        num_addrs,
+                                                       bool            extended,
+                                                       bool            replace);
+
+/**
+ * @brief Gets the number of addresses that are guaranteed to fit in the pending bit list.
+ *
+ * A call to @ref nrf_802154_ack_data_pending_bit_for_addr_list_set with the same @p extended and
+ * @p replace arguments succeeds for any list of at most this many addresses.
+ *
+ * @param[in]  extended   Indication if the capacity for extended or short addresses is requested.
+ * @param[in]  replace    If the addresses are to replace the current list.
+ *
+ * @returns  Number of addresses that can be added to the list.
+ */
+uint32_t nrf_802154_ack_data_pending_bit_for_addr_list_capacity_get(bool extended, bool replace);
+
+/**
+ * @brief Removes a list of addresses from the pending bit list.
+ *
+ * If the addresses in @p p_addrs are sorted in strictly ascending order of their numeric value,
+ * they are removed from the list in a single pass. Otherwise, they are removed one by one.
+ *
+ * @param[in]  p_addrs    Pointer to the addresses that are to be removed from the list.
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  extended   Indication if @p p_addrs contains extended addresses or short addresses.
+ *
+ * @retval true   All addresses successfully removed from the list.
+ * @retval false  At least one address was missing from the list.
+ */
+bool nrf_802154_ack_data_pending_bit_for_addr_list_clear(const uint8_t * p_addrs,
+                                                         uint32_t        num_addrs,
+                                                         bool            extended);
+
 /**
  * @brief Removes all addresses of a given length from the ACK data list.
  *
@@ -123,12 +175,13 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 /**
  * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
  *
- * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[inout]  p_frame_data  Pointer to a descriptor of the frame for which the ACK frame
+ *                              is being prepared.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame);
+bool nrf_802154_ack_data_pending_bit_should_be_set(nrf_802154_frame_parser_data_t * p_frame_data);
 
 /**
  * @brief Gets the IE data stored in the list for the source address of the provided frame.
@@ -143,4 +196,21 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_ext,
                                            uint8_t       * p_ie_length);
 
+/**
+ * @brief Gets the pending bit and the IE data for the ACK frame sent in response to a given frame.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_pending_bit_should_be_set and
+ * @ref nrf_802154_ack_data_ie_get, but looks up the source address of the frame only once.
+ *
+ * @param[inout] p_frame_data   Pointer to a descriptor of the frame for which the ACK frame
+ *                              is being prepared.
+ * @param[out]   p_pending_bit  If the pending bit is to be set.
+ * @param[out]   p_ie_length    Length of the IE data.
+ *
+ * @returns  Either pointer to the stored IE data or NULL if the IE data is not to be set.
+ */
+const uint8_t * nrf_802154_ack_data_for_frame_get(nrf_802154_frame_parser_data_t * p_frame_data,
+                                                  bool                           * p_pending_bit,
+                                                  uint8_t                        * p_ie_length);
+
 #endif // NRF_802154_ACK_DATA_H
@@ -77,18 +77,20 @@ void nrf_802154_ack_generator_init(void)
     nrf_802154_enh_ack_generator_init();
 }
 
-const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame)
+const uint8_t * nrf_802154_ack_generator_create(nrf_802154_frame_parser_data_t * p_frame_data)
 {
+    const uint8_t * p_frame = p_frame_data->p_frame;
+
     // This function should not be called if ACK is not requested.
     assert(p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT);
 
     switch (frame_version_is_2015_or_above(p_frame))
     {
         case FRAME_VERSION_BELOW_2015:
-            return nrf_802154_imm_ack_generator_create(p_frame);
+            return nrf_802154_imm_ack_generator_create(p_frame_data);
 
         case FRAME_VERSION_2015_OR_ABOVE:
-            return nrf_802154_enh_ack_generator_create(p_frame);
+            return nrf_802154_enh_ack_generator_create(p_frame_data);
 
         default:
             return NULL;
@@ -44,7 +44,9 @@
 #include <string.h>
 
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_frame_security.h"
 #include "nrf_802154_ack_data.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
 
@@ -80,9 +82,9 @@ static void fcf_security_enabled_set(const uint8_t * p_frame)
         (p_frame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT);
 }
 
-static void fcf_frame_pending_set(const uint8_t * p_frame)
+static void fcf_frame_pending_set(bool pending_bit)
 {
-    if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame))
+    if (pending_bit)
     {
         m_ack_data[FRAME_PENDING_OFFSET] |= FRAME_PENDING_BIT;
     }
@@ -139,6 +141,7 @@ static void fcf_frame_version_set(void)
 }
 
 static void frame_control_set(const uint8_t                      * p_frame,
+                              bool                                 pending_bit,
                               const uint8_t                      * p_ie_data,
                               nrf_802154_frame_parser_mhr_data_t * p_ack_offsets)
 {
@@ -146,7 +149,7 @@ static void frame_control_set(const uint8_t                      * p_frame,
 
     fcf_frame_type_set();
     fcf_security_enabled_set(p_frame);
-    fcf_frame_pending_set(p_frame);
+    fcf_frame_pending_set(pending_bit);
     fcf_panid_compression_set(p_frame);
     fcf_sequence_number_suppression_set(p_frame);
     fcf_ie_present_set(p_ie_data);
@@ -299,7 +302,7 @@ static void security_header_set(const nrf_802154_frame_parser_mhr_data_t * p_fra
 
     security_control_set(p_frame, p_ack);
 
-    // Frame counter is set by MAC layer when the frame is encrypted.
+    // Frame counter is set when the frame is secured, either by the driver or by the MAC layer.
     fc_suppressed = ((*p_ack->p_sec_ctrl) & FRAME_COUNTER_SUPPRESS_BIT);
 
     if (!fc_suppressed)
@@ -338,46 +341,54 @@ void nrf_802154_enh_ack_generator_init(void)
     // Intentionally empty.
 }
 
-const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame)
+const uint8_t * nrf_802154_enh_ack_generator_create(nrf_802154_frame_parser_data_t * p_frame_data)
 {
+    const uint8_t                            * p_frame   = p_frame_data->p_frame;
+    const nrf_802154_frame_parser_mhr_data_t * p_frame_offsets =
+        nrf_802154_frame_parser_mhr_get(p_frame_data);
+    nrf_802154_frame_parser_mhr_data_t         ack_offsets;
+    const uint8_t                            * p_sec_end = NULL;
 
-    nrf_802154_frame_parser_mhr_data_t frame_offsets;
-    nrf_802154_frame_parser_mhr_data_t ack_offsets;
-    const uint8_t                    * p_sec_end    = NULL;
-    bool                               parse_result = nrf_802154_frame_parser_mhr_parse(p_frame,
-                                                                                        &frame_offsets);
-
-    if (!parse_result)
+    if (p_frame_offsets == NULL)
     {
         return NULL;
     }
 
+    bool            pending_bit = false;
     uint8_t         ie_data_len = 0;
-    const uint8_t * p_ie_data   = nrf_802154_ack_data_ie_get(
-        frame_offsets.p_src_addr,
-        frame_offsets.src_addr_size == EXTENDED_ADDRESS_SIZE,
-        &ie_data_len);
+    const uint8_t * p_ie_data   = nrf_802154_ack_data_for_frame_get(p_frame_data,
+                                                                    &pending_bit,
+                                                                    &ie_data_len);
 
     // Clear previously created ACK.
     ack_buffer_clear();
 
     // Set Frame Control field bits.
-    frame_control_set(p_frame, p_ie_data, &ack_offsets);
+    frame_control_set(p_frame, pending_bit, p_ie_data, &ack_offsets);
 
     // Set valid sequence number in ACK frame.
     sequence_number_set(p_frame);
 
     // Set destination address and PAN ID.
-    destination_set(&frame_offsets, &ack_offsets);
+    destination_set(p_frame_offsets, &ack_offsets);
 
     // Set source address and PAN ID.
     source_set();
 
     // Set auxiliary security header.
-    security_header_set(&frame_offsets, &ack_offsets, &p_sec_end);
+    security_header_set(p_frame_offsets, &ack_offsets, &p_sec_end);
 
     // Set IE header.
     ie_header_set(p_ie_data, ie_data_len, p_sec_end);
 
+#if NRF_802154_SECURITY_ENABLED
+    // Secure the ACK if its key is known to the driver. Otherwise the ACK is left unsecured
+    // for the MAC layer.
+    if (nrf_802154_frame_security_apply(m_ack_data) == NRF_802154_FRAME_SECURITY_ERROR)
+    {
+        return NULL;
+    }
+#endif
+
     return m_ack_data;
 }
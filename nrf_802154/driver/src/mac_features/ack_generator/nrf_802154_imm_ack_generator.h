@@ -44,6 +44,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "mac_features/nrf_802154_frame_parser.h"
+
 /** Initializes the Immediate ACK generator module. */
 void nrf_802154_imm_ack_generator_init(void);
 
@@ -51,12 +53,11 @@ void nrf_802154_imm_ack_generator_init(void);
  *
  *  This function creates an Immediate ACK frame and inserts it into a radio buffer.
  *
- * @param [in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame
- *                       to respond to.
+ * @param [inout]  p_frame_data  Pointer to a descriptor of the frame to respond to.
  *
  * @returns  Pointer to a constant buffer that contains PHR and PSDU of the created
  *           Immediate ACK frame.
  */
-const uint8_t * nrf_802154_imm_ack_generator_create(const uint8_t * p_frame);
+const uint8_t * nrf_802154_imm_ack_generator_create(nrf_802154_frame_parser_data_t * p_frame_data);
 
 #endif // NRF_802154_IMM_ACK_GENERATOR_H
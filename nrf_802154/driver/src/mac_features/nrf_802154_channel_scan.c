@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the background channel scan procedure for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_channel_scan.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_utils.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+
+#define CHANNEL_MASK_SUPPORTED 0x07fff800UL ///< Mask of the supported channels 11-26.
+#define AVG_FRACTION_BITS      8           ///< Number of fractional bits of the rolling averages.
+#define OCCUPANCY_BUSY         100         ///< Occupancy of a channel measured as busy [%].
+
+/**@brief Channel quality with the rolling averages kept in the fixed point format. */
+typedef struct
+{
+    uint32_t samples;     ///< Number of measurements.
+    uint32_t timestamp;   ///< Time of the last measurement.
+    uint16_t energy_avg;  ///< Rolling average of the energy level.
+    uint16_t occupancy;   ///< Rolling average of the occupancy.
+    uint8_t  energy_last; ///< Energy level of the last measurement.
+    uint8_t  energy_max;  ///< Maximum energy level.
+} channel_entry_t;
+
+static channel_entry_t    m_map[NRF_802154_CHANNEL_COUNT]; ///< Channel map.
+static uint32_t           m_channel_mask;                  ///< Mask of the scanned channels.
+static uint32_t           m_ed_time;                       ///< Duration of the energy detection on a single channel [us].
+static uint8_t            m_channel;                       ///< Channel to be measured next.
+static volatile bool      m_scan_is_active;                ///< If the scan is running.
+static nrf_802154_timer_t m_timer;                         ///< Timer that triggers the consecutive measurements.
+
+static uint8_t channel_next_get(uint8_t channel)
+{
+    do
+    {
+        channel = (channel >= NRF_802154_CHANNEL_MAX) ? NRF_802154_CHANNEL_MIN : channel + 1;
+    }
+    while (!(m_channel_mask & (1UL << channel)));
+
+    return channel;
+}
+
+static uint16_t average_update(uint16_t avg, uint8_t value, bool first)
+{
+    int32_t target = (int32_t)value << AVG_FRACTION_BITS;
+
+    if (first)
+    {
+        return (uint16_t)target;
+    }
+
+    return (uint16_t)((int32_t)avg +
+                      ((target - (int32_t)avg) / (1 << NRF_802154_CHANNEL_SCAN_AVERAGING_SHIFT)));
+}
+
+static uint8_t average_get(uint16_t avg)
+{
+    return (uint8_t)((avg + (1U << (AVG_FRACTION_BITS - 1))) >> AVG_FRACTION_BITS);
+}
+
+static void scan_timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    if (m_scan_is_active)
+    {
+        // If the radio is not idle listening now, the same channel is measured at the next interval.
+        (void)nrf_802154_request_channel_scan_energy_detection(m_channel, m_ed_time);
+
+        m_timer.t0 = nrf_802154_timer_sched_time_get();
+
+        nrf_802154_timer_sched_add(&m_timer, true);
+    }
+}
+
+void nrf_802154_channel_scan_init(void)
+{
+    m_scan_is_active = false;
+    m_channel_mask   = 0;
+
+    nrf_802154_channel_scan_map_reset();
+}
+
+bool nrf_802154_channel_scan_start(uint32_t channel_mask, uint32_t ed_time_us, uint32_t interval_us)
+{
+    channel_mask &= CHANNEL_MASK_SUPPORTED;
+
+    if ((channel_mask == 0) || (interval_us <= ed_time_us))
+    {
+        return false;
+    }
+
+    nrf_802154_channel_scan_stop();
+
+    m_channel_mask = channel_mask;
+    m_ed_time      = ed_time_us;
+    m_channel      = channel_next_get(NRF_802154_CHANNEL_MAX);
+
+    m_timer.callback  = scan_timer_fired;
+    m_timer.p_context = NULL;
+    m_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_timer.dt        = interval_us;
+
+    m_scan_is_active = true;
+
+    nrf_802154_timer_sched_add(&m_timer, true);
+
+    return true;
+}
+
+void nrf_802154_channel_scan_stop(void)
+{
+    m_scan_is_active = false;
+
+    // To make sure `scan_timer_fired()` detects that the scan is being stopped if it preempts
+    // this function.
+    __DMB();
+
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+}
+
+void nrf_802154_channel_scan_map_get(nrf_802154_channel_map_t * p_map)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_CHANNEL_COUNT; i++)
+    {
+        const channel_entry_t        * p_entry   = &m_map[i];
+        nrf_802154_channel_quality_t * p_quality = &p_map->channels[i];
+
+        p_quality->samples     = p_entry->samples;
+        p_quality->timestamp   = p_entry->timestamp;
+        p_quality->energy_last = p_entry->energy_last;
+        p_quality->energy_avg  = average_get(p_entry->energy_avg);
+        p_quality->energy_max  = p_entry->energy_max;
+        p_quality->occupancy   = average_get(p_entry->occupancy);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_channel_scan_map_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memset(m_map, 0, sizeof(m_map));
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_channel_scan_energy_detected(uint8_t channel, uint8_t energy_level, bool busy)
+{
+    channel_entry_t               * p_entry;
+    bool                            first;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if ((channel < NRF_802154_CHANNEL_MIN) || (channel > NRF_802154_CHANNEL_MAX))
+    {
+        return;
+    }
+
+    p_entry = &m_map[channel - NRF_802154_CHANNEL_MIN];
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    first = (p_entry->samples == 0);
+
+    p_entry->samples++;
+    p_entry->timestamp   = nrf_802154_timer_sched_time_get();
+    p_entry->energy_last = energy_level;
+    p_entry->energy_avg  = average_update(p_entry->energy_avg, energy_level, first);
+    p_entry->occupancy   = average_update(p_entry->occupancy, busy ? OCCUPANCY_BUSY : 0, first);
+
+    if (energy_level > p_entry->energy_max)
+    {
+        p_entry->energy_max = energy_level;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (m_scan_is_active && (channel == m_channel))
+    {
+        m_channel = channel_next_get(channel);
+    }
+}
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that performs the background channel scan in the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_CHANNEL_SCAN_H
+#define NRF_802154_CHANNEL_SCAN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the background channel scan module.
+ */
+void nrf_802154_channel_scan_init(void);
+
+/**
+ * @brief Starts the background channel scan.
+ *
+ * Every @p interval_us, the module requests an energy detection procedure of @p ed_time_us on
+ * the next channel from @p channel_mask. The procedure is performed only if the radio is idle
+ * listening at that moment. Otherwise, the channel is measured at the next interval. If the scan
+ * is already running, it is restarted with the new parameters.
+ *
+ * @param[in]  channel_mask  Mask of channels to scan. Bit n corresponds to channel n.
+ * @param[in]  ed_time_us    Duration of the energy detection on a single channel.
+ * @param[in]  interval_us   Interval between the starts of consecutive energy detections.
+ *
+ * @retval true   The scan was started.
+ * @retval false  The scan was not started because the mask does not contain any supported channel
+ *                or @p interval_us is not longer than @p ed_time_us.
+ */
+bool nrf_802154_channel_scan_start(uint32_t channel_mask, uint32_t ed_time_us, uint32_t interval_us);
+
+/**
+ * @brief Stops the background channel scan.
+ *
+ * The channel map is preserved.
+ */
+void nrf_802154_channel_scan_stop(void);
+
+/**
+ * @brief Copies the channel map.
+ *
+ * @param[out] p_map  Pointer to the buffer for the channel map.
+ */
+void nrf_802154_channel_scan_map_get(nrf_802154_channel_map_t * p_map);
+
+/**
+ * @brief Clears the channel map.
+ */
+void nrf_802154_channel_scan_map_reset(void);
+
+/**
+ * @brief Updates the channel map with the result of a background energy detection.
+ *
+ * @param[in]  channel       Channel on which the energy was measured.
+ * @param[in]  energy_level  Measured energy level.
+ * @param[in]  busy          If the measured energy exceeded the CCA energy busy threshold.
+ */
+void nrf_802154_channel_scan_energy_detected(uint8_t channel, uint8_t energy_level, bool busy);
+
+#endif // NRF_802154_CHANNEL_SCAN_H
@@ -68,6 +68,11 @@ static uint8_t m_be;                 ///< Backoff exponent, which is related to
 static const uint8_t * mp_data;      ///< Pointer to a buffer containing PHR and PSDU of the frame being transmitted.
 static bool            m_is_running; ///< Indicates if CSMA-CA procedure is running.
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+static uint32_t m_start_timestamp; ///< Time when the current CSMA-CA procedure started.
+
+#endif
+
 /**
  * @brief Perform appropriate actions for busy channel conditions.
  *
@@ -271,6 +276,10 @@ void nrf_802154_csma_ca_start(const uint8_t * p_data)
 
     assert(!procedure_is_running());
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    m_start_timestamp = nrf_802154_timer_sched_time_get();
+#endif
+
     mp_data      = p_data;
     m_nb         = 0;
     m_be         = nrf_802154_pib_csmaca_min_be_get();
@@ -311,15 +320,21 @@ bool nrf_802154_csma_ca_abort(nrf_802154_term_t term_lvl, req_originator_t req_o
 
 bool nrf_802154_csma_ca_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    (void)error;
-
     bool result = true;
 
     if (p_frame == mp_data)
     {
         nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-        result = channel_busy();
+        if (error == NRF_802154_TX_ERROR_SECURITY)
+        {
+            // The frame cannot be secured, so the next attempts would fail the same way.
+            procedure_stop();
+        }
+        else
+        {
+            result = channel_busy();
+        }
 
         nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     }
@@ -333,6 +348,9 @@ bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame)
     {
         nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+        nrf_802154_stat_histogram_add(csmaca_access_delay,
+                                      nrf_802154_timer_sched_time_get() - m_start_timestamp);
+
         procedure_stop();
 
         nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -54,6 +54,7 @@
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_utils.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "timer/nrf_802154_timer_sched.h"
 
@@ -88,17 +89,53 @@ typedef struct
 } delayed_rx_frame_data_t;
 
 /**
- * @brief TX delayed operation configuration.
+ * @brief Delayed operation configuration.
  */
-static const uint8_t * mp_tx_data;         ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
-static bool            m_tx_cca;           ///< If CCA should be performed prior to transmission.
-static uint8_t         m_tx_channel;       ///< Channel number on which transmission should be performed.
+typedef struct
+{
+    uint32_t t0;      ///< Base of the delay time of the timeslot start.
+    uint32_t dt;      ///< Delta of the delay time of the timeslot start from @p t0.
+    uint8_t  channel; ///< Channel number on which the operation should be performed.
+
+    union
+    {
+        struct
+        {
+            const uint8_t * p_data; ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
+            bool            cca;    ///< If CCA should be performed prior to transmission.
+        } tx;                       ///< TX delayed operation configuration.
+
+        struct
+        {
+            uint32_t timeout; ///< Reception timeout counted from the start of the receive window.
+            uint32_t period;  ///< Period of the receive window or 0 if the window is not periodic.
+        } rx;                 ///< RX delayed operation configuration.
+    } data;                   ///< Configuration specific to the operation type.
+} dly_op_t;
+
+/**
+ * @brief Delayed operations waiting for the requested one to finish, ordered by their start time.
+ */
+typedef struct
+{
+    dly_op_t items[NRF_802154_DELAYED_TRX_QUEUE_SIZE]; ///< Scheduled operations.
+    uint8_t  count;                                    ///< Number of scheduled operations.
+} dly_op_queue_t;
+
+/**
+ * @brief Delayed operations for which the timeslot is requested or granted.
+ */
+static dly_op_t m_dly_op[RSCH_DLY_TS_NUM];
+
+/**
+ * @brief Delayed operations scheduled after the requested ones.
+ */
+static dly_op_queue_t m_dly_op_queue[RSCH_DLY_TS_NUM];
 
 /**
  * @brief RX delayed operation configuration.
  */
 static nrf_802154_timer_t m_timeout_timer; ///< Timer for delayed RX timeout handling.
-static uint8_t            m_rx_channel;    ///< Channel number on which reception should be performed.
 
 /**
  * @brief State of delayed operations.
@@ -110,6 +147,8 @@ static volatile delayed_trx_op_state_t m_dly_op_state[RSCH_DLY_TS_NUM];
  */
 static volatile delayed_rx_frame_data_t m_dly_rx_frame;
 
+static void dly_op_next_start(rsch_dly_ts_id_t dly_ts_id);
+
 /**
  * Set state of a delayed operation.
  *
@@ -197,17 +236,15 @@ static void dly_op_state_set(rsch_dly_ts_id_t       dly_ts_id,
 }
 
 /**
- * Start delayed operation.
+ * Request timeslot for delayed operation.
+ *
+ * The delayed operation must be in PENDING state when this function is called, in case timeslot
+ * starts immediately and interrupts current function execution.
  *
  * @param[in]  p_dly_ts_param  Parameters of the requested delayed timeslot.
  */
 static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param)
 {
-    // Set PENDING state before timeslot request, in case timeslot starts
-    // immediately and interrupts current function execution.
-    dly_op_state_set(p_dly_ts_param->id, DELAYED_TRX_OP_STATE_STOPPED,
-                     DELAYED_TRX_OP_STATE_PENDING);
-
     bool result = nrf_802154_rsch_delayed_timeslot_request(p_dly_ts_param);
 
     if (!result)
@@ -220,6 +257,126 @@ static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param)
     return result;
 }
 
+/**
+ * Check if a delayed operation starts before another one.
+ *
+ * @param[in]  p_first   Delayed operation to check.
+ * @param[in]  p_second  Delayed operation to compare with.
+ *
+ * @retval true   @p p_first starts before @p p_second.
+ * @retval false  @p p_first starts at the same time as or after @p p_second.
+ */
+static bool dly_op_starts_before(const dly_op_t * p_first, const dly_op_t * p_second)
+{
+    return (int32_t)((p_first->t0 + p_first->dt) - (p_second->t0 + p_second->dt)) < 0;
+}
+
+/**
+ * Insert a delayed operation into the queue, keeping the queue ordered by start time.
+ *
+ * Operations that start at the same time are kept in the order in which they were inserted.
+ * This function must be called from a critical section.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ * @param[in]  p_op       Delayed operation to insert.
+ *
+ * @retval true   The operation was inserted.
+ * @retval false  The queue is full.
+ */
+static bool dly_op_queue_insert(rsch_dly_ts_id_t dly_ts_id, const dly_op_t * p_op)
+{
+    dly_op_queue_t * p_queue = &m_dly_op_queue[dly_ts_id];
+    uint8_t          idx     = p_queue->count;
+
+    if (idx >= NRF_802154_DELAYED_TRX_QUEUE_SIZE)
+    {
+        return false;
+    }
+
+    while ((idx > 0) && dly_op_starts_before(p_op, &p_queue->items[idx - 1]))
+    {
+        p_queue->items[idx] = p_queue->items[idx - 1];
+        idx--;
+    }
+
+    p_queue->items[idx] = *p_op;
+    p_queue->count++;
+
+    return true;
+}
+
+/**
+ * Remove the first delayed operation from the queue.
+ *
+ * This function must be called from a critical section.
+ *
+ * @param[in]   dly_ts_id  Delayed timeslot ID.
+ * @param[out]  p_op       Removed delayed operation.
+ */
+static void dly_op_queue_pop(rsch_dly_ts_id_t dly_ts_id, dly_op_t * p_op)
+{
+    dly_op_queue_t * p_queue = &m_dly_op_queue[dly_ts_id];
+
+    assert(p_queue->count > 0);
+
+    *p_op = p_queue->items[0];
+    p_queue->count--;
+
+    for (uint8_t i = 0; i < p_queue->count; i++)
+    {
+        p_queue->items[i] = p_queue->items[i + 1];
+    }
+}
+
+/**
+ * Remove all delayed operations from the queue.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ *
+ * @retval true   At least one delayed operation was removed.
+ * @retval false  The queue was empty.
+ */
+static bool dly_op_queue_clear(rsch_dly_ts_id_t dly_ts_id)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result                          = m_dly_op_queue[dly_ts_id].count > 0;
+    m_dly_op_queue[dly_ts_id].count = 0;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * Schedule the next receive window of a periodic delayed reception.
+ *
+ * The next window is the first one that has not started yet. If the queue is full, the periodic
+ * reception ends with the current window.
+ *
+ * @param[in]  p_op  Delayed reception whose next window is to be scheduled.
+ */
+static void dly_rx_period_next_schedule(const dly_op_t * p_op)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    dly_op_t next = *p_op;
+    uint32_t now  = nrf_802154_timer_sched_time_get();
+
+    do
+    {
+        next.t0 += next.data.rx.period;
+    }
+    while (!nrf_802154_timer_sched_time_is_in_future(now, next.t0, next.dt));
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    (void)dly_op_queue_insert(RSCH_DLY_RX, &next);
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
 /**
  * Notify MAC layer that no frame was received before timeout.
  *
@@ -263,6 +420,8 @@ static void notify_rx_timeout(void * p_context)
             // even if the set operation failed, the delayed RX state
             // should be set to STOPPED from other context anyway
             assert(dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED);
+
+            dly_op_next_start(RSCH_DLY_RX);
         }
     }
 
@@ -276,7 +435,7 @@ static void notify_rx_timeout(void * p_context)
  */
 static void dly_tx_result_notify(bool result)
 {
-    (void)result;
+    const uint8_t * p_data = m_dly_op[RSCH_DLY_TX].data.tx.p_data;
 
     // To avoid attaching to every possible transmit hook, in order to be able
     // to switch from ONGOING to STOPPED state, ONGOING state is not used at all
@@ -285,8 +444,10 @@ static void dly_tx_result_notify(bool result)
 
     if (!result)
     {
-        nrf_802154_notify_transmit_failed(mp_tx_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+        nrf_802154_notify_transmit_failed(p_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
     }
+
+    dly_op_next_start(RSCH_DLY_TX);
 }
 
 /**
@@ -316,6 +477,8 @@ static void dly_rx_result_notify(bool result)
         dly_op_state_set(RSCH_DLY_RX, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_STOPPED);
 
         nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+
+        dly_op_next_start(RSCH_DLY_RX);
     }
 }
 
@@ -334,14 +497,16 @@ static void tx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
     {
         case DELAYED_TRX_OP_STATE_PENDING:
         {
-            nrf_802154_pib_channel_set(m_tx_channel);
+            const dly_op_t * p_op = &m_dly_op[RSCH_DLY_TX];
+
+            nrf_802154_pib_channel_set(p_op->channel);
 
             if (nrf_802154_request_channel_update())
             {
                 (void)nrf_802154_request_transmit(NRF_802154_TERM_802154,
                                                   REQ_ORIG_DELAYED_TRX,
-                                                  mp_tx_data,
-                                                  m_tx_cca,
+                                                  p_op->data.tx.p_data,
+                                                  p_op->data.tx.cca,
                                                   true,
                                                   dly_tx_result_notify);
             }
@@ -379,7 +544,15 @@ static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
     {
         case DELAYED_TRX_OP_STATE_PENDING:
         {
-            nrf_802154_pib_channel_set(m_rx_channel);
+            const dly_op_t * p_op = &m_dly_op[RSCH_DLY_RX];
+
+            // Schedule the next window now, while the current one cannot be overwritten.
+            if (p_op->data.rx.period != 0)
+            {
+                dly_rx_period_next_schedule(p_op);
+            }
+
+            nrf_802154_pib_channel_set(p_op->channel);
 
             if (nrf_802154_request_channel_update())
             {
@@ -407,100 +580,289 @@ static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
-bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
-                                     bool            cca,
-                                     uint32_t        t0,
-                                     uint32_t        dt,
-                                     uint8_t         channel)
+/**
+ * Request timeslot for a delayed operation.
+ *
+ * The delayed operation must be in PENDING state when this function is called.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ * @param[in]  p_op       Delayed operation to start.
+ *
+ * @retval true   The timeslot was requested.
+ * @retval false  The timeslot could not be requested. The delayed operation is STOPPED.
+ */
+static bool dly_op_start(rsch_dly_ts_id_t dly_ts_id, const dly_op_t * p_op)
 {
-    bool result = dly_op_state_get(RSCH_DLY_TX) == DELAYED_TRX_OP_STATE_STOPPED;
+    m_dly_op[dly_ts_id] = *p_op;
 
-    if (result)
+    rsch_dly_ts_param_t dly_ts_param =
+    {
+        .t0   = p_op->t0,
+        .dt   = p_op->dt,
+        .id   = dly_ts_id,
+        .type = RSCH_DLY_TS_TYPE_PRECISE,
+    };
+
+    if (dly_ts_id == RSCH_DLY_TX)
     {
-        dt -= TX_SETUP_TIME;
-        dt -= TX_RAMP_UP_TIME;
+        dly_ts_param.prio             = RSCH_PRIO_TX;
+        dly_ts_param.started_callback = tx_timeslot_started_callback;
+    }
+    else
+    {
+        m_timeout_timer.dt        = p_op->data.rx.timeout + RX_RAMP_UP_TIME;
+        m_timeout_timer.callback  = notify_rx_timeout;
+        m_timeout_timer.p_context = NULL;
+
+        // remove timer in case it was left after abort operation
+        nrf_802154_timer_sched_remove(&m_timeout_timer, NULL);
+
+        dly_ts_param.prio             = RSCH_PRIO_IDLE_LISTENING;
+        dly_ts_param.started_callback = rx_timeslot_started_callback;
+    }
 
-        if (cca)
+    return dly_op_request(&dly_ts_param);
+}
+
+/**
+ * Notify MAC layer that the timeslot for a scheduled delayed operation could not be requested.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ * @param[in]  p_op       Delayed operation that failed.
+ */
+static void dly_op_failed_notify(rsch_dly_ts_id_t dly_ts_id, const dly_op_t * p_op)
+{
+    if (dly_ts_id == RSCH_DLY_TX)
+    {
+        nrf_802154_notify_transmit_failed(p_op->data.tx.p_data,
+                                          NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+    }
+    else
+    {
+        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+
+        // A window of a periodic reception is requested too late if the previous window was
+        // extended by a frame reception. Skip to the next window in such case. Otherwise the
+        // timeslot was refused and the periodic reception ends.
+        if ((p_op->data.rx.period != 0) &&
+            !nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                      p_op->t0,
+                                                      p_op->dt))
         {
-            dt -= nrf_802154_cca_before_tx_duration_get();
+            dly_rx_period_next_schedule(p_op);
         }
+    }
+}
+
+/**
+ * Request timeslot for the first scheduled delayed operation if no other operation is requested.
+ *
+ * Scheduled operations for which the timeslot cannot be requested are notified as failed.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ */
+static void dly_op_next_start(rsch_dly_ts_id_t dly_ts_id)
+{
+    while (true)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+        dly_op_t                        op;
+        bool                            claimed = false;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        if ((dly_op_state_get(dly_ts_id) == DELAYED_TRX_OP_STATE_STOPPED) &&
+            (m_dly_op_queue[dly_ts_id].count > 0))
+        {
+            dly_op_queue_pop(dly_ts_id, &op);
+            dly_op_state_set(dly_ts_id,
+                             DELAYED_TRX_OP_STATE_STOPPED,
+                             DELAYED_TRX_OP_STATE_PENDING);
+            claimed = true;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (!claimed || dly_op_start(dly_ts_id, &op))
+        {
+            break;
+        }
+
+        dly_op_failed_notify(dly_ts_id, &op);
+    }
+}
+
+/**
+ * Schedule a delayed operation.
+ *
+ * If no delayed operation with the same ID is requested or scheduled, the timeslot is requested
+ * immediately. Otherwise the operation is inserted into the queue. If the operation starts before
+ * the one whose timeslot is requested and has not started yet, it takes over that request and
+ * the previously requested operation is moved back to the queue.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ * @param[in]  p_op       Delayed operation to schedule.
+ *
+ * @retval true   The operation was scheduled.
+ * @retval false  The operation could not be scheduled.
+ */
+static bool dly_op_schedule(rsch_dly_ts_id_t dly_ts_id, const dly_op_t * p_op)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
 
-        mp_tx_data   = p_data;
-        m_tx_cca     = cca;
-        m_tx_channel = channel;
+    bool result    = true;
+    bool start_now = false;
+    bool preempt   = false;
 
-        rsch_dly_ts_param_t dly_ts_param =
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if ((dly_op_state_get(dly_ts_id) == DELAYED_TRX_OP_STATE_STOPPED) &&
+        (m_dly_op_queue[dly_ts_id].count == 0))
+    {
+        // Set PENDING state before timeslot request, in case timeslot starts
+        // immediately and interrupts current function execution.
+        dly_op_state_set(dly_ts_id, DELAYED_TRX_OP_STATE_STOPPED, DELAYED_TRX_OP_STATE_PENDING);
+        start_now = true;
+    }
+    else if (m_dly_op_queue[dly_ts_id].count >= NRF_802154_DELAYED_TRX_QUEUE_SIZE)
+    {
+        result = false;
+    }
+    else
+    {
+        preempt = (dly_op_state_get(dly_ts_id) == DELAYED_TRX_OP_STATE_PENDING) &&
+                  dly_op_starts_before(p_op, &m_dly_op[dly_ts_id]);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (start_now)
+    {
+        result = dly_op_start(dly_ts_id, p_op);
+    }
+    else if (preempt && nrf_802154_rsch_delayed_timeslot_cancel(dly_ts_id))
+    {
+        // The requested timeslot has not started and will not start. The operation remains
+        // PENDING, so it is safe to move it back to the queue and reuse the request.
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        result = dly_op_queue_insert(dly_ts_id, &m_dly_op[dly_ts_id]);
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        assert(result);
+
+        result = dly_op_start(dly_ts_id, p_op);
+
+        if (!result)
         {
-            .t0               = t0,
-            .dt               = dt,
-            .prio             = RSCH_PRIO_TX,
-            .id               = RSCH_DLY_TX,
-            .type             = RSCH_DLY_TS_TYPE_PRECISE,
-            .started_callback = tx_timeslot_started_callback,
-        };
-
-        result = dly_op_request(&dly_ts_param);
+            dly_op_next_start(dly_ts_id);
+        }
+    }
+    else if (result)
+    {
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        result = dly_op_queue_insert(dly_ts_id, p_op);
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        // The requested operation might have finished in the meantime.
+        dly_op_next_start(dly_ts_id);
+    }
+    else
+    {
+        // The queue is full.
     }
 
     return result;
 }
 
+bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
+                                     bool            cca,
+                                     uint32_t        t0,
+                                     uint32_t        dt,
+                                     uint8_t         channel)
+{
+    dt -= TX_SETUP_TIME;
+    dt -= TX_RAMP_UP_TIME;
+
+    if (cca)
+    {
+        dt -= nrf_802154_cca_before_tx_duration_get();
+    }
+
+    dly_op_t op =
+    {
+        .t0      = t0,
+        .dt      = dt,
+        .channel = channel,
+        .data.tx =
+        {
+            .p_data = p_data,
+            .cca    = cca,
+        },
+    };
+
+    return dly_op_schedule(RSCH_DLY_TX, &op);
+}
+
 bool nrf_802154_delayed_trx_receive(uint32_t t0,
                                     uint32_t dt,
                                     uint32_t timeout,
                                     uint8_t  channel)
 {
-    bool result = dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED;
+    return nrf_802154_delayed_trx_receive_periodic(t0, dt, 0, timeout, channel);
+}
 
-    if (result)
+bool nrf_802154_delayed_trx_receive_periodic(uint32_t t0,
+                                             uint32_t dt,
+                                             uint32_t period,
+                                             uint32_t timeout,
+                                             uint8_t  channel)
+{
+    if ((period != 0) && (period <= timeout + RX_SETUP_TIME + RX_RAMP_UP_TIME))
     {
-        dt -= RX_SETUP_TIME;
-        dt -= RX_RAMP_UP_TIME;
-
-        m_timeout_timer.dt        = timeout + RX_RAMP_UP_TIME;
-        m_timeout_timer.callback  = notify_rx_timeout;
-        m_timeout_timer.p_context = NULL;
+        return false;
+    }
 
-        m_rx_channel = channel;
+    dt -= RX_SETUP_TIME;
+    dt -= RX_RAMP_UP_TIME;
 
-        // remove timer in case it was left after abort operation
-        nrf_802154_timer_sched_remove(&m_timeout_timer, NULL);
-
-        rsch_dly_ts_param_t dly_ts_param =
+    dly_op_t op =
+    {
+        .t0      = t0,
+        .dt      = dt,
+        .channel = channel,
+        .data.rx =
         {
-            .t0               = t0,
-            .dt               = dt,
-            .prio             = RSCH_PRIO_IDLE_LISTENING,
-            .id               = RSCH_DLY_RX,
-            .type             = RSCH_DLY_TS_TYPE_PRECISE,
-            .started_callback = rx_timeslot_started_callback,
-        };
-
-        result = dly_op_request(&dly_ts_param);
-    }
+            .timeout = timeout,
+            .period  = period,
+        },
+    };
 
-    return result;
+    return dly_op_schedule(RSCH_DLY_RX, &op);
 }
 
 bool nrf_802154_delayed_trx_transmit_cancel(void)
 {
-    bool result = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_TX);
+    bool was_scheduled = dly_op_queue_clear(RSCH_DLY_TX);
+    bool result        = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_TX);
 
     m_dly_op_state[RSCH_DLY_TX] = DELAYED_TRX_OP_STATE_STOPPED;
 
+    result = result || was_scheduled;
+
     return result;
 }
 
 bool nrf_802154_delayed_trx_receive_cancel(void)
 {
-    bool result      = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_RX);
-    bool was_running = false;
+    bool was_scheduled = dly_op_queue_clear(RSCH_DLY_RX);
+    bool result        = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_RX);
+    bool was_running   = false;
 
     nrf_802154_timer_sched_remove(&m_timeout_timer, &was_running);
 
     m_dly_op_state[RSCH_DLY_RX] = DELAYED_TRX_OP_STATE_STOPPED;
 
-    result = result || was_running;
+    result = result || was_running || was_scheduled;
 
     return result;
 }
@@ -525,6 +887,8 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
             // even if the set operation failed, the delayed RX state
             // should be set to STOPPED from other context anyway
             assert(dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED);
+
+            dly_op_next_start(RSCH_DLY_RX);
         }
         else
         {
@@ -50,7 +50,9 @@
  * @brief Delayed transmission or receive window.
  *
  * This module implements delayed transmission and receive window features used in the CSL and TSCH
- * modes.
+ * modes. Up to @ref NRF_802154_DELAYED_TRX_QUEUE_SIZE transmissions and receive windows can be
+ * scheduled in addition to the ones whose timeslot is already requested. Scheduled operations
+ * are performed in the order of their start time.
  */
 
 /**
@@ -79,7 +81,8 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
 /**
  * @brief Cancels a transmission scheduled by a call to @ref nrf_802154_delayed_trx_transmit.
  *
- * This function does not cancel transmission if the transmission is already ongoing.
+ * This function cancels all scheduled transmissions. It does not cancel transmission if
+ * the transmission is already ongoing.
  *
  * @retval true     Successfully cancelled a scheduled transmission.
  * @retval false    No delayed transmission was scheduled.
@@ -108,10 +111,32 @@ bool nrf_802154_delayed_trx_receive(uint32_t t0,
                                     uint32_t timeout,
                                     uint8_t  channel);
 
+/**
+ * @brief Requests the reception of frames in periodic receive windows.
+ *
+ * The first receive window starts at @p t0 + @p dt. Each subsequent window starts @p period
+ * microseconds after the previous one. Windows that could not be started on time are skipped.
+ * Each window is reported in the same way as a window requested by
+ * @ref nrf_802154_delayed_trx_receive.
+ *
+ * @param[in]  t0       Base of delay time in microseconds.
+ * @param[in]  dt       Delta of delay time from @p t0 in microseconds.
+ * @param[in]  period   Period of the receive windows in microseconds. It must be longer than
+ *                      @p timeout.
+ * @param[in]  timeout  Reception timeout (counted from the start of each window) in microseconds.
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ */
+bool nrf_802154_delayed_trx_receive_periodic(uint32_t t0,
+                                             uint32_t dt,
+                                             uint32_t period,
+                                             uint32_t timeout,
+                                             uint8_t  channel);
+
 /**
  * @brief Cancels a reception scheduled by a call to @ref nrf_802154_delayed_trx_receive.
  *
- * After a call to this function, no reception timeout event will be notified.
+ * This function cancels all scheduled receive windows, including periodic ones. After a call to
+ * this function, no reception timeout event will be notified.
  *
  * @retval true     Successfully cancelled a scheduled transmission.
  * @retval false    No delayed reception was scheduled.
@@ -204,9 +204,9 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2006(const uint8_t *
  * @p p_num_bytes. If there is destination address in given frame, this function returns true and
  * inserts offset of addressing fields end to @p p_num_bytes.
  *
- * @param[in]  p_data       Pointer to a buffer containing PHR and PSDU of the incoming frame.
- * @param[out] p_num_bytes  Offset of addressing fields end.
- * @param[in]  frame_type   Type of incoming frame.
+ * @param[in]  p_parser_data  Pointer to a descriptor of the incoming frame.
+ * @param[out] p_num_bytes    Offset of addressing fields end.
+ * @param[in]  frame_type     Type of incoming frame.
  *
  * @retval NRF_802154_RX_ERROR_NONE               No errors in given frame were detected - it may be
  *                                                further processed.
@@ -214,9 +214,10 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2006(const uint8_t *
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Detected an error in given frame - it should be
  *                                                discarded.
  */
-static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(const uint8_t * p_data,
-                                                                uint8_t       * p_num_bytes,
-                                                                uint8_t         frame_type)
+static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(
+    nrf_802154_frame_parser_data_t * p_parser_data,
+    uint8_t                        * p_num_bytes,
+    uint8_t                          frame_type)
 {
     nrf_802154_rx_error_t result;
 
@@ -227,15 +228,16 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(const uint8_t *
         case FRAME_TYPE_ACK:
         case FRAME_TYPE_COMMAND:
         {
-            uint8_t end_offset = nrf_802154_frame_parser_dst_addr_end_offset_get(p_data);
+            const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+                nrf_802154_frame_parser_mhr_get(p_parser_data);
 
-            if (end_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
+            if (p_mhr_data == NULL)
             {
                 result = NRF_802154_RX_ERROR_INVALID_FRAME;
             }
             else
             {
-                *p_num_bytes = end_offset;
+                *p_num_bytes = p_mhr_data->dst_addr_end_offset;
                 result       = NRF_802154_RX_ERROR_NONE;
             }
         }
@@ -267,9 +269,9 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(const uint8_t *
  * @p p_num_bytes. If there is destination address in given frame, this function returns true and
  * inserts offset of addressing fields end to @p p_num_bytes.
  *
- * @param[in]  p_data       Pointer to a buffer containing PHR and PSDU of the incoming frame.
- * @param[out] p_num_bytes  Offset of addressing fields end.
- * @param[in]  frame_type   Type of incoming frame.
+ * @param[in]  p_parser_data  Pointer to a descriptor of the incoming frame.
+ * @param[out] p_num_bytes    Offset of addressing fields end.
+ * @param[in]  frame_type     Type of incoming frame.
  *
  * @retval NRF_802154_RX_ERROR_NONE               No errors in given frame were detected - it may be
  *                                                further processed.
@@ -277,10 +279,11 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(const uint8_t *
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Detected an error in given frame - it should be
  *                                                discarded.
  */
-static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_data,
-                                                           uint8_t       * p_num_bytes,
-                                                           uint8_t         frame_type,
-                                                           uint8_t         frame_version)
+static nrf_802154_rx_error_t dst_addressing_end_offset_get(
+    nrf_802154_frame_parser_data_t * p_parser_data,
+    uint8_t                        * p_num_bytes,
+    uint8_t                          frame_type,
+    uint8_t                          frame_version)
 {
     nrf_802154_rx_error_t result;
 
@@ -288,11 +291,13 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_dat
     {
         case FRAME_VERSION_0:
         case FRAME_VERSION_1:
-            result = dst_addressing_end_offset_get_2006(p_data, p_num_bytes, frame_type);
+            result = dst_addressing_end_offset_get_2006(p_parser_data->p_frame,
+                                                        p_num_bytes,
+                                                        frame_type);
             break;
 
         case FRAME_VERSION_2:
-            result = dst_addressing_end_offset_get_2015(p_data, p_num_bytes, frame_type);
+            result = dst_addressing_end_offset_get_2015(p_parser_data, p_num_bytes, frame_type);
             break;
 
         default:
@@ -386,40 +391,39 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
  * Verify if destination addressing of incoming frame allows processing by this node.
  * This function checks addressing according to IEEE 802.15.4-2015.
  *
- * @param[in] p_data  Pointer to a buffer containing PHR and PSDU of the incoming frame.
+ * @param[in] p_parser_data  Pointer to a descriptor of the incoming frame.
  *
  * @retval NRF_802154_RX_ERROR_NONE               Destination address of incoming frame allows further processing of the frame.
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Received frame is invalid.
  * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Destination address of incoming frame does not allow further processing.
  */
-static nrf_802154_rx_error_t dst_addr_check(const uint8_t * p_data, uint8_t frame_type)
+static nrf_802154_rx_error_t dst_addr_check(nrf_802154_frame_parser_data_t * p_parser_data,
+                                            uint8_t                          frame_type)
 {
-    bool                               result;
-    nrf_802154_frame_parser_mhr_data_t mhr_data;
-
-    result = nrf_802154_frame_parser_mhr_parse(p_data, &mhr_data);
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_get(p_parser_data);
 
-    if (!result)
+    if (p_mhr_data == NULL)
     {
         return NRF_802154_RX_ERROR_INVALID_FRAME;
     }
 
-    if (mhr_data.p_dst_panid != NULL)
+    if (p_mhr_data->p_dst_panid != NULL)
     {
-        if (!dst_pan_id_check(mhr_data.p_dst_panid, frame_type))
+        if (!dst_pan_id_check(p_mhr_data->p_dst_panid, frame_type))
         {
             return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
         }
     }
 
-    switch (mhr_data.dst_addr_size)
+    switch (p_mhr_data->dst_addr_size)
     {
         case SHORT_ADDRESS_SIZE:
-            return dst_short_addr_check(mhr_data.p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
+            return dst_short_addr_check(p_mhr_data->p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
                    NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
 
         case EXTENDED_ADDRESS_SIZE:
-            return dst_extended_addr_check(mhr_data.p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
+            return dst_extended_addr_check(p_mhr_data->p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
                    NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
 
         case 0:
@@ -437,8 +441,10 @@ static nrf_802154_rx_error_t dst_addr_check(const uint8_t * p_data, uint8_t fram
     return NRF_802154_RX_ERROR_INVALID_FRAME;
 }
 
-nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes)
+nrf_802154_rx_error_t nrf_802154_filter_frame_part(nrf_802154_frame_parser_data_t * p_parser_data,
+                                                   uint8_t                        * p_num_bytes)
 {
+    const uint8_t       * p_data        = p_parser_data->p_frame;
     nrf_802154_rx_error_t result        = NRF_802154_RX_ERROR_INVALID_FRAME;
     uint8_t               frame_type    = p_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
     uint8_t               frame_version = p_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK;
@@ -464,11 +470,14 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
                 break;
             }
 
-            result = dst_addressing_end_offset_get(p_data, p_num_bytes, frame_type, frame_version);
+            result = dst_addressing_end_offset_get(p_parser_data,
+                                                   p_num_bytes,
+                                                   frame_type,
+                                                   frame_version);
             break;
 
         default:
-            result = dst_addr_check(p_data, frame_type);
+            result = dst_addr_check(p_parser_data, frame_type);
             break;
     }
 
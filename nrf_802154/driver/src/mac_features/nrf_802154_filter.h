@@ -44,6 +44,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_types.h"
+#include "nrf_802154_frame_parser.h"
 
 /**
  * @defgroup nrf_802154_filter Incoming frame filter API
@@ -65,17 +66,23 @@
  * and does not modify the @p p_num_bytes value. If the verified frame is incorrect, this function
  * returns false and the @p p_num_bytes value is undefined.
  *
- * @param[in]    p_data       Pointer to a buffer that contains PHR and PSDU of the incoming frame.
- * @param[inout] p_num_bytes  Number of bytes available in @p p_data buffer. This value is either
- *                            set to the requested number of bytes for the next iteration or remains
- *                            unchanged if no more iterations are to be performed during
- *                            the filtering of the given frame.
+ * The frame descriptor is to be initialized with @ref nrf_802154_frame_parser_data_init before
+ * the first call for a given frame. The MHR fields parsed by the filter are kept in the descriptor
+ * for the modules that process the frame after filtering.
+ *
+ * @param[inout] p_parser_data  Pointer to a descriptor of the incoming frame, whose buffer contains
+ *                              PHR and PSDU.
+ * @param[inout] p_num_bytes    Number of bytes available in the frame buffer. This value is either
+ *                              set to the requested number of bytes for the next iteration or
+ *                              remains unchanged if no more iterations are to be performed during
+ *                              the filtering of the given frame.
  *
  * @retval NRF_802154_RX_ERROR_NONE               Verified part of the incoming frame is valid.
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Verified part of the incoming frame is invalid.
  * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Incoming frame has destination address that
  *                                                mismatches the address of this node.
  */
-nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes);
+nrf_802154_rx_error_t nrf_802154_filter_frame_part(nrf_802154_frame_parser_data_t * p_parser_data,
+                                                   uint8_t                        * p_num_bytes);
 
 #endif /* NRF_802154_FILTER_H_ */
@@ -204,6 +204,49 @@ static bool src_panid_is_present(const uint8_t * p_frame)
     }
 }
 
+// Equivalent of dst_panid_is_present() and src_panid_is_present() for valid addressing modes.
+static void panid_presence_get(const uint8_t * p_frame,
+                               uint8_t         dst_addr_size,
+                               uint8_t         src_addr_size,
+                               bool          * p_dst_panid_present,
+                               bool          * p_src_panid_present)
+{
+    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
+
+    switch (frame_version_get(p_frame))
+    {
+        case FRAME_VERSION_0:
+        case FRAME_VERSION_1:
+            *p_dst_panid_present = (dst_addr_size != 0);
+            *p_src_panid_present = (src_addr_size != 0) && !panid_compression;
+            break;
+
+        case FRAME_VERSION_2:
+        default:
+            if ((dst_addr_size == EXTENDED_ADDRESS_SIZE) && (src_addr_size == EXTENDED_ADDRESS_SIZE))
+            {
+                *p_dst_panid_present = !panid_compression;
+                *p_src_panid_present = false;
+            }
+            else if (src_addr_size != 0)
+            {
+                *p_dst_panid_present = (dst_addr_size != 0);
+                *p_src_panid_present = !panid_compression;
+            }
+            else if (dst_addr_size != 0)
+            {
+                *p_dst_panid_present = !panid_compression;
+                *p_src_panid_present = false;
+            }
+            else
+            {
+                *p_dst_panid_present = panid_compression;
+                *p_src_panid_present = false;
+            }
+            break;
+    }
+}
+
 static bool src_panid_is_compressed(const uint8_t * p_frame)
 {
     return dst_panid_is_present(p_frame) && !src_panid_is_present(p_frame);
@@ -287,6 +330,34 @@ static uint8_t key_id_size_get(const uint8_t * p_frame)
     }
 }
 
+static uint8_t mic_size_get(const uint8_t * p_frame)
+{
+    const uint8_t * p_sec_ctrl = nrf_802154_frame_parser_sec_ctrl_get(p_frame);
+
+    if (p_sec_ctrl == NULL)
+    {
+        return 0;
+    }
+
+    switch (*p_sec_ctrl & SECURITY_LEVEL_MASK)
+    {
+        case SECURITY_LEVEL_MIC_32:
+        case SECURITY_LEVEL_ENC_MIC_32:
+            return MIC_32_SIZE;
+
+        case SECURITY_LEVEL_MIC_64:
+        case SECURITY_LEVEL_ENC_MIC_64:
+            return MIC_64_SIZE;
+
+        case SECURITY_LEVEL_MIC_128:
+        case SECURITY_LEVEL_ENC_MIC_128:
+            return MIC_128_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
 // IEs
 
 static uint8_t ie_offset_get(const uint8_t * p_frame)
@@ -530,6 +601,64 @@ uint8_t nrf_802154_frame_parser_ie_header_offset_get(const uint8_t * p_frame)
     }
 }
 
+uint8_t nrf_802154_frame_parser_mic_offset_get(const uint8_t * p_frame)
+{
+    uint8_t mic_size = mic_size_get(p_frame);
+
+    if (p_frame[PHR_OFFSET] < (FCS_SIZE + mic_size))
+    {
+        return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
+    }
+
+    return PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE - mic_size;
+}
+
+uint8_t nrf_802154_frame_parser_mac_payload_offset_get(const uint8_t * p_frame)
+{
+    uint32_t offset     = ie_offset_get(p_frame);
+    uint32_t end_offset = nrf_802154_frame_parser_mic_offset_get(p_frame);
+
+    if ((offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (end_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (offset > end_offset))
+    {
+        return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
+    }
+
+    if (!nrf_802154_frame_parser_ie_present_bit_is_set(p_frame))
+    {
+        return offset;
+    }
+
+    // Skip Header IEs up to and including the Header Termination IE. If there is no termination,
+    // the Header IEs extend up to the end of the frame.
+    while (offset + IE_HEADER_DESCRIPTOR_SIZE <= end_offset)
+    {
+        uint8_t len = p_frame[offset] & IE_DESCRIPTOR_LENGTH_MASK;
+        uint8_t id  = (p_frame[offset] >> 7) | ((p_frame[offset + 1] & ~IE_HEADER_TYPE_BIT) << 1);
+
+        if (p_frame[offset + 1] & IE_HEADER_TYPE_BIT)
+        {
+            // Payload IE found where a Header IE was expected.
+            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
+        }
+
+        offset += IE_HEADER_DESCRIPTOR_SIZE + len;
+
+        if ((id == IE_HT1_ELEMENT_ID) || (id == IE_HT2_ELEMENT_ID))
+        {
+            break;
+        }
+    }
+
+    if (offset > end_offset)
+    {
+        return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
+    }
+
+    return offset;
+}
+
 /***************************************************************************************************
  * @section Get functions
  **************************************************************************************************/
@@ -587,9 +716,23 @@ const uint8_t * nrf_802154_frame_parser_src_addr_get(const uint8_t * p_frame,
 bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_frame,
                                        nrf_802154_frame_parser_mhr_data_t * p_fields)
 {
-    uint8_t offset               = addressing_offset_get(p_frame);
-    bool    is_dst_panid_present = dst_panid_is_present(p_frame);
-    bool    is_src_panid_present = src_panid_is_present(p_frame);
+    uint8_t offset        = addressing_offset_get(p_frame);
+    uint8_t dst_addr_size = dst_addr_size_get(p_frame);
+    uint8_t src_addr_size = src_addr_size_get(p_frame);
+    bool    is_dst_panid_present;
+    bool    is_src_panid_present;
+
+    if ((dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
+    {
+        return false;
+    }
+
+    panid_presence_get(p_frame,
+                       dst_addr_size,
+                       src_addr_size,
+                       &is_dst_panid_present,
+                       &is_src_panid_present);
 
     if (is_dst_panid_present)
     {
@@ -601,54 +744,24 @@ bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_fr
         p_fields->p_dst_panid = NULL;
     }
 
-    if (dst_addr_is_present(p_frame))
-    {
-        p_fields->p_dst_addr    = &p_frame[offset];
-        p_fields->dst_addr_size = dst_addr_size_get(p_frame);
-        offset                 += (p_fields->dst_addr_size);
-
-        if (p_fields->dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_dst_addr    = NULL;
-        p_fields->dst_addr_size = 0;
-    }
+    p_fields->p_dst_addr          = (dst_addr_size != 0) ? &p_frame[offset] : NULL;
+    p_fields->dst_addr_size       = dst_addr_size;
+    offset                       += dst_addr_size;
+    p_fields->dst_addr_end_offset = offset;
 
     if (is_src_panid_present)
     {
         p_fields->p_src_panid = &p_frame[offset];
         offset               += PAN_ID_SIZE;
     }
-    else if (is_dst_panid_present)
-    {
-        p_fields->p_src_panid = p_fields->p_dst_panid;
-    }
-    else
-    {
-        p_fields->p_src_panid = NULL;
-    }
-
-    if (src_addr_is_present(p_frame))
-    {
-        p_fields->p_src_addr    = &p_frame[offset];
-        p_fields->src_addr_size = src_addr_size_get(p_frame);
-        offset                 += (p_fields->src_addr_size);
-
-        if (p_fields->src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
     else
     {
-        p_fields->p_src_addr    = NULL;
-        p_fields->src_addr_size = 0;
+        p_fields->p_src_panid = p_fields->p_dst_panid;
     }
 
+    p_fields->p_src_addr            = (src_addr_size != 0) ? &p_frame[offset] : NULL;
+    p_fields->src_addr_size         = src_addr_size;
+    offset                         += src_addr_size;
     p_fields->addressing_end_offset = offset;
 
     if (security_is_enabled(p_frame))
@@ -664,6 +777,28 @@ bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_fr
     return true;
 }
 
+void nrf_802154_frame_parser_data_init(const uint8_t                  * p_frame,
+                                       nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    p_parser_data->p_frame = p_frame;
+    p_parser_data->state   = NRF_802154_FRAME_PARSER_STATE_NONE;
+}
+
+const nrf_802154_frame_parser_mhr_data_t * nrf_802154_frame_parser_mhr_get(
+    nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    if (p_parser_data->state == NRF_802154_FRAME_PARSER_STATE_NONE)
+    {
+        p_parser_data->state = nrf_802154_frame_parser_mhr_parse(p_parser_data->p_frame,
+                                                                 &p_parser_data->mhr) ?
+                               NRF_802154_FRAME_PARSER_STATE_MHR_VALID :
+                               NRF_802154_FRAME_PARSER_STATE_MHR_INVALID;
+    }
+
+    return (p_parser_data->state == NRF_802154_FRAME_PARSER_STATE_MHR_VALID) ?
+           &p_parser_data->mhr : NULL;
+}
+
 const uint8_t * nrf_802154_frame_parser_sec_ctrl_get(const uint8_t * p_frame)
 {
     uint8_t sec_ctrl_offset = nrf_802154_frame_parser_sec_ctrl_offset_get(p_frame);
@@ -57,9 +57,33 @@ typedef struct
     const uint8_t * p_sec_ctrl;            ///< Pointer to the security control field, or NULL if missing.
     uint8_t         dst_addr_size;         ///< Size of the destination address field.
     uint8_t         src_addr_size;         ///< Size of the source address field.
+    uint8_t         dst_addr_end_offset;   ///< Offset of the first byte following destination addressing fields.
     uint8_t         addressing_end_offset; ///< Offset of the first byte following addressing fields.
 } nrf_802154_frame_parser_mhr_data_t;
 
+/**
+ * @brief Parsing state of a frame described by @ref nrf_802154_frame_parser_data_t.
+ */
+typedef enum
+{
+    NRF_802154_FRAME_PARSER_STATE_NONE,        ///< Frame has not been parsed yet.
+    NRF_802154_FRAME_PARSER_STATE_MHR_VALID,   ///< MHR has been parsed successfully.
+    NRF_802154_FRAME_PARSER_STATE_MHR_INVALID, ///< MHR has been parsed and found to be invalid.
+} nrf_802154_frame_parser_state_t;
+
+/**
+ * @brief Structure that describes a frame shared by the modules processing it.
+ *
+ * The MHR of the frame is parsed on first request and the result is kept, so that the filter,
+ * the ACK generator and other MAC features do not recompute the offsets from the FCF.
+ */
+typedef struct
+{
+    const uint8_t                    * p_frame; ///< Pointer to the frame, including PHR.
+    nrf_802154_frame_parser_mhr_data_t mhr;     ///< MHR fields. Valid only in @ref NRF_802154_FRAME_PARSER_STATE_MHR_VALID state.
+    uint8_t                            state;   ///< Parsing state of the frame. Refer to @ref nrf_802154_frame_parser_state_t.
+} nrf_802154_frame_parser_data_t;
+
 /**
  * @brief Determines if the destination address is extended.
  *
@@ -210,6 +234,33 @@ uint8_t nrf_802154_frame_parser_src_panid_offset_get(const uint8_t * p_frame);
 bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_frame,
                                        nrf_802154_frame_parser_mhr_data_t * p_fields);
 
+/**
+ * @brief Initializes a frame descriptor for a given frame.
+ *
+ * The frame does not need to be complete when this function is called. The MHR is parsed
+ * on the first call to @ref nrf_802154_frame_parser_mhr_get, which only requires the FCF
+ * to be available.
+ *
+ * @param[in]  p_frame        Pointer to a frame, including PHR.
+ * @param[out] p_parser_data  Pointer to a frame descriptor to initialize.
+ */
+void nrf_802154_frame_parser_data_init(const uint8_t                  * p_frame,
+                                       nrf_802154_frame_parser_data_t * p_parser_data);
+
+/**
+ * @brief Gets the MHR fields of a frame described by a frame descriptor.
+ *
+ * The MHR is parsed during the first call for a given frame descriptor. Subsequent calls
+ * return the stored result.
+ *
+ * @param[inout] p_parser_data  Pointer to a frame descriptor.
+ *
+ * @returns  Pointer to the MHR fields of the frame.
+ * @returns  NULL if the MHR of the frame cannot be parsed.
+ */
+const nrf_802154_frame_parser_mhr_data_t * nrf_802154_frame_parser_mhr_get(
+    nrf_802154_frame_parser_data_t * p_parser_data);
+
 /**
  * @brief Gets the security control field in the provided frame.
  *
@@ -318,4 +369,34 @@ const uint8_t * nrf_802154_frame_parser_ie_header_get(const uint8_t * p_frame);
  */
 uint8_t nrf_802154_frame_parser_ie_header_offset_get(const uint8_t * p_frame);
 
+/**
+ * @brief Gets the offset of the MIC field in the provided frame.
+ *
+ * If the frame is not secured or its security level does not include a MIC, the returned offset
+ * points to the FCS field.
+ *
+ * @param[in]   p_frame  Pointer to a frame.
+ *
+ * @returns  Offset in bytes of the MIC field, including one byte of the frame length.
+ * @returns  @ref NRF_802154_FRAME_PARSER_INVALID_OFFSET if the frame is too short to hold
+ *           the MIC and the FCS.
+ *
+ */
+uint8_t nrf_802154_frame_parser_mic_offset_get(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the offset of the part of the MAC payload that follows the Header IEs.
+ *
+ * The returned offset points to the first byte after the Header Termination IE, that is to
+ * the Payload IEs or to the Frame Payload. If the frame contains neither of them, the returned
+ * offset is equal to the offset of the MIC field.
+ *
+ * @param[in]   p_frame  Pointer to a frame.
+ *
+ * @returns  Offset in bytes of the MAC payload, including one byte of the frame length.
+ * @returns  @ref NRF_802154_FRAME_PARSER_INVALID_OFFSET if the frame is malformed.
+ *
+ */
+uint8_t nrf_802154_frame_parser_mac_payload_offset_get(const uint8_t * p_frame);
+
 #endif // NRF_802154_FRAME_PARSER_H
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the 802.15.4 CCM* frame security for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_frame_security.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_security_pib.h"
+#include "platform/nrf_802154_aes.h"
+
+#if NRF_802154_SECURITY_ENABLED
+
+#define CCM_NONCE_SIZE     13               ///< Size of the CCM* nonce.
+#define CCM_NONCE_OFFSET   1                ///< Offset of the nonce in the B0 and Ai blocks.
+#define CCM_L_SIZE         2                ///< Size of the CCM* length field.
+#define CCM_FLAGS_ADATA    0x40             ///< Bit of the B0 flags indicating that there is authenticated data.
+#define CCM_FLAGS_M_SHIFT  3                ///< Position of the encoded MIC length in the B0 flags.
+#define CCM_FLAGS_L        (CCM_L_SIZE - 1) ///< Encoded length field size in the B0 and Ai flags.
+#define KEY_ID_MODE_SHIFT  3                ///< Position of the Key Identifier Mode in the Security Control field.
+#define SECURITY_LEVEL_ENC 0x04             ///< Bit of the security level indicating that the payload is encrypted.
+
+/**@brief Context of the CBC-MAC calculation. */
+typedef struct
+{
+    const uint8_t * p_key;                        ///< Key used to calculate the MAC.
+    uint8_t         x[NRF_802154_AES_BLOCK_SIZE]; ///< Current CBC-MAC block.
+    uint8_t         pos;                          ///< Number of bytes already added to the current block.
+} cbc_mac_t;
+
+static void cbc_mac_update(cbc_mac_t * p_mac, const uint8_t * p_data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+    {
+        p_mac->x[p_mac->pos++] ^= p_data[i];
+
+        if (p_mac->pos == NRF_802154_AES_BLOCK_SIZE)
+        {
+            nrf_802154_aes_ecb_encrypt(p_mac->p_key, p_mac->x, p_mac->x);
+            p_mac->pos = 0;
+        }
+    }
+}
+
+static void cbc_mac_pad(cbc_mac_t * p_mac)
+{
+    // Padding with zeros leaves the current block unchanged.
+    if (p_mac->pos != 0)
+    {
+        nrf_802154_aes_ecb_encrypt(p_mac->p_key, p_mac->x, p_mac->x);
+        p_mac->pos = 0;
+    }
+}
+
+static void ctr_block_get(const uint8_t * p_key,
+                          const uint8_t * p_nonce,
+                          uint16_t        counter,
+                          uint8_t       * p_block)
+{
+    p_block[0] = CCM_FLAGS_L;
+    memcpy(&p_block[CCM_NONCE_OFFSET], p_nonce, CCM_NONCE_SIZE);
+    p_block[NRF_802154_AES_BLOCK_SIZE - 2] = (uint8_t)(counter >> 8);
+    p_block[NRF_802154_AES_BLOCK_SIZE - 1] = (uint8_t)counter;
+
+    nrf_802154_aes_ecb_encrypt(p_key, p_block, p_block);
+}
+
+/**
+ * @brief Performs the CCM* transformation in place.
+ *
+ * @param[in]    p_key    Pointer to the key.
+ * @param[in]    p_nonce  Pointer to the nonce.
+ * @param[in]    p_a      Pointer to the authenticated data.
+ * @param[in]    a_len    Length of the authenticated data.
+ * @param[inout] p_m      Pointer to the data to encrypt.
+ * @param[in]    m_len    Length of the data to encrypt.
+ * @param[out]   p_mic    Pointer to the buffer for the MIC.
+ * @param[in]    mic_len  Length of the MIC. Zero if the MIC is not to be calculated.
+ * @param[in]    encrypt  If @p p_m is to be encrypted. Otherwise it is only authenticated.
+ */
+static void ccm_star_transform(const uint8_t * p_key,
+                               const uint8_t * p_nonce,
+                               const uint8_t * p_a,
+                               uint32_t        a_len,
+                               uint8_t       * p_m,
+                               uint32_t        m_len,
+                               uint8_t       * p_mic,
+                               uint8_t         mic_len,
+                               bool            encrypt)
+{
+    uint8_t block[NRF_802154_AES_BLOCK_SIZE];
+
+    if (mic_len != 0)
+    {
+        cbc_mac_t mac = {.p_key = p_key};
+        uint8_t   l_a[CCM_L_SIZE];
+
+        mac.x[0] = ((a_len != 0) ? CCM_FLAGS_ADATA : 0) |
+                   (((mic_len - 2) / 2) << CCM_FLAGS_M_SHIFT) |
+                   CCM_FLAGS_L;
+        memcpy(&mac.x[CCM_NONCE_OFFSET], p_nonce, CCM_NONCE_SIZE);
+        mac.x[NRF_802154_AES_BLOCK_SIZE - 2] = (uint8_t)(m_len >> 8);
+        mac.x[NRF_802154_AES_BLOCK_SIZE - 1] = (uint8_t)m_len;
+        nrf_802154_aes_ecb_encrypt(p_key, mac.x, mac.x);
+
+        if (a_len != 0)
+        {
+            l_a[0] = (uint8_t)(a_len >> 8);
+            l_a[1] = (uint8_t)a_len;
+
+            cbc_mac_update(&mac, l_a, sizeof(l_a));
+            cbc_mac_update(&mac, p_a, a_len);
+            cbc_mac_pad(&mac);
+        }
+
+        cbc_mac_update(&mac, p_m, m_len);
+        cbc_mac_pad(&mac);
+
+        ctr_block_get(p_key, p_nonce, 0, block);
+
+        for (uint32_t i = 0; i < mic_len; i++)
+        {
+            p_mic[i] = mac.x[i] ^ block[i];
+        }
+    }
+
+    if (encrypt)
+    {
+        for (uint32_t i = 0; i < m_len; i++)
+        {
+            uint32_t pos = i % NRF_802154_AES_BLOCK_SIZE;
+
+            if (pos == 0)
+            {
+                ctr_block_get(p_key, p_nonce, (uint16_t)(i / NRF_802154_AES_BLOCK_SIZE + 1), block);
+            }
+
+            p_m[i] ^= block[pos];
+        }
+    }
+}
+
+nrf_802154_frame_security_result_t nrf_802154_frame_security_apply(uint8_t * p_frame)
+{
+    const uint8_t     * p_ext_addr = nrf_802154_pib_extended_address_get();
+    nrf_802154_key_id_t key_id;
+    uint8_t             key[NRF_802154_SECURITY_KEY_SIZE];
+    uint8_t             nonce[CCM_NONCE_SIZE];
+    uint32_t            frame_counter;
+    uint8_t             sec_ctrl_offset;
+    uint8_t             payload_offset;
+    uint8_t             mic_offset;
+    uint8_t             sec_ctrl;
+    uint8_t             level;
+    bool                encrypt;
+
+    switch (p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK)
+    {
+        case FRAME_VERSION_1:
+        case FRAME_VERSION_2:
+            break;
+
+        default:
+            // 802.15.4-2003 frames use a different auxiliary security header.
+            return NRF_802154_FRAME_SECURITY_NOT_APPLIED;
+    }
+
+    sec_ctrl_offset = nrf_802154_frame_parser_sec_ctrl_offset_get(p_frame);
+
+    if ((sec_ctrl_offset == 0) ||
+        (sec_ctrl_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (sec_ctrl_offset >= PHR_SIZE + p_frame[PHR_OFFSET]))
+    {
+        return NRF_802154_FRAME_SECURITY_NOT_APPLIED;
+    }
+
+    sec_ctrl = p_frame[sec_ctrl_offset];
+    level    = sec_ctrl & SECURITY_LEVEL_MASK;
+
+    if ((level == 0) ||
+        ((sec_ctrl & KEY_ID_MODE_MASK) == KEY_ID_MODE_0) ||
+        (sec_ctrl & FRAME_COUNTER_SUPPRESS_BIT))
+    {
+        return NRF_802154_FRAME_SECURITY_NOT_APPLIED;
+    }
+
+    key_id.mode     = (sec_ctrl & KEY_ID_MODE_MASK) >> KEY_ID_MODE_SHIFT;
+    key_id.p_key_id = nrf_802154_frame_parser_key_id_get(p_frame);
+
+    if ((key_id.p_key_id == NULL) || !nrf_802154_security_pib_key_get(&key_id, key))
+    {
+        return NRF_802154_FRAME_SECURITY_NOT_APPLIED;
+    }
+
+    encrypt        = (level & SECURITY_LEVEL_ENC) ? true : false;
+    mic_offset     = nrf_802154_frame_parser_mic_offset_get(p_frame);
+    payload_offset = encrypt ? nrf_802154_frame_parser_mac_payload_offset_get(p_frame) : mic_offset;
+
+    if ((mic_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (payload_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (payload_offset < sec_ctrl_offset + SECURITY_CONTROL_SIZE + FRAME_COUNTER_SIZE) ||
+        !nrf_802154_security_pib_frame_counter_get_next(&frame_counter))
+    {
+        return NRF_802154_FRAME_SECURITY_ERROR;
+    }
+
+    // Frame Counter field is transmitted in little-endian order.
+    p_frame[sec_ctrl_offset + SECURITY_CONTROL_SIZE + 0] = (uint8_t)frame_counter;
+    p_frame[sec_ctrl_offset + SECURITY_CONTROL_SIZE + 1] = (uint8_t)(frame_counter >> 8);
+    p_frame[sec_ctrl_offset + SECURITY_CONTROL_SIZE + 2] = (uint8_t)(frame_counter >> 16);
+    p_frame[sec_ctrl_offset + SECURITY_CONTROL_SIZE + 3] = (uint8_t)(frame_counter >> 24);
+
+    // Nonce consists of the big-endian source address, the big-endian frame counter
+    // and the security level.
+    for (uint32_t i = 0; i < EXTENDED_ADDRESS_SIZE; i++)
+    {
+        nonce[i] = p_ext_addr[EXTENDED_ADDRESS_SIZE - 1 - i];
+    }
+
+    nonce[EXTENDED_ADDRESS_SIZE + 0] = (uint8_t)(frame_counter >> 24);
+    nonce[EXTENDED_ADDRESS_SIZE + 1] = (uint8_t)(frame_counter >> 16);
+    nonce[EXTENDED_ADDRESS_SIZE + 2] = (uint8_t)(frame_counter >> 8);
+    nonce[EXTENDED_ADDRESS_SIZE + 3] = (uint8_t)frame_counter;
+    nonce[EXTENDED_ADDRESS_SIZE + 4] = level;
+
+    ccm_star_transform(key,
+                       nonce,
+                       &p_frame[PHR_SIZE],
+                       payload_offset - PHR_SIZE,
+                       &p_frame[payload_offset],
+                       mic_offset - payload_offset,
+                       &p_frame[mic_offset],
+                       PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE - mic_offset,
+                       encrypt);
+
+    return NRF_802154_FRAME_SECURITY_APPLIED;
+}
+
+#endif // NRF_802154_SECURITY_ENABLED
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that applies the 802.15.4 CCM* frame security in the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_FRAME_SECURITY_H
+#define NRF_802154_FRAME_SECURITY_H
+
+#include <stdint.h>
+
+/**
+ * @brief Result of applying the security to a frame.
+ */
+typedef enum
+{
+    NRF_802154_FRAME_SECURITY_NOT_APPLIED, ///< The frame is not to be secured by the driver and was not modified.
+    NRF_802154_FRAME_SECURITY_APPLIED,     ///< The frame was secured.
+    NRF_802154_FRAME_SECURITY_ERROR,       ///< The frame is to be secured by the driver, but it could not be secured.
+} nrf_802154_frame_security_result_t;
+
+/**
+ * @brief Applies the CCM* security to a frame.
+ *
+ * The security is applied to a frame that has the Security Enabled bit set, a non-zero security
+ * level, Key Identifier Mode other than 0 and the Frame Counter field present, if the key
+ * identified by the auxiliary security header is stored in the driver. The function writes
+ * the next value of the global frame counter into the auxiliary security header, calculates
+ * the MIC and encrypts the private payload fields in place. The MIC is written into the space
+ * reserved for it just before the FCS.
+ *
+ * @param[inout] p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ *
+ * @retval NRF_802154_FRAME_SECURITY_NOT_APPLIED  The frame does not need to be secured by the driver.
+ * @retval NRF_802154_FRAME_SECURITY_APPLIED      The frame was secured.
+ * @retval NRF_802154_FRAME_SECURITY_ERROR        The frame counter is exhausted or the frame is
+ *                                                malformed. The frame must not be transmitted.
+ *                                                Its content may have been modified.
+ */
+nrf_802154_frame_security_result_t nrf_802154_frame_security_apply(uint8_t * p_frame);
+
+#endif // NRF_802154_FRAME_SECURITY_H
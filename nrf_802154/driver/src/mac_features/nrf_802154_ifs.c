@@ -89,17 +89,19 @@ static void callback_fired(void * p_context)
 }
 
 /**@brief Checks if the IFS is needed by comparing the addresses of the actual and the last frames. */
-static bool is_ifs_needed_by_address(const uint8_t * p_frame)
+static bool is_ifs_needed_by_address(nrf_802154_frame_parser_data_t * p_frame_data)
 {
-    bool is_extended;
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_get(p_frame_data);
 
-    const uint8_t * addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &is_extended);
-
-    if (!addr)
+    if ((p_mhr_data == NULL) || (p_mhr_data->p_dst_addr == NULL))
     {
         return true;
     }
 
+    const uint8_t * addr        = p_mhr_data->p_dst_addr;
+    bool            is_extended = (p_mhr_data->dst_addr_size == EXTENDED_ADDRESS_SIZE);
+
     if (is_extended == m_is_last_address_extended)
     {
         uint8_t * last_addr = is_extended ? m_last_address.ext : m_last_address.sh;
@@ -149,7 +151,8 @@ static uint16_t ifs_needed_by_time(uint32_t current_timestamp)
 
 bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca)
 {
-    nrf_802154_ifs_mode_t mode = nrf_802154_pib_ifs_mode_get();
+    nrf_802154_ifs_mode_t          mode = nrf_802154_pib_ifs_mode_get();
+    nrf_802154_frame_parser_data_t frame_data;
 
     if (mode == NRF_802154_IFS_MODE_DISABLED)
     {
@@ -163,7 +166,16 @@ bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca)
         return true;
     }
 
-    if ((mode == NRF_802154_IFS_MODE_MATCHING_ADDRESSES) && !is_ifs_needed_by_address(p_frame))
+    if (nrf_802154_timer_sched_is_running(&m_timer))
+    {
+        // Another frame is waiting for the interframe space. Do not overwrite it, but let
+        // the abort hook decide if it can be aborted.
+        return true;
+    }
+
+    nrf_802154_frame_parser_data_init(p_frame, &frame_data);
+
+    if ((mode == NRF_802154_IFS_MODE_MATCHING_ADDRESSES) && !is_ifs_needed_by_address(&frame_data))
     {
         return true;
     }
@@ -190,20 +202,28 @@ bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca)
 
 void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
 {
+    nrf_802154_frame_parser_data_t frame_data;
+
     assert(p_frame[0] != 0U);
 
     m_last_frame_timestamp = nrf_802154_timer_sched_time_get();
 
-    const uint8_t * addr =
-        nrf_802154_frame_parser_dst_addr_get(p_frame, &m_is_last_address_extended);
+    nrf_802154_frame_parser_data_init(p_frame, &frame_data);
+
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_get(&frame_data);
 
-    if (!addr)
+    if ((p_mhr_data == NULL) || (p_mhr_data->p_dst_addr == NULL))
     {
         // If the transmitted frame has no address, we consider that enough time has passed so no IFS insertion will be needed.
         m_last_frame_length = 0;
         return;
     }
 
+    const uint8_t * addr = p_mhr_data->p_dst_addr;
+
+    m_is_last_address_extended = (p_mhr_data->dst_addr_size == EXTENDED_ADDRESS_SIZE);
+
     if (m_is_last_address_extended)
     {
         memcpy(m_last_address.ext, addr, EXTENDED_ADDRESS_SIZE);
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements storage of the frame security keys and of the frame counter
+ *   for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_security_pib.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_SECURITY_ENABLED
+
+#define FRAME_COUNTER_MAX UINT32_MAX ///< The frame counter value that must not be used in a frame.
+
+typedef struct
+{
+    uint8_t value[NRF_802154_SECURITY_KEY_SIZE]; ///< Value of the key.
+    uint8_t id[KEY_ID_MODE_3_SIZE];              ///< Key Source and Key Index of the key.
+    uint8_t mode;                                ///< Key Identifier Mode of the key.
+    bool    taken;                               ///< If the entry is in use.
+} key_entry_t;
+
+static key_entry_t       m_keys[NRF_802154_SECURITY_KEY_STORAGE_SIZE]; ///< Key storage.
+static volatile uint32_t m_frame_counter;                              ///< Global frame counter.
+
+static uint8_t key_id_size_get(uint8_t mode)
+{
+    switch (mode)
+    {
+        case 1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+static key_entry_t * key_entry_find(const nrf_802154_key_id_t * p_id, uint8_t id_size)
+{
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    {
+        key_entry_t * p_entry = &m_keys[i];
+
+        if (p_entry->taken &&
+            (p_entry->mode == p_id->mode) &&
+            (memcmp(p_entry->id, p_id->p_key_id, id_size) == 0))
+        {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+void nrf_802154_security_pib_init(void)
+{
+    memset(m_keys, 0, sizeof(m_keys));
+    m_frame_counter = 0;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_store(const nrf_802154_key_t * p_key)
+{
+    nrf_802154_security_error_t     err     = NRF_802154_SECURITY_ERROR_STORAGE_FULL;
+    uint8_t                         id_size = key_id_size_get(p_key->id.mode);
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (id_size == 0)
+    {
+        return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (key_entry_find(&p_key->id, id_size) != NULL)
+    {
+        err = NRF_802154_SECURITY_ERROR_ALREADY_PRESENT;
+    }
+    else
+    {
+        for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+        {
+            key_entry_t * p_entry = &m_keys[i];
+
+            if (!p_entry->taken)
+            {
+                memcpy(p_entry->value, p_key->value, sizeof(p_entry->value));
+                memcpy(p_entry->id, p_key->id.p_key_id, id_size);
+                p_entry->mode  = p_key->id.mode;
+                p_entry->taken = true;
+
+                err = NRF_802154_SECURITY_ERROR_NONE;
+                break;
+            }
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return err;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_remove(const nrf_802154_key_id_t * p_id)
+{
+    nrf_802154_security_error_t     err     = NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    uint8_t                         id_size = key_id_size_get(p_id->mode);
+    key_entry_t                   * p_entry;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (id_size == 0)
+    {
+        return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = key_entry_find(p_id, id_size);
+
+    if (p_entry != NULL)
+    {
+        memset(p_entry, 0, sizeof(*p_entry));
+        err = NRF_802154_SECURITY_ERROR_NONE;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return err;
+}
+
+bool nrf_802154_security_pib_key_get(const nrf_802154_key_id_t * p_id, uint8_t * p_value)
+{
+    bool                            result  = false;
+    uint8_t                         id_size = key_id_size_get(p_id->mode);
+    key_entry_t                   * p_entry;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (id_size == 0)
+    {
+        return false;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = key_entry_find(p_id, id_size);
+
+    if (p_entry != NULL)
+    {
+        memcpy(p_value, p_entry->value, sizeof(p_entry->value));
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter)
+{
+    m_frame_counter = frame_counter;
+}
+
+uint32_t nrf_802154_security_pib_global_frame_counter_get(void)
+{
+    return m_frame_counter;
+}
+
+bool nrf_802154_security_pib_frame_counter_get_next(uint32_t * p_frame_counter)
+{
+    uint32_t frame_counter;
+
+    do
+    {
+        frame_counter = __LDREXW(&m_frame_counter);
+
+        if (frame_counter == FRAME_COUNTER_MAX)
+        {
+            __CLREX();
+            return false;
+        }
+    }
+    while (__STREXW(frame_counter + 1U, &m_frame_counter));
+
+    *p_frame_counter = frame_counter;
+
+    return true;
+}
+
+#endif // NRF_802154_SECURITY_ENABLED
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that stores the frame security keys and the frame counter of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_SECURITY_PIB_H
+#define NRF_802154_SECURITY_PIB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the security PIB module.
+ *
+ * All keys are removed and the frame counter is set to 0.
+ */
+void nrf_802154_security_pib_init(void);
+
+/**
+ * @brief Stores a key in the key storage.
+ *
+ * @param[in]  p_key  Pointer to the key to store. The key and its identifier are copied.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key was stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There is no free entry in the storage.
+ * @retval NRF_802154_SECURITY_ERROR_ALREADY_PRESENT     A key with the same identifier is stored.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not supported.
+ */
+nrf_802154_security_error_t nrf_802154_security_pib_key_store(const nrf_802154_key_t * p_key);
+
+/**
+ * @brief Removes a key from the key storage.
+ *
+ * @param[in]  p_id  Pointer to the identifier of the key to remove.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key was removed.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND       There is no key with the given identifier.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not supported.
+ */
+nrf_802154_security_error_t nrf_802154_security_pib_key_remove(const nrf_802154_key_id_t * p_id);
+
+/**
+ * @brief Looks up a key in the key storage.
+ *
+ * @param[in]  p_id     Pointer to the identifier of the key to look up.
+ * @param[out] p_value  Buffer of @ref NRF_802154_SECURITY_KEY_SIZE bytes for the value of the key.
+ *
+ * @retval true   The key was found and its value was copied to @p p_value.
+ * @retval false  There is no key with the given identifier.
+ */
+bool nrf_802154_security_pib_key_get(const nrf_802154_key_id_t * p_id, uint8_t * p_value);
+
+/**
+ * @brief Sets the global frame counter.
+ *
+ * @param[in]  frame_counter  Value of the frame counter to use for the next secured frame.
+ */
+void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter);
+
+/**
+ * @brief Gets the global frame counter.
+ *
+ * @returns  Value of the frame counter that is to be used for the next secured frame.
+ */
+uint32_t nrf_802154_security_pib_global_frame_counter_get(void);
+
+/**
+ * @brief Takes the next value of the global frame counter.
+ *
+ * This function may be called from any priority.
+ *
+ * @param[out] p_frame_counter  Frame counter value to use in the secured frame.
+ *
+ * @retval true   The frame counter value was taken and the global frame counter was incremented.
+ * @retval false  The frame counter is exhausted.
+ */
+bool nrf_802154_security_pib_frame_counter_get_next(uint32_t * p_frame_counter);
+
+#endif // NRF_802154_SECURITY_PIB_H
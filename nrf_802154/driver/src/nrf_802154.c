@@ -61,6 +61,7 @@
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_stats.h"
 #include "hal/nrf_radio.h"
+#include "platform/nrf_802154_aes.h"
 #include "platform/nrf_802154_clock.h"
 #include "platform/nrf_802154_lp_timer.h"
 #include "platform/nrf_802154_random.h"
@@ -72,8 +73,10 @@
 #include "timer/nrf_802154_timer_sched.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_channel_scan.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_security_pib.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #include "nrf_802154_sl_ant_div.h"
@@ -216,13 +219,27 @@ void nrf_802154_init(void)
     nrf_802154_rsch_crit_sect_init(&crit_sect_int);
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
+    nrf_802154_stats_init();
     nrf_802154_temperature_init();
     nrf_802154_timer_coord_init();
     nrf_802154_timer_sched_init();
+#if NRF_802154_SECURITY_ENABLED
+    nrf_802154_aes_init();
+    nrf_802154_security_pib_init();
+#endif
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+    nrf_802154_channel_scan_init();
+#endif
 }
 
 void nrf_802154_deinit(void)
 {
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+    nrf_802154_channel_scan_stop();
+#endif
+#if NRF_802154_SECURITY_ENABLED
+    nrf_802154_aes_deinit();
+#endif
     nrf_802154_timer_sched_deinit();
     nrf_802154_timer_coord_uninit();
     nrf_802154_temperature_deinit();
@@ -435,6 +452,18 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
     return result;
 }
 
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_transmit_enqueue(p_data, cca);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 #else // NRF_802154_USE_RAW_API
 
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
@@ -501,6 +530,22 @@ bool nrf_802154_receive_at(uint32_t t0,
     return result;
 }
 
+bool nrf_802154_receive_at_periodic(uint32_t t0,
+                                    uint32_t dt,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_receive_periodic(t0, dt, period, timeout, channel);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 bool nrf_802154_receive_at_cancel(void)
 {
     bool result;
@@ -572,7 +617,7 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
-    assert(p_buffer->free == false);
+    assert(p_buffer->owner == RX_BUFFER_OWNER_APPLICATION);
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data);
@@ -589,7 +634,7 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
-    assert(p_buffer->free == false);
+    assert(p_buffer->owner == RX_BUFFER_OWNER_APPLICATION);
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data);
@@ -607,7 +652,7 @@ void nrf_802154_buffer_free(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
 
-    assert(p_buffer->free == false);
+    assert(p_buffer->owner == RX_BUFFER_OWNER_APPLICATION);
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
@@ -624,7 +669,7 @@ bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
 
-    assert(p_buffer->free == false);
+    assert(p_buffer->owner == RX_BUFFER_OWNER_APPLICATION);
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
@@ -727,6 +772,26 @@ void nrf_802154_pending_bit_for_addr_reset(bool extended)
     nrf_802154_ack_data_reset(extended, NRF_802154_ACK_DATA_PENDING_BIT);
 }
 
+bool nrf_802154_pending_bit_for_addr_list_set(const uint8_t * p_addrs,
+                                              uint32_t        num_addrs,
+                                              bool            extended,
+                                              bool            replace)
+{
+    return nrf_802154_ack_data_pending_bit_for_addr_list_set(p_addrs, num_addrs, extended, replace);
+}
+
+bool nrf_802154_pending_bit_for_addr_list_clear(const uint8_t * p_addrs,
+                                                uint32_t        num_addrs,
+                                                bool            extended)
+{
+    return nrf_802154_ack_data_pending_bit_for_addr_list_clear(p_addrs, num_addrs, extended);
+}
+
+uint32_t nrf_802154_pending_bit_for_addr_list_capacity_get(bool extended, bool replace)
+{
+    return nrf_802154_ack_data_pending_bit_for_addr_list_capacity_get(extended, replace);
+}
+
 void nrf_802154_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
 {
     nrf_802154_pib_cca_cfg_set(p_cca_cfg);
@@ -841,6 +906,56 @@ void nrf_802154_ifs_min_lifs_period_set(uint16_t period)
 
 #endif // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_SECURITY_ENABLED
+
+nrf_802154_security_error_t nrf_802154_security_key_store(const nrf_802154_key_t * p_key)
+{
+    return nrf_802154_security_pib_key_store(p_key);
+}
+
+nrf_802154_security_error_t nrf_802154_security_key_remove(const nrf_802154_key_id_t * p_id)
+{
+    return nrf_802154_security_pib_key_remove(p_id);
+}
+
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
+{
+    nrf_802154_security_pib_global_frame_counter_set(frame_counter);
+}
+
+uint32_t nrf_802154_security_global_frame_counter_get(void)
+{
+    return nrf_802154_security_pib_global_frame_counter_get();
+}
+
+#endif // NRF_802154_SECURITY_ENABLED
+
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+
+bool nrf_802154_background_scan_start(uint32_t channel_mask,
+                                      uint32_t ed_time_us,
+                                      uint32_t interval_us)
+{
+    return nrf_802154_channel_scan_start(channel_mask, ed_time_us, interval_us);
+}
+
+void nrf_802154_background_scan_stop(void)
+{
+    nrf_802154_channel_scan_stop();
+}
+
+void nrf_802154_channel_map_get(nrf_802154_channel_map_t * p_map)
+{
+    nrf_802154_channel_scan_map_get(p_map);
+}
+
+void nrf_802154_channel_map_reset(void)
+{
+    nrf_802154_channel_scan_map_reset();
+}
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
 {
     nrf_802154_capabilities_t    caps_drv = 0UL;
@@ -878,6 +993,9 @@ nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
                      NRF_802154_CAPABILITY_IFS : 0UL);
     }
 
+    caps_drv |= (NRF_802154_SECURITY_ENABLED ?
+                 NRF_802154_CAPABILITY_SECURITY : 0UL);
+
     return caps_drv;
 }
 
@@ -57,6 +57,7 @@
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_queue.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_stats.h"
@@ -67,9 +68,11 @@
 #include "drivers/nrfx_errors.h"
 #include "hal/nrf_radio.h"
 #include "mpsl_fem_protocol_api.h"
+#include "mac_features/nrf_802154_channel_scan.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_frame_security.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
@@ -117,10 +120,20 @@ static rx_buffer_t * const mp_current_rx_buffer = &nrf_802154_rx_buffers[0];
 
 #endif
 
+/// Descriptor of the frame being received, shared by the filter and the ACK generator.
+static nrf_802154_frame_parser_data_t m_rx_frame_data;
+
 static const uint8_t * mp_ack;         ///< Pointer to Ack frame buffer.
 static const uint8_t * mp_tx_data;     ///< Pointer to the data to transmit.
+static const uint8_t * mp_tx_frame;    ///< Pointer to the frame that is transmitted over the air.
+
+#if NRF_802154_SECURITY_ENABLED
+/// Buffer holding the copy of the transmitted frame to which the frame security was applied.
+static uint8_t m_tx_secured_frame[MAX_PACKET_SIZE + PHR_SIZE];
+#endif
 static uint32_t        m_ed_time_left; ///< Remaining time of the current energy detection procedure [us].
 static uint8_t         m_ed_result;    ///< Result of the current energy detection procedure.
+static uint8_t         m_ed_channel;   ///< Channel of the current background energy detection procedure.
 
 static volatile radio_state_t m_state; ///< State of the radio driver.
 
@@ -130,6 +143,9 @@ typedef struct
     bool rx_timeslot_requested : 1;                           ///< If timeslot for the frame being received is already requested.
     bool tx_with_cca           : 1;                           ///< If currently transmitted frame is transmitted with cca.
     bool tx_diminished_prio    : 1;                           ///< If priority of the current transmission should be diminished.
+    bool tx_queue_head_delayed : 1;                           ///< If transmission of the frame at the head of the transmit queue is delayed by a MAC feature.
+    bool ed_background         : 1;                           ///< If current energy detection is requested by the background channel scan.
+    bool tx_security_failed    : 1;                           ///< If the security could not be applied to the frame accepted for transmission.
 } nrf_802154_flags_t;
 
 static nrf_802154_flags_t m_flags;                            ///< Flags used to store the current driver state.
@@ -147,6 +163,18 @@ static nrf_802154_timer_t m_rx_prestarted_timer;
 /** @brief Value of Coex TX Request mode */
 static nrf_802154_coex_tx_request_mode_t m_coex_tx_request_mode;
 
+/** @brief Frame waiting in the transmit queue. */
+typedef struct
+{
+    const uint8_t * p_data; ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+    bool            cca;    ///< If CCA is to be performed before the transmission.
+} tx_queue_item_t;
+
+static nrf_802154_queue_t m_tx_queue; ///< Frames to be transmitted after the current transmission.
+
+/** @brief Memory holding transmit queue items. One slot is lost due to queue implementation. */
+static tx_queue_item_t m_tx_queue_memory[NRF_802154_TX_QUEUE_SIZE + 1];
+
 #if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
 #if !NRF_802154_FRAME_TIMESTAMP_ENABLED
 #error NRF_802154_FRAME_TIMESTAMP_ENABLED == 0 when NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED != 0
@@ -161,6 +189,11 @@ static uint32_t m_listening_start_hp_timestamp;
 
 #endif
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+static uint32_t m_tx_start_timestamp; ///< Time when the current transmit procedure started.
+
+#endif
+
 /***************************************************************************************************
  * @section Common core operations
  **************************************************************************************************/
@@ -302,6 +335,9 @@ static void transmit_started_notify(void)
 {
     const uint8_t * p_frame = mp_tx_data;
 
+    nrf_802154_stat_histogram_add(request_to_air_latency,
+                                  nrf_802154_timer_sched_time_get() - m_tx_start_timestamp);
+
     if (nrf_802154_core_hooks_tx_started(p_frame))
     {
         nrf_802154_tx_started(p_frame);
@@ -333,6 +369,27 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
     nrf_802154_critical_section_nesting_deny();
 }
 
+/** Notify MAC layer that transmission of frames waiting in the transmit queue was aborted. */
+static void tx_queue_flush(void)
+{
+    // A frame delayed by a MAC feature is notified by that feature if its transmission is aborted.
+    if (m_flags.tx_queue_head_delayed)
+    {
+        m_flags.tx_queue_head_delayed = false;
+        nrf_802154_queue_pop_commit(&m_tx_queue);
+    }
+
+    while (!nrf_802154_queue_is_empty(&m_tx_queue))
+    {
+        tx_queue_item_t * p_item  = (tx_queue_item_t *)nrf_802154_queue_pop_begin(&m_tx_queue);
+        const uint8_t   * p_frame = p_item->p_data;
+
+        nrf_802154_queue_pop_commit(&m_tx_queue);
+
+        nrf_802154_notify_transmit_failed(p_frame, NRF_802154_TX_ERROR_ABORTED);
+    }
+}
+
 /** Notify MAC layer that transmission procedure failed. */
 static void transmit_failed_notify(nrf_802154_tx_error_t error)
 {
@@ -341,6 +398,9 @@ static void transmit_failed_notify(nrf_802154_tx_error_t error)
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
         nrf_802154_notify_transmit_failed(p_frame, error);
+
+        // Frames queued after the failed one are not transmitted.
+        tx_queue_flush();
     }
 }
 
@@ -354,6 +414,16 @@ static void transmit_failed_notify_and_nesting_allow(nrf_802154_tx_error_t error
     nrf_802154_critical_section_nesting_deny();
 }
 
+/** Notify MAC layer that the frame accepted for transmission could not be secured. */
+static void transmit_security_failed_notify(void)
+{
+    if (m_flags.tx_security_failed)
+    {
+        m_flags.tx_security_failed = false;
+        transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_SECURITY);
+    }
+}
+
 /** Notify MAC layer that energy detection procedure ended. */
 static void energy_detected_notify(uint8_t result)
 {
@@ -414,7 +484,8 @@ static void rx_buffer_in_use_set(rx_buffer_t * p_rx_buffer)
  */
 static bool rx_buffer_is_available(void)
 {
-    return (mp_current_rx_buffer != NULL) && (mp_current_rx_buffer->free);
+    return (mp_current_rx_buffer != NULL) &&
+           (mp_current_rx_buffer->owner == RX_BUFFER_OWNER_DRIVER);
 }
 
 /** Get pointer to available rx buffer.
@@ -525,8 +596,12 @@ static rsch_prio_t min_required_rsch_prio(radio_state_t state)
         case RADIO_STATE_RX:
             return RSCH_PRIO_IDLE_LISTENING;
 
-        case RADIO_STATE_RX_ACK:
         case RADIO_STATE_ED:
+            // Background channel scan must not take the radio away from other protocols
+            // more than idle listening does.
+            return m_flags.ed_background ? RSCH_PRIO_IDLE_LISTENING : RSCH_PRIO_RX;
+
+        case RADIO_STATE_RX_ACK:
         case RADIO_STATE_CCA:
             return RSCH_PRIO_RX;
 
@@ -642,11 +717,14 @@ static bool can_terminate_current_operation(radio_state_t     state,
             result = (term_lvl >= NRF_802154_TERM_802154) || !receiving_psdu_now;
             break;
 
+        case RADIO_STATE_ED:
+            result = (term_lvl >= NRF_802154_TERM_802154) || m_flags.ed_background;
+            break;
+
         case RADIO_STATE_TX_ACK:
         case RADIO_STATE_CCA_TX:
         case RADIO_STATE_TX:
         case RADIO_STATE_RX_ACK:
-        case RADIO_STATE_ED:
         case RADIO_STATE_CCA:
             result = (term_lvl >= NRF_802154_TERM_802154);
             break;
@@ -677,7 +755,7 @@ static void operation_terminated_notify(radio_state_t state, bool receiving_psdu
             break;
 
         case RADIO_STATE_TX_ACK:
-            mp_current_rx_buffer->free = false;
+            mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
             received_frame_notify(mp_current_rx_buffer->data);
             break;
 
@@ -691,7 +769,11 @@ static void operation_terminated_notify(radio_state_t state, bool receiving_psdu
             break;
 
         case RADIO_STATE_ED:
-            nrf_802154_notify_energy_detection_failed(NRF_802154_ED_ERROR_ABORTED);
+            if (!m_flags.ed_background)
+            {
+                nrf_802154_notify_energy_detection_failed(NRF_802154_ED_ERROR_ABORTED);
+            }
+
             break;
 
         case RADIO_STATE_CCA:
@@ -833,6 +915,12 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             if (m_state == RADIO_STATE_ED)
             {
                 nrf_802154_sl_ant_div_energy_detection_aborted_notify();
+
+                if (m_flags.ed_background && timeslot_is_granted())
+                {
+                    // Background energy detection is performed on a channel other than in PIB.
+                    nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+                }
             }
 
             if (notify)
@@ -987,7 +1075,7 @@ static void rx_init(void)
     // Find RX buffer if none available
     if (!free_buffer)
     {
-        rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+        rx_buffer_in_use_set(nrf_802154_rx_buffer_alloc());
 
         nrf_802154_trx_receive_buffer_set(rx_buffer_get());
     }
@@ -1032,6 +1120,137 @@ static bool tx_init(const uint8_t * p_data, bool cca)
     return true;
 }
 
+/** Terminate ongoing operation and start TX operation.
+ *
+ * @param[in]  term_lvl   Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig   Module that originates this request.
+ * @param[in]  p_data     Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+ * @param[in]  cca        If the driver is to perform CCA procedure before transmission.
+ * @param[in]  immediate  If true, the driver returns to RX state if the transmission cannot start
+ *                        now. Otherwise, the transmission starts when the timeslot is granted.
+ *
+ * @retval true   TX operation was started or will be started when the timeslot is granted.
+ * @retval false  Ongoing operation was not terminated or immediate transmission failed.
+ */
+static bool tx_start(nrf_802154_term_t term_lvl,
+                     req_originator_t  req_orig,
+                     const uint8_t   * p_data,
+                     bool              cca,
+                     bool              immediate)
+{
+    bool result = current_operation_terminate(term_lvl, req_orig, true);
+
+    if (result)
+    {
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+        m_tx_start_timestamp = nrf_802154_timer_sched_time_get();
+#endif
+
+        m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
+        m_trx_transmit_frame_notifications_mask =
+            make_trx_frame_transmit_notification_mask(cca);
+        m_flags.tx_diminished_prio =
+            m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
+
+        mp_tx_frame = p_data;
+
+#if NRF_802154_SECURITY_ENABLED
+        if (p_data[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT)
+        {
+            nrf_802154_frame_security_result_t security_result = NRF_802154_FRAME_SECURITY_ERROR;
+
+            // The frame passed by the higher layer must not be modified, so it is secured
+            // in a copy. A frame that does not fit in the copy cannot be transmitted anyway.
+            if (p_data[PHR_OFFSET] <= MAX_PACKET_SIZE)
+            {
+                memcpy(m_tx_secured_frame, p_data, PHR_SIZE + p_data[PHR_OFFSET]);
+                security_result = nrf_802154_frame_security_apply(m_tx_secured_frame);
+            }
+
+            switch (security_result)
+            {
+                case NRF_802154_FRAME_SECURITY_APPLIED:
+                    mp_tx_frame = m_tx_secured_frame;
+                    break;
+
+                case NRF_802154_FRAME_SECURITY_ERROR:
+                    // Retrying would not help, so the request is accepted and the failure is
+                    // reported by the caller once it is done with the transmit queue.
+                    mp_tx_data                 = p_data;
+                    m_flags.tx_security_failed = true;
+                    state_set(RADIO_STATE_RX);
+                    rx_init();
+                    return true;
+
+                default:
+                    break;
+            }
+        }
+#endif
+
+        state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+        mp_tx_data = p_data;
+
+        // coverity[check_return]
+        result = tx_init(mp_tx_frame, cca);
+        if (immediate)
+        {
+            if (!result)
+            {
+                state_set(RADIO_STATE_RX);
+                rx_init();
+            }
+        }
+        else
+        {
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+/** Start transmission of the frame at the head of the transmit queue.
+ *
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval true   The frame is being transmitted or its transmission is delayed by a MAC feature.
+ * @retval false  Ongoing operation was not terminated. The frame stays at the head of the queue.
+ */
+static bool tx_queue_head_transmit(req_originator_t req_orig)
+{
+    tx_queue_item_t * p_item = (tx_queue_item_t *)nrf_802154_queue_pop_begin(&m_tx_queue);
+    const uint8_t   * p_data = p_item->p_data;
+    bool              cca    = p_item->cca;
+
+    if (!nrf_802154_core_hooks_pre_transmission(p_data, cca))
+    {
+        // A MAC feature (e.g. IFS) requests the transmission later. The frame stays at the head
+        // of the queue until then, so that frames enqueued in the meantime are not sent first.
+        m_flags.tx_queue_head_delayed = true;
+        return true;
+    }
+
+    if (!tx_start(NRF_802154_TERM_NONE, req_orig, p_data, cca, false))
+    {
+        return false;
+    }
+
+    nrf_802154_queue_pop_commit(&m_tx_queue);
+    transmit_security_failed_notify();
+
+    return true;
+}
+
+/** Start transmission of the next frame from the transmit queue after a successful transmission. */
+static void tx_queue_next_start(void)
+{
+    if (!nrf_802154_queue_is_empty(&m_tx_queue) && !tx_queue_head_transmit(REQ_ORIG_CORE))
+    {
+        tx_queue_flush();
+    }
+}
+
 /** Initialize ED operation */
 static void ed_init(void)
 {
@@ -1047,6 +1266,11 @@ static void ed_init(void)
 
     uint32_t trx_ed_count = 0U;
 
+    if (m_flags.ed_background)
+    {
+        nrf_802154_trx_channel_set(m_ed_channel);
+    }
+
     // Notify antenna diversity about energy detection request. Antenna diversity state
     // will be updated, and m_ed_time_left reduced accordingly.
     nrf_802154_sl_ant_div_energy_detection_requested_notify(&m_ed_time_left);
@@ -1060,6 +1284,28 @@ static void ed_init(void)
     nrf_802154_trx_energy_detection(trx_ed_count);
 }
 
+/** Pass the result of the background energy detection procedure to the channel scan module
+ *  and resume receiving. */
+static void ed_background_finished(void)
+{
+    m_flags.ed_background = false;
+
+    state_set(RADIO_STATE_RX);
+    rx_init();
+
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+    nrf_802154_cca_cfg_t cca_cfg;
+
+    nrf_802154_pib_cca_cfg_get(&cca_cfg);
+
+    // Compare the raw sample against the corrected threshold, as the CCA does in hardware.
+    nrf_802154_channel_scan_energy_detected(
+        m_ed_channel,
+        ed_result_get(m_ed_result),
+        m_ed_result >= nrf_802154_rssi_cca_ed_threshold_corrected_get(cca_cfg.ed_threshold));
+#endif
+}
+
 /** Initialize CCA operation. */
 static void cca_init(void)
 {
@@ -1154,7 +1400,7 @@ static void on_timeslot_ended(void)
 
             case RADIO_STATE_TX_ACK:
                 state_set(RADIO_STATE_RX);
-                mp_current_rx_buffer->free = false;
+                mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
                 received_frame_notify_and_nesting_allow(mp_current_rx_buffer->data);
                 break;
 
@@ -1261,11 +1507,11 @@ static void on_preconditions_approved(radio_state_t state)
             break;
 
         case RADIO_STATE_CCA_TX:
-            (void)tx_init(mp_tx_data, true);
+            (void)tx_init(mp_tx_frame, true);
             break;
 
         case RADIO_STATE_TX:
-            (void)tx_init(mp_tx_data, false);
+            (void)tx_init(mp_tx_frame, false);
             break;
 
         case RADIO_STATE_ED:
@@ -1561,8 +1807,12 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 
     if (!m_flags.frame_filtered)
     {
-        filter_result = nrf_802154_filter_frame_part(mp_current_rx_buffer->data,
-                                                     &num_data_bytes);
+        if (num_data_bytes == PHR_SIZE + FCF_SIZE)
+        {
+            nrf_802154_frame_parser_data_init(mp_current_rx_buffer->data, &m_rx_frame_data);
+        }
+
+        filter_result = nrf_802154_filter_frame_part(&m_rx_frame_data, &num_data_bytes);
 
         if (filter_result == NRF_802154_RX_ERROR_NONE)
         {
@@ -1790,13 +2040,15 @@ void nrf_802154_trx_receive_frame_received(void)
     uint8_t               prev_num_data_bytes = 0;
     nrf_802154_rx_error_t filter_result;
 
+    nrf_802154_frame_parser_data_init(mp_current_rx_buffer->data, &m_rx_frame_data);
+
     // Frame filtering
     while (num_data_bytes != prev_num_data_bytes)
     {
         prev_num_data_bytes = num_data_bytes;
 
         // Keep checking consecutive parts of the frame header.
-        filter_result = nrf_802154_filter_frame_part(mp_current_rx_buffer->data, &num_data_bytes);
+        filter_result = nrf_802154_filter_frame_part(&m_rx_frame_data, &num_data_bytes);
 
         if (filter_result == NRF_802154_RX_ERROR_NONE)
         {
@@ -1826,7 +2078,7 @@ void nrf_802154_trx_receive_frame_received(void)
         if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
             nrf_802154_pib_promiscuous_get())
         {
-            mp_current_rx_buffer->free = false;
+            mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
             received_frame_notify_and_nesting_allow(p_received_data);
         }
 
@@ -1853,7 +2105,9 @@ void nrf_802154_trx_receive_frame_received(void)
             ack_is_requested(mp_current_rx_buffer->data) &&
             nrf_802154_pib_auto_ack_get())
         {
-            mp_ack = nrf_802154_ack_generator_create(mp_current_rx_buffer->data);
+            assert(m_rx_frame_data.p_frame == mp_current_rx_buffer->data);
+
+            mp_ack = nrf_802154_ack_generator_create(&m_rx_frame_data);
             if (NULL != mp_ack)
             {
                 send_ack = true;
@@ -1872,7 +2126,7 @@ void nrf_802154_trx_receive_frame_received(void)
                 }
                 else
                 {
-                    mp_current_rx_buffer->free = false;
+                    mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
 
                     state_set(RADIO_STATE_RX);
                     rx_init();
@@ -1888,7 +2142,7 @@ void nrf_802154_trx_receive_frame_received(void)
                     nrf_802154_stat_counter_increment(coex_denied_requests);
                 }
 
-                mp_current_rx_buffer->free = false;
+                mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
 
                 state_set(RADIO_STATE_RX);
                 rx_init();
@@ -1904,10 +2158,10 @@ void nrf_802154_trx_receive_frame_received(void)
                 nrf_802154_pib_promiscuous_get())
             {
                 // Current buffer will be passed to the application
-                mp_current_rx_buffer->free = false;
+                mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
 
                 // Find new buffer
-                rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+                rx_buffer_in_use_set(nrf_802154_rx_buffer_alloc());
 
                 rx_init();
 
@@ -1978,7 +2232,7 @@ void nrf_802154_trx_transmit_ack_transmitted(void)
     uint8_t * p_received_data = mp_current_rx_buffer->data;
 
     // Current buffer used for receive operation will be passed to the application
-    mp_current_rx_buffer->free = false;
+    mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
 
     state_set(RADIO_STATE_RX);
 
@@ -2064,7 +2318,7 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
 
         if (!rx_buffer_free)
         {
-            rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+            rx_buffer_in_use_set(nrf_802154_rx_buffer_alloc());
 
             nrf_802154_trx_receive_buffer_set(rx_buffer_get());
         }
@@ -2076,6 +2330,8 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
         rx_init();
 
         transmitted_frame_notify(NULL, 0, 0);
+
+        tx_queue_next_start();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2202,11 +2458,13 @@ void nrf_802154_trx_receive_ack_received(void)
         uint32_t ts = timer_coord_timestamp_get();
 
         nrf_802154_stat_timestamp_write(last_ack_end_timestamp, ts);
+        nrf_802154_stat_histogram_add(ack_round_trip_time,
+                                      ts - nrf_802154_stat_timestamp_read(last_tx_end_timestamp));
 #endif
 
         rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
 
-        mp_current_rx_buffer->free = false;
+        mp_current_rx_buffer->owner = RX_BUFFER_OWNER_NOTIFICATION;
 
         state_set(RADIO_STATE_RX);
         rx_init();
@@ -2214,6 +2472,8 @@ void nrf_802154_trx_receive_ack_received(void)
         transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
                                  rssi_last_measurement_get(),  // rssi
                                  lqi_get(p_ack_buffer->data)); // lqi;
+
+        tx_queue_next_start();
     }
     else
     {
@@ -2321,11 +2581,17 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
     {
         nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
 
-        state_set(RADIO_STATE_RX);
-        rx_init();
-
-        energy_detected_notify(ed_result_get(m_ed_result));
+        if (m_flags.ed_background)
+        {
+            ed_background_finished();
+        }
+        else
+        {
+            state_set(RADIO_STATE_RX);
+            rx_init();
 
+            energy_detected_notify(ed_result_get(m_ed_result));
+        }
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2340,6 +2606,12 @@ void nrf_802154_core_init(void)
     m_state                    = RADIO_STATE_SLEEP;
     m_rsch_timeslot_is_granted = false;
 
+    nrf_802154_queue_init(&m_tx_queue,
+                          m_tx_queue_memory,
+                          sizeof(m_tx_queue_memory),
+                          sizeof(m_tx_queue_memory[0]));
+    m_flags.tx_queue_head_delayed = false;
+
     nrf_802154_trx_init();
     nrf_802154_ack_generator_init();
 }
@@ -2380,6 +2652,8 @@ bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
 
             if (result)
             {
+                tx_queue_flush();
+
                 // The order of calls in the following blocks is inverted to avoid RAAL races.
                 if (timeslot_is_granted())
                 {
@@ -2438,6 +2712,12 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
             notify_function(result);
         }
 
+        if (result)
+        {
+            // Notified after the result of the request, which may end the current transmission.
+            tx_queue_flush();
+        }
+
         nrf_802154_critical_section_exit();
     }
     else
@@ -2466,37 +2746,22 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
     if (result)
     {
+        bool queued         = false;
+        bool retransmission = (p_data == mp_tx_data);
+
+        if (m_flags.tx_queue_head_delayed &&
+            (((tx_queue_item_t *)nrf_802154_queue_pop_begin(&m_tx_queue))->p_data == p_data))
+        {
+            // The delayed frame from the transmit queue is being requested by the MAC feature.
+            m_flags.tx_queue_head_delayed = false;
+            nrf_802154_queue_pop_commit(&m_tx_queue);
+            queued = true;
+        }
+
         // Short-circuit evaluation in place.
         if ((immediate) || (nrf_802154_core_hooks_pre_transmission(p_data, cca)))
         {
-            result = current_operation_terminate(term_lvl, req_orig, true);
-
-            if (result)
-            {
-                m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
-                m_trx_transmit_frame_notifications_mask =
-                    make_trx_frame_transmit_notification_mask(cca);
-                m_flags.tx_diminished_prio =
-                    m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
-
-                state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
-                mp_tx_data = p_data;
-
-                // coverity[check_return]
-                result = tx_init(p_data, cca);
-                if (immediate)
-                {
-                    if (!result)
-                    {
-                        state_set(RADIO_STATE_RX);
-                        rx_init();
-                    }
-                }
-                else
-                {
-                    result = true;
-                }
-            }
+            result = tx_start(term_lvl, req_orig, p_data, cca, immediate);
         }
 
         if (notify_function != NULL)
@@ -2504,6 +2769,21 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
             notify_function(result);
         }
 
+        if (queued && !result)
+        {
+            // Frames queued after the failed one are not transmitted.
+            tx_queue_flush();
+        }
+        else if (!queued && !retransmission && result)
+        {
+            // Frames queued after an earlier transmission must not follow an unrelated frame.
+            // A retransmission (e.g. the next CSMA-CA attempt) keeps the queue, because its
+            // failure is not reported yet.
+            tx_queue_flush();
+        }
+
+        transmit_security_failed_notify();
+
         nrf_802154_critical_section_exit();
     }
     else
@@ -2519,6 +2799,55 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
     return result;
 }
 
+bool nrf_802154_core_transmit_enqueue(const uint8_t * p_data, bool cca)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        bool tx_in_progress = (m_state == RADIO_STATE_TX) ||
+                              (m_state == RADIO_STATE_CCA_TX) ||
+                              (m_state == RADIO_STATE_RX_ACK) ||
+                              m_flags.tx_queue_head_delayed;
+
+        if (!tx_in_progress)
+        {
+            // Frames left in the queue after a failure reported by a MAC feature are not transmitted.
+            tx_queue_flush();
+        }
+
+        result = !nrf_802154_queue_is_full(&m_tx_queue);
+
+        if (result)
+        {
+            tx_queue_item_t * p_item = (tx_queue_item_t *)nrf_802154_queue_push_begin(&m_tx_queue);
+
+            p_item->p_data = p_data;
+            p_item->cca    = cca;
+
+            nrf_802154_queue_push_commit(&m_tx_queue);
+
+            if (!tx_in_progress)
+            {
+                result = tx_queue_head_transmit(REQ_ORIG_HIGHER_LAYER);
+
+                if (!result)
+                {
+                    nrf_802154_queue_pop_commit(&m_tx_queue);
+                }
+            }
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2529,6 +2858,44 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
     {
         result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
 
+        if (result)
+        {
+            tx_queue_flush();
+
+            if (time_us < ED_ITER_DURATION)
+            {
+                time_us = ED_ITER_DURATION;
+            }
+
+            m_ed_time_left        = time_us;
+            m_ed_result           = 0;
+            m_flags.ed_background = false;
+
+            state_set(RADIO_STATE_ED);
+            ed_init();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+bool nrf_802154_core_channel_scan_energy_detection(uint8_t channel, uint32_t time_us)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        // Background measurements must not delay any other operation.
+        result = (m_state == RADIO_STATE_RX) &&
+                 current_operation_terminate(NRF_802154_TERM_NONE, REQ_ORIG_CHANNEL_SCAN, true);
+
         if (result)
         {
             if (time_us < ED_ITER_DURATION)
@@ -2536,8 +2903,10 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
                 time_us = ED_ITER_DURATION;
             }
 
-            m_ed_time_left = time_us;
-            m_ed_result    = 0;
+            m_ed_time_left        = time_us;
+            m_ed_result           = 0;
+            m_ed_channel          = channel;
+            m_flags.ed_background = true;
 
             state_set(RADIO_STATE_ED);
             ed_init();
@@ -2551,6 +2920,8 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
     return result;
 }
 
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2563,6 +2934,8 @@ bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 
         if (result)
         {
+            tx_queue_flush();
+
             state_set(RADIO_STATE_CCA);
             cca_init();
         }
@@ -2587,6 +2960,8 @@ bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
 
         if (result)
         {
+            tx_queue_flush();
+
             state_set(RADIO_STATE_CONTINUOUS_CARRIER);
             continuous_carrier_init();
         }
@@ -2612,6 +2987,8 @@ bool nrf_802154_core_modulated_carrier(nrf_802154_term_t term_lvl,
 
         if (result)
         {
+            tx_queue_flush();
+
             state_set(RADIO_STATE_MODULATED_CARRIER);
             mp_tx_data = p_data;
             modulated_carrier_init(p_data);
@@ -2632,7 +3009,7 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
     rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
     bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
 
-    p_buffer->free = true;
+    nrf_802154_rx_buffer_release(p_buffer);
 
     if (in_crit_sect)
     {
@@ -2640,7 +3017,11 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
         {
             if (nrf_802154_trx_receive_is_buffer_missing())
             {
-                rx_buffer_in_use_set(p_buffer);
+                if (!rx_buffer_is_available())
+                {
+                    rx_buffer_in_use_set(nrf_802154_rx_buffer_alloc());
+                }
+
                 nrf_802154_trx_receive_buffer_set(rx_buffer_get());
             }
         }
@@ -2661,7 +3042,8 @@ bool nrf_802154_core_channel_update(void)
 
     if (result)
     {
-        if (timeslot_is_granted())
+        // The background energy detection switches back to the PIB channel when it is finished.
+        if (timeslot_is_granted() && !((m_state == RADIO_STATE_ED) && m_flags.ed_background))
         {
             nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
         }
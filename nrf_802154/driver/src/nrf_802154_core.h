@@ -152,6 +152,21 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function);
 
+/**
+ * @brief Adds a frame to the transmit queue.
+ *
+ * Frames from the transmit queue are transmitted one after another as soon as the transmission
+ * of the previous frame succeeds. If no transmission is in progress, the transmission of the given
+ * frame is requested as by @ref nrf_802154_core_transmit.
+ *
+ * @param[in]  p_data  Pointer to a frame to transmit.
+ * @param[in]  cca     If the driver is to perform CCA procedure before transmission.
+ *
+ * @retval  true   The frame was added to the transmit queue.
+ * @retval  false  The transmit queue is full or the driver is performing other procedure.
+ */
+bool nrf_802154_core_transmit_enqueue(const uint8_t * p_data, bool cca);
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_ED state.
  *
@@ -167,6 +182,28 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
  */
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+
+/**
+ * @brief Requests the transition to the @ref RADIO_STATE_ED state to measure a channel
+ *        in the background.
+ *
+ * The transition is performed only from the @ref RADIO_STATE_RX state when no frame is being
+ * received. The procedure can be terminated by any request, in which case its termination is not
+ * notified. When the procedure is finished, the result is passed to the background channel scan
+ * module and the driver transitions to the @ref RADIO_STATE_RX state on the channel set in PIB.
+ *
+ * @param[in]  channel  Channel to measure.
+ * @param[in]  time_us  Minimal time of energy detection procedure.
+ *
+ * @retval  true   Entering the energy detection state succeeded.
+ * @retval  false  Entering the energy detection state failed
+ *                 (the driver is not idle listening).
+ */
+bool nrf_802154_core_channel_scan_energy_detection(uint8_t channel, uint32_t time_us);
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CCA state.
  *
@@ -47,6 +47,7 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
 #include "rsch/nrf_802154_rsch.h"
@@ -224,6 +225,11 @@ bool nrf_802154_critical_section_enter(void)
 
     result = critical_section_enter(false);
 
+    if (result)
+    {
+        nrf_802154_stat_crit_sect_enter_record(__builtin_return_address(0));
+    }
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
     return result;
@@ -239,6 +245,8 @@ void nrf_802154_critical_section_forcefully_enter(void)
     assert(critical_section_entered);
     (void)critical_section_entered;
 
+    nrf_802154_stat_crit_sect_enter_record(__builtin_return_address(0));
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -246,6 +254,7 @@ void nrf_802154_critical_section_exit(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_stat_crit_sect_exit_record();
     critical_section_exit();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
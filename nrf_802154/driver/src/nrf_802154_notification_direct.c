@@ -45,6 +45,7 @@
 
 #include "nrf_802154.h"
 #include "nrf_802154_critical_section.h"
+#include "nrf_802154_rx_buffer.h"
 
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
@@ -56,6 +57,8 @@ void nrf_802154_notification_init(void)
 
 void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
+    nrf_802154_rx_buffer_application_pass(p_data);
+
 #if NRF_802154_USE_RAW_API
     nrf_802154_received_raw(p_data, power, lqi);
 #else // NRF_802154_USE_RAW_API
@@ -73,6 +76,8 @@ void nrf_802154_notify_transmitted(const uint8_t * p_frame,
                                    int8_t          power,
                                    uint8_t         lqi)
 {
+    nrf_802154_rx_buffer_application_pass(p_ack);
+
 #if NRF_802154_USE_RAW_API
     nrf_802154_transmitted_raw(p_frame, p_ack, power, lqi);
 #else // NRF_802154_USE_RAW_API
@@ -48,18 +48,47 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_queue.h"
+#include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_egu.h"
+#include "timer/nrf_802154_timer_sched.h"
 
-/** Size of notification queue.
+#if NRF_802154_DELAYED_TRX_ENABLED
+/** Number of delayed operations of one kind that can be scheduled at the same time. */
+#define NTF_DELAYED_OPS_NUM (NRF_802154_DELAYED_TRX_QUEUE_SIZE + 1)
+#else
+#define NTF_DELAYED_OPS_NUM 0
+#endif
+
+/** Number of slots reserved for notifications that complete a request of the higher layer.
  *
- * One slot for each receive buffer, one for transmission, one for busy channel and one for energy
- * detection.
+ * One for the frame being transmitted, one for each frame in the transmit queue, one for each
+ * delayed transmission, one for energy detection and one for CCA. These notifications are never
+ * dropped. The higher layer requests an operation again only after it is notified about the end
+ * of the previous one, so these slots cannot run out.
+ */
+#define NTF_COMPLETIONS_NUM (1 + NRF_802154_TX_QUEUE_SIZE + NTF_DELAYED_OPS_NUM + 2)
+
+/** Number of slots for notifications that are dropped if the notification handler falls behind.
+ *
+ * One for each receive buffer holding a received frame. One for each delayed receive window,
+ * which also covers that many windows of a periodic reception ending before the handler runs.
+ * One for a failed frame reception. The background channel scan stores its results in the
+ * channel map and does not notify the higher layer, so it needs no slots.
+ */
+#define NTF_DROPPABLE_NUM (NRF_802154_RX_BUFFERS + NTF_DELAYED_OPS_NUM + 1)
+
+/** Size of notification queue.
  *
  * One slot is lost due to simplified queue implementation.
  */
-#define NTF_QUEUE_SIZE ((NRF_802154_RX_BUFFERS + 3) + 1)
+#define NTF_QUEUE_SIZE (NTF_COMPLETIONS_NUM + NTF_DROPPABLE_NUM + 1)
+
+#if NTF_QUEUE_SIZE > UINT8_MAX
+#error Too many notifications for the notification queue of the 802.15.4 radio driver.
+#endif
 
 #define NTF_INT        NRF_EGU_INT_TRIGGERED0   ///< Label of notification interrupt.
 #define NTF_TASK       NRF_EGU_TASK_TRIGGER0    ///< Label of notification task.
@@ -81,7 +110,10 @@ typedef enum
 /// Notification data in the notification queue.
 typedef struct
 {
-    nrf_802154_ntf_type_t type; ///< Notification type.
+    nrf_802154_ntf_type_t type;      ///< Notification type.
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    uint32_t              timestamp; ///< Time when the notification was queued.
+#endif
 
     union
     {
@@ -137,6 +169,8 @@ static nrf_802154_queue_t    m_notifications_queue;
 static nrf_802154_ntf_data_t m_notifications_queue_memory[NTF_QUEUE_SIZE];
 
 static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
+static volatile bool                            m_ntf_trigger;     ///< If the current notification starts a new batch.
+static volatile uint8_t                         m_droppable_count; ///< Number of queued notifications that can be dropped.
 
 /**
  * Enter notify block.
@@ -144,32 +178,78 @@ static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
  * This is a helper function used in all notification functions to atomically
  * find an empty slot in the notification queue and allow atomic slot update.
  *
- * @return Pointer to an empty slot in the notification queue.
+ * A notification that can be dropped is dropped and counted if all slots for such notifications
+ * are taken. Slots are reserved for all other notifications, so they are always queued.
+ *
+ * @param[in]  droppable  If the notification can be dropped.
+ *
+ * @return Pointer to an empty slot in the notification queue or NULL if the notification is
+ *         dropped.
  */
-static nrf_802154_ntf_data_t * ntf_enter(void)
+static nrf_802154_ntf_data_t * ntf_enter(bool droppable)
 {
     nrf_802154_mcu_critical_enter(m_mcu_cs);
 
+    if (droppable)
+    {
+        if (m_droppable_count >= NTF_DROPPABLE_NUM)
+        {
+            nrf_802154_mcu_critical_exit(m_mcu_cs);
+
+            nrf_802154_stat_counter_increment(dropped_notifications);
+
+            return NULL;
+        }
+
+        m_droppable_count++;
+    }
+
     assert(!nrf_802154_queue_is_full(&m_notifications_queue));
 
-    return nrf_802154_queue_push_begin(&m_notifications_queue);
+    // The notification handler drains the whole queue. It is enough to trigger it only for
+    // a notification pushed to an empty queue, as any later one is handled in the same run.
+    m_ntf_trigger = nrf_802154_queue_is_empty(&m_notifications_queue);
+
+    nrf_802154_ntf_data_t * p_slot = nrf_802154_queue_push_begin(&m_notifications_queue);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    p_slot->timestamp = nrf_802154_timer_sched_time_get();
+#endif
+
+    return p_slot;
 }
 
 /**
  * Exit notify block.
  *
  * This is a helper function used in all notification functions to end atomic slot update
- * and trigger SWI to process the notification from the slot.
+ * and trigger SWI to process the notification from the slot if needed.
  */
 static void ntf_exit(void)
 {
     nrf_802154_queue_push_commit(&m_notifications_queue);
 
-    nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
+    if (m_ntf_trigger)
+    {
+        nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
+    }
 
     nrf_802154_mcu_critical_exit(m_mcu_cs);
 }
 
+/**
+ * Release the buffer of a received frame whose notification was dropped.
+ *
+ * @param[in]  p_data  Pointer to the receive buffer or NULL.
+ */
+static void ntf_dropped_buffer_release(uint8_t * p_data)
+{
+    if (p_data != NULL)
+    {
+        nrf_802154_rx_buffer_release((rx_buffer_t *)p_data);
+    }
+}
+
 /**
  * @brief Notifies the next higher layer that a frame was received.
  *
@@ -181,7 +261,13 @@ static void ntf_exit(void)
  */
 void swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(true);
+
+    if (p_slot == NULL)
+    {
+        ntf_dropped_buffer_release(p_data);
+        return;
+    }
 
     p_slot->type                 = NTF_TYPE_RECEIVED;
     p_slot->data.received.p_data = p_data;
@@ -198,7 +284,12 @@ void swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
  */
 void swi_notify_receive_failed(nrf_802154_rx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(true);
+
+    if (p_slot == NULL)
+    {
+        return;
+    }
 
     p_slot->type                      = NTF_TYPE_RECEIVE_FAILED;
     p_slot->data.receive_failed.error = error;
@@ -222,7 +313,7 @@ void swi_notify_transmitted(const uint8_t * p_frame,
                             int8_t          power,
                             uint8_t         lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(false);
 
     p_slot->type                     = NTF_TYPE_TRANSMITTED;
     p_slot->data.transmitted.p_frame = p_frame;
@@ -243,7 +334,7 @@ void swi_notify_transmitted(const uint8_t * p_frame,
  */
 void swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(false);
 
     p_slot->type                         = NTF_TYPE_TRANSMIT_FAILED;
     p_slot->data.transmit_failed.p_frame = p_frame;
@@ -260,7 +351,7 @@ void swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t e
  */
 void swi_notify_energy_detected(uint8_t result)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(false);
 
     p_slot->type                        = NTF_TYPE_ENERGY_DETECTED;
     p_slot->data.energy_detected.result = result;
@@ -276,7 +367,7 @@ void swi_notify_energy_detected(uint8_t result)
  */
 void swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(false);
 
     p_slot->type                               = NTF_TYPE_ENERGY_DETECTION_FAILED;
     p_slot->data.energy_detection_failed.error = error;
@@ -293,7 +384,7 @@ void swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
  */
 void swi_notify_cca(bool channel_free)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(false);
 
     p_slot->type            = NTF_TYPE_CCA;
     p_slot->data.cca.result = channel_free;
@@ -310,7 +401,7 @@ void swi_notify_cca(bool channel_free)
  */
 void swi_notify_cca_failed(nrf_802154_cca_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(false);
 
     p_slot->type                  = NTF_TYPE_CCA_FAILED;
     p_slot->data.cca_failed.error = error;
@@ -320,6 +411,8 @@ void swi_notify_cca_failed(nrf_802154_cca_error_t error)
 
 void nrf_802154_notification_init(void)
 {
+    m_droppable_count = 0;
+
     nrf_802154_queue_init(&m_notifications_queue, m_notifications_queue_memory,
                           sizeof(m_notifications_queue_memory),
                           sizeof(m_notifications_queue_memory[0]));
@@ -380,9 +473,14 @@ static void irq_handler_ntf_event(void)
         nrf_802154_ntf_data_t * p_slot =
             (nrf_802154_ntf_data_t *)nrf_802154_queue_pop_begin(&m_notifications_queue);
 
+        nrf_802154_stat_histogram_add(notification_delay,
+                                      nrf_802154_timer_sched_time_get() - p_slot->timestamp);
+
         switch (p_slot->type)
         {
             case NTF_TYPE_RECEIVED:
+                nrf_802154_rx_buffer_application_pass(p_slot->data.received.p_data);
+
 #if NRF_802154_USE_RAW_API
                 nrf_802154_received_raw(p_slot->data.received.p_data,
                                         p_slot->data.received.power,
@@ -401,6 +499,8 @@ static void irq_handler_ntf_event(void)
 
             case NTF_TYPE_TRANSMITTED:
             {
+                nrf_802154_rx_buffer_application_pass(p_slot->data.transmitted.p_ack);
+
 #if NRF_802154_USE_RAW_API
                 nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
                                            p_slot->data.transmitted.p_ack,
@@ -456,7 +556,19 @@ static void irq_handler_ntf_event(void)
                 assert(false);
         }
 
+        bool droppable = (p_slot->type == NTF_TYPE_RECEIVED) ||
+                         (p_slot->type == NTF_TYPE_RECEIVE_FAILED);
+
         nrf_802154_queue_pop_commit(&m_notifications_queue);
+
+        if (droppable)
+        {
+            nrf_802154_mcu_critical_state_t mcu_cs;
+
+            nrf_802154_mcu_critical_enter(mcu_cs);
+            m_droppable_count--;
+            nrf_802154_mcu_critical_exit(mcu_cs);
+        }
     }
 }
 
@@ -106,6 +106,18 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  bool                           immediate,
                                  nrf_802154_notification_func_t notify_function);
 
+/**
+ * @brief Requests adding a frame to the transmit queue of the driver.
+ *
+ * @param[in]  p_data  Pointer to the frame to transmit.
+ * @param[in]  cca     If the driver is to perform the CCA procedure before transmission.
+ *
+ * @retval  true   The frame was added to the transmit queue.
+ * @retval  false  The transmit queue is full or the driver cannot enter the transmit state due to
+ *                 an ongoing operation.
+ */
+bool nrf_802154_request_transmit_enqueue(const uint8_t * p_data, bool cca);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state.
  *
@@ -117,6 +129,22 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
  */
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to measure a channel in the background.
+ *
+ * @param[in]  channel  Channel to measure.
+ * @param[in]  time_us  Requested duration of the energy detection procedure.
+ *
+ * @retval  true   The driver will enter energy detection state.
+ * @retval  false  The driver cannot enter the energy detection state because it is not idle
+ *                 listening.
+ */
+bool nrf_802154_request_channel_scan_energy_detection(uint8_t channel, uint32_t time_us);
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state.
  *
@@ -98,11 +98,24 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                            notify_function)
 }
 
+bool nrf_802154_request_transmit_enqueue(const uint8_t * p_data, bool cca)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_transmit_enqueue, p_data, cca)
+}
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us)
 }
 
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+bool nrf_802154_request_channel_scan_energy_detection(uint8_t channel, uint32_t time_us)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_channel_scan_energy_detection, channel, time_us)
+}
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_cca, term_lvl)
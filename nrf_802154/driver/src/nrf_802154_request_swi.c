@@ -75,7 +75,11 @@ typedef enum
     REQ_TYPE_SLEEP,
     REQ_TYPE_RECEIVE,
     REQ_TYPE_TRANSMIT,
+    REQ_TYPE_TRANSMIT_ENQUEUE,
     REQ_TYPE_ENERGY_DETECTION,
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+    REQ_TYPE_CHANNEL_SCAN_ENERGY_DETECTION,
+#endif
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_MODULATED_CARRIER,
@@ -120,6 +124,13 @@ typedef struct
             bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
 
+        struct
+        {
+            const uint8_t * p_data;   ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+            bool            cca;      ///< If CCA was requested prior to transmission.
+            bool          * p_result; ///< Transmit enqueue request result.
+        } transmit_enqueue;           ///< Transmit enqueue request details.
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -127,6 +138,13 @@ typedef struct
             uint32_t          time_us;  ///< Requested time of energy detection procedure.
         } energy_detection;             ///< Energy detection request details.
 
+        struct
+        {
+            bool   * p_result; ///< Energy detection request result.
+            uint32_t time_us;  ///< Requested time of energy detection procedure.
+            uint8_t  channel;  ///< Channel to measure.
+        } channel_scan_energy_detection; ///< Background channel scan energy detection request details.
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -351,6 +369,26 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
     req_exit();
 }
 
+/**
+ * @brief Requests adding a frame to the transmit queue from the SWI priority.
+ *
+ * @param[in]   p_data    Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                        transmitted.
+ * @param[in]   cca       If the driver should perform the CCA procedure before transmission.
+ * @param[out]  p_result  Result of adding the frame to the transmit queue.
+ */
+static void swi_transmit_enqueue(const uint8_t * p_data, bool cca, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                           = REQ_TYPE_TRANSMIT_ENQUEUE;
+    p_slot->data.transmit_enqueue.p_data   = p_data;
+    p_slot->data.transmit_enqueue.cca      = cca;
+    p_slot->data.transmit_enqueue.p_result = p_result;
+
+    req_exit();
+}
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state from the SWI priority.
  *
@@ -372,6 +410,31 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
     req_exit();
 }
 
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to measure a channel in the background
+ *        from the SWI priority.
+ *
+ * @param[in]   channel   Channel to measure.
+ * @param[in]   time_us   Requested duration of the energy detection procedure.
+ * @param[out]  p_result  Result of entering the energy detection state.
+ */
+static void swi_channel_scan_energy_detection(uint8_t   channel,
+                                              uint32_t  time_us,
+                                              bool    * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                                        = REQ_TYPE_CHANNEL_SCAN_ENERGY_DETECTION;
+    p_slot->data.channel_scan_energy_detection.channel  = channel;
+    p_slot->data.channel_scan_energy_detection.time_us  = time_us;
+    p_slot->data.channel_scan_energy_detection.p_result = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state from the SWI priority.
  *
@@ -572,6 +635,11 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      notify_function)
 }
 
+bool nrf_802154_request_transmit_enqueue(const uint8_t * p_data, bool cca)
+{
+    REQUEST_FUNCTION(nrf_802154_core_transmit_enqueue, swi_transmit_enqueue, p_data, cca)
+}
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                                          uint32_t          time_us)
 {
@@ -581,6 +649,17 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                      time_us)
 }
 
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+bool nrf_802154_request_channel_scan_energy_detection(uint8_t channel, uint32_t time_us)
+{
+    REQUEST_FUNCTION(nrf_802154_core_channel_scan_energy_detection,
+                     swi_channel_scan_energy_detection,
+                     channel,
+                     time_us)
+}
+
+#endif // NRF_802154_CHANNEL_SCAN_ENABLED
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca, swi_cca, term_lvl)
@@ -666,6 +745,12 @@ static void irq_handler_req_event(void)
                                              p_slot->data.transmit.notif_func);
                 break;
 
+            case REQ_TYPE_TRANSMIT_ENQUEUE:
+                *(p_slot->data.transmit_enqueue.p_result) =
+                    nrf_802154_core_transmit_enqueue(p_slot->data.transmit_enqueue.p_data,
+                                                     p_slot->data.transmit_enqueue.cca);
+                break;
+
             case REQ_TYPE_ENERGY_DETECTION:
                 *(p_slot->data.energy_detection.p_result) =
                     nrf_802154_core_energy_detection(
@@ -673,6 +758,15 @@ static void irq_handler_req_event(void)
                         p_slot->data.energy_detection.time_us);
                 break;
 
+#if NRF_802154_CHANNEL_SCAN_ENABLED
+            case REQ_TYPE_CHANNEL_SCAN_ENERGY_DETECTION:
+                *(p_slot->data.channel_scan_energy_detection.p_result) =
+                    nrf_802154_core_channel_scan_energy_detection(
+                        p_slot->data.channel_scan_energy_detection.channel,
+                        p_slot->data.channel_scan_energy_detection.time_us);
+                break;
+#endif
+
             case REQ_TYPE_CCA:
                 *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
                 break;
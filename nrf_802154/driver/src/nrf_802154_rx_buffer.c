@@ -40,33 +40,115 @@
 
 #include "nrf_802154_rx_buffer.h"
 
+#include <assert.h>
 #include <stddef.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_utils.h"
 
 #if NRF_802154_RX_BUFFERS < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
+#if NRF_802154_RX_BUFFERS >= UINT8_MAX
+#error Too many rx buffers in the 802.15.4 radio driver.
+#endif
+
+#define RX_BUFFER_NONE UINT8_MAX ///< Index marking the end of the free list.
+
 rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
 
+static volatile uint8_t m_free_head; ///< Index of the first buffer on the free list.
+static volatile uint8_t m_used;      ///< Number of buffers that are not on the free list.
+
+/**
+ * @brief Adds a value to the number of used buffers.
+ *
+ * @param[in]  delta  Value to add.
+ *
+ * @returns  Number of used buffers after the update.
+ */
+static uint8_t used_update(int8_t delta)
+{
+    uint8_t used;
+
+    do
+    {
+        used = __LDREXB(&m_used) + delta;
+    }
+    while (__STREXB(used, &m_used));
+
+    return used;
+}
+
 void nrf_802154_rx_buffer_init(void)
 {
     for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
     {
-        nrf_802154_rx_buffers[i].free = true;
+        nrf_802154_rx_buffers[i].owner     = RX_BUFFER_OWNER_NONE;
+        nrf_802154_rx_buffers[i].next_free =
+            (i + 1 < NRF_802154_RX_BUFFERS) ? (uint8_t)(i + 1) : RX_BUFFER_NONE;
     }
+
+    m_free_head = 0;
+    m_used      = 0;
 }
 
-rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
+rx_buffer_t * nrf_802154_rx_buffer_alloc(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    uint8_t head;
+
+    // The exclusive access is cleared on exception entry and return, so the next index read here
+    // is still valid if storing the new head succeeds.
+    do
     {
-        if (nrf_802154_rx_buffers[i].free)
+        head = __LDREXB(&m_free_head);
+
+        if (head == RX_BUFFER_NONE)
         {
-            return &nrf_802154_rx_buffers[i];
+            __CLREX();
+            return NULL;
         }
     }
+    while (__STREXB(nrf_802154_rx_buffers[head].next_free, &m_free_head));
 
-    return NULL;
+    rx_buffer_t * p_buffer = &nrf_802154_rx_buffers[head];
+
+    assert(p_buffer->owner == RX_BUFFER_OWNER_NONE);
+    p_buffer->owner = RX_BUFFER_OWNER_DRIVER;
+
+    nrf_802154_stat_rx_buffers_used_update(used_update(1));
+
+    return p_buffer;
+}
+
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer)
+{
+    uint8_t idx = (uint8_t)(p_buffer - nrf_802154_rx_buffers);
+
+    assert(idx < NRF_802154_RX_BUFFERS);
+    assert(p_buffer->owner != RX_BUFFER_OWNER_NONE);
+
+    p_buffer->owner = RX_BUFFER_OWNER_NONE;
+
+    // Decrease the number of used buffers first, so that it never exceeds the actual one.
+    nrf_802154_stat_rx_buffers_used_update(used_update(-1));
+
+    do
+    {
+        p_buffer->next_free = __LDREXB(&m_free_head);
+    }
+    while (__STREXB(idx, &m_free_head));
+}
+
+void nrf_802154_rx_buffer_application_pass(uint8_t * p_data)
+{
+    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+
+    if (p_buffer != NULL)
+    {
+        assert(p_buffer->owner == RX_BUFFER_OWNER_NOTIFICATION);
+        p_buffer->owner = RX_BUFFER_OWNER_APPLICATION;
+    }
 }
@@ -49,13 +49,25 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Owners of a receive buffer.
+ */
+typedef enum
+{
+    RX_BUFFER_OWNER_NONE,         ///< The buffer is free.
+    RX_BUFFER_OWNER_DRIVER,       ///< The buffer is used by the driver to receive a frame.
+    RX_BUFFER_OWNER_NOTIFICATION, ///< The buffer contains a frame waiting to be notified.
+    RX_BUFFER_OWNER_APPLICATION,  ///< The buffer contains a frame passed to the higher layer.
+} rx_buffer_owner_t;
+
 /**
  * @brief Structure that contains the received frame.
  */
 typedef struct
 {
-    uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
+    uint8_t                    data[MAX_PACKET_SIZE + 1];
+    volatile rx_buffer_owner_t owner;     // Module that currently owns this buffer.
+    uint8_t                    next_free; // Index of the next buffer on the free list.
 } rx_buffer_t;
 
 /**
@@ -73,11 +85,28 @@ extern rx_buffer_t nrf_802154_rx_buffers[];
 void nrf_802154_rx_buffer_init(void);
 
 /**
- * @brief Gets a free buffer to receive a frame.
+ * @brief Takes a free buffer to receive a frame.
+ *
+ * The returned buffer is owned by the driver until it is released by a call to
+ * @ref nrf_802154_rx_buffer_release.
  *
  * @returns  Pointer to a free buffer, or NULL if no free buffer is available.
  */
-rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
+rx_buffer_t * nrf_802154_rx_buffer_alloc(void);
+
+/**
+ * @brief Returns a buffer to the pool of free buffers.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer to be released.
+ */
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Records that a buffer containing a received frame is passed to the higher layer.
+ *
+ * @param[in]  p_data  Pointer to the PHR of the frame, or NULL if there is no frame.
+ */
+void nrf_802154_rx_buffer_application_pass(uint8_t * p_data);
 
 #ifdef __cplusplus
 }
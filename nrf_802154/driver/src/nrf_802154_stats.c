@@ -39,6 +39,7 @@
 
 #define NUMBER_OF_STAT_COUNTERS (sizeof(nrf_802154_stat_counters_t) / sizeof(uint32_t))
 #define NUMBER_OF_STAT_TOTALS   (sizeof(nrf_802154_stat_totals_t) / sizeof(uint64_t))
+#define NUMBER_OF_STAT_BUCKETS  (sizeof(nrf_802154_stat_histograms_t) / sizeof(uint32_t))
 
 /**@brief Structure holding statistics about the Radio Driver behavior. */
 volatile nrf_802154_stats_t g_nrf_802154_stats;
@@ -46,6 +47,170 @@ volatile nrf_802154_stats_t g_nrf_802154_stats;
 /**@brief Structure holding total times spent in certain states. */
 volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 
+/**@brief Structure holding histograms of time intervals of certain operations. */
+volatile nrf_802154_stat_histograms_t g_nrf_802154_stat_histograms;
+
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_SITES >= UINT8_MAX
+#error NRF_802154_STATS_CRIT_SECT_PROFILER_SITES must be lower than 255
+#endif
+
+#ifndef NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_GET
+#define NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_GET() (DWT->CYCCNT)
+#define NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_DWT   1
+#endif
+
+#define CRIT_SECT_SITE_NONE UINT8_MAX ///< Critical section is not attributed to any call site
+
+/**@brief Kinds of profiled critical sections. Each kind is nested independently. */
+typedef enum
+{
+    CRIT_SECT_KIND_MCU,    ///< MCU critical section
+    CRIT_SECT_KIND_DRIVER, ///< Driver critical section
+    CRIT_SECT_KIND_NUM,
+} crit_sect_kind_t;
+
+/**@brief Critical section that is currently held. */
+typedef struct
+{
+    uint32_t start_time; ///< Timestamp of the moment the critical section was entered
+    uint8_t  site_idx;   ///< Index of the call site in @ref m_crit_sect_sites
+} crit_sect_frame_t;
+
+/**@brief Stack of currently held critical sections of one kind. */
+typedef struct
+{
+    crit_sect_frame_t frames[NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH];
+    uint8_t           depth; ///< Current nesting level, including levels that are not measured
+} crit_sect_stack_t;
+
+static nrf_802154_stat_crit_sect_site_t m_crit_sect_sites[NRF_802154_STATS_CRIT_SECT_PROFILER_SITES];
+static crit_sect_stack_t                m_crit_sect_stacks[CRIT_SECT_KIND_NUM];
+
+/**@brief Find the call site in the sites table, adding it if it is not there yet.
+ *
+ * @note This function must be called with interrupts disabled.
+ *
+ * @param[in]  p_site  Address of the code that entered the critical section.
+ *
+ * @returns  Index of the call site or @ref CRIT_SECT_SITE_NONE if the table is full.
+ */
+static uint8_t crit_sect_site_find(const void * p_site)
+{
+    uint32_t idx = ((uintptr_t)p_site >> 1) % NRF_802154_STATS_CRIT_SECT_PROFILER_SITES;
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_CRIT_SECT_PROFILER_SITES; i++)
+    {
+        if (m_crit_sect_sites[idx].p_site == p_site)
+        {
+            return (uint8_t)idx;
+        }
+
+        if (m_crit_sect_sites[idx].p_site == NULL)
+        {
+            m_crit_sect_sites[idx].p_site = p_site;
+            return (uint8_t)idx;
+        }
+
+        idx = (idx + 1U) % NRF_802154_STATS_CRIT_SECT_PROFILER_SITES;
+    }
+
+    return CRIT_SECT_SITE_NONE;
+}
+
+static void crit_sect_entered(crit_sect_kind_t kind, const void * p_site)
+{
+    crit_sect_stack_t * p_stack = &m_crit_sect_stacks[kind];
+    uint32_t            primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    if (p_stack->depth < NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH)
+    {
+        crit_sect_frame_t * p_frame = &p_stack->frames[p_stack->depth];
+
+        p_frame->site_idx = crit_sect_site_find(p_site);
+
+        if ((p_frame->site_idx != CRIT_SECT_SITE_NONE) &&
+            (m_crit_sect_sites[p_frame->site_idx].max_depth <= p_stack->depth))
+        {
+            m_crit_sect_sites[p_frame->site_idx].max_depth = p_stack->depth + 1U;
+        }
+
+        p_frame->start_time = NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_GET();
+    }
+
+    assert(p_stack->depth < UINT8_MAX);
+    p_stack->depth++;
+
+    __set_PRIMASK(primask);
+}
+
+static void crit_sect_exiting(crit_sect_kind_t kind)
+{
+    uint32_t            end_time = NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_GET();
+    crit_sect_stack_t * p_stack  = &m_crit_sect_stacks[kind];
+    uint32_t            primask  = __get_PRIMASK();
+
+    __disable_irq();
+
+    assert(p_stack->depth > 0U);
+    p_stack->depth--;
+
+    if (p_stack->depth < NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH)
+    {
+        crit_sect_frame_t * p_frame = &p_stack->frames[p_stack->depth];
+
+        if (p_frame->site_idx != CRIT_SECT_SITE_NONE)
+        {
+            nrf_802154_stat_crit_sect_site_t * p_site    = &m_crit_sect_sites[p_frame->site_idx];
+            uint32_t                           hold_time = end_time - p_frame->start_time;
+
+            p_site->count++;
+            p_site->total_time += hold_time;
+
+            if (p_site->max_time < hold_time)
+            {
+                p_site->max_time = hold_time;
+            }
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+__attribute__((noinline)) void nrf_802154_stat_mcu_crit_sect_entered(void)
+{
+    crit_sect_entered(CRIT_SECT_KIND_MCU, __builtin_return_address(0));
+}
+
+void nrf_802154_stat_mcu_crit_sect_exiting(void)
+{
+    crit_sect_exiting(CRIT_SECT_KIND_MCU);
+}
+
+void nrf_802154_stat_crit_sect_entered(const void * p_site)
+{
+    crit_sect_entered(CRIT_SECT_KIND_DRIVER, p_site);
+}
+
+void nrf_802154_stat_crit_sect_exiting(void)
+{
+    crit_sect_exiting(CRIT_SECT_KIND_DRIVER);
+}
+
+#endif // NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+
+void nrf_802154_stats_init(void)
+{
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED && \
+    defined(NRF_802154_STATS_CRIT_SECT_PROFILER_TIMESTAMP_DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
 void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
 {
     *p_stats = g_nrf_802154_stats;
@@ -109,6 +274,101 @@ void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals)
     }
 }
 
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_histograms;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_histograms);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_BUCKETS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_histograms_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_histograms);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_BUCKETS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_histogram_update(volatile nrf_802154_stat_histogram_t * p_histogram,
+                                      uint32_t                              value)
+{
+    uint32_t            bucket = (value == 0U) ? 0U : (32U - __CLZ(value));
+    volatile uint32_t * p_bucket;
+    uint32_t            count;
+
+    if (bucket >= NRF_802154_STAT_HISTOGRAM_BUCKETS)
+    {
+        bucket = NRF_802154_STAT_HISTOGRAM_BUCKETS - 1U;
+    }
+
+    p_bucket = &p_histogram->buckets[bucket];
+
+    do
+    {
+        count = __LDREXW(p_bucket) + 1U;
+    }
+    while (__STREXW(count, p_bucket));
+}
+
+uint32_t nrf_802154_stat_crit_sect_sites_get(nrf_802154_stat_crit_sect_site_t * p_sites,
+                                             uint32_t                           max_sites)
+{
+    uint32_t count = 0U;
+
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+    for (uint32_t i = 0; (i < NRF_802154_STATS_CRIT_SECT_PROFILER_SITES) && (count < max_sites);
+         i++)
+    {
+        uint32_t primask = __get_PRIMASK();
+
+        __disable_irq();
+
+        if (m_crit_sect_sites[i].p_site != NULL)
+        {
+            p_sites[count++] = m_crit_sect_sites[i];
+        }
+
+        __set_PRIMASK(primask);
+    }
+#else
+    (void)p_sites;
+    (void)max_sites;
+#endif
+
+    return count;
+}
+
+void nrf_802154_stat_crit_sect_sites_reset(void)
+{
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_CRIT_SECT_PROFILER_SITES; i++)
+    {
+        m_crit_sect_sites[i] = (nrf_802154_stat_crit_sect_site_t){0};
+    }
+
+    // Critical sections held now are no longer attributed to the removed call sites.
+    for (uint32_t kind = 0; kind < CRIT_SECT_KIND_NUM; kind++)
+    {
+        for (uint32_t i = 0; i < NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH; i++)
+        {
+            m_crit_sect_stacks[kind].frames[i].site_idx = CRIT_SECT_SITE_NONE;
+        }
+    }
+
+    __set_PRIMASK(primask);
+#endif
+}
+
 __WEAK void nrf_802154_stat_totals_get_notify(void)
 {
     /* Implementation here is intentionally empty.
@@ -35,6 +35,7 @@
 #ifndef NRF_802154_STATS_H_
 #define NRF_802154_STATS_H_
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 #include "nrf_802154_utils.h"
 
@@ -44,6 +45,8 @@ extern volatile nrf_802154_stats_t g_nrf_802154_stats;
 
 extern volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 
+extern volatile nrf_802154_stat_histograms_t g_nrf_802154_stat_histograms;
+
 /**@brief Increment one of the @ref nrf_802154_stat_counters_t fields.
  *
  * @param field_name    Identifier of struct member to increment
@@ -86,8 +89,77 @@ extern volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
     }                                                       \
     while (0)
 
+/**@brief Update the number of receive buffers in use and its high-water mark.
+ *
+ * @param count         Number of receive buffers in use
+ */
+#define nrf_802154_stat_rx_buffers_used_update(count)                   \
+    do                                                                  \
+    {                                                                   \
+        nrf_802154_mcu_critical_state_t mcu_cs;                         \
+        uint32_t                        used_value = (count);           \
+                                                                        \
+        nrf_802154_mcu_critical_enter(mcu_cs);                          \
+        g_nrf_802154_stats.rx_buffers.used = used_value;                \
+        if (g_nrf_802154_stats.rx_buffers.high_water_mark < used_value) \
+        {                                                               \
+            g_nrf_802154_stats.rx_buffers.high_water_mark = used_value; \
+        }                                                               \
+        nrf_802154_mcu_critical_exit(mcu_cs);                           \
+    }                                                                   \
+    while (0)
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+/**@brief Add a time interval to one of the @ref nrf_802154_stat_histograms_t fields.
+ *
+ * @param field_name    Identifier of struct member to update
+ * @param value         Time interval in microseconds
+ */
+#define nrf_802154_stat_histogram_add(field_name, value) \
+    nrf_802154_stat_histogram_update(&g_nrf_802154_stat_histograms.field_name, (value))
+#else
+#define nrf_802154_stat_histogram_add(field_name, value) \
+    do                                                   \
+    {                                                    \
+    }                                                    \
+    while (0)
+#endif
+
+/**@brief Add a time interval to a histogram without locking.
+ *
+ * @param p_histogram   Histogram to update
+ * @param value         Time interval in microseconds
+ */
+void nrf_802154_stat_histogram_update(volatile nrf_802154_stat_histogram_t * p_histogram,
+                                      uint32_t                              value);
+
 extern void nrf_802154_stat_totals_get_notify(void);
 
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+/**@brief Records that a driver critical section was entered.
+ *
+ * @param p_site        Address of the code that entered the critical section
+ */
+#define nrf_802154_stat_crit_sect_enter_record(p_site) \
+    nrf_802154_stat_crit_sect_entered(p_site)
+
+/**@brief Records that a driver critical section is about to be exited. */
+#define nrf_802154_stat_crit_sect_exit_record() \
+    nrf_802154_stat_crit_sect_exiting()
+#else
+#define nrf_802154_stat_crit_sect_enter_record(p_site) \
+    do                                                 \
+    {                                                  \
+    }                                                  \
+    while (0)
+
+#define nrf_802154_stat_crit_sect_exit_record() \
+    do                                          \
+    {                                           \
+    }                                           \
+    while (0)
+#endif
+
 #else // !defined(UNIT_TEST)
 
 #define nrf_802154_stat_counter_increment(field_name) \
@@ -100,11 +172,47 @@ extern void nrf_802154_stat_totals_get_notify(void);
 #define nrf_802154_stat_timestamp_read(field_name) \
     nrf_802154_stat_timestamp_read_func(offsetof(nrf_802154_stat_timestamps_t, field_name))
 
+#define nrf_802154_stat_rx_buffers_used_update(count) \
+    nrf_802154_stat_rx_buffers_used_update_func(count)
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+#define nrf_802154_stat_histogram_add(field_name, value)                                  \
+    nrf_802154_stat_histogram_add_func(offsetof(nrf_802154_stat_histograms_t, field_name), \
+                                       (value))
+#else
+// Values passed by callers are only available when histograms are enabled.
+#define nrf_802154_stat_histogram_add(field_name, value) \
+    do                                                   \
+    {                                                    \
+    }                                                    \
+    while (0)
+#endif
+
 // Functions for which mocks are generated.
 void nrf_802154_stat_counter_increment_func(size_t field_offset);
 void nrf_802154_stat_timestamp_write_func(size_t field_offset, uint32_t value);
 uint32_t nrf_802154_stat_timestamp_read_func(size_t field_offset);
+void nrf_802154_stat_rx_buffers_used_update_func(uint32_t count);
+void nrf_802154_stat_histogram_add_func(size_t field_offset, uint32_t value);
+
+#define nrf_802154_stat_crit_sect_enter_record(p_site) \
+    nrf_802154_stat_crit_sect_entered(p_site)
+
+#define nrf_802154_stat_crit_sect_exit_record() \
+    nrf_802154_stat_crit_sect_exiting()
 
 #endif // !defined(UNIT_TEST)
 
+/**@brief Records that a driver critical section was entered.
+ *
+ * @param p_site        Address of the code that entered the critical section
+ */
+void nrf_802154_stat_crit_sect_entered(const void * p_site);
+
+/**@brief Records that a driver critical section is about to be exited. */
+void nrf_802154_stat_crit_sect_exiting(void);
+
+/**@brief Initializes the statistics module. */
+void nrf_802154_stats_init(void);
+
 #endif /* NRF_802154_STATS_H_ */
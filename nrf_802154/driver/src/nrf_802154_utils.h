@@ -38,6 +38,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include "nrf.h"
+#include "nrf_802154_config.h"
 #include <nrfx.h>
 #include <soc/nrfx_coredep.h>
 
@@ -92,6 +93,30 @@
  */
 typedef uint32_t nrf_802154_mcu_critical_state_t;
 
+#if NRF_802154_STATS_CRIT_SECT_PROFILER_ENABLED
+
+/**@brief Records that an MCU critical section was entered by the caller of this function. */
+void nrf_802154_stat_mcu_crit_sect_entered(void);
+
+/**@brief Records that an MCU critical section is about to be exited. */
+void nrf_802154_stat_mcu_crit_sect_exiting(void);
+
+#else
+
+#define nrf_802154_stat_mcu_crit_sect_entered() \
+    do                                          \
+    {                                           \
+    }                                           \
+    while (0)
+
+#define nrf_802154_stat_mcu_crit_sect_exiting() \
+    do                                          \
+    {                                           \
+    }                                           \
+    while (0)
+
+#endif
+
 /**@brief Enters critical section on MCU level.
  *
  * Use @ref nrf_802154_mcu_critical_exit complementary. Consider following code:
@@ -110,6 +135,7 @@ typedef uint32_t nrf_802154_mcu_critical_state_t;
     {                                                     \
         (mcu_critical_state) = __get_PRIMASK();           \
         __disable_irq();                                  \
+        nrf_802154_stat_mcu_crit_sect_entered();          \
     }                                                     \
     while (0)
 
@@ -124,6 +150,7 @@ typedef uint32_t nrf_802154_mcu_critical_state_t;
 #define nrf_802154_mcu_critical_exit(mcu_critical_state) \
     do                                                   \
     {                                                    \
+        nrf_802154_stat_mcu_crit_sect_exiting();         \
         __set_PRIMASK(mcu_critical_state);               \
     }                                                    \
     while (0)
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @file
+ *   This file implements the AES abstraction layer.
+ *
+ * This AES abstraction layer uses the ECB peripheral, which encrypts a block much faster than
+ * the software implementation. The ECB peripheral must be reserved for the 802.15.4 driver.
+ * In particular, it must not be used by a Bluetooth controller running in the multiprotocol mode.
+ * The software implementation in nrf_802154_aes_sw.c must be used in such configurations.
+ *
+ */
+
+#include "platform/nrf_802154_aes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hal/nrf_ecb.h"
+#include "nrf_802154_utils.h"
+
+/**@brief Data structure read and written by the ECB peripheral. */
+typedef struct
+{
+    uint8_t key[NRF_802154_AES_KEY_SIZE];          ///< Key.
+    uint8_t cleartext[NRF_802154_AES_BLOCK_SIZE];  ///< Block to encrypt.
+    uint8_t ciphertext[NRF_802154_AES_BLOCK_SIZE]; ///< Encrypted block.
+} ecb_data_t;
+
+static ecb_data_t m_ecb_data; ///< Data of the current ECB operation.
+
+void nrf_802154_aes_init(void)
+{
+    nrf_ecb_data_pointer_set(NRF_ECB, &m_ecb_data);
+}
+
+void nrf_802154_aes_deinit(void)
+{
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STOPECB);
+}
+
+void nrf_802154_aes_ecb_encrypt(const uint8_t * p_key,
+                                const uint8_t * p_cleartext,
+                                uint8_t       * p_ciphertext)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            done = false;
+
+    // The ECB data structure is shared, so a block is encrypted as a whole before
+    // an interrupt can encrypt another one.
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memcpy(m_ecb_data.key, p_key, sizeof(m_ecb_data.key));
+    memcpy(m_ecb_data.cleartext, p_cleartext, sizeof(m_ecb_data.cleartext));
+    nrf_ecb_data_pointer_set(NRF_ECB, &m_ecb_data);
+
+    while (!done)
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+
+        while (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB) &&
+               !nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+        {
+            // Intentionally empty
+        }
+
+        // The operation is aborted when the CCM or AAR peripheral takes the AES core,
+        // so it is started again.
+        done = nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    }
+
+    memcpy(p_ciphertext, m_ecb_data.ciphertext, sizeof(m_ecb_data.ciphertext));
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
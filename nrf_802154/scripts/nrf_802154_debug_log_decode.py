@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Decoder of the nRF 802.15.4 debug log.
+
+Decodes log words captured from g_nrf_802154_sl_log_buffer or streamed with
+nrf_802154_sl_log_drain() into readable lines. The input is a binary file of
+little-endian 32-bit words in the order they were recorded. Names of modules
+and events are taken from nrf_802154_debug_log_codes.h in the driver sources.
+Function entries and exits record the low 20 bits of the address of __func__,
+which is resolved to the function name when the application ELF file is given.
+
+With timestamps, entries and exits are paired to report the number of calls and
+the total, self and maximum time of each function, or to write the call stacks
+in the folded format of flamegraph.pl. A function interrupted by an IRQ handler
+that is also logged has the handler counted as its callee.
+
+Examples:
+  nrf_802154_debug_log_decode.py log.bin --elf zephyr.elf --timestamps \\
+      --timestamp-hz 64000000
+  nrf_802154_debug_log_decode.py log.bin --elf zephyr.elf --timestamps \\
+      --folded log.folded && flamegraph.pl log.folded > log.svg
+"""
+
+import argparse
+import collections
+import os
+import re
+import struct
+import sys
+
+LOG_TYPE_BITPOS = 28
+MODULE_ID_BITPOS = 22
+EVENT_ID_BITPOS = 16
+
+LOG_TYPE_FUNCTION_ENTER = 1
+LOG_TYPE_FUNCTION_EXIT = 2
+LOG_TYPE_LOCAL_EVENT = 3
+LOG_TYPE_GLOBAL_EVENT = 4
+
+FUNC_ADDR_MASK = 0x000FFFFF
+
+DEFAULT_CODES = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             '..', 'driver', 'src', 'nrf_802154_debug_log_codes.h')
+
+
+class LogCodes:
+    """Names of modules and events parsed from the log codes headers."""
+
+    def __init__(self, paths):
+        self.modules = {}
+        self.local_events = {}
+        self.global_events = {}
+
+        for path in paths:
+            with open(path) as f:
+                self._parse(f.read())
+
+    def _parse(self, text):
+        for name, value in re.findall(
+                r'NRF_802154_(?:DRV|MPSL|SL)_MODULE_ID_(\w+)\s*=\s*(\d+)U?', text):
+            self.modules[int(value)] = name
+
+        for module, event, value in re.findall(
+                r'NRF_802154_LOG_L_EVENT_DEFINE\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\d+)', text):
+            self.local_events[(module, int(value))] = event
+
+        for name, value in re.findall(
+                r'NRF_802154_LOG_GLOBAL_EVENT_ID_(\w+)\s*=\s*(\d+)U?', text):
+            self.global_events[int(value)] = name
+
+    def module(self, module_id):
+        return self.modules.get(module_id, 'MODULE_{}'.format(module_id))
+
+
+class ElfStrings:
+    """Reads NUL-terminated strings from the allocated sections of an ELF32 file."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError('{} is not a little-endian ELF32 file'.format(path))
+
+        shoff, = struct.unpack_from('<I', self.data, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', self.data, 0x2e)
+
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                '<IIIIII', self.data, shoff + i * shentsize)
+            # Allocated sections with contents in the file.
+            if (flags & 0x2) and sh_type != 8 and size > 0:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr_low):
+        for addr, offset, size in self.sections:
+            candidate = (addr & ~FUNC_ADDR_MASK) | addr_low
+            if addr <= candidate < addr + size:
+                start = offset + candidate - addr
+                end = self.data.find(b'\0', start, offset + size)
+                if end > start:
+                    return self.data[start:end].decode('ascii', 'replace')
+        return None
+
+
+class CallTimings:
+    """Timings of functions from pairs of entry and exit records."""
+
+    def __init__(self):
+        self.stack = []
+        self.functions = collections.OrderedDict()
+        self.folded = collections.OrderedDict()
+
+    def enter(self, func, time):
+        # Each frame holds the function, its entry time and the time spent in its callees.
+        self.stack.append([func, time, 0])
+
+    def exit(self, func, time):
+        # The entry of a function called before the log starts was not recorded.
+        if func not in [frame[0] for frame in self.stack]:
+            return
+
+        # Frames above the function lost their exit records, they end with it.
+        while self.stack[-1][0] != func:
+            self.stack.pop()
+
+        stack = [frame[0] for frame in self.stack]
+        _, start, callees = self.stack.pop()
+        total = time - start
+        own = total - callees
+
+        calls, func_total, func_own, func_max = self.functions.get(func, (0, 0, 0, 0))
+        self.functions[func] = (calls + 1, func_total + total, func_own + own,
+                                max(func_max, total))
+
+        key = ';'.join(stack)
+        self.folded[key] = self.folded.get(key, 0) + own
+
+        if self.stack:
+            self.stack[-1][2] += total
+
+    def print_table(self, scale, unit):
+        print('{:<40} {:>8} {:>14} {:>14} {:>14}'.format(
+            'function', 'calls', 'total ' + unit, 'self ' + unit, 'max ' + unit))
+
+        # Ticks are integers, microseconds are printed with a nanosecond resolution.
+        precision = 0 if scale == 1 else 3
+        row = '{{:<40}} {{:>8}} {{:>14.{0}f}} {{:>14.{0}f}} {{:>14.{0}f}}'.format(precision)
+
+        for func, (calls, total, own, longest) in sorted(
+                self.functions.items(), key=lambda item: item[1][1], reverse=True):
+            print(row.format(func, calls, total * scale, own * scale, longest * scale))
+
+    def write_folded(self, f):
+        for stack, own in self.folded.items():
+            f.write('{} {}\n'.format(stack, own))
+
+
+def function_name(word, elf):
+    addr = word & FUNC_ADDR_MASK
+    func = elf.string(addr) if elf is not None else None
+    return func if func is not None else '0x{:05x}'.format(addr)
+
+
+def decode_word(word, codes, elf):
+    log_type = word >> LOG_TYPE_BITPOS
+    module = codes.module((word >> MODULE_ID_BITPOS) & 0x3f)
+
+    if log_type in (LOG_TYPE_FUNCTION_ENTER, LOG_TYPE_FUNCTION_EXIT):
+        arrow = '->' if log_type == LOG_TYPE_FUNCTION_ENTER else '<-'
+        return '{:<16} {} {}'.format(module, arrow, function_name(word, elf))
+
+    event_id = (word >> EVENT_ID_BITPOS) & 0x3f
+    param = word & 0xffff
+
+    if log_type == LOG_TYPE_LOCAL_EVENT:
+        event = codes.local_events.get((module, event_id), 'EVENT_{}'.format(event_id))
+        return '{:<16} {}({})'.format(module, event, param)
+
+    if log_type == LOG_TYPE_GLOBAL_EVENT:
+        event = codes.global_events.get(event_id, 'GLOBAL_EVENT_{}'.format(event_id))
+        return '{:<16} global {}({})'.format(module, event, param)
+
+    return 'unknown word 0x{:08x}'.format(word)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('log', help='binary file of little-endian log words')
+    parser.add_argument('--elf', help='application ELF file to resolve function names')
+    parser.add_argument('--codes', action='append', default=[],
+                        help='additional headers with log codes, can be repeated')
+    parser.add_argument('--timestamps', action='store_true',
+                        help='each record is followed by a timestamp word, '
+                             'see NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED')
+    parser.add_argument('--timestamp-hz', type=float,
+                        help='frequency of the timestamps, to print them as '
+                             'microseconds relative to the first record')
+    parser.add_argument('--timings', action='store_true',
+                        help='print the timings of the functions instead of '
+                             'the records, requires --timestamps')
+    parser.add_argument('--folded', metavar='FILE',
+                        help='write the self time of each call stack in '
+                             'timestamp ticks for flamegraph.pl, requires '
+                             '--timestamps')
+    args = parser.parse_args()
+
+    if (args.timings or args.folded) and not args.timestamps:
+        parser.error('--timings and --folded require --timestamps')
+
+    codes = LogCodes([DEFAULT_CODES] + args.codes)
+    elf = ElfStrings(args.elf) if args.elf else None
+
+    with open(args.log, 'rb') as f:
+        data = f.read()
+
+    record_len = 2 if args.timestamps else 1
+    words = struct.unpack('<{}I'.format(len(data) // 4), data[:len(data) // 4 * 4])
+    prev_ts = None
+    elapsed = 0
+    timings = CallTimings()
+
+    for i in range(0, len(words) - record_len + 1, record_len):
+        word = words[i]
+
+        # Zero words are empty entries of a log buffer that did not wrap yet.
+        if word == 0:
+            continue
+
+        if args.timestamps:
+            ts = words[i + 1]
+            # Timestamps are 32-bit free-running counters, so accumulate the deltas.
+            if prev_ts is not None:
+                elapsed += (ts - prev_ts) & 0xffffffff
+            prev_ts = ts
+
+            log_type = word >> LOG_TYPE_BITPOS
+            if log_type == LOG_TYPE_FUNCTION_ENTER:
+                timings.enter(function_name(word, elf), elapsed)
+            elif log_type == LOG_TYPE_FUNCTION_EXIT:
+                timings.exit(function_name(word, elf), elapsed)
+
+        if args.timings:
+            continue
+
+        line = decode_word(word, codes, elf)
+
+        if args.timestamps:
+            if args.timestamp_hz:
+                line = '{:>14.3f} us  {}'.format(elapsed * 1e6 / args.timestamp_hz, line)
+            else:
+                line = '{:>10}  {}'.format(ts, line)
+
+        print(line)
+
+    if args.timings:
+        if args.timestamp_hz:
+            timings.print_table(1e6 / args.timestamp_hz, '[us]')
+        else:
+            timings.print_table(1, '[ticks]')
+
+    if args.folded:
+        with open(args.folded, 'w') as f:
+            timings.write_folded(f)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
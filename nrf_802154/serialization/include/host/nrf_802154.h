@@ -141,6 +141,87 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
  */
 void nrf_802154_pending_bit_for_addr_reset(bool extended);
 
+/**
+ * @brief Adds addresses of peer nodes to the pending bit list in a single operation.
+ *
+ * This function is equivalent to calling @ref nrf_802154_pending_bit_for_addr_set for every
+ * address in @p p_addrs, but updates the list at once. If the addresses are sorted in strictly
+ * ascending order of their numeric value, they are merged into the list in a single pass, and the
+ * list is left unmodified if the result does not fit.
+ *
+ * A list that does not fit in a single serialization frame is sent in several parts. In that case,
+ * the function checks up front that the whole list fits, using
+ * @ref nrf_802154_pending_bit_for_addr_list_capacity_get, and returns false without modifying the
+ * list if it does not. The check is conservative: addresses that are already on the list are
+ * counted as new ones.
+ *
+ * The pending bit list works differently, depending on the upper layer for which the source
+ * address matching method is selected:
+ *   - For Thread, @ref NRF_802154_SRC_ADDR_MATCH_THREAD
+ *   - For Zigbee, @ref NRF_802154_SRC_ADDR_MATCH_ZIGBEE
+ *   - For Standard-compliant, @ref NRF_802154_SRC_ADDR_MATCH_ALWAYS_1
+ * For more information, see @ref nrf_802154_src_addr_match_t.
+ *
+ * The method can be set during initialization phase by calling @ref nrf_802154_src_matching_method.
+ *
+ * @param[in]  p_addrs    Array of bytes containing consecutive addresses of the nodes
+ *                        (little-endian).
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]  replace    If all addresses of a given type are to be removed from the list before
+ *                        adding @p p_addrs.
+ *
+ * @retval True   All addresses are successfully added to the list.
+ * @retval False  Not enough memory to store all addresses in the list.
+ */
+bool nrf_802154_pending_bit_for_addr_list_set(const uint8_t * p_addrs,
+                                              uint32_t        num_addrs,
+                                              bool            extended,
+                                              bool            replace);
+
+/**
+ * @brief Gets the number of addresses that are guaranteed to fit in the pending bit list.
+ *
+ * A call to @ref nrf_802154_pending_bit_for_addr_list_set with the same @p extended and
+ * @p replace arguments succeeds for any list of at most this many addresses, provided that the
+ * pending bit list is not modified in between.
+ *
+ * @param[in]  extended  If the capacity for extended MAC addresses or short MAC addresses is
+ *                       requested.
+ * @param[in]  replace   If the addresses are to replace all addresses of a given type.
+ *
+ * @returns  Number of addresses that can be added to the list.
+ */
+uint32_t nrf_802154_pending_bit_for_addr_list_capacity_get(bool extended, bool replace);
+
+/**
+ * @brief Removes addresses of peer nodes from the pending bit list in a single operation.
+ *
+ * This function is equivalent to calling @ref nrf_802154_pending_bit_for_addr_clear for every
+ * address in @p p_addrs. If the addresses are sorted in strictly ascending order of their numeric
+ * value, they are removed from the list in a single pass.
+ *
+ * The pending bit list works differently, depending on the upper layer for which the source
+ * address matching method is selected:
+ *   - For Thread, @ref NRF_802154_SRC_ADDR_MATCH_THREAD
+ *   - For Zigbee, @ref NRF_802154_SRC_ADDR_MATCH_ZIGBEE
+ *   - For Standard-compliant, @ref NRF_802154_SRC_ADDR_MATCH_ALWAYS_1
+ * For more information, see @ref nrf_802154_src_addr_match_t.
+ *
+ * The method can be set during initialization phase by calling @ref nrf_802154_src_matching_method.
+ *
+ * @param[in]  p_addrs    Array of bytes containing consecutive addresses of the nodes
+ *                        (little-endian).
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ *
+ * @retval True   All addresses are successfully removed from the list.
+ * @retval False  At least one of the addresses is not in the list.
+ */
+bool nrf_802154_pending_bit_for_addr_list_clear(const uint8_t * p_addrs,
+                                                uint32_t        num_addrs,
+                                                bool            extended);
+
 /**
  * @brief Initializes the 802.15.4 driver.
  *
@@ -377,4 +458,56 @@ int8_t nrf_802154_dbm_from_energy_level_calculate(uint8_t energy_level);
  */
 nrf_802154_capabilities_t nrf_802154_capabilities_get(void);
 
+/**
+ * @brief Get histograms of time intervals of certain operations.
+ *
+ * @param[out] p_stat_histograms Structure that will be filled with current histograms.
+ */
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms);
+
+/**
+ * @brief Resets all buckets of the histograms of time intervals to 0.
+ */
+void nrf_802154_stat_histograms_reset(void);
+
+/**
+ * @brief Stores a frame security key in the driver.
+ *
+ * The network core secures frames and Enh-Acks with the stored keys only if it is built with
+ * the frame security, see @ref NRF_802154_CAPABILITY_SECURITY.
+ *
+ * @param[in]  p_key  Pointer to the key to store. The key and its identifier are copied.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key was stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There is no free entry in the key storage.
+ * @retval NRF_802154_SECURITY_ERROR_ALREADY_PRESENT     A key with the same identifier is stored.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not supported.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_store(const nrf_802154_key_t * p_key);
+
+/**
+ * @brief Removes a frame security key from the driver.
+ *
+ * @param[in]  p_id  Pointer to the identifier of the key to remove.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key was removed.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND       There is no key with the given identifier.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not supported.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_remove(const nrf_802154_key_id_t * p_id);
+
+/**
+ * @brief Sets the global frame counter used by the frames secured by the driver.
+ *
+ * @param[in]  frame_counter  Value of the frame counter to use for the next secured frame.
+ */
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter);
+
+/**
+ * @brief Gets the global frame counter used by the frames secured by the driver.
+ *
+ * @returns  Value of the frame counter that is to be used for the next secured frame.
+ */
+uint32_t nrf_802154_security_global_frame_counter_get(void);
+
 #endif
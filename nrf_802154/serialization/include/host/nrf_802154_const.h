@@ -46,6 +46,10 @@
 #define EXTENDED_ADDRESS_SIZE 8     ///< Size of the Extended Mac Address.
 #define SHORT_ADDRESS_SIZE    2     ///< Size of the Short Mac Address.
 
+#define KEY_ID_MODE_1_SIZE    1     ///< Size of the 0x01 Key Identifier Mode field.
+#define KEY_ID_MODE_2_SIZE    5     ///< Size of the 0x10 Key Identifier Mode field.
+#define KEY_ID_MODE_3_SIZE    9     ///< Size of the 0x11 Key Identifier Mode field.
+
 #define ED_MIN_DBM            (-92) ///< dBm value corresponding to value 0 in the EDSAMPLE register.
 #define ED_RESULT_FACTOR      4     ///< Factor needed to calculate the ED result based on the data from the RADIO peripheral.
 
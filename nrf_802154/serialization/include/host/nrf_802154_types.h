@@ -58,6 +58,7 @@ typedef uint8_t nrf_802154_tx_error_t;
 #define NRF_802154_TX_ERROR_ABORTED         0x06 // !< Procedure was aborted by another operation.
 #define NRF_802154_TX_ERROR_TIMESLOT_DENIED 0x07 // !< Transmission did not start due to a denied timeslot request.
 #define NRF_802154_TX_ERROR_TIMEOUT         0x08 // !< Timeout specified for a transmission has been reached.
+#define NRF_802154_TX_ERROR_SECURITY        0x09 // !< Frame security could not be applied to the frame.
 
 /**
  * @brief Possible errors during the frame reception.
@@ -116,7 +117,8 @@ typedef uint8_t nrf_802154_src_addr_match_t;
  * - @ref NRF_802154_CAPABILITY_ACK_TIMEOUT,
  * - @ref NRF_802154_CAPABILITY_ANT_DIVERSITY,
  * - @ref NRF_802154_CAPABILITY_IFS,
- * - @ref NRF_802154_CAPABILITY_TIMESTAMP
+ * - @ref NRF_802154_CAPABILITY_TIMESTAMP,
+ * - @ref NRF_802154_CAPABILITY_SECURITY
  *
  */
 typedef uint32_t nrf_802154_capabilities_t;
@@ -128,6 +130,85 @@ typedef uint32_t nrf_802154_capabilities_t;
 #define NRF_802154_CAPABILITY_ANT_DIVERSITY (1UL << 4UL) // !< Antenna diversity supported
 #define NRF_802154_CAPABILITY_IFS           (1UL << 5UL) // !< Inter-frame spacing supported
 #define NRF_802154_CAPABILITY_TIMESTAMP     (1UL << 6UL) // !< Frame timestamping supported
+#define NRF_802154_CAPABILITY_SECURITY      (1UL << 7UL) // !< Frame security supported
+
+/**
+ * @brief Number of buckets in a histogram of time intervals.
+ */
+#define NRF_802154_STAT_HISTOGRAM_BUCKETS 20
+
+/**
+ * @brief Type of structure holding a histogram of time intervals.
+ *
+ * Bucket 0 counts intervals of 0 us. Bucket @c n counts intervals from 2^(n-1) us
+ * to 2^n - 1 us. The last bucket counts all longer intervals as well.
+ */
+typedef struct
+{
+    /**@brief Number of intervals counted in each bucket. */
+    uint32_t buckets[NRF_802154_STAT_HISTOGRAM_BUCKETS];
+} nrf_802154_stat_histogram_t;
+
+/**
+ * @brief Type of structure holding histograms of time intervals of certain operations.
+ */
+typedef struct
+{
+    /**@brief Time from the start of CSMA/CA procedure to the start of the transmission. */
+    nrf_802154_stat_histogram_t csmaca_access_delay;
+    /**@brief Time from the end of the transmitted frame to the end of the received ACK. */
+    nrf_802154_stat_histogram_t ack_round_trip_time;
+    /**@brief Time from the start of the transmit procedure to the start of the transmission. */
+    nrf_802154_stat_histogram_t request_to_air_latency;
+    /**@brief Time from an event to the delivery of its notification to the higher layer. */
+    nrf_802154_stat_histogram_t notification_delay;
+} nrf_802154_stat_histograms_t;
+
+/**
+ * @brief Size of the key used by the 802.15.4 frame security, in bytes.
+ */
+#define NRF_802154_SECURITY_KEY_SIZE 16
+
+/**
+ * @brief Errors reported by the functions that manage the frame security keys.
+ *
+ * Possible values:
+ * - @ref NRF_802154_SECURITY_ERROR_NONE,
+ * - @ref NRF_802154_SECURITY_ERROR_STORAGE_FULL,
+ * - @ref NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND,
+ * - @ref NRF_802154_SECURITY_ERROR_ALREADY_PRESENT,
+ * - @ref NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED
+ */
+typedef uint8_t nrf_802154_security_error_t;
+
+#define NRF_802154_SECURITY_ERROR_NONE               0x00 // !< The operation succeeded.
+#define NRF_802154_SECURITY_ERROR_STORAGE_FULL       0x01 // !< There is no free entry in the key storage.
+#define NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND      0x02 // !< There is no key with the given identifier.
+#define NRF_802154_SECURITY_ERROR_ALREADY_PRESENT    0x03 // !< A key with the given identifier is already stored.
+#define NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED 0x04 // !< The Key Identifier Mode is not supported.
+
+/**
+ * @brief Structure that identifies a frame security key.
+ */
+typedef struct
+{
+    /**@brief Key Identifier Mode of the key. Only modes 1, 2 and 3 are supported. */
+    uint8_t         mode;
+    /**@brief Key Source followed by Key Index, in the order in which they are transmitted in the
+     *        auxiliary security header. The field is 1, 5 or 9 bytes long for modes 1, 2 and 3. */
+    const uint8_t * p_key_id;
+} nrf_802154_key_id_t;
+
+/**
+ * @brief Structure that holds a frame security key.
+ */
+typedef struct
+{
+    /**@brief Value of the key. */
+    uint8_t             value[NRF_802154_SECURITY_KEY_SIZE];
+    /**@brief Identifier of the key. */
+    nrf_802154_key_id_t id;
+} nrf_802154_key_t;
 
 /**
  *@}
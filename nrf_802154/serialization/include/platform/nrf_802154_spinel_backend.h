@@ -44,6 +44,7 @@
 
 #include <stddef.h>
 
+#include "nrf_802154_serialization_config.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_spinel_backend_callouts.h"
 
@@ -63,6 +64,48 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
                                                            size_t       data_len);
 
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+/**
+ * @brief Allocates a buffer for a spinel frame to be sent over spinel backend.
+ *
+ * The spinel frame is encoded directly into the returned buffer, which must then be passed
+ * to either @ref nrf_802154_spinel_encoded_packet_buffer_send or
+ * @ref nrf_802154_spinel_encoded_packet_buffer_discard.
+ *
+ * @param[in]  max_len  Maximum size of the spinel frame to be stored in the buffer.
+ *
+ * @returns  pointer to the allocated buffer or NULL if no buffer could be allocated.
+ *
+ */
+void * nrf_802154_spinel_encoded_packet_buffer_alloc(size_t max_len);
+
+/**
+ * @brief Sends a spinel frame stored in a buffer allocated by the spinel backend.
+ *
+ * The ownership of the buffer is passed back to the backend.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_buffer_alloc.
+ * @param[in]  data_len  Size of the spinel frame stored in @p p_buffer.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_send(void * p_buffer,
+                                                                  size_t data_len);
+
+/**
+ * @brief Releases a buffer allocated by the spinel backend without sending it.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_buffer_alloc.
+ *
+ */
+void nrf_802154_spinel_encoded_packet_buffer_discard(void * p_buffer);
+
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
 /**
  * @brief Initializes spinel backend.
  *
@@ -44,6 +44,8 @@
 
 #include <stddef.h>
 
+#include "nrf_802154_serialization_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -57,6 +59,48 @@ extern "C" {
  */
 extern void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len);
 
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+/**
+ * @brief Allocates a buffer to receive a spinel frame into.
+ *
+ * The buffer is owned by the serialization, which keeps it after decoding when the spinel frame
+ * carries a buffer the driver holds on to, so that the buffer content is not copied. The backend
+ * must pass the buffer to either @ref nrf_802154_spinel_encoded_packet_buffer_received or
+ * @ref nrf_802154_spinel_encoded_packet_rx_buffer_discard. When no buffer is returned, the backend
+ * receives the frame into its own buffer and passes it to
+ * @ref nrf_802154_spinel_encoded_packet_received.
+ *
+ * @param[in]  max_len  Maximum size of the spinel frame to be stored in the buffer.
+ *
+ * @returns  pointer to the allocated buffer or NULL if no buffer could be allocated.
+ *
+ */
+extern void * nrf_802154_spinel_encoded_packet_rx_buffer_alloc(size_t max_len);
+
+/**
+ * @brief Notifies that spinel frame was received into a buffer allocated by the serialization.
+ *
+ * The ownership of the buffer is passed back to the serialization.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_rx_buffer_alloc.
+ * @param[in]  data_len  Size of the spinel frame stored in @p p_buffer.
+ *
+ */
+extern void nrf_802154_spinel_encoded_packet_buffer_received(void * p_buffer, size_t data_len);
+
+/**
+ * @brief Releases a buffer allocated by the serialization when no spinel frame was received.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_rx_buffer_alloc.
+ *
+ */
+extern void nrf_802154_spinel_encoded_packet_rx_buffer_discard(void * p_buffer);
+
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2020 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_serialization_async
+ * 802.15.4 radio driver serialization asynchronous API
+ * @{
+ *
+ * Asynchronous variants of selected nRF 802.15.4 radio driver API calls for the application core.
+ *
+ * Unlike the blocking calls declared in nrf_802154.h, these functions return as soon as the
+ * request is sent to the network core. Every request is tagged with a spinel transaction
+ * identifier, so several requests can be outstanding at the same time. The result is reported
+ * through a completion callback when the matching response arrives.
+ *
+ */
+
+#ifndef NRF_802154_SERIALIZATION_ASYNC_H_
+#define NRF_802154_SERIALIZATION_ASYNC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_serialization_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Completion callback of an asynchronous request.
+ *
+ * The callback is called from the context in which spinel frames are received. If the request
+ * times out, it is called from @ref nrf_802154_serialization_async_timeouts_process instead.
+ *
+ * @param[in]  error      Zero if a valid response was received or negative error value otherwise.
+ * @param[in]  result     Result of the request. For requests whose blocking variant returns
+ *                        a value, it is the returned value. For the remaining requests, it is
+ *                        true if the network core reported success.
+ * @param[in]  p_context  Context pointer passed when the request was started.
+ *
+ */
+typedef void (* nrf_802154_ser_async_callback_t)(nrf_802154_ser_err_t error,
+                                                 bool                 result,
+                                                 void               * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_pan_id_set.
+ *
+ * @param[in]  p_pan_id   Pointer to the PAN ID (2 bytes, little-endian).
+ * @param[in]  callback   Completion callback. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *           @ref NRF_802154_SERIALIZATION_ERROR_NO_MEMORY is returned if the maximum number of
+ *           outstanding requests is reached.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_pan_id_set_async(const uint8_t                 * p_pan_id,
+                                                 nrf_802154_ser_async_callback_t callback,
+                                                 void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_short_address_set.
+ *
+ * @param[in]  p_short_address  Pointer to the short address (2 bytes, little-endian).
+ * @param[in]  callback         Completion callback. Can be NULL.
+ * @param[in]  p_context        Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_short_address_set_async(
+    const uint8_t                 * p_short_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_extended_address_set.
+ *
+ * @param[in]  p_extended_address  Pointer to the extended address (8 bytes, little-endian).
+ * @param[in]  callback            Completion callback. Can be NULL.
+ * @param[in]  p_context           Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_extended_address_set_async(
+    const uint8_t                 * p_extended_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_pending_bit_for_addr_set.
+ *
+ * @param[in]  p_addr     Array of bytes containing the address in little-endian byte order.
+ * @param[in]  extended   If the given address is an extended MAC address or a short MAC address.
+ * @param[in]  callback   Completion callback. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_pending_bit_for_addr_set_async(
+    const uint8_t                 * p_addr,
+    bool                            extended,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_pending_bit_for_addr_clear.
+ *
+ * @param[in]  p_addr     Array of bytes containing the address in little-endian byte order.
+ * @param[in]  extended   If the given address is an extended MAC address or a short MAC address.
+ * @param[in]  callback   Completion callback. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_pending_bit_for_addr_clear_async(
+    const uint8_t                 * p_addr,
+    bool                            extended,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_pending_bit_for_addr_reset.
+ *
+ * @param[in]  extended   If the list of extended MAC addresses or short MAC addresses is reset.
+ * @param[in]  callback   Completion callback. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_pending_bit_for_addr_reset_async(
+    bool                            extended,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_channel_set.
+ *
+ * @param[in]  channel    Channel number (11-26).
+ * @param[in]  callback   Completion callback. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_channel_set_async(uint8_t                         channel,
+                                                  nrf_802154_ser_async_callback_t callback,
+                                                  void                          * p_context);
+
+/**
+ * @brief Asynchronous variant of @ref nrf_802154_tx_power_set.
+ *
+ * @param[in]  power      Transmit power in dBm.
+ * @param[in]  callback   Completion callback. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_tx_power_set_async(int8_t                          power,
+                                                   nrf_802154_ser_async_callback_t callback,
+                                                   void                          * p_context);
+
+/**
+ * @brief Cancels outstanding asynchronous requests.
+ *
+ * Cancels all outstanding requests started with the given callback and context. Completion
+ * callbacks of the cancelled requests are not called. The requests have already been sent,
+ * so the network core still processes them, and their responses are dropped.
+ *
+ * A transaction identifier of a cancelled request is reused only after its response arrives
+ * or, if @ref NRF_802154_SERIALIZATION_ASYNC_TIMEOUT is not 0, after the timeout period.
+ *
+ * @param[in]  callback   Completion callback of the requests to be cancelled.
+ * @param[in]  p_context  Context pointer of the requests to be cancelled.
+ *
+ * @returns  number of cancelled requests.
+ *
+ */
+uint8_t nrf_802154_serialization_async_cancel(nrf_802154_ser_async_callback_t callback,
+                                              const void                    * p_context);
+
+/**
+ * @brief Completes asynchronous requests whose responses have not arrived in time.
+ *
+ * Completion callbacks of the requests outstanding for longer than
+ * @ref NRF_802154_SERIALIZATION_ASYNC_TIMEOUT are called with
+ * @ref NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT from the context of this function.
+ * The function is also called when an asynchronous request is started, and it can be called
+ * periodically to report timeouts when no new requests are started.
+ * It does nothing if @ref NRF_802154_SERIALIZATION_ASYNC_TIMEOUT is 0.
+ *
+ * @returns  number of requests that timed out.
+ *
+ */
+uint8_t nrf_802154_serialization_async_timeouts_process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SERIALIZATION_ASYNC_H_ */
+
+/** @} */
@@ -49,4 +49,58 @@
 #define NRF_802154_TX_BUFFERS 4
 #endif
 
+/**
+ * @brief Use hash tables to map buffer pointers and handles in serialization buffer managers.
+ *
+ * When set to 1, key-value maps are open-addressing hash tables, so buffer lookups within
+ * critical sections take constant time on average. This requires twice as many item slots
+ * and one additional byte per slot. When set to 0, key-value maps are searched linearly.
+ */
+#ifndef NRF_802154_SERIALIZATION_KVMAP_HASH
+#define NRF_802154_SERIALIZATION_KVMAP_HASH 0
+#endif
+
+/**
+ * @brief Exchange spinel frames with the spinel backend without intermediate copies.
+ *
+ * When set to 1, outgoing spinel frames are packed in place into a buffer obtained from
+ * @ref nrf_802154_spinel_encoded_packet_buffer_alloc and passed to the backend without an
+ * intermediate copy. The backend must implement the buffer functions declared in
+ * nrf_802154_spinel_backend.h. When set to 0, frames are packed into a temporary buffer
+ * and sent with @ref nrf_802154_spinel_encoded_packet_send.
+ *
+ * Incoming spinel frames can be received directly into buffers of the serialization obtained
+ * from @ref nrf_802154_spinel_encoded_packet_rx_buffer_alloc. A frame passed to the driver is
+ * then used in place within the received buffer instead of being copied to another buffer.
+ * Buffers of the serialization are 64 bytes larger to hold the spinel frame around it.
+ */
+#ifndef NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+#define NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY 0
+#endif
+
+/**
+ * @brief Maximum number of asynchronous requests the application core can have outstanding.
+ *
+ * Each request is identified by a spinel transaction identifier, so the value must be in
+ * range 1..15.
+ */
+#ifndef NRF_802154_SERIALIZATION_ASYNC_REQUESTS
+#define NRF_802154_SERIALIZATION_ASYNC_REQUESTS 4
+#endif
+
+/**
+ * @brief Time in microseconds after which an asynchronous request without response times out.
+ *
+ * A request that times out is completed with @ref NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT
+ * by @ref nrf_802154_serialization_async_timeouts_process, which is also called when a new
+ * request is started. Its transaction identifier is not reused for another timeout period,
+ * so that a late response is dropped instead of completing a different request.
+ *
+ * When set to a non-zero value, the platform must implement
+ * @ref nrf_802154_serialization_time_get. When set to 0, requests never time out.
+ */
+#ifndef NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+#define NRF_802154_SERIALIZATION_ASYNC_TIMEOUT 0
+#endif
+
 #endif // NRF_802154_SER_CONFIG_H__
@@ -44,12 +44,20 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "nrf_802154_serialization_config.h"
+
 /**
  * @brief Default length of a buffer allocated by the buffer allocation mechanism.
  *
- * The buffer should be able to store the longest possible 802.15.4 packet.
+ * The buffer should be able to store the longest possible 802.15.4 packet. When spinel frames
+ * are received directly into the buffers, the buffer must also hold the spinel header and other
+ * fields encoded together with the 802.15.4 packet.
  */
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+#define NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN (128 + 64)
+#else
 #define NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN 128
+#endif
 
 /**@brief Calculates byte size of memory required to store a buffer allocator.
  *
@@ -65,21 +73,25 @@
     ((capacity) * (sizeof(nrf_802154_buffer_t)))
 
 /** @brief Structure representing a buffer. */
-typedef struct
+typedef struct nrf_802154_buffer_s
 {
     /** @brief Stored data. */
-    uint8_t       data[NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN];
+    uint8_t                      data[NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN];
+    /** @brief Next buffer in the free list. Valid only if the buffer is not in use. */
+    struct nrf_802154_buffer_s * p_next_free;
     /** @brief Flag indicating if a buffer is currently in use. */
-    volatile bool taken;
+    volatile bool                taken;
 } nrf_802154_buffer_t;
 
 /** @brief Structure representing a buffer allocator. */
 typedef struct
 {
     /** @brief Pointer to a memory used to store buffers. */
-    void * p_memory;
+    void                * p_memory;
     /** @brief Maximum number of buffers the buffer allocator instance is able to store. */
-    size_t capacity;
+    size_t                capacity;
+    /** @brief First buffer in the list of free buffers, NULL if all buffers are in use. */
+    nrf_802154_buffer_t * p_free_head;
 } nrf_802154_buffer_allocator_t;
 
 /**
@@ -103,21 +115,23 @@ void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
 /**
  * @brief Allocates buffer for 802.15.4 reception or transmission.
  *
+ * Allocation takes constant time regardless of the number of buffers in the pool.
+ *
  * @param[in] p_obj  Pointer to a buffer allocator that stores the buffer pool to allocate from.
  *
  * @return Pointer to allocated buffer or NULL if no buffer could be allocated.
  */
-void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p_obj);
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj);
 
 /**
  * @brief Frees buffer allocated for 802.15.4 reception or transmission.
  *
  * @param[in] p_obj     Pointer to a buffer allocator that stores the buffer pool to free from.
- * @param[in] p_buffer  Pointer to a buffer to free.
+ * @param[in] p_buffer  Pointer to a buffer to free. It can point anywhere within the buffer.
  *
  * @note This function should be used complementary to @ref nrf_802154_buffer_allocator_alloc.
  */
-void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
 
 /**
  * @brief Gets total number of buffers a buffer allocator can store.
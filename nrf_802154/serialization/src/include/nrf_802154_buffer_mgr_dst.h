@@ -49,6 +49,11 @@
  * received with. When local peer is done with given buffer
  * @ref nrf_802154_buffer_mgr_dst_remove_by_local_pointer should be called to
  * remove mapping and free any resources used by the mapping.
+ *
+ * When @ref NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY is set, spinel frames are received directly
+ * into buffers of the buffer manager. Data that lies within the spinel frame being decoded is
+ * not copied by @ref nrf_802154_buffer_mgr_dst_add. Instead, the buffer holding the spinel frame
+ * is kept and the local pointer points to the data within it.
  */
 
 #ifndef NRF_802154_BUFFER_MGR_DST_H__
@@ -60,6 +65,7 @@
 
 #include "nrf_802154_kvmap.h"
 #include "nrf_802154_buffer_allocator.h"
+#include "nrf_802154_serialization_config.h"
 
 /**@brief Type of a buffer manager for destination peer of serialization. */
 typedef struct
@@ -73,6 +79,18 @@ typedef struct
 
     /**@brief Allocator providing storage for local buffers. */
     nrf_802154_buffer_allocator_t allocator;
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    /**@brief Buffer holding the spinel frame being decoded.
+     *
+     * NULL if no spinel frame is being decoded or the frame was received into a buffer
+     * of the spinel backend.
+     */
+    uint8_t * p_rx_buffer;
+
+    /**@brief Flag indicating if the buffer holding the spinel frame being decoded is kept. */
+    bool      rx_buffer_kept;
+#endif
 } nrf_802154_buffer_mgr_dst_t;
 
 /**@brief Calculates number of bytes needed to store map.
@@ -156,7 +174,10 @@ void nrf_802154_buffer_mgr_dst_init(
 
 /**@brief Adds a remote buffer handle to a buffer manager obtaining a local pointer.
  *
- * This causes an allocation of a buffer and copy of data into it.
+ * This causes an allocation of a buffer and copy of data into it. If the data lies within
+ * the spinel frame being decoded, which was received into a buffer from
+ * @ref nrf_802154_buffer_mgr_dst_rx_buffer_alloc, that buffer is kept instead and no data is
+ * copied. This is done at most once per spinel frame.
  *
  * @param[in,out] p_obj           Pointer to a buffer manager object.
  * @param[in]     buffer_handle   Handle of a remote buffer.
@@ -210,4 +231,43 @@ bool nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
     nrf_802154_buffer_mgr_dst_t * p_obj,
     void                        * p_local_pointer);
 
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+/**@brief Allocates a buffer to receive a spinel frame into.
+ *
+ * @param[in,out] p_obj  Pointer to a buffer manager object.
+ *
+ * @returns  Pointer to a buffer of @ref NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN bytes
+ *           or NULL if no buffer is available.
+ */
+void * nrf_802154_buffer_mgr_dst_rx_buffer_alloc(nrf_802154_buffer_mgr_dst_t * p_obj);
+
+/**@brief Marks the start of decoding of a spinel frame received into a buffer.
+ *
+ * @param[in,out] p_obj     Pointer to a buffer manager object.
+ * @param[in]     p_buffer  Buffer returned by @ref nrf_802154_buffer_mgr_dst_rx_buffer_alloc.
+ */
+void nrf_802154_buffer_mgr_dst_rx_buffer_decode_begin(nrf_802154_buffer_mgr_dst_t * p_obj,
+                                                      void                        * p_buffer);
+
+/**@brief Marks the end of decoding of a spinel frame received into a buffer.
+ *
+ * The buffer is freed unless data within it was added to the buffer manager during decoding.
+ * In that case it is freed by @ref nrf_802154_buffer_mgr_dst_remove_by_local_pointer.
+ *
+ * @param[in,out] p_obj  Pointer to a buffer manager object.
+ */
+void nrf_802154_buffer_mgr_dst_rx_buffer_decode_end(nrf_802154_buffer_mgr_dst_t * p_obj);
+
+/**@brief Frees a buffer returned by @ref nrf_802154_buffer_mgr_dst_rx_buffer_alloc that was not
+ *        decoded.
+ *
+ * @param[in,out] p_obj     Pointer to a buffer manager object.
+ * @param[in]     p_buffer  Buffer to free.
+ */
+void nrf_802154_buffer_mgr_dst_rx_buffer_discard(nrf_802154_buffer_mgr_dst_t * p_obj,
+                                                 void                        * p_buffer);
+
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
 #endif // NRF_802154_BUFFER_MGR_DST_H__
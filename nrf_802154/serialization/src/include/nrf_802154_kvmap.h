@@ -42,6 +42,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "nrf_802154_serialization_config.h"
+
 /**@brief Structure representing a key-value map */
 typedef struct
 {
@@ -55,8 +57,17 @@ typedef struct
     size_t key_size;
     /**@brief Size of a value in bytes */
     size_t val_size;
+#if NRF_802154_SERIALIZATION_KVMAP_HASH
+    /**@brief Number of hash table slots */
+    size_t slots;
+#endif
 } nrf_802154_kvmap_t;
 
+#if NRF_802154_SERIALIZATION_KVMAP_HASH
+/**@brief Number of hash table slots reserved for each item a key-value map can store. */
+#define NRF_802154_KVMAP_SLOTS_PER_ITEM 2U
+#endif
+
 /**@brief Calculates capacity of memory required to store a key-value map.
  *
  * Example:
@@ -68,8 +79,13 @@ typedef struct
  *                       7, 6);
  * @endcode
  */
+#if NRF_802154_SERIALIZATION_KVMAP_HASH
+#define NRF_802154_KVMAP_MEMORY_SIZE(capacity, key_size, val_size) \
+    ((capacity) * NRF_802154_KVMAP_SLOTS_PER_ITEM * ((key_size) + (val_size) + 1U))
+#else
 #define NRF_802154_KVMAP_MEMORY_SIZE(capacity, key_size, val_size) \
     ((capacity) * ((key_size) + (val_size)))
+#endif
 
 /**@brief Initializes a key-value map instance.
  *
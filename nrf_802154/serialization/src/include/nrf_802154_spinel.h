@@ -42,9 +42,12 @@
 #ifndef NRF_802154_SPINEL_H_
 #define NRF_802154_SPINEL_H_
 
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_serialization_config.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_spinel_codec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -85,6 +88,52 @@ extern "C" {
  */
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...);
 
+/**
+ * @brief Spinel frame encoded in place with the writers of nrf_802154_spinel_codec.h.
+ */
+typedef struct
+{
+#if !NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    uint8_t                    buffer[NRF_802154_SPINEL_FRAME_BUFFER_SIZE]; ///< Frame buffer.
+#endif
+    uint8_t                  * p_buffer; ///< Start of the frame.
+    nrf_802154_spinel_writer_t writer;   ///< Writer of the frame, to encode the property value.
+} nrf_802154_spinel_frame_t;
+
+/**
+ * @brief Starts a spinel frame with a property command and encodes its header.
+ *
+ * The property value is then encoded with the writers of nrf_802154_spinel_codec.h to
+ * @c p_frame->writer, and the frame is sent with @ref nrf_802154_spinel_frame_send.
+ * Encodes the same header as @ref nrf_802154_spinel_send_cmd_tid with
+ * @ref SPINEL_DATATYPE_UINT_PACKED_S for the property.
+ *
+ * @param[out] p_frame   Frame to start.
+ * @param[in]  tid       Transaction identifier placed in the spinel frame header.
+ * @param[in]  cmd       Spinel command.
+ * @param[in]  property  Spinel property.
+ *
+ * @returns  zero on success or negative error value on failure. The frame must not be sent
+ *           if it could not be started.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_frame_begin(nrf_802154_spinel_frame_t * p_frame,
+                                                   spinel_tid_t                tid,
+                                                   spinel_command_t            cmd,
+                                                   spinel_prop_key_t           property);
+
+/**
+ * @brief Sends a spinel frame started with @ref nrf_802154_spinel_frame_begin.
+ *
+ * The frame is discarded if any of its fields could not be encoded.
+ *
+ * @param[in]  p_frame  Frame to send.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_frame_send(nrf_802154_spinel_frame_t * p_frame);
+
 /**
  * @brief Gets buffer manager for transactions originated by the remote serialization peer.
  *
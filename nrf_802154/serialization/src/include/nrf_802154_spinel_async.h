@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_async
+ * 802.15.4 radio driver spinel serialization asynchronous requests
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_ASYNC_H_
+#define NRF_802154_SPINEL_ASYNC_H_
+
+#include <stddef.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_serialization_async.h"
+#include "nrf_802154_serialization_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the table of outstanding asynchronous requests.
+ */
+void nrf_802154_spinel_async_init(void);
+
+/**
+ * @brief Reserves a transaction identifier for an asynchronous request.
+ *
+ * @param[in]  callback   Completion callback to be called when the response arrives. Can be NULL.
+ * @param[in]  p_context  Context pointer passed to @p callback.
+ * @param[out] p_tid      Reserved transaction identifier, to be placed in the request.
+ *
+ * @returns zero on success or @ref NRF_802154_SERIALIZATION_ERROR_NO_MEMORY if the maximum
+ *          number of outstanding requests is reached.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_async_request_start(
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context,
+    spinel_tid_t                  * p_tid);
+
+/**
+ * @brief Releases a transaction identifier of a request that could not be sent.
+ *
+ * @param[in]  tid  Transaction identifier returned by @ref nrf_802154_spinel_async_request_start.
+ *
+ */
+void nrf_802154_spinel_async_request_abort(spinel_tid_t tid);
+
+/**
+ * @brief Completes an asynchronous request with the received response.
+ *
+ * @param[in]  tid                Transaction identifier of the response.
+ * @param[in]  property           Property of the response.
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_async_response_handle(spinel_tid_t      tid,
+                                                             spinel_prop_key_t property,
+                                                             const void      * p_property_data,
+                                                             size_t            property_data_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_ASYNC_H_ */
+
+/** @} */
@@ -0,0 +1,616 @@
+/*
+ * Copyright (c) 2020 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_codec
+ * 802.15.4 radio driver spinel serialization specialized codec
+ * @{
+ *
+ * Straight-line readers and writers of spinel primitive data types.
+ *
+ * @ref spinel_datatype_unpack and @ref spinel_datatype_pack interpret their format strings
+ * character by character and fetch arguments through a va_list. The formats used on per-frame
+ * paths are fixed, so their decoders and encoders are written as sequences of the readers and
+ * writers below instead. Each reader decodes exactly what @ref spinel_datatype_unpack decodes and
+ * each writer encodes exactly what @ref spinel_datatype_pack encodes for the corresponding format
+ * character.
+ *
+ * A reader that runs past the end of the buffer sets the error flag and returns zero, so a whole
+ * format can be decoded without intermediate checks and verified once with
+ * @ref nrf_802154_spinel_reader_ok. Writers do the same with @ref nrf_802154_spinel_writer_ok.
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_CODEC_H_
+#define NRF_802154_SPINEL_CODEC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_datatypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum length of a buffer accepted by @ref spinel_datatype_unpack.
+ */
+#define NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH 32767
+
+/**
+ * @brief State of decoding of a spinel buffer.
+ */
+typedef struct
+{
+    const uint8_t * p_data; ///< Next byte to decode.
+    size_t          len;    ///< Number of bytes left to decode.
+    bool            error;  ///< Set if decoding failed.
+} nrf_802154_spinel_reader_t;
+
+/**
+ * @brief Initializes a reader of a spinel buffer.
+ *
+ * @param[out] p_reader  Reader to initialize.
+ * @param[in]  p_data    Pointer to a buffer to be decoded.
+ * @param[in]  data_len  Size of the @p p_data buffer.
+ */
+static inline void nrf_802154_spinel_reader_init(nrf_802154_spinel_reader_t * p_reader,
+                                                 const void                 * p_data,
+                                                 size_t                       data_len)
+{
+    p_reader->p_data = (const uint8_t *)p_data;
+    p_reader->len    = data_len;
+    p_reader->error  = (data_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH);
+}
+
+/**
+ * @brief Checks if all reads from a reader succeeded.
+ *
+ * @param[in]  p_reader  Reader to check.
+ *
+ * @retval true   All data was decoded successfully.
+ * @retval false  Decoding failed.
+ */
+static inline bool nrf_802154_spinel_reader_ok(const nrf_802154_spinel_reader_t * p_reader)
+{
+    return !p_reader->error;
+}
+
+/**
+ * @brief Consumes @p len bytes from a reader.
+ *
+ * @returns Pointer to the consumed bytes or NULL if there are not enough bytes left.
+ */
+static inline const uint8_t * nrf_802154_spinel_read_bytes(nrf_802154_spinel_reader_t * p_reader,
+                                                           size_t                       len)
+{
+    const uint8_t * p_bytes = p_reader->p_data;
+
+    if (p_reader->error || (p_reader->len < len))
+    {
+        p_reader->error = true;
+        return NULL;
+    }
+
+    p_reader->p_data += len;
+    p_reader->len    -= len;
+
+    return p_bytes;
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_UINT8_S.
+ */
+static inline uint8_t nrf_802154_spinel_read_uint8(nrf_802154_spinel_reader_t * p_reader)
+{
+    const uint8_t * p_bytes = nrf_802154_spinel_read_bytes(p_reader, sizeof(uint8_t));
+
+    return (p_bytes != NULL) ? p_bytes[0] : 0U;
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_INT8_S.
+ */
+static inline int8_t nrf_802154_spinel_read_int8(nrf_802154_spinel_reader_t * p_reader)
+{
+    return (int8_t)nrf_802154_spinel_read_uint8(p_reader);
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_BOOL_S.
+ */
+static inline bool nrf_802154_spinel_read_bool(nrf_802154_spinel_reader_t * p_reader)
+{
+    return nrf_802154_spinel_read_uint8(p_reader) != 0U;
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_UINT16_S.
+ */
+static inline uint16_t nrf_802154_spinel_read_uint16(nrf_802154_spinel_reader_t * p_reader)
+{
+    const uint8_t * p_bytes = nrf_802154_spinel_read_bytes(p_reader, sizeof(uint16_t));
+
+    if (p_bytes == NULL)
+    {
+        return 0U;
+    }
+
+    return (uint16_t)(((uint16_t)p_bytes[1] << 8) | p_bytes[0]);
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_UINT32_S.
+ */
+static inline uint32_t nrf_802154_spinel_read_uint32(nrf_802154_spinel_reader_t * p_reader)
+{
+    const uint8_t * p_bytes = nrf_802154_spinel_read_bytes(p_reader, sizeof(uint32_t));
+
+    if (p_bytes == NULL)
+    {
+        return 0U;
+    }
+
+    return ((uint32_t)p_bytes[3] << 24) | ((uint32_t)p_bytes[2] << 16) |
+           ((uint32_t)p_bytes[1] << 8) | (uint32_t)p_bytes[0];
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_UINT_PACKED_S.
+ */
+static inline uint32_t nrf_802154_spinel_read_uint_packed(nrf_802154_spinel_reader_t * p_reader)
+{
+    uint32_t value = 0U;
+    uint8_t  byte;
+
+    for (uint32_t shift = 0U; shift < 32U; shift += 7U)
+    {
+        byte   = nrf_802154_spinel_read_uint8(p_reader);
+        value |= (uint32_t)(byte & 0x7FU) << shift;
+
+        if ((byte & 0x80U) == 0U)
+        {
+            break;
+        }
+    }
+
+    if ((byte & 0x80U) || (value >= SPINEL_MAX_UINT_PACKED))
+    {
+        p_reader->error = true;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_DATA_S placed at the end of a format.
+ *
+ * The data spans all remaining bytes.
+ *
+ * @param[inout] p_reader  Reader to decode from.
+ * @param[out]   p_len     Length of the data.
+ *
+ * @returns Pointer to the data.
+ */
+static inline const uint8_t * nrf_802154_spinel_read_data(nrf_802154_spinel_reader_t * p_reader,
+                                                          size_t                     * p_len)
+{
+    *p_len = p_reader->error ? 0U : p_reader->len;
+
+    return nrf_802154_spinel_read_bytes(p_reader, *p_len);
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_DATA_WLEN_S, or @ref SPINEL_DATATYPE_DATA_S that is
+ *        followed by other fields.
+ *
+ * @param[inout] p_reader  Reader to decode from.
+ * @param[out]   p_len     Length of the data.
+ *
+ * @returns Pointer to the data.
+ */
+static inline const uint8_t * nrf_802154_spinel_read_data_wlen(
+    nrf_802154_spinel_reader_t * p_reader,
+    size_t                     * p_len)
+{
+    uint16_t len = nrf_802154_spinel_read_uint16(p_reader);
+
+    if (len >= SPINEL_FRAME_MAX_SIZE)
+    {
+        p_reader->error = true;
+    }
+
+    *p_len = len;
+
+    return nrf_802154_spinel_read_bytes(p_reader, len);
+}
+
+/**
+ * @brief Decodes @ref SPINEL_DATATYPE_NRF_802154_HDATA_S.
+ *
+ * @param[inout] p_reader     Reader to decode from.
+ * @param[out]   p_handle     Data handle.
+ * @param[out]   p_hdata_len  Length of the data as returned by @ref spinel_datatype_unpack
+ *                            for @ref NRF_802154_HDATA_DECODE.
+ *
+ * @returns Pointer to the data.
+ */
+static inline const uint8_t * nrf_802154_spinel_read_hdata(nrf_802154_spinel_reader_t * p_reader,
+                                                           uint32_t                   * p_handle,
+                                                           size_t                     * p_hdata_len)
+{
+    nrf_802154_spinel_reader_t block;
+    size_t                     block_len;
+    const uint8_t            * p_block = nrf_802154_spinel_read_data_wlen(p_reader, &block_len);
+    const uint8_t            * p_data;
+
+    nrf_802154_spinel_reader_init(&block, p_block, block_len);
+    block.error = p_reader->error;
+
+    *p_handle = nrf_802154_spinel_read_uint32(&block);
+    p_data    = nrf_802154_spinel_read_data(&block, p_hdata_len);
+
+    p_reader->error = block.error;
+
+    return p_data;
+}
+
+/**
+ * @brief State of encoding of a spinel buffer.
+ */
+typedef struct
+{
+    uint8_t * p_data;  ///< Next byte to encode.
+    size_t    len;     ///< Number of bytes left in the buffer.
+    size_t    written; ///< Number of bytes encoded.
+    bool      error;   ///< Set if encoding failed.
+} nrf_802154_spinel_writer_t;
+
+/**
+ * @brief Initializes a writer of a spinel buffer.
+ *
+ * @param[out] p_writer     Writer to initialize.
+ * @param[in]  p_buffer     Pointer to a buffer to encode to.
+ * @param[in]  buffer_size  Size of the @p p_buffer buffer.
+ */
+static inline void nrf_802154_spinel_writer_init(nrf_802154_spinel_writer_t * p_writer,
+                                                 void                       * p_buffer,
+                                                 size_t                       buffer_size)
+{
+    p_writer->p_data  = (uint8_t *)p_buffer;
+    p_writer->len     = buffer_size;
+    p_writer->written = 0U;
+    p_writer->error   = (buffer_size > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH);
+}
+
+/**
+ * @brief Checks if all writes to a writer succeeded.
+ *
+ * @param[in]  p_writer  Writer to check.
+ *
+ * @retval true   All data was encoded successfully.
+ * @retval false  Encoding failed.
+ */
+static inline bool nrf_802154_spinel_writer_ok(const nrf_802154_spinel_writer_t * p_writer)
+{
+    return !p_writer->error;
+}
+
+/**
+ * @brief Gets the number of bytes encoded by a writer.
+ */
+static inline size_t nrf_802154_spinel_writer_length(const nrf_802154_spinel_writer_t * p_writer)
+{
+    return p_writer->written;
+}
+
+/**
+ * @brief Reserves @p len bytes in a writer.
+ *
+ * @returns Pointer to the reserved bytes or NULL if there is not enough space left.
+ */
+static inline uint8_t * nrf_802154_spinel_write_reserve(nrf_802154_spinel_writer_t * p_writer,
+                                                        size_t                       len)
+{
+    uint8_t * p_bytes = p_writer->p_data;
+
+    if (p_writer->error || (p_writer->len < len))
+    {
+        p_writer->error = true;
+        return NULL;
+    }
+
+    p_writer->p_data  += len;
+    p_writer->len     -= len;
+    p_writer->written += len;
+
+    return p_bytes;
+}
+
+/**
+ * @brief Encodes @p len bytes without a length.
+ *
+ * If @p p_bytes is NULL, zeros are encoded.
+ */
+static inline void nrf_802154_spinel_write_bytes(nrf_802154_spinel_writer_t * p_writer,
+                                                 const void                 * p_bytes,
+                                                 size_t                       len)
+{
+    uint8_t * p_out = nrf_802154_spinel_write_reserve(p_writer, len);
+
+    if (p_out == NULL)
+    {
+        return;
+    }
+
+    if (p_bytes != NULL)
+    {
+        memcpy(p_out, p_bytes, len);
+    }
+    else
+    {
+        memset(p_out, 0, len);
+    }
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_UINT8_S.
+ */
+static inline void nrf_802154_spinel_write_uint8(nrf_802154_spinel_writer_t * p_writer,
+                                                 uint8_t                      value)
+{
+    uint8_t * p_out = nrf_802154_spinel_write_reserve(p_writer, sizeof(uint8_t));
+
+    if (p_out != NULL)
+    {
+        p_out[0] = value;
+    }
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_INT8_S.
+ */
+static inline void nrf_802154_spinel_write_int8(nrf_802154_spinel_writer_t * p_writer,
+                                                int8_t                       value)
+{
+    nrf_802154_spinel_write_uint8(p_writer, (uint8_t)value);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_BOOL_S.
+ */
+static inline void nrf_802154_spinel_write_bool(nrf_802154_spinel_writer_t * p_writer,
+                                                bool                         value)
+{
+    nrf_802154_spinel_write_uint8(p_writer, value ? 1U : 0U);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_UINT16_S.
+ */
+static inline void nrf_802154_spinel_write_uint16(nrf_802154_spinel_writer_t * p_writer,
+                                                  uint16_t                     value)
+{
+    uint8_t * p_out = nrf_802154_spinel_write_reserve(p_writer, sizeof(uint16_t));
+
+    if (p_out != NULL)
+    {
+        p_out[0] = (uint8_t)value;
+        p_out[1] = (uint8_t)(value >> 8);
+    }
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_UINT32_S.
+ */
+static inline void nrf_802154_spinel_write_uint32(nrf_802154_spinel_writer_t * p_writer,
+                                                  uint32_t                     value)
+{
+    uint8_t * p_out = nrf_802154_spinel_write_reserve(p_writer, sizeof(uint32_t));
+
+    if (p_out != NULL)
+    {
+        p_out[0] = (uint8_t)value;
+        p_out[1] = (uint8_t)(value >> 8);
+        p_out[2] = (uint8_t)(value >> 16);
+        p_out[3] = (uint8_t)(value >> 24);
+    }
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_UINT_PACKED_S.
+ */
+static inline void nrf_802154_spinel_write_uint_packed(nrf_802154_spinel_writer_t * p_writer,
+                                                       uint32_t                     value)
+{
+    if (value >= SPINEL_MAX_UINT_PACKED)
+    {
+        p_writer->error = true;
+        return;
+    }
+
+    while (value >= 0x80U)
+    {
+        nrf_802154_spinel_write_uint8(p_writer, (uint8_t)(value | 0x80U));
+        value >>= 7;
+    }
+
+    nrf_802154_spinel_write_uint8(p_writer, (uint8_t)value);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_DATA_S placed at the end of a format.
+ */
+static inline void nrf_802154_spinel_write_data(nrf_802154_spinel_writer_t * p_writer,
+                                                const void                 * p_data,
+                                                size_t                       len)
+{
+    nrf_802154_spinel_write_bytes(p_writer, p_data, len);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_DATA_WLEN_S, or @ref SPINEL_DATATYPE_DATA_S that is
+ *        followed by other fields.
+ */
+static inline void nrf_802154_spinel_write_data_wlen(nrf_802154_spinel_writer_t * p_writer,
+                                                     const void                 * p_data,
+                                                     size_t                       len)
+{
+    if (len > UINT16_MAX)
+    {
+        p_writer->error = true;
+        return;
+    }
+
+    nrf_802154_spinel_write_uint16(p_writer, (uint16_t)len);
+    nrf_802154_spinel_write_bytes(p_writer, p_data, len);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_NRF_802154_HDATA_S.
+ *
+ * Encodes what @ref spinel_datatype_pack encodes for
+ * @ref NRF_802154_HDATA_ENCODE(handle, p_data, data_len).
+ *
+ * @param[inout] p_writer  Writer to encode to.
+ * @param[in]    handle    Data handle.
+ * @param[in]    p_data    Pointer to the data. If NULL, zeros are encoded.
+ * @param[in]    data_len  Length of the data as passed to @ref NRF_802154_HDATA_ENCODE.
+ */
+static inline void nrf_802154_spinel_write_hdata(nrf_802154_spinel_writer_t * p_writer,
+                                                 uint32_t                     handle,
+                                                 const uint8_t              * p_data,
+                                                 size_t                       data_len)
+{
+    size_t hdata_len = NRF_802154_HDATA_LENGTH(data_len);
+
+    // The structure is followed by other fields, so it is prefixed with its length
+    nrf_802154_spinel_write_uint16(p_writer, (uint16_t)(sizeof(uint32_t) + hdata_len));
+    nrf_802154_spinel_write_uint32(p_writer, handle);
+    nrf_802154_spinel_write_data(p_writer, p_data, hdata_len);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW.
+ *
+ * @param[inout] p_writer      Writer to encode to.
+ * @param[in]    frame_handle  Handle of the frame to transmit.
+ * @param[in]    p_frame       Frame to transmit, with the PHR in the first byte.
+ * @param[in]    cca           If CCA is performed before the transmission.
+ */
+static inline void nrf_802154_spinel_write_transmit_raw(nrf_802154_spinel_writer_t * p_writer,
+                                                        uint32_t                     frame_handle,
+                                                        const uint8_t              * p_frame,
+                                                        bool                         cca)
+{
+    nrf_802154_spinel_write_hdata(p_writer, frame_handle, p_frame, p_frame[0]);
+    nrf_802154_spinel_write_bool(p_writer, cca);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW.
+ *
+ * @param[inout] p_writer      Writer to encode to.
+ * @param[in]    frame_handle  Handle of the frame to transmit.
+ * @param[in]    p_frame       Frame to transmit, with the PHR in the first byte.
+ */
+static inline void nrf_802154_spinel_write_transmit_csma_ca_raw(
+    nrf_802154_spinel_writer_t * p_writer,
+    uint32_t                     frame_handle,
+    const uint8_t              * p_frame)
+{
+    // The structure ends the format, but spinel_datatype_pack prefixes it with its length anyway
+    nrf_802154_spinel_write_hdata(p_writer, frame_handle, p_frame, p_frame[0]);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * @param[inout] p_writer      Writer to encode to.
+ * @param[in]    frame_handle  Handle of the received frame.
+ * @param[in]    p_frame       Received frame, with the PHR in the first byte.
+ * @param[in]    power         RSSI of the frame.
+ * @param[in]    lqi           LQI of the frame.
+ * @param[in]    time          Timestamp of the frame.
+ */
+static inline void nrf_802154_spinel_write_received_timestamp_raw(
+    nrf_802154_spinel_writer_t * p_writer,
+    uint32_t                     frame_handle,
+    const uint8_t              * p_frame,
+    int8_t                       power,
+    uint8_t                      lqi,
+    uint32_t                     time)
+{
+    nrf_802154_spinel_write_hdata(p_writer, frame_handle, p_frame, p_frame[0]);
+    nrf_802154_spinel_write_int8(p_writer, power);
+    nrf_802154_spinel_write_uint8(p_writer, lqi);
+    nrf_802154_spinel_write_uint32(p_writer, time);
+}
+
+/**
+ * @brief Encodes @ref SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW.
+ *
+ * @param[inout] p_writer      Writer to encode to.
+ * @param[in]    frame_handle  Handle of the transmitted frame.
+ * @param[in]    ack_handle    Handle of the received ACK.
+ * @param[in]    p_ack         Received ACK, with the PHR in the first byte. Can be NULL.
+ * @param[in]    ack_len       Length of the ACK, 0 if @p p_ack is NULL.
+ * @param[in]    power         RSSI of the ACK.
+ * @param[in]    lqi           LQI of the ACK.
+ */
+static inline void nrf_802154_spinel_write_transmitted_raw(nrf_802154_spinel_writer_t * p_writer,
+                                                           uint32_t                     frame_handle,
+                                                           uint32_t                     ack_handle,
+                                                           const uint8_t              * p_ack,
+                                                           size_t                       ack_len,
+                                                           int8_t                       power,
+                                                           uint8_t                      lqi)
+{
+    nrf_802154_spinel_write_uint32(p_writer, frame_handle);
+    nrf_802154_spinel_write_hdata(p_writer, ack_handle, p_ack, ack_len);
+    nrf_802154_spinel_write_int8(p_writer, power);
+    nrf_802154_spinel_write_uint8(p_writer, lqi);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_CODEC_H_ */
+
+/** @} */
@@ -254,6 +254,60 @@ typedef enum
      */
     SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET =
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 31,
+
+    /**
+     * Vendor property for nrf_802154_pending_bit_for_addr_list_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 32,
+
+    /**
+     * Vendor property for nrf_802154_pending_bit_for_addr_list_clear serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 33,
+
+    /**
+     * Vendor property for nrf_802154_stat_histograms_get serialization, one histogram at a time.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 34,
+
+    /**
+     * Vendor property for nrf_802154_stat_histograms_reset serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_RESET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 35,
+
+    /**
+     * Vendor property for nrf_802154_pending_bit_for_addr_list_capacity_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 36,
+
+    /**
+     * Vendor property for nrf_802154_security_key_store serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 37,
+
+    /**
+     * Vendor property for nrf_802154_security_key_remove serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 38,
+
+    /**
+     * Vendor property for nrf_802154_security_global_frame_counter_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 39,
+
+    /**
+     * Vendor property for nrf_802154_security_global_frame_counter_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 40,
 } spinel_prop_vendor_key_t;
 
 /**
@@ -484,6 +538,45 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET     SPINEL_DATATYPE_BOOL_S
 
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_list_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET       \
+    SPINEL_DATATYPE_BOOL_S /* If addresses are extended */             \
+    SPINEL_DATATYPE_BOOL_S /* If addresses replace the current list */ \
+    SPINEL_DATATYPE_DATA_S /* Consecutive addresses */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_list_set return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET_RET   SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_list_clear.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR \
+    SPINEL_DATATYPE_BOOL_S /* If addresses are extended */         \
+    SPINEL_DATATYPE_DATA_S /* Consecutive addresses */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_list_clear return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_list_capacity_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET \
+    SPINEL_DATATYPE_BOOL_S /* If addresses are extended */                \
+    SPINEL_DATATYPE_BOOL_S /* If addresses replace the current list */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_list_capacity_get return
+ *        value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET_RET \
+    SPINEL_DATATYPE_UINT32_S
+
 /**
  * @brief Spinel data type desription for nrf_802154_src_addr_matching_method_set.
  */
@@ -521,6 +614,107 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET SPINEL_DATATYPE_UINT32_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_stat_histograms_get.
+ *
+ * All histograms do not fit in a single frame, so each request fetches one histogram. The
+ * request carries the index of the histogram, in the order of the fields of
+ * @ref nrf_802154_stat_histograms_t.
+ */
+#define SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_GET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Number of buckets described by @ref SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_BUCKETS_S.
+ *
+ * It must be equal to @ref NRF_802154_STAT_HISTOGRAM_BUCKETS.
+ */
+#define NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS 20
+
+/**
+ * @brief Spinel data type description for the buckets of a histogram, one field per bucket.
+ */
+#define SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_BUCKETS_S                    \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S \
+    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT32_S
+
+/**
+ * @brief Expands to the values of the buckets, to be packed as
+ *        @ref SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_BUCKETS_S.
+ */
+#define NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS_VALUES(buckets)               \
+    (buckets)[0], (buckets)[1], (buckets)[2], (buckets)[3], (buckets)[4],      \
+    (buckets)[5], (buckets)[6], (buckets)[7], (buckets)[8], (buckets)[9],      \
+    (buckets)[10], (buckets)[11], (buckets)[12], (buckets)[13], (buckets)[14], \
+    (buckets)[15], (buckets)[16], (buckets)[17], (buckets)[18], (buckets)[19]
+
+/**
+ * @brief Expands to the pointers to the buckets, to be unpacked as
+ *        @ref SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_BUCKETS_S.
+ */
+#define NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS_POINTERS(buckets)                  \
+    &(buckets)[0], &(buckets)[1], &(buckets)[2], &(buckets)[3], &(buckets)[4],      \
+    &(buckets)[5], &(buckets)[6], &(buckets)[7], &(buckets)[8], &(buckets)[9],      \
+    &(buckets)[10], &(buckets)[11], &(buckets)[12], &(buckets)[13], &(buckets)[14], \
+    &(buckets)[15], &(buckets)[16], &(buckets)[17], &(buckets)[18], &(buckets)[19]
+
+/**
+ * @brief Spinel data type description for nrf_802154_stat_histogram_get_ret.
+ */
+#define SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_GET_RET \
+    SPINEL_DATATYPE_UINT8_S /* Index of the histogram */  \
+    SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_BUCKETS_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_stat_histograms_reset.
+ */
+#define SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_RESET SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_store.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE          \
+    SPINEL_DATATYPE_UINT8_S     /* Key Identifier Mode */      \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Key Source and Key Index */ \
+    SPINEL_DATATYPE_DATA_S      /* Value of the key */
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_store return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE_RET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_remove.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE \
+    SPINEL_DATATYPE_UINT8_S /* Key Identifier Mode */  \
+    SPINEL_DATATYPE_DATA_S  /* Key Source and Key Index */
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_remove return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_RET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_global_frame_counter_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET     SPINEL_DATATYPE_UINT32_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_global_frame_counter_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET     SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_global_frame_counter_get return
+ *        value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET_RET SPINEL_DATATYPE_UINT32_S
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,7 @@
 
 #include <stddef.h>
 
+#include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization_error.h"
 
 #ifdef __cplusplus
@@ -68,13 +69,15 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
  * @note Implementation of this function differs for an application core and
  * for network core.
  *
+ * @param[in]  tid       Transaction identifier from the spinel frame header.
  * @param[in]  cmd       Spinel command received
  * @param[in]  p_data    Pointer to a buffer that contains data to be decoded.
  * @param[in]  data_len  Size of the @ref p_data buffer.
  *
  * @returns zero on success or negative error value on failure.
  */
-extern nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
+extern nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_tid_t     tid,
+                                                           spinel_command_t cmd,
                                                            const void     * p_cmd_data,
                                                            size_t           cmd_data_len);
 
@@ -127,16 +127,82 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_capabilities_get_r
     size_t                      property_data_len,
     nrf_802154_capabilities_t * p_capabilities);
 
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_capacity         Decoded capacity of the pending bit list.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_capacity_get_ret(
+    const void * p_property_data,
+    size_t       property_data_len,
+    uint32_t   * p_capacity);
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_index            Decoded index of the histogram.
+ * @param[out] p_histogram        Decoded histogram.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_histogram_get_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    uint8_t                     * p_index,
+    nrf_802154_stat_histogram_t * p_histogram);
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE and
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_err              Decoded result of the key operation.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_security_error_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    nrf_802154_security_error_t * p_err);
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_frame_counter    Decoded frame counter.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_security_global_frame_counter_get_ret(
+    const void * p_property_data,
+    size_t       property_data_len,
+    uint32_t   * p_frame_counter);
+
 /**
  * @brief Decode and dispatch SPINEL_CMD_PROP_VALUE_IS.
  *
+ * @param[in]  tid       Transaction identifier of the request the property responds to,
+ *                       or 0 if the property is not correlated with an asynchronous request.
  * @param[in]  p_data    Pointer to a buffer that contains data to be decoded.
  * @param[in]  data_len  Size of the @ref p_data buffer.
  *
  * @returns zero on success or negative error value on failure.
  *
  */
-nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(const void * cmd_data,
+nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(spinel_tid_t tid,
+                                                                const void * cmd_data,
                                                                 size_t       cmd_data_len);
 
 #ifdef __cplusplus
@@ -66,6 +66,25 @@ extern "C" {
                                prop,                                \
                                __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_SET with a transaction identifier.
+ *
+ * @param[in]  tid    Transaction identifier the response is to be correlated with.
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_cmd_prop_value_set_tid(tid, prop, p_fmt, ...) \
+    nrf_802154_spinel_send_cmd_tid(tid,                                      \
+                                   SPINEL_CMD_PROP_VALUE_SET,                \
+                                   SPINEL_DATATYPE_UINT_PACKED_S p_fmt,      \
+                                   prop,                                     \
+                                   __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
@@ -80,6 +80,40 @@ extern "C" {
                                prop,                                \
                                __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel property SPINEL_PROP_LAST_STATUS as a response to a request.
+ *
+ * @param[in]  tid     Transaction identifier of the request.
+ * @param[in]  status  Spinel status to be serialized and sent.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_response_last_status_is(tid, status)                        \
+    nrf_802154_spinel_send_response_prop_value_is(tid,                                     \
+                                                  SPINEL_PROP_LAST_STATUS,                 \
+                                                  SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS, \
+                                                  status)
+
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS as a response to a request.
+ *
+ * @param[in]  tid    Transaction identifier of the request.
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_response_prop_value_is(tid, prop, p_fmt, ...) \
+    nrf_802154_spinel_send_cmd_tid(tid,                                      \
+                                   SPINEL_CMD_PROP_VALUE_IS,                 \
+                                   SPINEL_DATATYPE_UINT_PACKED_S p_fmt,      \
+                                   prop,                                     \
+                                   __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,64 +47,48 @@
 #include <stdint.h>
 #include <string.h>
 
-static uint8_t * buffer_alloc(nrf_802154_buffer_t * p_buffer_pool, size_t buffer_pool_len)
+static uint8_t * buffer_alloc(nrf_802154_buffer_allocator_t * p_obj)
 {
-    nrf_802154_buffer_t * p_buffer = NULL;
-    bool                  success  = false;
-    bool                  retry    = false;
+    nrf_802154_buffer_t * p_buffer;
     uint32_t              crit_sect;
 
-    do
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    // Take the first buffer from the free list. This takes constant time regardless of
+    // the pool size, so the critical section is kept short
+    p_buffer = p_obj->p_free_head;
+
+    if (p_buffer != NULL)
     {
-        retry = false;
-
-        // Iterate over the buffer pool to search for a free buffer
-        for (uint32_t i = 0; i < buffer_pool_len; i++)
-        {
-            p_buffer = &p_buffer_pool[i];
-
-            if (!p_buffer->taken)
-            {
-                // Free buffer detected. Enter critical section to take it
-                nrf_802154_serialization_crit_sect_enter(&crit_sect);
-
-                if (p_buffer->taken)
-                {
-                    // The allocation was preempted and the buffer was taken by higher priority
-                    // Reiterate over the buffer pool and search for a free buffer again
-                    retry = true;
-                }
-                else
-                {
-                    // The allocation can be performed safely
-                    p_buffer->taken = true;
-                    success         = true;
-                }
-
-                nrf_802154_serialization_crit_sect_exit(crit_sect);
-
-                break;
-            }
-        }
+        assert(!p_buffer->taken);
+
+        p_obj->p_free_head = p_buffer->p_next_free;
+        p_buffer->taken    = true;
     }
-    while (retry);
 
-    return success ? p_buffer->data : NULL;
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return (p_buffer != NULL) ? p_buffer->data : NULL;
 }
 
-static void buffer_free(nrf_802154_buffer_t * p_buffer_to_free,
-                        nrf_802154_buffer_t * p_buffer_pool,
-                        size_t                buffer_pool_len)
+static void buffer_free(void                          * p_buffer_to_free,
+                        nrf_802154_buffer_allocator_t * p_obj)
 {
-    uint32_t crit_sect;
-    size_t   idx =
+    nrf_802154_buffer_t * p_buffer_pool = (nrf_802154_buffer_t *)p_obj->p_memory;
+    uint32_t              crit_sect;
+    size_t                idx =
         ((uintptr_t)p_buffer_to_free - (uintptr_t)p_buffer_pool) / sizeof(nrf_802154_buffer_t);
 
-    assert(idx < buffer_pool_len);
+    assert(idx < p_obj->capacity);
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    p_buffer_pool[idx].taken = false;
+    assert(p_buffer_pool[idx].taken);
+
+    // Return the buffer to the front of the free list
+    p_buffer_pool[idx].taken       = false;
+    p_buffer_pool[idx].p_next_free = p_obj->p_free_head;
+    p_obj->p_free_head             = &p_buffer_pool[idx];
 
     nrf_802154_serialization_crit_sect_exit(crit_sect);
 }
@@ -117,24 +101,28 @@ void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
 
     assert((capacity == 0U) || ((capacity != 0U) && (p_memory != NULL)));
 
-    p_obj->p_memory = p_memory;
-    p_obj->capacity = capacity;
+    p_obj->p_memory    = p_memory;
+    p_obj->capacity    = capacity;
+    p_obj->p_free_head = NULL;
 
     nrf_802154_buffer_t * p_buffer = (nrf_802154_buffer_t *)p_obj->p_memory;
 
-    for (size_t i = 0; i < p_obj->capacity; i++)
+    // Link all buffers into the free list, lowest index first
+    for (size_t i = p_obj->capacity; i > 0U; i--)
     {
-        p_buffer[i].taken = false;
+        p_buffer[i - 1U].taken       = false;
+        p_buffer[i - 1U].p_next_free = p_obj->p_free_head;
+        p_obj->p_free_head           = &p_buffer[i - 1U];
     }
 }
 
-void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p_obj)
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj)
 {
-    return buffer_alloc((nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
+    return buffer_alloc(p_obj);
 }
 
-void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj,
-                                      void                                * p_buffer)
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj,
+                                      void                          * p_buffer)
 {
-    buffer_free(p_buffer, (nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
+    buffer_free(p_buffer, p_obj);
 }
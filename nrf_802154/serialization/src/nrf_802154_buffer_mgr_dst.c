@@ -56,8 +56,31 @@ void nrf_802154_buffer_mgr_dst_init(
     nrf_802154_buffer_allocator_init(&p_obj->allocator,
                                      p_allocator_memory,
                                      NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(buffers_count));
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    p_obj->p_rx_buffer    = NULL;
+    p_obj->rx_buffer_kept = false;
+#endif
+}
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+/* Checks if the data lies within the spinel frame being decoded and the frame can be kept. */
+static bool rx_buffer_can_keep(const nrf_802154_buffer_mgr_dst_t * p_obj,
+                               const void                        * p_data,
+                               size_t                              data_size)
+{
+    const uint8_t * p_begin = p_obj->p_rx_buffer;
+    const uint8_t * p_byte  = p_data;
+
+    return (p_begin != NULL) &&
+           !p_obj->rx_buffer_kept &&
+           (p_byte >= p_begin) &&
+           ((size_t)(p_byte - p_begin) + data_size <= NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN);
 }
 
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
 bool nrf_802154_buffer_mgr_dst_add(
     nrf_802154_buffer_mgr_dst_t * p_obj,
     uint32_t                      buffer_handle,
@@ -67,6 +90,20 @@ bool nrf_802154_buffer_mgr_dst_add(
 {
     bool result = false;
 
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    if (rx_buffer_can_keep(p_obj, p_data, data_size))
+    {
+        // Keep the received buffer and point to the data within it
+        *pp_local_pointer = (void *)p_data;
+        result            = nrf_802154_kvmap_add(&p_obj->map, pp_local_pointer, &buffer_handle);
+
+        assert(result);
+        p_obj->rx_buffer_kept = true;
+
+        return result;
+    }
+#endif
+
     *pp_local_pointer = nrf_802154_buffer_allocator_alloc(&p_obj->allocator);
 
     if (*pp_local_pointer != NULL)
@@ -105,3 +142,40 @@ bool nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
 
     return result;
 }
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+void * nrf_802154_buffer_mgr_dst_rx_buffer_alloc(nrf_802154_buffer_mgr_dst_t * p_obj)
+{
+    return nrf_802154_buffer_allocator_alloc(&p_obj->allocator);
+}
+
+void nrf_802154_buffer_mgr_dst_rx_buffer_decode_begin(nrf_802154_buffer_mgr_dst_t * p_obj,
+                                                      void                        * p_buffer)
+{
+    assert(p_obj->p_rx_buffer == NULL);
+
+    p_obj->p_rx_buffer    = p_buffer;
+    p_obj->rx_buffer_kept = false;
+}
+
+void nrf_802154_buffer_mgr_dst_rx_buffer_decode_end(nrf_802154_buffer_mgr_dst_t * p_obj)
+{
+    assert(p_obj->p_rx_buffer != NULL);
+
+    if (!p_obj->rx_buffer_kept)
+    {
+        nrf_802154_buffer_allocator_free(&p_obj->allocator, p_obj->p_rx_buffer);
+    }
+
+    p_obj->p_rx_buffer    = NULL;
+    p_obj->rx_buffer_kept = false;
+}
+
+void nrf_802154_buffer_mgr_dst_rx_buffer_discard(nrf_802154_buffer_mgr_dst_t * p_obj,
+                                                 void                        * p_buffer)
+{
+    nrf_802154_buffer_allocator_free(&p_obj->allocator, p_buffer);
+}
+
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
@@ -61,7 +61,150 @@ static void item_value_write(const nrf_802154_kvmap_t * p_kvmap,
     }
 }
 
-static size_t item_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+#if NRF_802154_SERIALIZATION_KVMAP_HASH
+
+/* Items are stored in an open-addressing hash table with linear probing.
+ * The table has NRF_802154_KVMAP_SLOTS_PER_ITEM slots per item the map can hold
+ * to keep probe sequences short. Slot states are stored after all slots.
+ */
+
+#define SLOT_FREE 0U
+#define SLOT_USED 1U
+
+static inline uint8_t * slot_states_get(const nrf_802154_kvmap_t * p_kvmap)
+{
+    return item_ptr_by_idx_get(p_kvmap, p_kvmap->slots);
+}
+
+static inline size_t slot_idx_next(const nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    idx++;
+
+    return (idx == p_kvmap->slots) ? 0U : idx;
+}
+
+static size_t slot_idx_home_get(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+{
+    const uint8_t * p_byte = p_key;
+    uint32_t        hash   = 2166136261UL;
+
+    /* FNV-1a */
+    for (size_t i = 0U; i < p_kvmap->key_size; i++)
+    {
+        hash ^= p_byte[i];
+        hash *= 16777619UL;
+    }
+
+    return hash % p_kvmap->slots;
+}
+
+static void memory_init(nrf_802154_kvmap_t * p_kvmap, size_t memsize)
+{
+    p_kvmap->capacity = memsize / NRF_802154_KVMAP_MEMORY_SIZE(1U,
+                                                               p_kvmap->key_size,
+                                                               p_kvmap->val_size);
+    p_kvmap->slots = p_kvmap->capacity * NRF_802154_KVMAP_SLOTS_PER_ITEM;
+
+    if (p_kvmap->slots != 0U)
+    {
+        memset(slot_states_get(p_kvmap), SLOT_FREE, p_kvmap->slots);
+    }
+}
+
+/* Searches for the slot holding the key. When the key is not present, returns
+ * the free slot where the key should be inserted.
+ */
+static bool item_find(const nrf_802154_kvmap_t * p_kvmap, const void * p_key, size_t * p_idx)
+{
+    const uint8_t * p_states = slot_states_get(p_kvmap);
+    size_t          idx;
+
+    if (p_kvmap->slots == 0U)
+    {
+        *p_idx = 0U;
+        return false;
+    }
+
+    idx = slot_idx_home_get(p_kvmap, p_key);
+
+    /* There is always at least one free slot, so the loop terminates. */
+    while (p_states[idx] != SLOT_FREE)
+    {
+        if (memcmp(item_ptr_by_idx_get(p_kvmap, idx), p_key, p_kvmap->key_size) == 0)
+        {
+            /* Hit! */
+            *p_idx = idx;
+            return true;
+        }
+
+        idx = slot_idx_next(p_kvmap, idx);
+    }
+
+    *p_idx = idx;
+    return false;
+}
+
+static uint8_t * item_insert(nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    slot_states_get(p_kvmap)[idx] = SLOT_USED;
+
+    return item_ptr_by_idx_get(p_kvmap, idx);
+}
+
+static void item_delete(nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    uint8_t * p_states  = slot_states_get(p_kvmap);
+    size_t    item_size = NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size);
+    size_t    hole      = idx;
+    size_t    next      = idx;
+    size_t    home;
+    bool      movable;
+
+    /* Backward-shift deletion: items that would become unreachable because of
+     * the hole are moved into it, so no tombstones are needed.
+     */
+    while (true)
+    {
+        next = slot_idx_next(p_kvmap, next);
+
+        if (p_states[next] == SLOT_FREE)
+        {
+            break;
+        }
+
+        home = slot_idx_home_get(p_kvmap, item_ptr_by_idx_get(p_kvmap, next));
+
+        /* Item can be moved if its home slot is not cyclically within (hole, next] */
+        if (next > hole)
+        {
+            movable = (home <= hole) || (home > next);
+        }
+        else
+        {
+            movable = (home <= hole) && (home > next);
+        }
+
+        if (movable)
+        {
+            memcpy(item_ptr_by_idx_get(p_kvmap, hole),
+                   item_ptr_by_idx_get(p_kvmap, next),
+                   item_size);
+            hole = next;
+        }
+    }
+
+    p_states[hole] = SLOT_FREE;
+}
+
+#else // NRF_802154_SERIALIZATION_KVMAP_HASH
+
+static void memory_init(nrf_802154_kvmap_t * p_kvmap, size_t memsize)
+{
+    p_kvmap->capacity = memsize / NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size,
+                                                            p_kvmap->val_size);
+}
+
+static bool item_find(const nrf_802154_kvmap_t * p_kvmap, const void * p_key, size_t * p_idx)
 {
     size_t    item_size = NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size);
     uint8_t * p_item    = p_kvmap->p_memory;
@@ -77,9 +220,38 @@ static size_t item_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap, const v
         }
     }
 
-    return idx;
+    *p_idx = idx;
+
+    return idx < p_kvmap->count;
+}
+
+static uint8_t * item_insert(nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    /* Not found, add next at p_kvmap->count */
+    return item_ptr_by_idx_get(p_kvmap, idx);
 }
 
+static void item_delete(nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    size_t last = p_kvmap->count - 1U;
+
+    if (idx < last)
+    {
+        const uint8_t * p_last_item = item_ptr_by_idx_get(p_kvmap, last);
+        uint8_t       * p_item      = item_ptr_by_idx_get(p_kvmap, idx);
+
+        memcpy(p_item,
+               p_last_item,
+               NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
+    }
+    else
+    {
+        /* We hit last item, no item move necessary */
+    }
+}
+
+#endif // NRF_802154_SERIALIZATION_KVMAP_HASH
+
 void nrf_802154_kvmap_init(nrf_802154_kvmap_t * p_kvmap,
                            void               * p_memory,
                            size_t               memsize,
@@ -87,10 +259,11 @@ void nrf_802154_kvmap_init(nrf_802154_kvmap_t * p_kvmap,
                            size_t               val_size)
 {
     p_kvmap->p_memory = p_memory;
-    p_kvmap->capacity = memsize / NRF_802154_KVMAP_ITEMSIZE(key_size, val_size);
     p_kvmap->key_size = key_size;
     p_kvmap->val_size = val_size;
     p_kvmap->count    = 0U;
+
+    memory_init(p_kvmap, memsize);
 }
 
 bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, const void * p_value)
@@ -101,8 +274,7 @@ bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, cons
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx < p_kvmap->count)
+    if (item_find(p_kvmap, p_key, &idx))
     {
         /* Item already present */
         uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, idx);
@@ -116,8 +288,7 @@ bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, cons
     }
     else
     {
-        /* Not found, try to add next at p_kvmap->count */
-        uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
+        uint8_t * p_item = item_insert(p_kvmap, idx);
 
         memcpy(p_item, p_key, p_kvmap->key_size);
         item_value_write(p_kvmap, p_item, p_value);
@@ -138,28 +309,15 @@ bool nrf_802154_kvmap_remove(nrf_802154_kvmap_t * p_kvmap, const void * p_key)
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx >= p_kvmap->count)
+    if (!item_find(p_kvmap, p_key, &idx))
     {
         /* Key not found */
         success = false;
     }
     else
     {
+        item_delete(p_kvmap, idx);
         p_kvmap->count--;
-        if (idx < p_kvmap->count)
-        {
-            const uint8_t * p_last_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
-            uint8_t       * p_item      = item_ptr_by_idx_get(p_kvmap, idx);
-
-            memcpy(p_item,
-                   p_last_item,
-                   NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
-        }
-        else
-        {
-            /* We hit last item, no item move necessary */
-        }
     }
 
     nrf_802154_serialization_crit_sect_exit(crit_sect);
@@ -177,8 +335,7 @@ bool nrf_802154_kvmap_search(const nrf_802154_kvmap_t * p_kvmap,
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx >= p_kvmap->count)
+    if (!item_find(p_kvmap, p_key, &idx))
     {
         /* Key not found */
         success = false;
@@ -91,26 +91,97 @@ bail:
 
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
 {
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    // Encode the frame in place in the buffer that is handed over to the backend
+    size_t         command_buff_size = NRF_802154_SPINEL_FRAME_BUFFER_SIZE;
+    uint8_t      * command_buff      =
+        nrf_802154_spinel_encoded_packet_buffer_alloc(command_buff_size);
+
+    if (command_buff == NULL)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+#else
     uint8_t        command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
+    size_t         command_buff_size = sizeof(command_buff);
+#endif
     spinel_ssize_t siz;
 
     va_list args;
 
     va_start(args, p_fmt);
 
-    siz = spinel_datatype_vpack(command_buff, sizeof(command_buff), p_fmt, args);
+    siz = spinel_datatype_vpack(command_buff, command_buff_size, p_fmt, args);
 
     va_end(args);
 
     if (siz < 0)
     {
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+        nrf_802154_spinel_encoded_packet_buffer_discard(command_buff);
+#endif
         return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
     }
 
     NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
     NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
 
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    return nrf_802154_spinel_encoded_packet_buffer_send(command_buff, (size_t)siz);
+#else
     return nrf_802154_spinel_encoded_packet_send(command_buff, (size_t)siz);
+#endif
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_frame_begin(nrf_802154_spinel_frame_t * p_frame,
+                                                   spinel_tid_t                tid,
+                                                   spinel_command_t            cmd,
+                                                   spinel_prop_key_t           property)
+{
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    p_frame->p_buffer = nrf_802154_spinel_encoded_packet_buffer_alloc(
+        NRF_802154_SPINEL_FRAME_BUFFER_SIZE);
+
+    if (p_frame->p_buffer == NULL)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+#else
+    p_frame->p_buffer = p_frame->buffer;
+#endif
+
+    nrf_802154_spinel_writer_init(&p_frame->writer,
+                                  p_frame->p_buffer,
+                                  NRF_802154_SPINEL_FRAME_BUFFER_SIZE);
+
+    nrf_802154_spinel_write_uint8(&p_frame->writer,
+                                  SPINEL_HEADER_FLAG | (tid & SPINEL_HEADER_TID_MASK));
+    nrf_802154_spinel_write_uint_packed(&p_frame->writer, cmd);
+    nrf_802154_spinel_write_uint_packed(&p_frame->writer, property);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_frame_send(nrf_802154_spinel_frame_t * p_frame)
+{
+    size_t len = nrf_802154_spinel_writer_length(&p_frame->writer);
+
+    if (!nrf_802154_spinel_writer_ok(&p_frame->writer))
+    {
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+        nrf_802154_spinel_encoded_packet_buffer_discard(p_frame->p_buffer);
+#endif
+        return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_frame->p_buffer, len, "data");
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    return nrf_802154_spinel_encoded_packet_buffer_send(p_frame->p_buffer, len);
+#else
+    return nrf_802154_spinel_encoded_packet_send(p_frame->p_buffer, len);
+#endif
 }
 
 void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
@@ -129,3 +200,30 @@ bail:
 
     return;
 }
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+void * nrf_802154_spinel_encoded_packet_rx_buffer_alloc(size_t max_len)
+{
+    if (max_len > NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN)
+    {
+        return NULL;
+    }
+
+    return nrf_802154_buffer_mgr_dst_rx_buffer_alloc(&m_dst_mgr);
+}
+
+void nrf_802154_spinel_encoded_packet_buffer_received(void * p_buffer, size_t data_len)
+{
+    // Buffers received with the frame are kept by the buffer manager instead of being copied
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_begin(&m_dst_mgr, p_buffer);
+    nrf_802154_spinel_encoded_packet_received(p_buffer, data_len);
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_end(&m_dst_mgr);
+}
+
+void nrf_802154_spinel_encoded_packet_rx_buffer_discard(void * p_buffer)
+{
+    nrf_802154_buffer_mgr_dst_rx_buffer_discard(&m_dst_mgr, p_buffer);
+}
+
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
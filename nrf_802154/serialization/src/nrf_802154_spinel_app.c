@@ -49,7 +49,9 @@
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_async.h"
 #include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_async.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_enc_app.h"
 #include "nrf_802154_spinel_dec_app.h"
@@ -63,6 +65,14 @@
 #include "nrf_802154.h"
 #include "nrf_802154_types.h"
 
+/**
+ * @brief Maximum size of the address list sent in a single spinel frame.
+ *
+ * It is a multiple of both the short and the extended address size and leaves room for the frame
+ * header within @ref NRF_802154_SPINEL_FRAME_MAX_SIZE.
+ */
+#define PENDING_BIT_ADDR_LIST_CHUNK_SIZE 240
+
 /**
  * @brief Wait with timeout for SPINEL_STATUS_OK to be received.
  *
@@ -279,9 +289,235 @@ bail:
     return error;
 }
 
+/**
+ * @brief Wait with timeout for pending bit list capacity property to be received.
+ *
+ * @param[in]  timeout     Timeout in us.
+ * @param[out] p_capacity  Pointer to the capacity variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t pending_bit_list_capacity_await(uint32_t   timeout,
+                                                            uint32_t * p_capacity)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_capacity_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        p_capacity);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", *p_capacity, "Capacity");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Wait with timeout for statistic histogram property to be received.
+ *
+ * @param[in]  timeout      Timeout in us.
+ * @param[in]  index        Index of the requested histogram.
+ * @param[out] p_histogram  Pointer to the histogram structure which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t stat_histogram_await(uint32_t                      timeout,
+                                                 uint8_t                       index,
+                                                 nrf_802154_stat_histogram_t * p_histogram)
+{
+    nrf_802154_ser_err_t              res;
+    uint8_t                           received_index;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_stat_histogram_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        &received_index,
+        p_histogram);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    SERIALIZATION_ERROR_IF(received_index != index,
+                           NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE,
+                           error,
+                           bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Wait with timeout for the result of a frame security key operation to be received.
+ *
+ * @param[in]  timeout  Timeout in us.
+ * @param[out] p_err    Pointer to the result variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t security_error_await(uint32_t                      timeout,
+                                                 nrf_802154_security_error_t * p_err)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_security_error_ret(p_notify_data->data,
+                                                                      p_notify_data->data_len,
+                                                                      p_err);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", *p_err, "Security error");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Wait with timeout for the global frame counter property to be received.
+ *
+ * @param[in]  timeout          Timeout in us.
+ * @param[out] p_frame_counter  Pointer to the frame counter variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t frame_counter_await(uint32_t timeout, uint32_t * p_frame_counter)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_security_global_frame_counter_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        p_frame_counter);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", *p_frame_counter, "Frame counter");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Get the size of the Key Source and Key Index fields of a Key Identifier Mode.
+ *
+ * @param[in]  mode  Key Identifier Mode.
+ *
+ * @returns  Size of the fields, or 0 if the mode is not supported.
+ */
+static uint32_t security_key_id_size_get(uint8_t mode)
+{
+    switch (mode)
+    {
+        case 1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Complete sending of an asynchronous request.
+ *
+ * @param[in]  tid  Transaction identifier of the request.
+ * @param[in]  res  Result of sending the request.
+ *
+ * @returns  @p res.
+ *
+ */
+static nrf_802154_ser_err_t async_request_sent(spinel_tid_t tid, nrf_802154_ser_err_t res)
+{
+    if (res < 0)
+    {
+        // No response is going to arrive for a request that could not be sent
+        nrf_802154_spinel_async_request_abort(tid);
+    }
+
+    return res;
+}
+
 void nrf_802154_init(void)
 {
     nrf_802154_serialization_init();
+    nrf_802154_spinel_async_init();
 }
 
 bool nrf_802154_sleep(void)
@@ -619,6 +855,148 @@ bail:
     return;
 }
 
+bool nrf_802154_pending_bit_for_addr_list_set(const uint8_t * p_addrs,
+                                              uint32_t        num_addrs,
+                                              bool            extended,
+                                              bool            replace)
+{
+    nrf_802154_ser_err_t res;
+    size_t               addr_len        = extended ? 8 : 2;
+    uint32_t             max_chunk_addrs = PENDING_BIT_ADDR_LIST_CHUNK_SIZE / addr_len;
+    uint32_t             chunk_addrs;
+    bool                 list_set_res    = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_addrs, num_addrs * addr_len);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (replace ? "true" : "false"), "replace");
+
+    // Lists that do not fit in a single frame are sent in chunks. Only the first chunk replaces
+    // the current list, the following ones are merged into it. A chunk that does not fit would
+    // leave the list partially updated, so the capacity is checked before the first chunk.
+    if ((num_addrs > max_chunk_addrs) &&
+        (nrf_802154_pending_bit_for_addr_list_capacity_get(extended, replace) < num_addrs))
+    {
+        return false;
+    }
+
+    do
+    {
+        chunk_addrs = (num_addrs < max_chunk_addrs) ? num_addrs : max_chunk_addrs;
+
+        nrf_802154_spinel_response_notifier_lock_before_request(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET,
+            SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET,
+            extended,
+            replace,
+            p_addrs,
+            chunk_addrs * addr_len);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = net_generic_bool_response_await(&list_set_res,
+                                              CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        p_addrs   += chunk_addrs * addr_len;
+        num_addrs -= chunk_addrs;
+        replace    = false;
+    }
+    while (list_set_res && (num_addrs > 0));
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return list_set_res;
+}
+
+uint32_t nrf_802154_pending_bit_for_addr_list_capacity_get(bool extended, bool replace)
+{
+    nrf_802154_ser_err_t res;
+    uint32_t             capacity = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (replace ? "true" : "false"), "replace");
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET,
+        extended,
+        replace);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = pending_bit_list_capacity_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &capacity);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return capacity;
+}
+
+bool nrf_802154_pending_bit_for_addr_list_clear(const uint8_t * p_addrs,
+                                                uint32_t        num_addrs,
+                                                bool            extended)
+{
+    nrf_802154_ser_err_t res;
+    size_t               addr_len        = extended ? 8 : 2;
+    uint32_t             max_chunk_addrs = PENDING_BIT_ADDR_LIST_CHUNK_SIZE / addr_len;
+    uint32_t             chunk_addrs;
+    bool                 chunk_clr_res   = false;
+    bool                 list_clr_res    = true;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_addrs, num_addrs * addr_len);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    while (num_addrs > 0)
+    {
+        chunk_addrs = (num_addrs < max_chunk_addrs) ? num_addrs : max_chunk_addrs;
+
+        nrf_802154_spinel_response_notifier_lock_before_request(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR,
+            SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR,
+            extended,
+            p_addrs,
+            chunk_addrs * addr_len);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = net_generic_bool_response_await(&chunk_clr_res,
+                                              CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        list_clr_res &= chunk_clr_res;
+        p_addrs      += chunk_addrs * addr_len;
+        num_addrs    -= chunk_addrs;
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return list_clr_res && (error == NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
 void nrf_802154_channel_set(uint8_t channel)
 {
     nrf_802154_ser_err_t res;
@@ -736,8 +1114,9 @@ bail:
 
 void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data)
 {
-    nrf_802154_ser_err_t res;
-    uint32_t             data_handle;
+    nrf_802154_ser_err_t      res;
+    uint32_t                  data_handle;
+    nrf_802154_spinel_frame_t frame;
 
     SERIALIZATION_ERROR_INIT(error);
 
@@ -752,10 +1131,16 @@ void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data)
 
     nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
-        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]));
+    res = nrf_802154_spinel_frame_begin(&frame,
+                                        0U,
+                                        SPINEL_CMD_PROP_VALUE_SET,
+                                        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    nrf_802154_spinel_write_transmit_csma_ca_raw(&frame.writer, data_handle, p_data);
+
+    res = nrf_802154_spinel_frame_send(&frame);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -770,9 +1155,10 @@ bail:
 
 bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
 {
-    nrf_802154_ser_err_t res;
-    uint32_t             data_handle;
-    bool                 transmit_result = false;
+    nrf_802154_ser_err_t      res;
+    uint32_t                  data_handle;
+    bool                      transmit_result = false;
+    nrf_802154_spinel_frame_t frame;
 
     SERIALIZATION_ERROR_INIT(error);
 
@@ -788,11 +1174,16 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
     nrf_802154_spinel_response_notifier_lock_before_request(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
-        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]),
-        cca);
+    res = nrf_802154_spinel_frame_begin(&frame,
+                                        0U,
+                                        SPINEL_CMD_PROP_VALUE_SET,
+                                        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    nrf_802154_spinel_write_transmit_raw(&frame.writer, data_handle, p_data, cca);
+
+    res = nrf_802154_spinel_frame_send(&frame);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -940,7 +1331,416 @@ bail:
     return caps;
 }
 
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms)
+{
+    int32_t                       res;
+    // Histograms are fetched one by one, because all of them do not fit in a single frame.
+    nrf_802154_stat_histogram_t * p_histograms = (nrf_802154_stat_histogram_t *)p_stat_histograms;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    for (uint8_t i = 0; i < sizeof(*p_stat_histograms) / sizeof(p_histograms[0]); i++)
+    {
+        nrf_802154_spinel_response_notifier_lock_before_request(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET,
+            SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_GET,
+            i);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = stat_histogram_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                   i,
+                                   &p_histograms[i]);
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+void nrf_802154_stat_histograms_reset(void)
+{
+    int32_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_RESET,
+        SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_RESET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+nrf_802154_security_error_t nrf_802154_security_key_store(const nrf_802154_key_t * p_key)
+{
+    nrf_802154_ser_err_t        res;
+    nrf_802154_security_error_t err    = NRF_802154_SECURITY_ERROR_STORAGE_FULL;
+    uint32_t                    id_len = security_key_id_size_get(p_key->id.mode);
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", p_key->id.mode, "mode");
+    NRF_802154_SPINEL_LOG_BUFF(p_key->id.p_key_id, id_len);
+
+    // The network core rejects an unsupported mode, so its identifier is not sent.
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+        p_key->id.mode,
+        p_key->id.p_key_id,
+        id_len,
+        p_key->value,
+        sizeof(p_key->value));
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = security_error_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &err);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return err;
+}
+
+nrf_802154_security_error_t nrf_802154_security_key_remove(const nrf_802154_key_id_t * p_id)
+{
+    nrf_802154_ser_err_t        res;
+    nrf_802154_security_error_t err    = NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    uint32_t                    id_len = security_key_id_size_get(p_id->mode);
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", p_id->mode, "mode");
+    NRF_802154_SPINEL_LOG_BUFF(p_id->p_key_id, id_len);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+        p_id->mode,
+        p_id->p_key_id,
+        id_len);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = security_error_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &err);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return err;
+}
+
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", frame_counter);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+        frame_counter);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+uint32_t nrf_802154_security_global_frame_counter_get(void)
+{
+    nrf_802154_ser_err_t res;
+    uint32_t             frame_counter = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = frame_counter_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &frame_counter);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return frame_counter;
+}
+
 int8_t nrf_802154_dbm_from_energy_level_calculate(uint8_t energy_level)
 {
     return ED_MIN_DBM + (energy_level / ED_RESULT_FACTOR);
 }
+
+nrf_802154_ser_err_t nrf_802154_pan_id_set_async(
+    const uint8_t                 * p_pan_id,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_pan_id, PAN_ID_SIZE);
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+        p_pan_id,
+        PAN_ID_SIZE);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_short_address_set_async(
+    const uint8_t                 * p_short_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_short_address, SHORT_ADDRESS_SIZE);
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET,
+        SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
+        p_short_address,
+        SHORT_ADDRESS_SIZE);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_extended_address_set_async(
+    const uint8_t                 * p_extended_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_extended_address, EXTENDED_ADDRESS_SIZE);
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET,
+        SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
+        p_extended_address,
+        EXTENDED_ADDRESS_SIZE);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_pending_bit_for_addr_set_async(
+    const uint8_t                 * p_addr,
+    bool                            extended,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? 8 : 2);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+        p_addr,
+        extended ? 8 : 2);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_pending_bit_for_addr_clear_async(
+    const uint8_t                 * p_addr,
+    bool                            extended,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? 8 : 2);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+        p_addr,
+        extended ? 8 : 2);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_pending_bit_for_addr_reset_async(
+    bool                            extended,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+        extended);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_channel_set_async(
+    uint8_t                         channel,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", channel);
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_SET,
+        SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
+        channel);
+
+    return async_request_sent(tid, res);
+}
+
+nrf_802154_ser_err_t nrf_802154_tx_power_set_async(
+    int8_t                          power,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    spinel_tid_t         tid;
+    nrf_802154_ser_err_t res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%d", power);
+
+    res = nrf_802154_spinel_async_request_start(callback, p_context, &tid);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET,
+        SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+        power);
+
+    return async_request_sent(tid, res);
+}
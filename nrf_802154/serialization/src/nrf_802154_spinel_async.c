@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2020 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_async.c
+ *
+ * @brief Tracking of asynchronous requests sent by the application core.
+ *
+ * Each outstanding request occupies a slot indexed by its spinel transaction identifier.
+ * The network core echoes the identifier in the response, which is used here to find
+ * the completion callback of the request.
+ *
+ * A request that is cancelled or times out leaves its slot stale. A stale slot is released
+ * when the late response arrives or after another timeout period, so that its identifier
+ * is never matched with a response to the abandoned request.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_async.h"
+#include "nrf_802154_spinel_dec_app.h"
+#include "nrf_802154_spinel_log.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+
+#if NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+#include "nrf_802154_serialization_time.h"
+#endif
+
+#if (NRF_802154_SERIALIZATION_ASYNC_REQUESTS < 1) || \
+    (NRF_802154_SERIALIZATION_ASYNC_REQUESTS > 15)
+#error "NRF_802154_SERIALIZATION_ASYNC_REQUESTS must be in range 1..15"
+#endif
+
+/**
+ * @brief States of a request slot.
+ */
+typedef enum
+{
+    ASYNC_SLOT_FREE,    ///< The slot can be used for a new request.
+    ASYNC_SLOT_PENDING, ///< The request awaits its response.
+    ASYNC_SLOT_STALE,   ///< The request was cancelled or timed out and its response is dropped.
+} async_slot_state_t;
+
+/**
+ * @brief Outstanding asynchronous request.
+ */
+typedef struct
+{
+    nrf_802154_ser_async_callback_t callback;  ///< Completion callback.
+    void                          * p_context; ///< Context passed to the completion callback.
+    uint32_t                        deadline;  ///< Time at which the slot state expires.
+    async_slot_state_t              state;     ///< State of the slot.
+} async_request_t;
+
+static async_request_t m_requests[NRF_802154_SERIALIZATION_ASYNC_REQUESTS];
+static uint8_t         m_next_slot;
+
+/**
+ * @brief Converts a slot index to a transaction identifier. Identifier 0 is reserved.
+ */
+static inline spinel_tid_t tid_from_slot(uint8_t slot)
+{
+    return (spinel_tid_t)(slot + 1U);
+}
+
+/**
+ * @brief Converts a transaction identifier to a slot index.
+ */
+static inline uint8_t slot_from_tid(spinel_tid_t tid)
+{
+    return (uint8_t)(tid - 1U);
+}
+
+#if NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+
+/**
+ * @brief Calculates the deadline of a slot state entered now.
+ */
+static inline uint32_t deadline_get(void)
+{
+    return nrf_802154_serialization_time_get() + NRF_802154_SERIALIZATION_ASYNC_TIMEOUT;
+}
+
+/**
+ * @brief Checks if the deadline of a slot state has passed. Safe for time wrapping around.
+ */
+static inline bool deadline_passed(uint32_t deadline, uint32_t now)
+{
+    return (int32_t)(now - deadline) >= 0;
+}
+
+#else // NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+
+static inline uint32_t deadline_get(void)
+{
+    return 0U;
+}
+
+#endif // NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+
+void nrf_802154_spinel_async_init(void)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    for (uint8_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        m_requests[i].state = ASYNC_SLOT_FREE;
+    }
+
+    m_next_slot = 0U;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_async_request_start(
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context,
+    spinel_tid_t                  * p_tid)
+{
+    uint32_t             crit_sect;
+    nrf_802154_ser_err_t res = NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+
+    // Release slots of requests that have timed out before looking for a free one
+    (void)nrf_802154_serialization_async_timeouts_process();
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    // Start the search after the most recently used slot, so that an identifier
+    // is not reused immediately after its response has been handled
+    for (uint8_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        uint8_t slot = (uint8_t)((m_next_slot + i) % NRF_802154_SERIALIZATION_ASYNC_REQUESTS);
+
+        if (m_requests[slot].state == ASYNC_SLOT_FREE)
+        {
+            m_requests[slot].callback  = callback;
+            m_requests[slot].p_context = p_context;
+            m_requests[slot].deadline  = deadline_get();
+            m_requests[slot].state     = ASYNC_SLOT_PENDING;
+
+            m_next_slot = (uint8_t)((slot + 1U) % NRF_802154_SERIALIZATION_ASYNC_REQUESTS);
+            *p_tid      = tid_from_slot(slot);
+            res         = NRF_802154_SERIALIZATION_ERROR_OK;
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return res;
+}
+
+void nrf_802154_spinel_async_request_abort(spinel_tid_t tid)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_requests[slot_from_tid(tid)].state = ASYNC_SLOT_FREE;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_async_response_handle(spinel_tid_t      tid,
+                                                             spinel_prop_key_t property,
+                                                             const void      * p_property_data,
+                                                             size_t            property_data_len)
+{
+    uint32_t                        crit_sect;
+    nrf_802154_ser_async_callback_t callback  = NULL;
+    void                          * p_context = NULL;
+    async_slot_state_t              state;
+    bool                            result = false;
+    nrf_802154_ser_err_t            res;
+    uint8_t                         slot   = slot_from_tid(tid);
+
+    if ((tid == 0U) || (slot >= NRF_802154_SERIALIZATION_ASYNC_REQUESTS))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    state = m_requests[slot].state;
+
+    if (state == ASYNC_SLOT_PENDING)
+    {
+        callback  = m_requests[slot].callback;
+        p_context = m_requests[slot].p_context;
+    }
+
+    m_requests[slot].state = ASYNC_SLOT_FREE;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (state == ASYNC_SLOT_STALE)
+    {
+        // Late response to a cancelled or timed out request
+        NRF_802154_SPINEL_LOG_RAW("Dropped late response, tid: %u\n", tid);
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    if (state == ASYNC_SLOT_FREE)
+    {
+        // Response to a request that is not outstanding
+        return NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+    }
+
+    if (property == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status = SPINEL_STATUS_FAILURE;
+
+        res = nrf_802154_spinel_decode_prop_last_status(p_property_data,
+                                                        property_data_len,
+                                                        &status);
+
+        result = (status == SPINEL_STATUS_OK);
+    }
+    else
+    {
+        res = nrf_802154_spinel_decode_prop_generic_bool(p_property_data,
+                                                         property_data_len,
+                                                         &result);
+    }
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", tid, "tid");
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", result ? "true" : "false", "result");
+
+    if (callback != NULL)
+    {
+        // Failure status reported by the network core is passed to the callback through result
+        callback((res < 0) ? res : NRF_802154_SERIALIZATION_ERROR_OK, result, p_context);
+    }
+
+    return (res < 0) ? res : NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+uint8_t nrf_802154_serialization_async_cancel(nrf_802154_ser_async_callback_t callback,
+                                              const void                    * p_context)
+{
+    uint32_t crit_sect;
+    uint8_t  cancelled = 0U;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    for (uint8_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        if ((m_requests[i].state == ASYNC_SLOT_PENDING) &&
+            (m_requests[i].callback == callback) &&
+            (m_requests[i].p_context == p_context))
+        {
+            m_requests[i].deadline = deadline_get();
+            m_requests[i].state    = ASYNC_SLOT_STALE;
+            cancelled++;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return cancelled;
+}
+
+uint8_t nrf_802154_serialization_async_timeouts_process(void)
+{
+    uint8_t timed_out = 0U;
+
+#if NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+    for (uint8_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        uint32_t                        crit_sect;
+        nrf_802154_ser_async_callback_t callback = NULL;
+        void                          * p_context;
+        bool                            expired  = false;
+        uint32_t                        now      = nrf_802154_serialization_time_get();
+
+        nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+        if ((m_requests[i].state != ASYNC_SLOT_FREE) &&
+            deadline_passed(m_requests[i].deadline, now))
+        {
+            if (m_requests[i].state == ASYNC_SLOT_PENDING)
+            {
+                // Keep the identifier reserved for another period in case the response comes late
+                callback               = m_requests[i].callback;
+                p_context              = m_requests[i].p_context;
+                m_requests[i].deadline = now + NRF_802154_SERIALIZATION_ASYNC_TIMEOUT;
+                m_requests[i].state    = ASYNC_SLOT_STALE;
+                expired                = true;
+            }
+            else
+            {
+                m_requests[i].state = ASYNC_SLOT_FREE;
+            }
+        }
+
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+        if (expired)
+        {
+            timed_out++;
+
+            if (callback != NULL)
+            {
+                callback(NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT, false, p_context);
+            }
+        }
+    }
+#endif // NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+
+    return timed_out;
+}
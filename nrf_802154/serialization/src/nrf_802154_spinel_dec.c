@@ -37,29 +37,33 @@
 #include <stddef.h>
 
 #include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_serialization_error.h"
 
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len)
 {
-    uint8_t          header;
-    spinel_command_t cmd;
-    const void     * p_cmd_data;
-    size_t           cmd_data_len;
+    nrf_802154_spinel_reader_t reader;
+    uint8_t                    header;
+    spinel_command_t           cmd;
+    const void               * p_cmd_data;
+    size_t                     cmd_data_len;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(p_packet_data,
-                                                packet_data_len,
-                                                SPINEL_DATATYPE_COMMAND_S SPINEL_DATATYPE_DATA_S,
-                                                &header,
-                                                &cmd,
-                                                &p_cmd_data,
-                                                &cmd_data_len);
+    // SPINEL_DATATYPE_COMMAND_S SPINEL_DATATYPE_DATA_S
+    nrf_802154_spinel_reader_init(&reader, p_packet_data, packet_data_len);
 
-    if (siz < 0)
+    header     = nrf_802154_spinel_read_uint8(&reader);
+    cmd        = nrf_802154_spinel_read_uint_packed(&reader);
+    p_cmd_data = nrf_802154_spinel_read_data(&reader, &cmd_data_len);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    return nrf_802154_spinel_dispatch_cmd(cmd, p_cmd_data, cmd_data_len);
+    return nrf_802154_spinel_dispatch_cmd(SPINEL_HEADER_GET_TID(header),
+                                          cmd,
+                                          p_cmd_data,
+                                          cmd_data_len);
 }
@@ -34,6 +34,7 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #ifndef TEST
 #include <nrf.h>
@@ -41,7 +42,9 @@
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_async.h"
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_spinel_log.h"
@@ -51,6 +54,10 @@
 
 #include "nrf_802154.h"
 
+#if NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS != NRF_802154_STAT_HISTOGRAM_BUCKETS
+#error "Serialized histograms must have the same number of buckets as the driver histograms"
+#endif
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_DONE.
  *
@@ -169,25 +176,24 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t remote_frame_handle;
-    void   * p_frame;
-    size_t   frame_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    uint32_t timestamp;
-    void   * p_local_ptr;
-
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-                                                NRF_802154_HDATA_DECODE(remote_frame_handle,
-                                                                        p_frame,
-                                                                        frame_hdata_len),
-                                                &power,
-                                                &lqi,
-                                                &timestamp);
-
-    if (siz < 0)
+    nrf_802154_spinel_reader_t reader;
+    uint32_t                   remote_frame_handle;
+    const void               * p_frame;
+    size_t                     frame_hdata_len;
+    int8_t                     power;
+    uint8_t                    lqi;
+    uint32_t                   timestamp;
+    void                     * p_local_ptr;
+
+    // SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    p_frame   = nrf_802154_spinel_read_hdata(&reader, &remote_frame_handle, &frame_hdata_len);
+    power     = nrf_802154_spinel_read_int8(&reader);
+    lqi       = nrf_802154_spinel_read_uint8(&reader);
+    timestamp = nrf_802154_spinel_read_uint32(&reader);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -277,26 +283,25 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmitted_raw(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t frame_handle;
-    uint32_t remote_ack_handle;
-    void   * p_ack;
-    size_t   ack_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    void   * p_frame;
-    void   * p_ack_local_ptr = NULL;
-
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
-                                                &frame_handle,
-                                                NRF_802154_HDATA_DECODE(remote_ack_handle,
-                                                                        p_ack,
-                                                                        ack_hdata_len),
-                                                &power,
-                                                &lqi);
-
-    if (siz < 0)
+    nrf_802154_spinel_reader_t reader;
+    uint32_t                   frame_handle;
+    uint32_t                   remote_ack_handle;
+    const void               * p_ack;
+    size_t                     ack_hdata_len;
+    int8_t                     power;
+    uint8_t                    lqi;
+    void                     * p_frame;
+    void                     * p_ack_local_ptr = NULL;
+
+    // SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    frame_handle = nrf_802154_spinel_read_uint32(&reader);
+    p_ack        = nrf_802154_spinel_read_hdata(&reader, &remote_ack_handle, &ack_hdata_len);
+    power        = nrf_802154_spinel_read_int8(&reader);
+    lqi          = nrf_802154_spinel_read_uint8(&reader);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -471,23 +476,85 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_capabilities_get_r
             NRF_802154_SERIALIZATION_ERROR_OK);
 }
 
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_capacity_get_ret(
+    const void * p_property_data,
+    size_t       property_data_len,
+    uint32_t   * p_capacity)
+{
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET_RET,
+        p_capacity);
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_histogram_get_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    uint8_t                     * p_index,
+    nrf_802154_stat_histogram_t * p_histogram)
+{
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_GET_RET,
+        p_index,
+        NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS_POINTERS(p_histogram->buckets));
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_security_error_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    nrf_802154_security_error_t * p_err)
+{
+    // Key store and key remove return values have the same format.
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE_RET,
+                                                p_err);
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_security_global_frame_counter_get_ret(
+    const void * p_property_data,
+    size_t       property_data_len,
+    uint32_t   * p_frame_counter)
+{
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET_RET,
+        p_frame_counter);
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
+    spinel_tid_t tid,
     const void * p_cmd_data,
     size_t       cmd_data_len)
 {
-    spinel_prop_key_t property;
-    const void      * p_property_data;
-    size_t            property_data_len;
-    spinel_ssize_t    siz;
-
-    siz = spinel_datatype_unpack(p_cmd_data,
-                                 cmd_data_len,
-                                 SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S,
-                                 &property,
-                                 &p_property_data,
-                                 &property_data_len);
+    nrf_802154_spinel_reader_t reader;
+    spinel_prop_key_t          property;
+    const void               * p_property_data;
+    size_t                     property_data_len;
 
-    if (siz < 0)
+    // SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S
+    nrf_802154_spinel_reader_init(&reader, p_cmd_data, cmd_data_len);
+
+    property        = nrf_802154_spinel_read_uint_packed(&reader);
+    p_property_data = nrf_802154_spinel_read_data(&reader, &property_data_len);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -510,11 +577,34 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET:
         // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET:
+        // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
         // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET:
+        // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW:
+            if (tid != 0U)
+            {
+                // Response to an asynchronous request
+                return nrf_802154_spinel_async_response_handle(tid,
+                                                               property,
+                                                               p_property_data,
+                                                               property_data_len);
+            }
+
             nrf_802154_spinel_response_notifier_property_notify(property,
                                                                 p_property_data,
                                                                 property_data_len);
@@ -564,14 +654,15 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
     }
 }
 
-nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
+nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_tid_t     tid,
+                                                    spinel_command_t cmd,
                                                     const void     * p_cmd_data,
                                                     size_t           cmd_data_len)
 {
     switch (cmd)
     {
         case SPINEL_CMD_PROP_VALUE_IS:
-            return nrf_802154_spinel_decode_cmd_prop_value_is(p_cmd_data, cmd_data_len);
+            return nrf_802154_spinel_decode_cmd_prop_value_is(tid, p_cmd_data, cmd_data_len);
 
         default:
             NRF_802154_SPINEL_LOG_RAW("Unsupported command: %s(%u)\n",
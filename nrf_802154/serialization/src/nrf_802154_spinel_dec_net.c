@@ -34,10 +34,12 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_const.h"
 
 #include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_enc_net.h"
@@ -49,6 +51,23 @@
 
 #include "nrf_802154.h"
 
+#if NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS != NRF_802154_STAT_HISTOGRAM_BUCKETS
+#error "Serialized histograms must have the same number of buckets as the driver histograms"
+#endif
+
+/**
+ * @brief Transaction identifier of the request being decoded.
+ *
+ * Responses are sent with the same identifier, so that the application core can match them
+ * to asynchronous requests.
+ *
+ * A single variable suffices because dispatch is serial: spinel frames are decoded one at
+ * a time from a single context, and each request decoder sends its response before it returns.
+ * A decoder that deferred its response or a backend that decoded frames concurrently would
+ * have to carry the identifier with the request instead.
+ */
+static spinel_tid_t m_request_tid;
+
 /**
  * @brief Deal with SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP request and send response.
  *
@@ -66,9 +85,11 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_sleep(const void * p_p
 
     sleep_response = nrf_802154_sleep();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
-                                                    SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
-                                                    sleep_response);
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
+        SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
+        sleep_response);
 }
 
 /**
@@ -88,9 +109,11 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive(const void * p
 
     receive_response = nrf_802154_receive();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
-                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
-                                                    receive_response);
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
+        receive_response);
 }
 
 static nrf_802154_ser_err_t spinel_decode_prop_nrf_802514_channel_get(const void * p_property_data,
@@ -99,7 +122,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802514_channel_get(const void
     (void)p_property_data;
     (void)property_data_len;
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET,
         SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
         nrf_802154_channel_get());
@@ -123,7 +147,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802514_channel_set(const void
 
     nrf_802154_channel_set(channel);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -159,7 +183,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_id_set(
 
     nrf_802154_pan_id_set((uint8_t *)p_pan_id);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -195,7 +219,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_short_address_set(
 
     nrf_802154_short_address_set((uint8_t *)p_short_address);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -231,7 +255,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_extended_address_set(
 
     nrf_802154_extended_address_set((uint8_t *)p_extended_address);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -260,7 +284,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_coord_set(
 
     nrf_802154_pan_coord_set(enabled);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -289,7 +313,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_promiscuous_set(
 
     nrf_802154_promiscuous_set(enabled);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -307,9 +331,11 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca(const void * p_pro
 
     bool result = nrf_802154_cca();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
-                                                    SPINEL_DATATYPE_NRF_802154_CCA_RET,
-                                                    result);
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
+        SPINEL_DATATYPE_NRF_802154_CCA_RET,
+        result);
 }
 
 /**
@@ -338,7 +364,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection(
 
     bool result = nrf_802154_energy_detection(time_us);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION,
         SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
         result);
@@ -369,7 +396,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_auto_pending_bit_set(
 
     nrf_802154_auto_pending_bit_set(enabled);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -414,7 +441,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_s
 
     result = nrf_802154_pending_bit_for_addr_set(p_addr, extended);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
         result);
@@ -463,12 +491,144 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_c
 
     result = nrf_802154_pending_bit_for_addr_clear(p_addr, extended);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
         result);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    const uint8_t * p_addrs;
+    size_t          addrs_len;
+    size_t          addr_len;
+    bool            extended;
+    bool            replace;
+    bool            result = false;
+    spinel_ssize_t  siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET,
+                                 &extended,
+                                 &replace,
+                                 &p_addrs,
+                                 &addrs_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    addr_len = extended ? 8 : 2;
+
+    if ((addrs_len % addr_len) != 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    result = nrf_802154_pending_bit_for_addr_list_set(p_addrs,
+                                                      addrs_len / addr_len,
+                                                      extended,
+                                                      replace);
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_capacity_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    bool           extended;
+    bool           replace;
+    uint32_t       capacity;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET,
+                                 &extended,
+                                 &replace);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    capacity = nrf_802154_pending_bit_for_addr_list_capacity_get(extended, replace);
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET_RET,
+        capacity);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_clear(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    const uint8_t * p_addrs;
+    size_t          addrs_len;
+    size_t          addr_len;
+    bool            extended;
+    bool            result = false;
+    spinel_ssize_t  siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR,
+                                 &extended,
+                                 &p_addrs,
+                                 &addrs_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    addr_len = extended ? 8 : 2;
+
+    if ((addrs_len % addr_len) != 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    result = nrf_802154_pending_bit_for_addr_list_clear(p_addrs, addrs_len / addr_len, extended);
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR_RET,
+        result);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET.
  *
@@ -495,7 +655,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_r
 
     nrf_802154_pending_bit_for_addr_reset(extended);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -531,12 +691,14 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_src_addr_matching_meth
             break;
 
         default:
-            return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_INVALID_ARGUMENT);
+            return nrf_802154_spinel_send_response_last_status_is(
+                m_request_tid,
+                SPINEL_STATUS_INVALID_ARGUMENT);
     }
 
     nrf_802154_src_addr_matching_method_set(match_method);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -550,18 +712,18 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t     remote_frame_handle;
-    const void * p_frame;
-    size_t       frame_hdata_len;
-    void       * p_local_frame_ptr;
+    nrf_802154_spinel_reader_t reader;
+    uint32_t                   remote_frame_handle;
+    const void               * p_frame;
+    size_t                     frame_hdata_len;
+    void                     * p_local_frame_ptr;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(
-        p_property_data,
-        property_data_len,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
-        NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len));
+    // SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
 
-    if (siz < 0)
+    p_frame = nrf_802154_spinel_read_hdata(&reader, &remote_frame_handle, &frame_hdata_len);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -582,7 +744,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(
     // Transmit the content under the locally accessible pointer
     nrf_802154_transmit_csma_ca_raw(p_local_frame_ptr);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -596,20 +758,20 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t     remote_frame_handle;
-    const void * p_frame;
-    size_t       frame_hdata_len;
-    bool         cca;
-    void       * p_local_frame_ptr;
+    nrf_802154_spinel_reader_t reader;
+    uint32_t                   remote_frame_handle;
+    const void               * p_frame;
+    size_t                     frame_hdata_len;
+    bool                       cca;
+    void                     * p_local_frame_ptr;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(
-        p_property_data,
-        property_data_len,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
-        NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len),
-        &cca);
+    // SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
 
-    if (siz < 0)
+    p_frame = nrf_802154_spinel_read_hdata(&reader, &remote_frame_handle, &frame_hdata_len);
+    cca     = nrf_802154_spinel_read_bool(&reader);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -635,7 +797,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw(
                                                           p_local_frame_ptr);
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
         result);
@@ -652,15 +815,16 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t local_frame_handle;
-    void   * p_local_ptr;
+    nrf_802154_spinel_reader_t reader;
+    uint32_t                   local_frame_handle;
+    void                     * p_local_ptr;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
-                                                &local_frame_handle);
+    // SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
 
-    if (siz < 0)
+    local_frame_handle = nrf_802154_spinel_read_uint32(&reader);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -687,7 +851,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
         }
     }
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -714,7 +878,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_power_set(const voi
 
     nrf_802154_tx_power_set(power);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
 }
 
 /**
@@ -734,7 +898,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_power_get(const voi
 
     power = nrf_802154_tx_power_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
         SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
         power);
@@ -758,28 +923,258 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_capabilities_get(
 
     caps = nrf_802154_capabilities_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
         SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
         caps);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_stat_histogram_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_stat_histograms_t        histograms;
+    const nrf_802154_stat_histogram_t * p_histogram;
+    uint8_t                             index;
+    spinel_ssize_t                      siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_GET,
+                                 &index);
+
+    if ((siz < 0) || (index >= sizeof(histograms) / sizeof(histograms.csmaca_access_delay)))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_stat_histograms_get(&histograms);
+
+    p_histogram = &((const nrf_802154_stat_histogram_t *)&histograms)[index];
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET,
+        SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAM_GET_RET,
+        index,
+        NRF_802154_SPINEL_STAT_HISTOGRAM_BUCKETS_VALUES(p_histogram->buckets));
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_RESET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_stat_histograms_reset(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    nrf_802154_stat_histograms_reset();
+
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
+}
+
+#if NRF_802154_SECURITY_ENABLED
+
+/**
+ * @brief Get the size of the Key Source and Key Index fields of a Key Identifier Mode.
+ *
+ * @param[in]  mode  Key Identifier Mode.
+ *
+ * @returns  Size of the fields, or 0 if the mode is not supported.
+ */
+static size_t security_key_id_size_get(uint8_t mode)
+{
+    switch (mode)
+    {
+        case 1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_store(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_key_t            key;
+    const uint8_t             * p_value;
+    size_t                      value_len;
+    size_t                      id_len;
+    nrf_802154_security_error_t err;
+    spinel_ssize_t              siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+                                 &key.id.mode,
+                                 &key.id.p_key_id,
+                                 &id_len,
+                                 &p_value,
+                                 &value_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    // The driver reads as many bytes of the identifier as the mode requires.
+    if ((id_len != security_key_id_size_get(key.id.mode)) ||
+        (value_len != NRF_802154_SECURITY_KEY_SIZE))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    memcpy(key.value, p_value, sizeof(key.value));
+
+    err = nrf_802154_security_key_store(&key);
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE_RET,
+        err);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_remove(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_key_id_t         id;
+    size_t                      id_len;
+    nrf_802154_security_error_t err;
+    spinel_ssize_t              siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+                                 &id.mode,
+                                 &id.p_key_id,
+                                 &id_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (id_len != security_key_id_size_get(id.mode))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    err = nrf_802154_security_key_remove(&id);
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_RET,
+        err);
+}
+
+/**
+ * @brief Decode and dispatch
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_global_frame_counter_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       frame_counter;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                                 &frame_counter);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_security_global_frame_counter_set(frame_counter);
+
+    return nrf_802154_spinel_send_response_last_status_is(m_request_tid, SPINEL_STATUS_OK);
+}
+
+/**
+ * @brief Decode and dispatch
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_global_frame_counter_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        m_request_tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET_RET,
+        nrf_802154_security_global_frame_counter_get());
+}
+
+#endif // NRF_802154_SECURITY_ENABLED
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_cmd_data,
                                                                  size_t       cmd_data_len)
 {
-    spinel_prop_key_t property;
-    const void      * p_property_data;
-    size_t            property_data_len;
-    spinel_ssize_t    siz;
+    nrf_802154_spinel_reader_t reader;
+    spinel_prop_key_t          property;
+    const void               * p_property_data;
+    size_t                     property_data_len;
 
-    siz = spinel_datatype_unpack(p_cmd_data,
-                                 cmd_data_len,
-                                 SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S,
-                                 &property,
-                                 &p_property_data,
-                                 &property_data_len);
+    // SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S
+    nrf_802154_spinel_reader_init(&reader, p_cmd_data, cmd_data_len);
 
-    if (siz < 0)
+    property        = nrf_802154_spinel_read_uint_packed(&reader);
+    p_property_data = nrf_802154_spinel_read_data(&reader, &property_data_len);
+
+    if (!nrf_802154_spinel_reader_ok(&reader))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -814,6 +1209,20 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_pending_bit_for_addr_reset(p_property_data,
                                                                             property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_SET:
+            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_set(p_property_data,
+                                                                               property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CLEAR:
+            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_clear(
+                p_property_data,
+                property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_LIST_CAPACITY_GET:
+            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_list_capacity_get(
+                p_property_data,
+                property_data_len);
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET:
             return spinel_decode_prop_nrf_802154_src_addr_matching_method_set(p_property_data,
                                                                               property_data_len);
@@ -864,6 +1273,34 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_capabilities_get(p_property_data,
                                                                   property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAM_GET:
+            return spinel_decode_prop_nrf_802154_stat_histogram_get(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_RESET:
+            return spinel_decode_prop_nrf_802154_stat_histograms_reset(p_property_data,
+                                                                       property_data_len);
+
+#if NRF_802154_SECURITY_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
+            return spinel_decode_prop_nrf_802154_security_key_store(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
+            return spinel_decode_prop_nrf_802154_security_key_remove(p_property_data,
+                                                                     property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET:
+            return spinel_decode_prop_nrf_802154_security_global_frame_counter_set(
+                p_property_data,
+                property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_GET:
+            return spinel_decode_prop_nrf_802154_security_global_frame_counter_get(
+                p_property_data,
+                property_data_len);
+#endif // NRF_802154_SECURITY_ENABLED
+
         default:
             NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
                                       spinel_prop_key_to_cstr(property),
@@ -873,10 +1310,13 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
     }
 }
 
-nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
+nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_tid_t     tid,
+                                                    spinel_command_t cmd,
                                                     const void     * p_cmd_data,
                                                     size_t           cmd_data_len)
 {
+    m_request_tid = tid;
+
     switch (cmd)
     {
         case SPINEL_CMD_PROP_VALUE_SET:
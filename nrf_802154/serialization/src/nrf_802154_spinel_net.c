@@ -204,8 +204,9 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
                                        uint8_t   lqi,
                                        uint32_t  time)
 {
-    nrf_802154_ser_err_t res;
-    uint32_t             local_data_handle;
+    nrf_802154_ser_err_t      res;
+    uint32_t                  local_data_handle;
+    nrf_802154_spinel_frame_t frame;
 
     SERIALIZATION_ERROR_INIT(error);
 
@@ -228,13 +229,22 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
     }
 
     // Serialize the call
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
-        power,
-        lqi,
-        time);
+    res = nrf_802154_spinel_frame_begin(&frame,
+                                        0U,
+                                        SPINEL_CMD_PROP_VALUE_IS,
+                                        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW);
+
+    if (res >= 0)
+    {
+        nrf_802154_spinel_write_received_timestamp_raw(&frame.writer,
+                                                       local_data_handle,
+                                                       p_data,
+                                                       power,
+                                                       lqi,
+                                                       time);
+
+        res = nrf_802154_spinel_frame_send(&frame);
+    }
 
     if (res < 0)
     {
@@ -322,13 +332,25 @@ void nrf_802154_transmitted_raw(const uint8_t * p_frame,
     }
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW,
-        SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
-        remote_frame_handle,
-        NRF_802154_HDATA_ENCODE(ack_handle, p_ack, ack_len),
-        power,
-        lqi);
+    nrf_802154_spinel_frame_t frame;
+    nrf_802154_ser_err_t      res = nrf_802154_spinel_frame_begin(
+        &frame,
+        0U,
+        SPINEL_CMD_PROP_VALUE_IS,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW);
+
+    if (res >= 0)
+    {
+        nrf_802154_spinel_write_transmitted_raw(&frame.writer,
+                                                remote_frame_handle,
+                                                ack_handle,
+                                                p_ack,
+                                                ack_len,
+                                                power,
+                                                lqi);
+
+        res = nrf_802154_spinel_frame_send(&frame);
+    }
 
     // Free the local frame pointer no matter the result of serialization
     local_transmitted_frame_ptr_free((void *)p_frame);
@@ -86,6 +86,59 @@
 #define NRF_802154_SL_DEBUG_LOG_BLOCKS_INTERRUPTS 0
 #endif
 
+/**@def NRF_802154_SL_OPENSOURCE
+ * @brief Indicates that the driver is built with the open-source SL.
+ *
+ * The SL library writes to the log buffer with the macros it was built with, so the features
+ * that change the layout of the log buffer are available with the open-source SL only.
+ */
+#ifndef NRF_802154_SL_OPENSOURCE
+#define NRF_802154_SL_OPENSOURCE 0
+#endif
+
+/**@def NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED
+ * @brief Configures if each entry of the log buffer is followed by a timestamp.
+ *
+ * Setting this macro to 1 makes every log record two words long: the log word followed by
+ * the value of @ref NRF_802154_SL_DEBUG_LOG_TIMESTAMP_GET sampled when the log was recorded.
+ * Records never straddle the end of the log buffer, so the buffer and any stream obtained
+ * with @ref nrf_802154_sl_log_drain can be split into records without additional framing.
+ *
+ * @note This option is supported by the open-source SL only.
+ */
+#ifndef NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED
+#define NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED 0
+#endif
+
+#if (NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED) && !(NRF_802154_SL_OPENSOURCE)
+#error "NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED is supported by the open-source SL only"
+#endif
+
+#if (NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED)
+
+/**@def NRF_802154_SL_DEBUG_LOG_TIMESTAMP_GET
+ * @brief Returns a 32-bit free-running timestamp to be stored with each log record.
+ *
+ * By default, the DWT cycle counter is used, which is enabled by @ref nrf_802154_sl_log_init.
+ * Define this macro to use a different time source. It is evaluated on every log call, so it
+ * must be cheap and safe to call from any priority.
+ */
+#ifndef NRF_802154_SL_DEBUG_LOG_TIMESTAMP_GET
+#include "nrf.h"
+#define NRF_802154_SL_DEBUG_LOG_TIMESTAMP_GET() (DWT->CYCCNT)
+#define NRF_802154_SL_DEBUG_LOG_TIMESTAMP_DWT   1
+#endif
+
+/**@brief Number of words of the log buffer occupied by one log record. */
+#define NRF_802154_SL_DEBUG_LOG_RECORD_LEN      2U
+
+#else
+
+/**@brief Number of words of the log buffer occupied by one log record. */
+#define NRF_802154_SL_DEBUG_LOG_RECORD_LEN 1U
+
+#endif
+
 /**@def NRF_802154_SL_LOG_VERBOSITY
  * @brief Defines the verbosity level of generated logs.
  *
@@ -141,7 +194,48 @@
 extern volatile uint32_t g_nrf_802154_sl_log_buffer[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
 extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
 
-/**@brief Writes one word into debug log buffer. */
+#if (NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED)
+
+/**@brief Stores the timestamp of the log record that starts at index @p idx. */
+#define nrf_802154_sl_debug_log_write_timestamp(idx) \
+    g_nrf_802154_sl_log_buffer[(idx) + 1U] = NRF_802154_SL_DEBUG_LOG_TIMESTAMP_GET()
+
+#else
+
+#define nrf_802154_sl_debug_log_write_timestamp(idx) \
+    do                                               \
+    {                                                \
+    }                                                \
+    while (0)
+
+#endif
+
+#if (NRF_802154_SL_OPENSOURCE)
+
+/**@brief Returns the log pointer that follows the record written at @p ptr.
+ *
+ * The log pointer is a free-running count of words written to the buffer, which allows
+ * @ref nrf_802154_sl_log_drain to detect records that were overwritten.
+ */
+#define nrf_802154_sl_debug_log_ptr_next(ptr) \
+    ((ptr) + NRF_802154_SL_DEBUG_LOG_RECORD_LEN)
+
+#else
+
+/**@brief Returns the log pointer that follows the record written at @p ptr.
+ *
+ * The log pointer is the index of the next record in the buffer, as the SL library expects.
+ */
+#define nrf_802154_sl_debug_log_ptr_next(ptr) \
+    (((ptr) + NRF_802154_SL_DEBUG_LOG_RECORD_LEN) & (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U))
+
+#endif
+
+/**@brief Writes one log record into debug log buffer.
+ *
+ * The index of the record in the buffer is obtained by masking the log pointer with the buffer
+ * length.
+ */
 #define nrf_802154_sl_debug_log_write_raw(value)                                                \
     do                                                                                          \
     {                                                                                           \
@@ -151,12 +245,14 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
         nrf_802154_sl_debug_log_disable_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);          \
                                                                                                 \
         uint32_t nrf_802154_sl_debug_log_write_raw_ptr = gp_nrf_802154_sl_log_ptr;              \
+        uint32_t nrf_802154_sl_debug_log_write_raw_idx =                                        \
+            nrf_802154_sl_debug_log_write_raw_ptr & (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U);  \
                                                                                                 \
-        g_nrf_802154_sl_log_buffer[nrf_802154_sl_debug_log_write_raw_ptr] =                     \
+        g_nrf_802154_sl_log_buffer[nrf_802154_sl_debug_log_write_raw_idx] =                     \
             nrf_802154_sl_debug_log_wr_raw_value;                                               \
-        nrf_802154_sl_debug_log_write_raw_ptr += 1U;                                            \
-        nrf_802154_sl_debug_log_write_raw_ptr &= (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U);     \
-        gp_nrf_802154_sl_log_ptr               = nrf_802154_sl_debug_log_write_raw_ptr;         \
+        nrf_802154_sl_debug_log_write_timestamp(nrf_802154_sl_debug_log_write_raw_idx);         \
+        gp_nrf_802154_sl_log_ptr =                                                              \
+            nrf_802154_sl_debug_log_ptr_next(nrf_802154_sl_debug_log_write_raw_ptr);            \
                                                                                                 \
         nrf_802154_sl_debug_log_restore_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);          \
     }                                                                                           \
@@ -293,6 +389,28 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
  */
 void nrf_802154_sl_log_init(void);
 
+#if (NRF_802154_SL_OPENSOURCE)
+
+/**
+ * @brief Copies log records recorded since the previous call into the provided buffer.
+ *
+ * This function allows the log to be streamed continuously over a transport. Only whole records
+ * are copied. Records that were overwritten before they could be copied are skipped and
+ * reported through @p p_lost_words, so the caller can mark a discontinuity in the stream.
+ *
+ * @note This function is not reentrant and must be called from a single context only.
+ * @note This function is provided by the open-source SL only.
+ *
+ * @param[out] p_words       Buffer to which log words are to be copied.
+ * @param[in]  max_words     Capacity of @p p_words in words.
+ * @param[out] p_lost_words  Number of words lost since the previous call. Can be NULL.
+ *
+ * @returns  Number of words copied into @p p_words.
+ */
+uint32_t nrf_802154_sl_log_drain(uint32_t * p_words, uint32_t max_words, uint32_t * p_lost_words);
+
+#endif
+
 /**
  *@}
  **/
@@ -34,17 +34,97 @@
 
 #include "nrf_802154_sl_log.h"
 
+#include <stddef.h>
+
+#if !(NRF_802154_SL_OPENSOURCE)
+#error NRF_802154_SL_OPENSOURCE must be set to 1 when the open-source SL is built
+#endif
+
+#if (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN & (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U)) != 0U
+#error NRF_802154_SL_DEBUG_LOG_BUFFER_LEN must be power of 2
+#endif
+
 /**
  * @brief Buffer used to store debug log messages.
  */
 volatile uint32_t g_nrf_802154_sl_log_buffer[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
 
 /**
- * @brief Index of the log buffer pointing to the element that should be filled with next log message.
+ * @brief Free-running number of words written to the log buffer.
+ *
+ * The element that should be filled with next log message is pointed by this value masked with
+ * the buffer length.
  */
 volatile uint32_t gp_nrf_802154_sl_log_ptr = 0;
 
+/**
+ * @brief Free-running number of words consumed by @ref nrf_802154_sl_log_drain.
+ */
+static uint32_t m_drain_ptr;
+
 void nrf_802154_sl_log_init(void)
 {
-    /* intentionally empty */
+#if (NRF_802154_SL_DEBUG_LOG_TIMESTAMPS_ENABLED) && defined(NRF_802154_SL_DEBUG_LOG_TIMESTAMP_DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    m_drain_ptr = gp_nrf_802154_sl_log_ptr;
+}
+
+uint32_t nrf_802154_sl_log_drain(uint32_t * p_words, uint32_t max_words, uint32_t * p_lost_words)
+{
+    uint32_t wr_ptr = gp_nrf_802154_sl_log_ptr;
+    uint32_t lost   = 0U;
+    uint32_t count;
+    uint32_t overwritten;
+
+    if ((wr_ptr - m_drain_ptr) > NRF_802154_SL_DEBUG_LOG_BUFFER_LEN)
+    {
+        lost        = wr_ptr - m_drain_ptr - NRF_802154_SL_DEBUG_LOG_BUFFER_LEN;
+        m_drain_ptr = wr_ptr - NRF_802154_SL_DEBUG_LOG_BUFFER_LEN;
+    }
+
+    count = wr_ptr - m_drain_ptr;
+    max_words -= max_words % NRF_802154_SL_DEBUG_LOG_RECORD_LEN;
+
+    if (count > max_words)
+    {
+        count = max_words;
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        p_words[i] =
+            g_nrf_802154_sl_log_buffer[(m_drain_ptr + i) & (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U)];
+    }
+
+    // Discard words the writer may have overwritten while they were being copied.
+    wr_ptr      = gp_nrf_802154_sl_log_ptr;
+    overwritten = 0U;
+
+    if ((wr_ptr - m_drain_ptr) > NRF_802154_SL_DEBUG_LOG_BUFFER_LEN)
+    {
+        overwritten = wr_ptr - m_drain_ptr - NRF_802154_SL_DEBUG_LOG_BUFFER_LEN;
+
+        if (overwritten > count)
+        {
+            overwritten = count;
+        }
+    }
+
+    for (uint32_t i = overwritten; i < count; i++)
+    {
+        p_words[i - overwritten] = p_words[i];
+    }
+
+    m_drain_ptr += count;
+    lost        += overwritten;
+
+    if (p_lost_words != NULL)
+    {
+        *p_lost_words = lost;
+    }
+
+    return count - overwritten;
 }
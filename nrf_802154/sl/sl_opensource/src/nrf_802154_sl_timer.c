@@ -47,6 +47,78 @@ static void timeout_handler(struct k_timer * timer_id);
 
 K_TIMER_DEFINE(timer, timeout_handler, NULL);
 
+/* Running timers ordered by expiration time. The k_timer is armed for the head of the list. */
+static nrf_802154_timer_t * mp_head;
+
+static uint32_t expiration_time_get(const nrf_802154_timer_t * p_timer)
+{
+    return p_timer->t0 + p_timer->dt;
+}
+
+static bool expires_before(const nrf_802154_timer_t * p_first,
+                           const nrf_802154_timer_t * p_second)
+{
+    return (int32_t)(expiration_time_get(p_first) - expiration_time_get(p_second)) < 0;
+}
+
+/* Unlinks the given timer from the list. Must be called with interrupts disabled. */
+static bool timer_unlink(nrf_802154_timer_t * p_timer)
+{
+    for (nrf_802154_timer_t ** pp_item = &mp_head; *pp_item != NULL;
+         pp_item = &(*pp_item)->p_next)
+    {
+        if (*pp_item == p_timer)
+        {
+            *pp_item        = p_timer->p_next;
+            p_timer->p_next = NULL;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Arms the k_timer for the head of the list. Must be called with interrupts disabled. */
+static void timer_arm(void)
+{
+    nrf_802154_timer_t * p_head = mp_head;
+
+    if (p_head == NULL)
+    {
+        k_timer_stop(&timer);
+        return;
+    }
+
+    uint32_t now   = nrf_802154_timer_sched_time_get();
+    uint32_t delta = 0;
+
+    if (nrf_802154_timer_sched_time_is_in_future(now, p_head->t0, p_head->dt))
+    {
+        delta = expiration_time_get(p_head) - now;
+    }
+
+    // Expiration times are aligned to ticks by timer_dt_round(), so the delta differs from
+    // a whole number of ticks only by the rounding of the tick to microsecond conversion.
+    k_timer_start(&timer, K_TICKS(k_us_to_ticks_floor32(delta + 1)), K_NO_WAIT);
+}
+
+/* Aligns the expiration time of the given timer to a tick of the underlying k_timer. */
+static void timer_dt_round(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    int64_t  now_ticks = k_uptime_ticks();
+    uint32_t now       = NRF_802154_SL_RTC_TICKS_TO_US(now_ticks);
+
+    if (!nrf_802154_timer_sched_time_is_in_future(now, p_timer->t0, p_timer->dt))
+    {
+        return;
+    }
+
+    uint32_t delta = expiration_time_get(p_timer) - now;
+    uint32_t ticks = round_up ? k_us_to_ticks_ceil32(delta) : k_us_to_ticks_floor32(delta);
+
+    p_timer->dt = (uint32_t)NRF_802154_SL_RTC_TICKS_TO_US(now_ticks + ticks) - p_timer->t0;
+}
+
 void nrf_802154_timer_coord_init(void)
 {
     // Intentionally empty
@@ -70,11 +142,27 @@ void nrf_802154_timer_coord_stop(void)
 void nrf_802154_timer_sched_init(void)
 {
     BUILD_ASSERT(CONFIG_SYS_CLOCK_TICKS_PER_SEC == NRF_802154_SL_RTC_FREQUENCY);
+
+    mp_head = NULL;
 }
 
 void nrf_802154_timer_sched_deinit(void)
 {
-    // Intentionally empty
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    k_timer_stop(&timer);
+
+    while (mp_head != NULL)
+    {
+        nrf_802154_timer_t * p_timer = mp_head;
+
+        mp_head         = p_timer->p_next;
+        p_timer->p_next = NULL;
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
 }
 
 uint32_t nrf_802154_timer_sched_time_get(void)
@@ -82,67 +170,136 @@ uint32_t nrf_802154_timer_sched_time_get(void)
     return NRF_802154_SL_RTC_TICKS_TO_US(k_uptime_ticks());
 }
 
-void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+uint32_t nrf_802154_timer_sched_granularity_get(void)
 {
-    (void)round_up;
-    assert(!(p_timer->p_next)); // Only one timer is allowed to run at a time.
+    return NRF_802154_SL_US_PER_TICK;
+}
 
-    uint32_t now    = nrf_802154_timer_sched_time_get();
-    uint32_t target = p_timer->t0 + p_timer->dt - now;
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    uint32_t target_time = t0 + dt;
+    int32_t  difference  = target_time - now;
 
-    k_timer_user_data_set(&timer, (void *)p_timer->callback); // Passing arguments is not supported.
-    k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+    return difference > 0;
 }
 
-void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
+uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_timer)
 {
-    if (k_timer_status_get(&timer) > 0)
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if (!nrf_802154_timer_sched_time_is_in_future(now, p_timer->t0, p_timer->dt))
     {
-        /* Timer has expired. */
-        if (p_was_running)
-        {
-            *p_was_running = false;
-        }
+        return 0;
     }
-    else if (k_timer_remaining_get(&timer) == 0)
+
+    return expiration_time_get(p_timer) - now;
+}
+
+void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    assert(p_timer->callback != NULL);
+
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    bool was_head = (mp_head == p_timer);
+
+    (void)timer_unlink(p_timer);
+    timer_dt_round(p_timer, round_up);
+
+    // Timers with equal expiration time fire in the order they were added.
+    nrf_802154_timer_t ** pp_item = &mp_head;
+
+    while ((*pp_item != NULL) && !expires_before(p_timer, *pp_item))
     {
-        /* Timer was stopped (by someone else) before expiring. */
-        if (p_was_running)
-        {
-            *p_was_running = false;
-        }
+        pp_item = &(*pp_item)->p_next;
     }
-    else
+
+    p_timer->p_next = *pp_item;
+    *pp_item        = p_timer;
+
+    if (was_head || (mp_head == p_timer))
     {
-        /* Timer is still running. */
-        k_timer_stop(&timer);
-        if (p_was_running)
-        {
-            *p_was_running = true;
-        }
+        timer_arm();
     }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
 }
 
-bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
 {
-    (void)now;
-    (void)t0;
-    (void)dt;
-    return false;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    bool was_head    = (mp_head == p_timer);
+    bool was_running = timer_unlink(p_timer);
+
+    if (was_head)
+    {
+        timer_arm();
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    if (p_was_running)
+    {
+        *p_was_running = was_running;
+    }
 }
 
 static void timeout_handler(struct k_timer * timer_id)
 {
-    nrf_802154_timer_callback_t callback =
-        (nrf_802154_timer_callback_t)k_timer_user_data_get(timer_id);
+    (void)timer_id;
+
+    while (true)
+    {
+        nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+        nrf_802154_timer_t * p_timer = mp_head;
+        uint32_t             now     = nrf_802154_timer_sched_time_get();
+
+        if ((p_timer == NULL) ||
+            nrf_802154_timer_sched_time_is_in_future(now, p_timer->t0, p_timer->dt))
+        {
+            timer_arm();
+            nrf_802154_sl_mcu_critical_exit(mcu_cs);
+            break;
+        }
 
-    callback(NULL); // Passing arguments is not supported.
+        mp_head         = p_timer->p_next;
+        p_timer->p_next = NULL;
+
+        nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+        // The callback is called outside of the critical section, so it may add or remove timers.
+        p_timer->callback(p_timer->p_context);
+    }
 }
 
 bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
 {
-    (void)p_timer;
-    return k_timer_status_get(&timer) < 0;
+    bool result = false;
+
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    for (nrf_802154_timer_t * p_item = mp_head; p_item != NULL; p_item = p_item->p_next)
+    {
+        if (p_item == p_timer)
+        {
+            result = true;
+            break;
+        }
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return result;
 }
 
 void nrf_802154_lp_timer_init(void)
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of the ACK data lookup done for every received frame with an ACK request.
+ *
+ * The list holds the given number of extended addresses with the pending bit set, and every other
+ * one has IE data as well. For random frames from present and missing addresses, the benchmark
+ * measures host CPU time of a single search for the pending bit and the IE data, as done by the
+ * Enh-Ack generator, and of separate searches for both of them. The MHR of each frame is parsed
+ * up front, so only the lookup is measured.
+ *
+ * Usage: nrf_802154_ack_data_lookup_bench [number_of_lookups]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#define BENCH_DEFAULT_COUNT 1000000
+#define BENCH_MAX_ADDRESSES 512U
+#define BENCH_FRAME_SIZE    (PHR_SIZE + 7 + EXTENDED_ADDRESS_SIZE + FCS_SIZE)
+
+static const uint32_t m_sizes[] = {8U, 64U, 256U, BENCH_MAX_ADDRESSES};
+
+static uint8_t                        m_addrs[BENCH_MAX_ADDRESSES * EXTENDED_ADDRESS_SIZE];
+static uint8_t                        m_frames[2][BENCH_MAX_ADDRESSES][BENCH_FRAME_SIZE];
+static nrf_802154_frame_parser_data_t m_frame_data[2][BENCH_MAX_ADDRESSES];
+static uint32_t                       m_random = 1U;
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t random_get(uint32_t range)
+{
+    m_random = m_random * 1103515245U + 12345U;
+
+    return (m_random >> 16) % range;
+}
+
+/* Writes an extended address of the given value in little-endian order. */
+static void addr_write(uint8_t * p_addr, uint32_t value)
+{
+    memset(p_addr, 0, EXTENDED_ADDRESS_SIZE);
+
+    for (uint32_t i = 0; i < sizeof(value); i++)
+    {
+        // Both words of the address differ, so that the comparison looks at the whole address.
+        p_addr[i]                             = (uint8_t)(value >> (8 * i));
+        p_addr[EXTENDED_ADDRESS_SIZE - 1 - i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/* Builds a 2015 data frame from an extended address and parses its MHR. */
+static void frame_build(uint8_t                        * p_frame,
+                        nrf_802154_frame_parser_data_t * p_frame_data,
+                        uint32_t                         src_addr)
+{
+    uint8_t * p_psdu = &p_frame[PHR_SIZE];
+    uint8_t   index  = 0;
+
+    p_psdu[index++] = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK | ACK_REQUEST_BIT;
+    p_psdu[index++] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_EXTENDED | FRAME_VERSION_2;
+    p_psdu[index++] = 0;
+    p_psdu[index++] = TEST_PAN_ID & 0xff;
+    p_psdu[index++] = TEST_PAN_ID >> 8;
+    p_psdu[index++] = TEST_SHORT_ADDR & 0xff;
+    p_psdu[index++] = TEST_SHORT_ADDR >> 8;
+    addr_write(&p_psdu[index], src_addr);
+    index += EXTENDED_ADDRESS_SIZE;
+    p_psdu[index++] = 0;
+    p_psdu[index++] = 0;
+
+    p_frame[PHR_OFFSET] = index;
+
+    nrf_802154_frame_parser_data_init(p_frame, p_frame_data);
+    TEST_ASSERT(nrf_802154_frame_parser_mhr_get(p_frame_data) != NULL);
+}
+
+/* Fills the list with even addresses. Frames come from even (present) and odd (missing) ones. */
+static void list_fill(uint32_t addresses)
+{
+    static const uint8_t ie[] = {0x01, 0x02, 0x03, 0x04};
+
+    nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
+    nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_IE);
+
+    for (uint32_t i = 0; i < addresses; i++)
+    {
+        addr_write(&m_addrs[EXTENDED_ADDRESS_SIZE * i], 2 * i + 2);
+        frame_build(m_frames[0][i], &m_frame_data[0][i], 2 * i + 2);
+        frame_build(m_frames[1][i], &m_frame_data[1][i], 2 * i + 1);
+    }
+
+    TEST_ASSERT(nrf_802154_ack_data_pending_bit_for_addr_list_set(m_addrs, addresses, true, true));
+
+    for (uint32_t i = 0; i < addresses; i += 2)
+    {
+        TEST_ASSERT(nrf_802154_ack_data_for_addr_set(&m_addrs[EXTENDED_ADDRESS_SIZE * i],
+                                                     true,
+                                                     NRF_802154_ACK_DATA_IE,
+                                                     ie,
+                                                     sizeof(ie)));
+    }
+}
+
+/* Returns average time of a lookup of random present or missing addresses in ns. */
+static double lookup_time_get(uint32_t addresses, uint32_t count, bool present, bool single)
+{
+    uint64_t start;
+    uint32_t pending = 0;
+
+    start = time_ns();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_802154_frame_parser_data_t * p_frame_data =
+            &m_frame_data[present ? 0 : 1][random_get(addresses)];
+        const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+            nrf_802154_frame_parser_mhr_get(p_frame_data);
+        bool    pending_bit;
+        uint8_t ie_length;
+
+        if (single)
+        {
+            (void)nrf_802154_ack_data_for_frame_get(p_frame_data, &pending_bit, &ie_length);
+        }
+        else
+        {
+            pending_bit = nrf_802154_ack_data_pending_bit_should_be_set(p_frame_data);
+            (void)nrf_802154_ack_data_ie_get(p_mhr_data->p_src_addr, true, &ie_length);
+        }
+
+        pending += pending_bit ? 1 : 0;
+    }
+
+    TEST_ASSERT(pending == (present ? count : 0));
+
+    return (double)(time_ns() - start) / count;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count = BENCH_DEFAULT_COUNT;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    test_driver_init();
+
+    printf("addresses  hit [ns]  hit, 2 searches [ns]  miss [ns]  miss, 2 searches [ns]\n");
+
+    for (size_t i = 0; i < sizeof(m_sizes) / sizeof(m_sizes[0]); i++)
+    {
+        double hit;
+        double hit_two;
+        double miss;
+        double miss_two;
+
+        list_fill(m_sizes[i]);
+
+        hit      = lookup_time_get(m_sizes[i], count, true, true);
+        hit_two  = lookup_time_get(m_sizes[i], count, true, false);
+        miss     = lookup_time_get(m_sizes[i], count, false, true);
+        miss_two = lookup_time_get(m_sizes[i], count, false, false);
+
+        printf("%9u  %8.1f  %20.1f  %9.1f  %21.1f\n", m_sizes[i], hit, hit_two, miss, miss_two);
+    }
+
+    return 0;
+}
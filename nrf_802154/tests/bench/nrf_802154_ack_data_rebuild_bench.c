@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of rebuilding the pending bit list.
+ *
+ * A Thread parent rebuilds the list of its children with pending data. The benchmark measures host
+ * CPU time of replacing the list by a sorted list, by an unsorted list, and by resetting the list
+ * and adding the addresses one by one. Each rebuild alternates between two lists that share half
+ * of their addresses, so that records are both added and removed.
+ *
+ * Usage: nrf_802154_ack_data_rebuild_bench [number_of_rebuilds]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#define BENCH_DEFAULT_COUNT 10000
+#define BENCH_MAX_CHILDREN  256U
+
+static const uint32_t m_sizes[] = {8U, 64U, BENCH_MAX_CHILDREN};
+
+static uint8_t  m_sorted[2][BENCH_MAX_CHILDREN * EXTENDED_ADDRESS_SIZE];
+static uint8_t  m_unsorted[2][BENCH_MAX_CHILDREN * EXTENDED_ADDRESS_SIZE];
+static uint32_t m_random = 1U;
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t random_get(uint32_t range)
+{
+    m_random = m_random * 1103515245U + 12345U;
+
+    return (m_random >> 16) % range;
+}
+
+/* Builds two lists of children, sorted and shuffled, which share every other address. */
+static void lists_build(uint32_t children, bool extended)
+{
+    uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    for (uint32_t list = 0; list < 2; list++)
+    {
+        for (uint32_t i = 0; i < children; i++)
+        {
+            uint32_t  value  = 0x100 + 2 * i + ((list == 1) && (i % 2) ? 1 : 0);
+            uint8_t * p_addr = &m_sorted[list][addr_size * i];
+
+            memset(p_addr, 0, addr_size);
+            p_addr[0] = value & 0xff;
+            p_addr[1] = value >> 8;
+
+            if (extended)
+            {
+                // Extended addresses are compared by their most significant word first.
+                p_addr[EXTENDED_ADDRESS_SIZE - 1] = 0xf4;
+            }
+        }
+
+        memcpy(m_unsorted[list], m_sorted[list], addr_size * children);
+
+        for (uint32_t i = children - 1; i > 0; i--)
+        {
+            uint8_t  tmp[EXTENDED_ADDRESS_SIZE];
+            uint32_t j = random_get(i + 1);
+
+            memcpy(tmp, &m_unsorted[list][addr_size * i], addr_size);
+            memcpy(&m_unsorted[list][addr_size * i], &m_unsorted[list][addr_size * j], addr_size);
+            memcpy(&m_unsorted[list][addr_size * j], tmp, addr_size);
+        }
+    }
+}
+
+/* Returns average time of a replacement of the list with a single call in ns. */
+static double list_replace_time_get(uint8_t lists[2][BENCH_MAX_CHILDREN * EXTENDED_ADDRESS_SIZE],
+                                    uint32_t children,
+                                    bool     extended,
+                                    uint32_t count)
+{
+    uint64_t start = time_ns();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(lists[i % 2],
+                                                             children,
+                                                             extended,
+                                                             true));
+    }
+
+    return (double)(time_ns() - start) / count;
+}
+
+/* Returns average time of a reset of the list followed by additions of single addresses in ns. */
+static double per_addr_replace_time_get(uint32_t children, bool extended, uint32_t count)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint64_t start     = time_ns();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_802154_pending_bit_for_addr_reset(extended);
+
+        for (uint32_t j = 0; j < children; j++)
+        {
+            TEST_ASSERT(nrf_802154_pending_bit_for_addr_set(&m_unsorted[i % 2][addr_size * j],
+                                                            extended));
+        }
+    }
+
+    return (double)(time_ns() - start) / count;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count = BENCH_DEFAULT_COUNT;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    test_driver_init();
+
+    printf("addr      children  sorted [ns]  unsorted [ns]  per-address [ns]\n");
+
+    for (uint32_t extended = 0; extended < 2; extended++)
+    {
+        for (size_t i = 0; i < sizeof(m_sizes) / sizeof(m_sizes[0]); i++)
+        {
+            double sorted;
+            double unsorted;
+            double per_addr;
+
+            lists_build(m_sizes[i], extended);
+
+            sorted   = list_replace_time_get(m_sorted, m_sizes[i], extended, count);
+            unsorted = list_replace_time_get(m_unsorted, m_sizes[i], extended, count);
+            per_addr = per_addr_replace_time_get(m_sizes[i], extended, count);
+
+            TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_capacity_get(extended, false) ==
+                        nrf_802154_pending_bit_for_addr_list_capacity_get(extended, true) -
+                        m_sizes[i]);
+
+            printf("%-8s  %8u  %11.1f  %13.1f  %16.1f\n",
+                   extended ? "extended" : "short",
+                   m_sizes[i],
+                   sorted,
+                   unsorted,
+                   per_addr);
+
+            nrf_802154_pending_bit_for_addr_reset(extended);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of the driver processing time on the simulated transceiver.
+ *
+ * The benchmark measures host CPU time spent by the driver between radio events, which is a proxy
+ * for the time the driver spends in the RADIO interrupt on the target. It reports the time of
+ * receiving a frame with an ACK request up to the start of the ACK transmission, the time of
+ * a complete acknowledged transmission, the number of frames per second and the high-water mark
+ * of the receive buffers. The higher layer keeps the given number of received frames before it
+ * frees the oldest one, which models a higher layer that processes frames with a delay.
+ * It also reports the average cost of taking a free receive buffer and returning it while these
+ * frames are held.
+ *
+ * Usage: nrf_802154_bench [number_of_frames] [number_of_held_frames]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#include "nrf_802154_rx_buffer.h"
+
+#define BENCH_DEFAULT_COUNT 10000
+#define BENCH_MAX_HELD      NRF_802154_RX_BUFFERS
+
+static uint32_t  m_received_count;
+static uint32_t  m_transmitted_count;
+static uint32_t  m_held_max;
+static uint8_t * mp_held[BENCH_MAX_HELD];
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    uint32_t index = m_received_count % BENCH_MAX_HELD;
+
+    m_received_count++;
+
+    if (m_held_max == 0)
+    {
+        nrf_802154_buffer_free_raw(p_data);
+        return;
+    }
+
+    // Slots are reused in a round-robin manner, so the slot held for the longest time is freed.
+    if (m_received_count > m_held_max)
+    {
+        uint32_t oldest = (m_received_count - m_held_max - 1) % BENCH_MAX_HELD;
+
+        nrf_802154_buffer_free_raw(mp_held[oldest]);
+    }
+
+    mp_held[index] = p_data;
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int compare_u64(const void * p_a, const void * p_b)
+{
+    uint64_t a = *(const uint64_t *)p_a;
+    uint64_t b = *(const uint64_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static void report(const char * p_name, uint64_t * p_samples, uint32_t count, uint64_t total)
+{
+    qsort(p_samples, count, sizeof(p_samples[0]), compare_u64);
+
+    printf("%s:\n", p_name);
+    printf("  frames/s:        %.0f\n", count * 1e9 / total);
+    printf("  p50:             %.2f us\n", p_samples[count / 2] / 1e3);
+    printf("  p99:             %.2f us\n", p_samples[(uint64_t)count * 99 / 100] / 1e3);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t   count = BENCH_DEFAULT_COUNT;
+    uint64_t * p_samples;
+    uint64_t   start;
+    uint64_t   total;
+    uint8_t    frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t    ack[IMM_ACK_LENGTH + PHR_SIZE];
+
+    nrf_802154_stats_t stats;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        m_held_max = strtoul(argv[2], NULL, 0);
+    }
+
+    // The driver needs one free buffer to keep receiving.
+    if ((count == 0) || (m_held_max >= BENCH_MAX_HELD))
+    {
+        return 1;
+    }
+
+    p_samples = malloc(count * sizeof(p_samples[0]));
+    if (p_samples == NULL)
+    {
+        return 1;
+    }
+
+    test_driver_init();
+    TEST_ASSERT(nrf_802154_receive());
+    nrf_802154_sim_process();
+
+    // Reception of a frame up to the start of the ACK transmission.
+    total = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, (uint8_t)i, true, 50);
+
+        start = time_ns();
+        nrf_802154_sim_rx_frame(frame, true);
+        p_samples[i] = time_ns() - start;
+        total       += p_samples[i];
+
+        TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXACK);
+        nrf_802154_sim_tx_ack_end();
+        nrf_802154_sim_process();
+    }
+
+    TEST_ASSERT(m_received_count == count);
+    report("rx frame to ACK start", p_samples, count, total);
+
+    nrf_802154_stats_get(&stats);
+    printf("  rx buffers hwm:  %u\n", stats.rx_buffers.high_water_mark);
+    printf("  dropped notif.:  %u\n", stats.counters.dropped_notifications);
+
+    // Acknowledged transmission, from the request to the notification.
+    total = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, (uint8_t)i, true, 50);
+        test_imm_ack_build(ack, (uint8_t)i);
+
+        start = time_ns();
+        TEST_ASSERT(nrf_802154_transmit_raw(frame, true));
+        nrf_802154_sim_process();
+        nrf_802154_sim_tx_end(true);
+        nrf_802154_sim_rx_ack(ack, true);
+        nrf_802154_sim_process();
+        p_samples[i] = time_ns() - start;
+        total       += p_samples[i];
+    }
+
+    TEST_ASSERT(m_transmitted_count == count);
+    report("acknowledged tx", p_samples, count, total);
+
+    // Taking a receive buffer as the core does when it re-arms the receiver.
+    start = time_ns();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        rx_buffer_t * p_buffer = nrf_802154_rx_buffer_alloc();
+
+        TEST_ASSERT(p_buffer != NULL);
+        nrf_802154_rx_buffer_release(p_buffer);
+    }
+
+    total = time_ns() - start;
+
+    printf("rx buffer alloc and release:\n");
+    printf("  buffers:         %u\n", NRF_802154_RX_BUFFERS);
+    printf("  held:            %u\n", m_held_max);
+    printf("  avg:             %.1f ns\n", (double)total / count);
+
+    free(p_samples);
+
+    return 0;
+}
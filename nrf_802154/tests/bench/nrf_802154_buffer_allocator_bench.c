@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of the buffer allocator used by the serialization.
+ *
+ * The free-list allocator is compared with the linear search of a free buffer it replaced,
+ * which is reproduced here over the same buffers. For each pool size the benchmark measures
+ * host CPU time of an allocation followed by a free when the pool is empty and when all buffers
+ * but the last one are taken, which is the worst case of the linear search.
+ *
+ * Usage: nrf_802154_buffer_allocator_bench [number_of_operations]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#include "nrf_802154_buffer_allocator.h"
+#include "nrf_802154_serialization_crit_sect.h"
+
+#define BENCH_DEFAULT_COUNT 100000
+#define BENCH_MAX_BUFFERS   128U
+
+static const size_t m_sizes[] = {8U, 32U, BENCH_MAX_BUFFERS};
+
+static uint8_t                       m_memory[NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(
+                                                  BENCH_MAX_BUFFERS)];
+static nrf_802154_buffer_allocator_t m_allocator;
+static size_t                        m_linear_len;
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Linear search of a free buffer, as done before the free list was introduced. */
+static void * linear_alloc(void)
+{
+    nrf_802154_buffer_t * p_pool = (nrf_802154_buffer_t *)m_memory;
+    uint32_t              crit_sect;
+
+    for (size_t i = 0U; i < m_linear_len; i++)
+    {
+        if (!p_pool[i].taken)
+        {
+            bool taken;
+
+            nrf_802154_serialization_crit_sect_enter(&crit_sect);
+            taken = p_pool[i].taken;
+            p_pool[i].taken = true;
+            nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+            if (!taken)
+            {
+                return p_pool[i].data;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void linear_free(void * p_buffer)
+{
+    nrf_802154_buffer_t * p_pool = (nrf_802154_buffer_t *)m_memory;
+    size_t                idx    =
+        ((uintptr_t)p_buffer - (uintptr_t)p_pool) / sizeof(nrf_802154_buffer_t);
+    uint32_t              crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    p_pool[idx].taken = false;
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+static void * free_list_alloc(void)
+{
+    return nrf_802154_buffer_allocator_alloc(&m_allocator);
+}
+
+static void free_list_free(void * p_buffer)
+{
+    nrf_802154_buffer_allocator_free(&m_allocator, p_buffer);
+}
+
+/* Returns average time of an allocation followed by a free in ns, after taking the given number
+ * of buffers.
+ */
+static double alloc_free_time_get(size_t buffers,
+                                  size_t taken,
+                                  uint32_t count,
+                                  void *(*alloc)(void),
+                                  void (* free_fn)(void *))
+{
+    void   * p_taken[BENCH_MAX_BUFFERS];
+    uint64_t start;
+
+    nrf_802154_buffer_allocator_init(&m_allocator,
+                                     m_memory,
+                                     NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(buffers));
+    m_linear_len = buffers;
+
+    for (size_t i = 0U; i < taken; i++)
+    {
+        p_taken[i] = alloc();
+        TEST_ASSERT(p_taken[i] != NULL);
+    }
+
+    start = time_ns();
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        void * p_buffer = alloc();
+
+        TEST_ASSERT(p_buffer != NULL);
+        free_fn(p_buffer);
+    }
+
+    start = time_ns() - start;
+
+    for (size_t i = 0U; i < taken; i++)
+    {
+        free_fn(p_taken[i]);
+    }
+
+    return (double)start / count;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count = BENCH_DEFAULT_COUNT;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    printf("                 empty pool [ns]      one free buffer [ns]\n");
+    printf("buffers       linear  free list       linear  free list\n");
+
+    for (size_t i = 0U; i < sizeof(m_sizes) / sizeof(m_sizes[0]); i++)
+    {
+        size_t buffers = m_sizes[i];
+
+        printf("%7zu  %11.1f  %9.1f  %11.1f  %9.1f\n",
+               buffers,
+               alloc_free_time_get(buffers, 0U, count, linear_alloc, linear_free),
+               alloc_free_time_get(buffers, 0U, count, free_list_alloc, free_list_free),
+               alloc_free_time_get(buffers, buffers - 1U, count, linear_alloc, linear_free),
+               alloc_free_time_get(buffers, buffers - 1U, count, free_list_alloc,
+                                   free_list_free));
+    }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of CSMA-CA transmissions on the simulated transceiver.
+ *
+ * The channel is found busy by each CCA with the given probability, which models the traffic of
+ * other nodes. There is no medium shared by several simulated nodes, so other transmissions
+ * only show up as busy CCAs. The benchmark transmits frames back to back and reports the number
+ * of frames per second of simulated time, the share of frames dropped after the maximum number
+ * of backoffs, the average number of CCAs per frame and the host CPU time per frame.
+ *
+ * Usage: nrf_802154_csma_ca_bench [number_of_frames] [busy_channel_percent]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#define BENCH_DEFAULT_COUNT   10000
+#define BENCH_PAYLOAD_LEN     50
+#define BENCH_BACKOFF_STEP_US 320 ///< Unit backoff period, in microseconds.
+#define BENCH_MAX_STEPS       1000
+#define BENCH_SYMBOL_US       16  ///< Duration of a symbol, in microseconds.
+#define BENCH_SHR_SIZE        5   ///< Size of the synchronization header, in bytes.
+
+static uint32_t m_transmitted_count;
+static uint32_t m_failed_count;
+static uint32_t m_random = 1U;
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+
+    TEST_ASSERT(error == NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    m_failed_count++;
+}
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t random_get(uint32_t range)
+{
+    m_random = m_random * 1103515245U + 12345U;
+
+    return (m_random >> 16) % range;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count        = BENCH_DEFAULT_COUNT;
+    uint32_t busy_percent = 0;
+    uint32_t ccas         = 0;
+    uint64_t sim_start;
+    uint64_t start;
+    uint64_t sim_time;
+    uint64_t host_time;
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        busy_percent = strtoul(argv[2], NULL, 0);
+    }
+
+    if ((count == 0) || (busy_percent > 100))
+    {
+        return 1;
+    }
+
+    test_driver_init();
+    test_driver_receive();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 0, false, BENCH_PAYLOAD_LEN);
+
+    sim_start = nrf_802154_sim_time_get();
+    start     = time_ns();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t done = m_transmitted_count + m_failed_count;
+
+        frame[DSN_OFFSET] = (uint8_t)i;
+        nrf_802154_transmit_csma_ca_raw(frame);
+
+        for (uint32_t step = 0; m_transmitted_count + m_failed_count == done; step++)
+        {
+            TEST_ASSERT(step < BENCH_MAX_STEPS);
+
+            if (nrf_802154_sim_trx_state_get() != TRX_STATE_TXFRAME)
+            {
+                nrf_802154_sim_time_advance(BENCH_BACKOFF_STEP_US);
+                continue;
+            }
+
+            ccas++;
+
+            if (random_get(100) < busy_percent)
+            {
+                nrf_802154_sim_tx_end(false);
+            }
+            else
+            {
+                nrf_802154_sim_time_advance((BENCH_SHR_SIZE + PHR_SIZE + frame[PHR_OFFSET]) *
+                                            2 * BENCH_SYMBOL_US);
+                nrf_802154_sim_tx_end(true);
+            }
+
+            nrf_802154_sim_process();
+        }
+    }
+
+    host_time = time_ns() - start;
+    sim_time  = nrf_802154_sim_time_get() - sim_start;
+
+    TEST_ASSERT(m_transmitted_count + m_failed_count == count);
+    TEST_ASSERT((busy_percent != 0) || (m_failed_count == 0));
+
+    printf("busy channel:        %u %%\n", busy_percent);
+    printf("frames per second:   %.1f\n", m_transmitted_count * 1000000.0 / sim_time);
+    printf("dropped frames:      %.2f %%\n", m_failed_count * 100.0 / count);
+    printf("CCAs per frame:      %.2f\n", (double)ccas / count);
+    printf("host time per frame: %.1f ns\n", (double)host_time / count);
+
+    return 0;
+}
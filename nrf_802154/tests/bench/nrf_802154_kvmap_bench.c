@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of the key-value map used by the serialization.
+ *
+ * The map is configured like the one of the destination buffer manager: keys are pointers to
+ * buffers and values are 32-bit buffer handles. For each map size the map is filled to its
+ * capacity and the benchmark measures host CPU time of a search of a present key, a search of
+ * a missing key and a removal followed by an addition of the same key. All of them are done in
+ * the serialization critical section, so their time adds to the interrupt latency. The benchmark
+ * is built with both the linear and the hashed map, so that both can be compared.
+ *
+ * Usage: nrf_802154_kvmap_bench [number_of_operations]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#include "nrf_802154_kvmap.h"
+
+#define BENCH_DEFAULT_COUNT 100000
+#define BENCH_MAX_ITEMS     128U
+#define BENCH_BUFFER_SIZE   128U
+
+typedef struct
+{
+    uint8_t data[BENCH_BUFFER_SIZE];
+} bench_buffer_t;
+
+static const size_t m_sizes[] = {8U, 32U, BENCH_MAX_ITEMS};
+
+static bench_buffer_t     m_buffers[BENCH_MAX_ITEMS * 2U];
+static uint8_t            m_memory[NRF_802154_KVMAP_MEMORY_SIZE(BENCH_MAX_ITEMS,
+                                                                sizeof(void *),
+                                                                sizeof(uint32_t))];
+static nrf_802154_kvmap_t m_kvmap;
+static uint32_t           m_random = 1U;
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t random_get(uint32_t range)
+{
+    m_random = m_random * 1103515245U + 12345U;
+
+    return (m_random >> 16) % range;
+}
+
+/* Fills a map of the given capacity with pointers to the first buffers. */
+static void map_fill(size_t items)
+{
+    nrf_802154_kvmap_init(&m_kvmap,
+                          m_memory,
+                          NRF_802154_KVMAP_MEMORY_SIZE(items, sizeof(void *), sizeof(uint32_t)),
+                          sizeof(void *),
+                          sizeof(uint32_t));
+
+    for (uint32_t i = 0U; i < items; i++)
+    {
+        void * p_key = &m_buffers[i];
+
+        TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &p_key, &i));
+    }
+}
+
+/* Returns average time of a search of random present or missing keys in ns. */
+static double search_time_get(size_t items, uint32_t count, bool present)
+{
+    uint64_t start;
+    uint32_t value;
+
+    start = time_ns();
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t idx   = random_get(items) + (present ? 0U : BENCH_MAX_ITEMS);
+        void   * p_key = &m_buffers[idx];
+
+        TEST_ASSERT(nrf_802154_kvmap_search(&m_kvmap, &p_key, &value) == present);
+    }
+
+    return (double)(time_ns() - start) / count;
+}
+
+/* Returns average time of a removal and an addition of a random present key in ns. */
+static double remove_add_time_get(size_t items, uint32_t count)
+{
+    uint64_t start;
+
+    start = time_ns();
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t idx   = random_get(items);
+        void   * p_key = &m_buffers[idx];
+
+        TEST_ASSERT(nrf_802154_kvmap_remove(&m_kvmap, &p_key));
+        TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &p_key, &idx));
+    }
+
+    return (double)(time_ns() - start) / count;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count = BENCH_DEFAULT_COUNT;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    printf("map:   %s\n", NRF_802154_SERIALIZATION_KVMAP_HASH ? "hash" : "linear");
+    printf("items  hit [ns]  miss [ns]  remove+add [ns]\n");
+
+    for (size_t i = 0U; i < sizeof(m_sizes) / sizeof(m_sizes[0]); i++)
+    {
+        double hit;
+        double miss;
+        double remove_add;
+
+        map_fill(m_sizes[i]);
+
+        hit        = search_time_get(m_sizes[i], count, true);
+        miss       = search_time_get(m_sizes[i], count, false);
+        remove_add = remove_add_time_get(m_sizes[i], count);
+
+        TEST_ASSERT(nrf_802154_kvmap_count(&m_kvmap) == m_sizes[i]);
+
+        printf("%5zu  %8.1f  %9.1f  %15.1f\n", m_sizes[i], hit, miss, remove_add);
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Benchmark of the overhead of the debug log.
+ *
+ * The benchmark measures host CPU time of recording a log event and of draining the log. It is
+ * built with and without timestamped records, so the two results show the relative cost of
+ * the timestamps. Absolute numbers depend on the host and do not translate to target cycles.
+ *
+ * Usage: nrf_802154_log_bench [number_of_events]
+ */
+
+#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_APPLICATION
+
+#include <time.h>
+
+#include "test_common.h"
+
+#include "nrf_802154_debug_log.h"
+
+#define BENCH_DEFAULT_COUNT 1000000
+#define BENCH_DRAIN_BATCH   (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN / NRF_802154_SL_DEBUG_LOG_RECORD_LEN / 2)
+
+static uint32_t m_words[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count = BENCH_DEFAULT_COUNT;
+    uint32_t records = 0;
+    uint32_t words   = 0;
+    uint32_t lost;
+    uint64_t log_total;
+    uint64_t drain_total;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    test_driver_init();
+
+    log_total = time_ns();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_802154_sl_log_local_event(NRF_802154_LOG_VERBOSITY_LOW, 1, (uint16_t)i);
+    }
+
+    log_total = time_ns() - log_total;
+
+    // Records are drained in batches that fit in the buffer, so that none of them is lost.
+    (void)nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost);
+    drain_total = 0;
+
+    for (uint32_t i = 0; i < count; i += BENCH_DRAIN_BATCH)
+    {
+        uint64_t start;
+
+        for (uint32_t j = 0; j < BENCH_DRAIN_BATCH; j++)
+        {
+            nrf_802154_sl_log_local_event(NRF_802154_LOG_VERBOSITY_LOW, 1, (uint16_t)j);
+        }
+
+        start        = time_ns();
+        words       += nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost);
+        drain_total += time_ns() - start;
+
+        TEST_ASSERT(lost == 0);
+        records += BENCH_DRAIN_BATCH;
+    }
+
+    TEST_ASSERT(words == records * NRF_802154_SL_DEBUG_LOG_RECORD_LEN);
+
+    printf("record length:     %u words\n", NRF_802154_SL_DEBUG_LOG_RECORD_LEN);
+    printf("log event:         %.2f ns\n", (double)log_total / count);
+    printf("drain of a record: %.2f ns\n", (double)drain_total / records);
+
+    return 0;
+}
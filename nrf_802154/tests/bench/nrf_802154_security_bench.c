@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Benchmark of the frame security.
+ *
+ * The benchmark measures host CPU time of securing an Enh-Ack and a frame of the maximum length
+ * with the AES backend the driver is built with, and counts the AES blocks encrypted per frame.
+ * An Enh-Ack is secured in the RADIO interrupt and must be ready within the 192 us turnaround
+ * time. The host time is only a proxy, so when the time of encrypting one AES block on the target
+ * is given, the benchmark also estimates the target time and compares it with the turnaround time.
+ *
+ * Usage: nrf_802154_security_bench [number_of_frames] [target_us_per_block]
+ */
+
+#include <time.h>
+
+#include "test_common.h"
+
+#include "mac_features/nrf_802154_frame_security.h"
+#include "platform/nrf_802154_aes.h"
+
+#define BENCH_DEFAULT_COUNT 10000
+#define BENCH_TURNAROUND_US 192
+#define BENCH_KEY_INDEX     1
+#define BENCH_MIC_SIZE      4
+
+static uint32_t m_aes_blocks;
+
+void __real_nrf_802154_aes_ecb_encrypt(const uint8_t * p_key,
+                                       const uint8_t * p_clear,
+                                       uint8_t       * p_cipher);
+
+/* Counts the AES blocks encrypted by the frame security, see the linker options of the bench. */
+void __wrap_nrf_802154_aes_ecb_encrypt(const uint8_t * p_key,
+                                       const uint8_t * p_clear,
+                                       uint8_t       * p_cipher)
+{
+    m_aes_blocks++;
+    __real_nrf_802154_aes_ecb_encrypt(p_key, p_clear, p_cipher);
+}
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int compare_u64(const void * p_a, const void * p_b)
+{
+    uint64_t a = *(const uint64_t *)p_a;
+    uint64_t b = *(const uint64_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+/* Writes the auxiliary security header with the ENC-MIC-32 level and Key Identifier Mode 1. */
+static uint8_t aux_sec_header_set(uint8_t * p_psdu, uint8_t index)
+{
+    p_psdu[index++] = SECURITY_LEVEL_ENC_MIC_32 | KEY_ID_MODE_1;
+
+    for (uint8_t i = 0; i < FRAME_COUNTER_SIZE; i++)
+    {
+        p_psdu[index++] = 0;
+    }
+
+    p_psdu[index++] = BENCH_KEY_INDEX;
+
+    return index;
+}
+
+/* Builds an 802.15.4-2015 Enh-Ack addressed to an extended address, without IEs. */
+static void enh_ack_build(uint8_t * p_frame)
+{
+    uint8_t * p_psdu = &p_frame[PHR_SIZE];
+    uint8_t   index  = 0;
+
+    p_psdu[index++] = FRAME_TYPE_ACK | SECURITY_ENABLED_BIT;
+    p_psdu[index++] = DEST_ADDR_TYPE_EXTENDED | FRAME_VERSION_2;
+    p_psdu[index++] = 0;
+    p_psdu[index++] = TEST_PAN_ID & 0xff;
+    p_psdu[index++] = TEST_PAN_ID >> 8;
+
+    for (uint8_t i = 0; i < EXTENDED_ADDRESS_SIZE; i++)
+    {
+        p_psdu[index++] = i;
+    }
+
+    index = aux_sec_header_set(p_psdu, index);
+
+    for (uint8_t i = 0; i < BENCH_MIC_SIZE + FCS_SIZE; i++)
+    {
+        p_psdu[index++] = 0;
+    }
+
+    p_frame[PHR_OFFSET] = index;
+}
+
+/* Builds an 802.15.4-2006 data frame of the maximum length. */
+static void max_frame_build(uint8_t * p_frame)
+{
+    uint8_t * p_psdu = &p_frame[PHR_SIZE];
+    uint8_t   index  = 0;
+
+    p_psdu[index++] = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK | SECURITY_ENABLED_BIT;
+    p_psdu[index++] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_1;
+    p_psdu[index++] = 0;
+    p_psdu[index++] = TEST_PAN_ID & 0xff;
+    p_psdu[index++] = TEST_PAN_ID >> 8;
+    p_psdu[index++] = TEST_PEER_ADDR & 0xff;
+    p_psdu[index++] = TEST_PEER_ADDR >> 8;
+    p_psdu[index++] = TEST_SHORT_ADDR & 0xff;
+    p_psdu[index++] = TEST_SHORT_ADDR >> 8;
+
+    index = aux_sec_header_set(p_psdu, index);
+
+    while (index < MAX_PACKET_SIZE)
+    {
+        p_psdu[index] = index;
+        index++;
+    }
+
+    p_frame[PHR_OFFSET] = MAX_PACKET_SIZE;
+}
+
+static void bench(const char * p_name,
+                  void (*frame_build)(uint8_t * p_frame),
+                  uint64_t   * p_samples,
+                  uint32_t     count,
+                  double       target_us_per_block)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint64_t start;
+    uint64_t total  = 0;
+    uint32_t blocks = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        frame_build(frame);
+        m_aes_blocks = 0;
+
+        start = time_ns();
+        TEST_ASSERT(nrf_802154_frame_security_apply(frame) == NRF_802154_FRAME_SECURITY_APPLIED);
+        p_samples[i] = time_ns() - start;
+        total       += p_samples[i];
+
+        // Each frame of the same length needs the same number of blocks.
+        TEST_ASSERT((i == 0) || (m_aes_blocks == blocks));
+        blocks = m_aes_blocks;
+    }
+
+    qsort(p_samples, count, sizeof(p_samples[0]), compare_u64);
+
+    printf("%s (%u bytes):\n", p_name, frame[PHR_OFFSET]);
+    printf("  frames/s:        %.0f\n", count * 1e9 / total);
+    printf("  p50:             %.2f us\n", p_samples[count / 2] / 1e3);
+    printf("  p99:             %.2f us\n", p_samples[(uint64_t)count * 99 / 100] / 1e3);
+    printf("  aes blocks:      %u\n", blocks);
+
+    if (target_us_per_block > 0)
+    {
+        printf("  target estimate: %.1f us (turnaround %u us)\n",
+               blocks * target_us_per_block,
+               BENCH_TURNAROUND_US);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t         count               = BENCH_DEFAULT_COUNT;
+    double           target_us_per_block = 0;
+    uint64_t       * p_samples;
+    uint8_t          key_index = BENCH_KEY_INDEX;
+    nrf_802154_key_t key       =
+    {
+        .value = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                  0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf},
+        .id    = {.mode = 1, .p_key_id = &key_index},
+    };
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        target_us_per_block = strtod(argv[2], NULL);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    p_samples = malloc(count * sizeof(p_samples[0]));
+    if (p_samples == NULL)
+    {
+        return 1;
+    }
+
+    test_driver_init();
+    TEST_ASSERT(nrf_802154_security_key_store(&key) == NRF_802154_SECURITY_ERROR_NONE);
+
+    bench("secured enh-ack", enh_ack_build, p_samples, count, target_us_per_block);
+    bench("secured max frame", max_frame_build, p_samples, count, target_us_per_block);
+
+    free(p_samples);
+
+    return 0;
+}
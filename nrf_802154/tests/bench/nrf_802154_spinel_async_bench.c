@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of pipelined asynchronous requests of the serialization.
+ *
+ * The application side of the serialization sends requests over a simulated IPC to the simulated
+ * network core, which serves them one at a time. For each pipeline depth the benchmark keeps that
+ * many requests outstanding, starting a new request from the completion callback of the previous
+ * one, and reports the throughput in simulated time and host CPU time per request. Depth 1 is
+ * equivalent to the blocking calls, which wait for the response before the next request is sent.
+ *
+ * Usage: nrf_802154_spinel_async_bench [number_of_requests] [latency_us] [service_us]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "test_assert.h"
+
+#include "nrf_802154_serialization_async.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_spinel_async.h"
+#include "nrf_802154_sim_spinel.h"
+
+#define BENCH_DEFAULT_COUNT      100000
+#define BENCH_DEFAULT_LATENCY_US 20U
+#define BENCH_DEFAULT_SERVICE_US 10U
+
+static const uint32_t m_depths[] = {1U, 2U, 4U, 8U, NRF_802154_SERIALIZATION_ASYNC_REQUESTS};
+
+static uint32_t m_to_start;
+static uint32_t m_completed;
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void completion_callback(nrf_802154_ser_err_t error, bool result, void * p_context);
+
+static void request_start(void)
+{
+    static const uint8_t pan_id[2] = {0xcd, 0xab};
+
+    m_to_start--;
+    TEST_ASSERT(nrf_802154_pan_id_set_async(pan_id, completion_callback, NULL) > 0);
+}
+
+static void completion_callback(nrf_802154_ser_err_t error, bool result, void * p_context)
+{
+    (void)p_context;
+
+    TEST_ASSERT((error == NRF_802154_SERIALIZATION_ERROR_OK) && result);
+
+    m_completed++;
+
+    // Keep the pipeline full
+    if (m_to_start > 0U)
+    {
+        request_start();
+    }
+}
+
+/* Runs the requests and returns host CPU time per request, in nanoseconds. */
+static double requests_run(uint32_t depth, uint32_t count, uint32_t latency, uint32_t service)
+{
+    uint64_t start;
+
+    nrf_802154_sim_spinel_reset(latency, service);
+
+    // The buffer managers initialized by nrf_802154_init() need 32-bit pointers, and asynchronous
+    // requests do not use them
+    nrf_802154_spinel_async_init();
+
+    m_to_start  = count;
+    m_completed = 0U;
+
+    start = time_ns();
+
+    for (uint32_t i = 0U; (i < depth) && (m_to_start > 0U); i++)
+    {
+        request_start();
+    }
+
+    while (nrf_802154_sim_spinel_next_response_deliver())
+    {
+    }
+
+    TEST_ASSERT(m_completed == count);
+    TEST_ASSERT(nrf_802154_sim_spinel_errors_get() == 0U);
+
+    return (double)(time_ns() - start) / count;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count   = BENCH_DEFAULT_COUNT;
+    uint32_t latency = BENCH_DEFAULT_LATENCY_US;
+    uint32_t service = BENCH_DEFAULT_SERVICE_US;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        latency = strtoul(argv[2], NULL, 0);
+    }
+
+    if (argc > 3)
+    {
+        service = strtoul(argv[3], NULL, 0);
+    }
+
+    if ((count == 0) || (service == 0))
+    {
+        return 1;
+    }
+
+    printf("IPC latency %u us, network core service time %u us\n", latency, service);
+    printf("depth  requests/s  speedup  host CPU [ns/request]\n");
+
+    double base_rate = 0.0;
+
+    for (size_t i = 0U; i < sizeof(m_depths) / sizeof(m_depths[0]); i++)
+    {
+        double cpu_ns = requests_run(m_depths[i], count, latency, service);
+        double rate   = count * 1e6 / nrf_802154_sim_spinel_time_get();
+
+        if (i == 0U)
+        {
+            base_rate = rate;
+        }
+
+        printf("%5u  %10.0f  %6.2fx  %21.1f\n", m_depths[i], rate, rate / base_rate, cpu_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Benchmark of the straight-line spinel encoders of the serialization.
+ *
+ * For each per-frame format the benchmark measures host CPU time of encoding a frame with
+ * spinel_datatype_pack(), which interprets the format string, and with the writers of
+ * nrf_802154_spinel_codec.h. Each variant is a separate function, so that the code size of
+ * the call sites can be compared with the nrf_802154_spinel_codec_size test. The benchmark is
+ * built with optimizations, see CMakeLists.txt.
+ *
+ * Usage: nrf_802154_spinel_codec_bench [number_of_frames]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_assert.h"
+
+#include "nrf_802154_spinel_codec.h"
+#include "nrf_802154_spinel_datatypes.h"
+
+#define BENCH_DEFAULT_COUNT 1000000
+#define BENCH_BUFFER_SIZE   300U
+#define BENCH_FRAME_LEN     127U
+
+typedef size_t (* bench_encoder_t)(uint8_t * p_buffer);
+
+typedef struct
+{
+    const char    * p_name;
+    bench_encoder_t pack;
+    bench_encoder_t writer;
+} bench_format_t;
+
+/* Frame long enough for the 4 bytes read past its end by NRF_802154_HDATA_ENCODE. */
+static uint8_t           m_frame[BENCH_FRAME_LEN + 1U + 4U];
+static volatile uint32_t m_handle = 0x12345678U;
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static size_t packed_length(spinel_ssize_t siz)
+{
+    return (siz < 0) ? 0U : (size_t)siz;
+}
+
+static void writer_begin(nrf_802154_spinel_writer_t * p_writer,
+                         uint8_t                    * p_buffer,
+                         spinel_prop_key_t            property)
+{
+    nrf_802154_spinel_writer_init(p_writer, p_buffer, BENCH_BUFFER_SIZE);
+    nrf_802154_spinel_write_uint8(p_writer, SPINEL_HEADER_FLAG);
+    nrf_802154_spinel_write_uint_packed(p_writer, SPINEL_CMD_PROP_VALUE_SET);
+    nrf_802154_spinel_write_uint_packed(p_writer, property);
+}
+
+static size_t writer_end(const nrf_802154_spinel_writer_t * p_writer)
+{
+    return nrf_802154_spinel_writer_ok(p_writer) ? nrf_802154_spinel_writer_length(p_writer) : 0U;
+}
+
+__attribute__((noinline)) size_t bench_encode_transmit_pack(uint8_t * p_buffer)
+{
+    return packed_length(spinel_datatype_pack(p_buffer,
+                                              BENCH_BUFFER_SIZE,
+                                              SPINEL_DATATYPE_COMMAND_PROP_S
+                                              SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                              SPINEL_HEADER_FLAG,
+                                              SPINEL_CMD_PROP_VALUE_SET,
+                                              SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
+                                              NRF_802154_HDATA_ENCODE(m_handle, m_frame,
+                                                                      m_frame[0]),
+                                              true));
+}
+
+__attribute__((noinline)) size_t bench_encode_transmit_writer(uint8_t * p_buffer)
+{
+    nrf_802154_spinel_writer_t writer;
+
+    writer_begin(&writer, p_buffer, SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
+    nrf_802154_spinel_write_transmit_raw(&writer, m_handle, m_frame, true);
+
+    return writer_end(&writer);
+}
+
+__attribute__((noinline)) size_t bench_encode_received_pack(uint8_t * p_buffer)
+{
+    return packed_length(spinel_datatype_pack(
+                             p_buffer,
+                             BENCH_BUFFER_SIZE,
+                             SPINEL_DATATYPE_COMMAND_PROP_S
+                             SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                             SPINEL_HEADER_FLAG,
+                             SPINEL_CMD_PROP_VALUE_SET,
+                             SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                             NRF_802154_HDATA_ENCODE(m_handle, m_frame, m_frame[0]),
+                             -60,
+                             200U,
+                             m_handle));
+}
+
+__attribute__((noinline)) size_t bench_encode_received_writer(uint8_t * p_buffer)
+{
+    nrf_802154_spinel_writer_t writer;
+
+    writer_begin(&writer, p_buffer, SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW);
+    nrf_802154_spinel_write_received_timestamp_raw(&writer, m_handle, m_frame, -60, 200U,
+                                                   m_handle);
+
+    return writer_end(&writer);
+}
+
+__attribute__((noinline)) size_t bench_encode_transmitted_pack(uint8_t * p_buffer)
+{
+    // ACK of a data request frame
+    return packed_length(spinel_datatype_pack(
+                             p_buffer,
+                             BENCH_BUFFER_SIZE,
+                             SPINEL_DATATYPE_COMMAND_PROP_S
+                             SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                             SPINEL_HEADER_FLAG,
+                             SPINEL_CMD_PROP_VALUE_SET,
+                             SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW,
+                             m_handle,
+                             NRF_802154_HDATA_ENCODE(m_handle, m_frame, 5U),
+                             -60,
+                             200U));
+}
+
+__attribute__((noinline)) size_t bench_encode_transmitted_writer(uint8_t * p_buffer)
+{
+    nrf_802154_spinel_writer_t writer;
+
+    writer_begin(&writer, p_buffer, SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW);
+    nrf_802154_spinel_write_transmitted_raw(&writer, m_handle, m_handle, m_frame, 5U, -60, 200U);
+
+    return writer_end(&writer);
+}
+
+static const bench_format_t m_formats[] =
+{
+    {"transmit", bench_encode_transmit_pack, bench_encode_transmit_writer},
+    {"received", bench_encode_received_pack, bench_encode_received_writer},
+    {"transmitted", bench_encode_transmitted_pack, bench_encode_transmitted_writer},
+};
+
+/* Encodes the frames and returns host CPU time per frame, in nanoseconds. */
+static double encode_time_get(bench_encoder_t encoder, uint32_t count)
+{
+    static uint8_t buffer[BENCH_BUFFER_SIZE];
+    uint64_t       start = time_ns();
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        TEST_ASSERT(encoder(buffer) > 0U);
+    }
+
+    return (double)(time_ns() - start) / count;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t count = BENCH_DEFAULT_COUNT;
+
+    if (argc > 1)
+    {
+        count = strtoul(argv[1], NULL, 0);
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    for (size_t i = 0U; i < sizeof(m_frame); i++)
+    {
+        m_frame[i] = (uint8_t)i;
+    }
+
+    m_frame[0] = BENCH_FRAME_LEN;
+
+    printf("format       bytes  pack [ns/frame]  writer [ns/frame]\n");
+
+    for (size_t i = 0U; i < sizeof(m_formats) / sizeof(m_formats[0]); i++)
+    {
+        uint8_t packed[BENCH_BUFFER_SIZE];
+        uint8_t written[BENCH_BUFFER_SIZE];
+        size_t  len = m_formats[i].pack(packed);
+
+        // Both variants must produce the same frame
+        TEST_ASSERT(m_formats[i].writer(written) == len);
+        TEST_ASSERT(memcmp(packed, written, len) == 0);
+
+        printf("%-11s  %5zu  %15.1f  %17.1f\n",
+               m_formats[i].p_name,
+               len,
+               encode_time_get(m_formats[i].pack, count),
+               encode_time_get(m_formats[i].writer, count));
+    }
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#
+# Copyright (c) 2021 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Prints sizes of symbols of an executable, in bytes.
+#   NM      - nm tool
+#   FILE    - executable
+#   SYMBOLS - regular expression matching the symbol names
+
+execute_process(
+  COMMAND ${NM} --print-size --radix=d ${FILE}
+  OUTPUT_VARIABLE symbols
+  RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${NM} failed on ${FILE}")
+endif()
+
+string(REPLACE "\n" ";" symbols "${symbols}")
+
+foreach(line ${symbols})
+  if(line MATCHES "^[0-9]+ ([0-9]+) [tT] (.+)$")
+    set(size ${CMAKE_MATCH_1})
+    set(name ${CMAKE_MATCH_2})
+
+    if(name MATCHES "${SYMBOLS}")
+      math(EXPR size "${size}")
+      message("${name} ${size}")
+    endif()
+  endif()
+endforeach()
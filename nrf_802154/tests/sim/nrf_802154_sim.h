@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Simulated transceiver and time for host tests of the 802.15.4 driver.
+ *
+ * The simulation replaces nrf_802154_trx.c, the platform layer and the Zephyr kernel timer used by
+ * the open-source SL. The rest of the driver is compiled unmodified. Radio events do not happen by
+ * themselves: a test starts an operation through the public driver API and then ends it with one
+ * of the functions below, which call the trx handlers in the same order as the trx module does.
+ * All functions are called from a single thread, which plays the role of both the main thread and
+ * the RADIO interrupt.
+ *
+ * The simulation works at the level of the trx API. It does not model the RADIO, TIMER, EGU and
+ * PPI registers, so nrf_802154_trx.c and the hardware-dependent timings are not covered. There is
+ * no air medium shared by several nodes either: the test decides the CCA results and provides the
+ * received frames, and the duration of radio operations is simulated only when the test advances
+ * the time.
+ */
+
+#ifndef NRF_802154_SIM_H__
+#define NRF_802154_SIM_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_trx.h"
+
+/**
+ * @brief Statistics of the simulated transceiver.
+ */
+typedef struct
+{
+    uint32_t tx_frames;      ///< Number of started frame transmissions.
+    uint32_t tx_acks;        ///< Number of started ACK transmissions.
+    uint32_t rx_frames;      ///< Number of started frame receptions.
+    uint32_t rx_acks;        ///< Number of started ACK receptions.
+    uint32_t ed_operations;  ///< Number of started energy detections.
+    uint32_t ed_time_us;     ///< Total time of started energy detections, in microseconds.
+    uint32_t cca_operations; ///< Number of started standalone CCA operations.
+    uint32_t aborts;         ///< Number of aborted operations.
+} nrf_802154_sim_stats_t;
+
+/**
+ * @brief Resets the simulation. Must be called before @ref nrf_802154_init.
+ */
+void nrf_802154_sim_reset(void);
+
+/**
+ * @brief Gets the current simulated time, in microseconds.
+ */
+uint64_t nrf_802154_sim_time_get(void);
+
+/**
+ * @brief Advances the simulated time and fires the timers that expire in the meantime.
+ *
+ * @param[in]  us  Time to advance, in microseconds.
+ */
+void nrf_802154_sim_time_advance(uint32_t us);
+
+/**
+ * @brief Sets the simulated temperature and notifies the driver about the change.
+ *
+ * The temperature is 20 C after @ref nrf_802154_sim_reset, at which RSSI, LQI and ED values
+ * need no correction.
+ *
+ * @param[in]  temperature  Temperature, in centigrades (C).
+ */
+void nrf_802154_sim_temperature_set(int8_t temperature);
+
+/**
+ * @brief Delivers pending asynchronous events, such as the HFCLK start or the end of going idle.
+ *
+ * The SWI handlers run after all other events, unless the SWI is held.
+ */
+void nrf_802154_sim_process(void);
+
+/**
+ * @brief Holds or releases the SWI, as if higher priority interrupts kept it from running.
+ *
+ * @param[in]  hold  If the SWI handlers must not run.
+ */
+void nrf_802154_sim_swi_hold(bool hold);
+
+/**
+ * @brief Gets the current state of the simulated transceiver.
+ */
+trx_state_t nrf_802154_sim_trx_state_get(void);
+
+/**
+ * @brief Gets the channel the simulated transceiver is tuned to.
+ */
+uint8_t nrf_802154_sim_channel_get(void);
+
+/**
+ * @brief Gets the frame passed to the last frame transmission, starting with the PHR.
+ */
+const uint8_t * nrf_802154_sim_tx_frame_get(void);
+
+/**
+ * @brief Gets the frame passed to the last ACK transmission, starting with the PHR.
+ */
+const uint8_t * nrf_802154_sim_tx_ack_get(void);
+
+/**
+ * @brief Gets the statistics of the simulated transceiver.
+ */
+const nrf_802154_sim_stats_t * nrf_802154_sim_stats_get(void);
+
+/**
+ * @brief Checks if the receiver waits for a receive buffer, so that it cannot receive a frame.
+ */
+bool nrf_802154_sim_rx_buffer_is_missing(void);
+
+/**
+ * @brief Ends a frame transmission started with @ref nrf_802154_trx_transmit_frame.
+ *
+ * @param[in]  channel_idle  Result of the CCA preceding the transmission, ignored without CCA.
+ */
+void nrf_802154_sim_tx_end(bool channel_idle);
+
+/**
+ * @brief Ends an ACK transmission started with @ref nrf_802154_trx_transmit_ack.
+ */
+void nrf_802154_sim_tx_ack_end(void);
+
+/**
+ * @brief Receives a frame while the transceiver receives frames.
+ *
+ * If the driver responds with an ACK, the ACK transmission is started, but not ended.
+ *
+ * @param[in]  p_frame  Frame to receive, starting with the PHR.
+ * @param[in]  crc_ok   If the frame is received with a correct CRC.
+ */
+void nrf_802154_sim_rx_frame(const uint8_t * p_frame, bool crc_ok);
+
+/**
+ * @brief Receives an ACK while the transceiver waits for one.
+ *
+ * @param[in]  p_ack   ACK frame to receive, starting with the PHR.
+ * @param[in]  crc_ok  If the ACK is received with a correct CRC.
+ */
+void nrf_802154_sim_rx_ack(const uint8_t * p_ack, bool crc_ok);
+
+/**
+ * @brief Ends an energy detection started with @ref nrf_802154_trx_energy_detection.
+ *
+ * @param[in]  ed_sample  Raw ED sample reported by the RADIO.
+ */
+void nrf_802154_sim_ed_end(uint8_t ed_sample);
+
+/**
+ * @brief Ends a standalone CCA started with @ref nrf_802154_trx_standalone_cca.
+ *
+ * @param[in]  channel_idle  If the channel was found idle.
+ */
+void nrf_802154_sim_cca_end(bool channel_idle);
+
+#endif /* NRF_802154_SIM_H__ */
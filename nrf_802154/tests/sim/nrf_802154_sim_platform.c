@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the platform layer, the Zephyr kernel timer and the SWI for
+ *   the simulation.
+ *
+ */
+
+#include "nrf_802154_sim.h"
+#include "nrf_802154_sim_internal.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include <kernel.h>
+#include <nrf.h>
+
+#include "hal/nrf_radio.h"
+#include "nrf_802154_sl_utils.h"
+#include "platform/nrf_802154_clock.h"
+#include "platform/nrf_802154_hp_timer.h"
+#include "platform/nrf_802154_irq.h"
+#include "platform/nrf_802154_random.h"
+#include "platform/nrf_802154_temperature.h"
+#include "nrf_802154_swi.h"
+
+#define SIM_DEFAULT_TEMPERATURE 20 ///< Temperature after reset, at which RSSI needs no correction [C].
+
+SCB_Type       g_nrf_scb_sim;
+DWT_Type       g_nrf_dwt_sim;
+CoreDebug_Type g_nrf_core_debug_sim;
+NRF_RADIO_Type g_nrf_radio_sim;
+NRF_EGU_Type   g_nrf_egu_sim;
+
+static uint64_t         m_time_us;
+static struct k_timer * mp_timers;
+static bool             m_hfclk_running;
+static bool             m_hfclk_pending;
+static bool             m_lfclk_running;
+static uint32_t         m_random;
+static int8_t           m_temperature;
+static bool             m_swi_held;
+
+static k_ticks_t us_to_ticks(uint64_t us)
+{
+    return (k_ticks_t)((us * CONFIG_SYS_CLOCK_TICKS_PER_SEC) / NRF_802154_SL_US_PER_S);
+}
+
+static uint64_t ticks_to_us(k_ticks_t ticks)
+{
+    return ((uint64_t)ticks * NRF_802154_SL_US_PER_S + CONFIG_SYS_CLOCK_TICKS_PER_SEC - 1) /
+           CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+}
+
+__WEAK void nrf_802154_notification_swi_irq_handler(void)
+{
+    // Implemented by nrf_802154_notification_swi.c if the executable uses it.
+}
+
+/* Returns true if an enabled EGU event waits for the SWI handler. */
+static bool swi_pending(void)
+{
+    if (m_swi_held)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < sizeof(g_nrf_egu_sim.EVENTS_TRIGGERED) /
+         sizeof(g_nrf_egu_sim.EVENTS_TRIGGERED[0]); i++)
+    {
+        if (g_nrf_egu_sim.EVENTS_TRIGGERED[i] && (g_nrf_egu_sim.INTEN & (1UL << i)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void timer_unlink(struct k_timer * timer)
+{
+    for (struct k_timer ** pp_item = &mp_timers; *pp_item != NULL; pp_item = &(*pp_item)->p_next)
+    {
+        if (*pp_item == timer)
+        {
+            *pp_item       = timer->p_next;
+            timer->p_next  = NULL;
+            timer->running = false;
+            break;
+        }
+    }
+}
+
+/* Returns the running timer that expires first. */
+static struct k_timer * timer_first_get(void)
+{
+    struct k_timer * p_first = NULL;
+
+    for (struct k_timer * p_item = mp_timers; p_item != NULL; p_item = p_item->p_next)
+    {
+        if ((p_first == NULL) || (p_item->expiry < p_first->expiry))
+        {
+            p_first = p_item;
+        }
+    }
+
+    return p_first;
+}
+
+void nrf_802154_sim_reset(void)
+{
+    m_time_us       = 0;
+    mp_timers       = NULL;
+    m_hfclk_running = false;
+    m_hfclk_pending = false;
+    m_lfclk_running = false;
+    m_random        = 0x12345678UL;
+    m_temperature   = SIM_DEFAULT_TEMPERATURE;
+    m_swi_held      = false;
+
+    memset(&g_nrf_egu_sim, 0, sizeof(g_nrf_egu_sim));
+
+    nrf_802154_sim_trx_reset();
+}
+
+uint64_t nrf_802154_sim_time_get(void)
+{
+    return m_time_us;
+}
+
+void nrf_802154_sim_time_advance(uint32_t us)
+{
+    uint64_t end = m_time_us + us;
+
+    while (true)
+    {
+        struct k_timer * p_timer = timer_first_get();
+
+        if ((p_timer == NULL) || (ticks_to_us(p_timer->expiry) > end))
+        {
+            break;
+        }
+
+        if (ticks_to_us(p_timer->expiry) > m_time_us)
+        {
+            m_time_us = ticks_to_us(p_timer->expiry);
+        }
+
+        timer_unlink(p_timer);
+        p_timer->expiry_fn(p_timer);
+        nrf_802154_sim_process();
+    }
+
+    m_time_us = end;
+}
+
+void nrf_802154_sim_process(void)
+{
+    while (m_hfclk_pending || nrf_802154_sim_trx_idle_pending() || swi_pending())
+    {
+        if (m_hfclk_pending)
+        {
+            m_hfclk_pending = false;
+            m_hfclk_running = true;
+            nrf_802154_clock_hfclk_ready();
+        }
+
+        if (nrf_802154_sim_trx_idle_pending())
+        {
+            nrf_802154_sim_trx_idle_finish();
+        }
+
+        // The SWI has a lower priority than the events above.
+        if (!m_hfclk_pending && !nrf_802154_sim_trx_idle_pending() && swi_pending())
+        {
+            nrf_802154_notification_swi_irq_handler();
+        }
+    }
+}
+
+void nrf_802154_sim_swi_hold(bool hold)
+{
+    m_swi_held = hold;
+}
+
+void nrf_802154_swi_init(void)
+{
+    // The SWI handlers are called by nrf_802154_sim_process.
+}
+
+
+int64_t k_uptime_ticks(void)
+{
+    return us_to_ticks(m_time_us);
+}
+
+void k_timer_start(struct k_timer * timer, k_timeout_t duration, k_timeout_t period)
+{
+    (void)period;
+
+    timer_unlink(timer);
+
+    timer->expiry  = k_uptime_ticks() + duration.ticks;
+    timer->running = true;
+    timer->p_next  = mp_timers;
+    mp_timers      = timer;
+}
+
+void k_timer_stop(struct k_timer * timer)
+{
+    bool was_running = timer->running;
+
+    timer_unlink(timer);
+
+    if (was_running && (timer->stop_fn != NULL))
+    {
+        timer->stop_fn(timer);
+    }
+}
+
+uint64_t NRF_802154_SL_US_TO_RTC_TICKS(uint64_t time)
+{
+    return (uint64_t)us_to_ticks(time);
+}
+
+void nrf_802154_clock_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_clock_deinit(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_clock_hfclk_start(void)
+{
+    // The clock is ready asynchronously, as on the target.
+    m_hfclk_pending = true;
+}
+
+void nrf_802154_clock_hfclk_stop(void)
+{
+    m_hfclk_pending = false;
+    m_hfclk_running = false;
+}
+
+bool nrf_802154_clock_hfclk_is_running(void)
+{
+    return m_hfclk_running;
+}
+
+void nrf_802154_clock_lfclk_start(void)
+{
+    m_lfclk_running = true;
+}
+
+void nrf_802154_clock_lfclk_stop(void)
+{
+    m_lfclk_running = false;
+}
+
+bool nrf_802154_clock_lfclk_is_running(void)
+{
+    return m_lfclk_running;
+}
+
+void nrf_802154_irq_init(uint32_t irqn, uint32_t prio, nrf_802154_isr_t isr)
+{
+    (void)irqn;
+    (void)prio;
+    (void)isr;
+}
+
+void nrf_802154_irq_enable(uint32_t irqn)
+{
+    (void)irqn;
+}
+
+void nrf_802154_irq_disable(uint32_t irqn)
+{
+    (void)irqn;
+}
+
+void nrf_802154_irq_set_pending(uint32_t irqn)
+{
+    (void)irqn;
+}
+
+void nrf_802154_irq_clear_pending(uint32_t irqn)
+{
+    (void)irqn;
+}
+
+bool nrf_802154_irq_is_enabled(uint32_t irqn)
+{
+    (void)irqn;
+
+    return true;
+}
+
+uint32_t nrf_802154_irq_priority_get(uint32_t irqn)
+{
+    (void)irqn;
+
+    return 0;
+}
+
+void nrf_802154_hp_timer_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_hp_timer_deinit(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_hp_timer_start(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_hp_timer_stop(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_hp_timer_current_time_get(void)
+{
+    return (uint32_t)m_time_us;
+}
+
+uint32_t nrf_802154_hp_timer_sync_task_get(void)
+{
+    return 0;
+}
+
+void nrf_802154_hp_timer_sync_prepare(void)
+{
+    // Intentionally empty
+}
+
+bool nrf_802154_hp_timer_sync_time_get(uint32_t * p_timestamp)
+{
+    *p_timestamp = (uint32_t)m_time_us;
+
+    return true;
+}
+
+uint32_t nrf_802154_hp_timer_timestamp_task_get(void)
+{
+    return 0;
+}
+
+uint32_t nrf_802154_hp_timer_timestamp_get(void)
+{
+    return (uint32_t)m_time_us;
+}
+
+void nrf_802154_random_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_random_deinit(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    // Deterministic xorshift, so that the CSMA-CA backoffs are repeatable between runs.
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+
+    return m_random;
+}
+
+void nrf_802154_sim_temperature_set(int8_t temperature)
+{
+    m_temperature = temperature;
+
+    nrf_802154_temperature_changed();
+}
+
+void nrf_802154_temperature_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_temperature_deinit(void)
+{
+    // Intentionally empty
+}
+
+int8_t nrf_802154_temperature_get(void)
+{
+    return m_temperature;
+}
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the simulated network core and the platform of the serialization
+ *   for host tests of the application side of the serialization.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_sim_spinel.h"
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_callouts.h"
+#include "nrf_802154_serialization_error.h"
+#include "nrf_802154_serialization_time.h"
+#include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_spinel_backend_callouts.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_response_notifier.h"
+
+/* More than the maximum number of outstanding asynchronous requests. */
+#define SIM_SPINEL_RESPONSES_MAX 32U
+
+/**
+ * @brief Response of the network core on its way to the application core.
+ */
+typedef struct
+{
+    uint32_t     arrival_time; ///< Time at which the response reaches the application core.
+    spinel_tid_t tid;          ///< Transaction identifier of the request.
+} sim_spinel_response_t;
+
+static sim_spinel_response_t m_responses[SIM_SPINEL_RESPONSES_MAX];
+static uint32_t              m_responses_head;
+static uint32_t              m_responses_count;
+
+static uint32_t m_now;
+static uint32_t m_latency;
+static uint32_t m_service;
+static uint32_t m_net_busy_until;
+static bool     m_unresponsive;
+static uint32_t m_requests;
+static uint32_t m_errors;
+
+void nrf_802154_sim_spinel_reset(uint32_t latency_us, uint32_t service_us)
+{
+    m_responses_head  = 0U;
+    m_responses_count = 0U;
+    m_now             = 0U;
+    m_latency         = latency_us;
+    m_service         = service_us;
+    m_net_busy_until  = 0U;
+    m_unresponsive    = false;
+    m_requests        = 0U;
+    m_errors          = 0U;
+}
+
+uint32_t nrf_802154_sim_spinel_time_get(void)
+{
+    return m_now;
+}
+
+/* Delivers the oldest response in flight to the application core. */
+static void response_deliver(void)
+{
+    sim_spinel_response_t response = m_responses[m_responses_head];
+    uint8_t               frame[8];
+    spinel_ssize_t        siz;
+
+    // Remove the response first, as the completion callback can send another request
+    m_responses_head = (m_responses_head + 1U) % SIM_SPINEL_RESPONSES_MAX;
+    m_responses_count--;
+
+    siz = spinel_datatype_pack(frame,
+                               sizeof(frame),
+                               SPINEL_DATATYPE_COMMAND_PROP_S
+                               SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS,
+                               SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | response.tid,
+                               SPINEL_CMD_PROP_VALUE_IS,
+                               SPINEL_PROP_LAST_STATUS,
+                               SPINEL_STATUS_OK);
+    assert(siz > 0);
+
+    nrf_802154_spinel_encoded_packet_received(frame, (size_t)siz);
+}
+
+void nrf_802154_sim_spinel_time_advance(uint32_t us)
+{
+    uint32_t end = m_now + us;
+
+    while ((m_responses_count > 0U) &&
+           ((int32_t)(end - m_responses[m_responses_head].arrival_time) >= 0))
+    {
+        m_now = m_responses[m_responses_head].arrival_time;
+        response_deliver();
+    }
+
+    m_now = end;
+}
+
+bool nrf_802154_sim_spinel_next_response_deliver(void)
+{
+    if (m_responses_count == 0U)
+    {
+        return false;
+    }
+
+    if ((int32_t)(m_responses[m_responses_head].arrival_time - m_now) > 0)
+    {
+        m_now = m_responses[m_responses_head].arrival_time;
+    }
+
+    response_deliver();
+
+    return true;
+}
+
+void nrf_802154_sim_spinel_unresponsive_set(bool unresponsive)
+{
+    m_unresponsive = unresponsive;
+}
+
+uint32_t nrf_802154_sim_spinel_requests_get(void)
+{
+    return m_requests;
+}
+
+uint32_t nrf_802154_sim_spinel_errors_get(void)
+{
+    return m_errors;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
+                                                           size_t       data_len)
+{
+    const uint8_t * p_frame = (const uint8_t *)p_data;
+    uint32_t        start;
+    uint32_t        tail;
+
+    assert(data_len > 0U);
+
+    m_requests++;
+
+    if (m_unresponsive)
+    {
+        return (nrf_802154_ser_err_t)data_len;
+    }
+
+    // The network core serves the requests in the order of their arrival
+    start = m_now + m_latency;
+
+    if ((int32_t)(m_net_busy_until - start) > 0)
+    {
+        start = m_net_busy_until;
+    }
+
+    m_net_busy_until = start + m_service;
+
+    assert(m_responses_count < SIM_SPINEL_RESPONSES_MAX);
+
+    tail = (m_responses_head + m_responses_count) % SIM_SPINEL_RESPONSES_MAX;
+
+    m_responses[tail].arrival_time = m_net_busy_until + m_latency;
+    m_responses[tail].tid          = SPINEL_HEADER_GET_TID(p_frame[0]);
+    m_responses_count++;
+
+    return (nrf_802154_ser_err_t)data_len;
+}
+
+nrf_802154_ser_err_t nrf_802154_backend_init(void)
+{
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+uint32_t nrf_802154_serialization_time_get(void)
+{
+    return m_now;
+}
+
+void nrf_802154_serialization_error(const nrf_802154_ser_err_data_t * p_err)
+{
+    (void)p_err;
+
+    m_errors++;
+}
+
+/* Blocking calls are not simulated, the network core answers asynchronous requests only. */
+
+void nrf_802154_spinel_response_notifier_init(void)
+{
+}
+
+void nrf_802154_spinel_response_notifier_lock_before_request(spinel_prop_key_t property)
+{
+    (void)property;
+}
+
+nrf_802154_spinel_notify_buff_t * nrf_802154_spinel_response_notifier_property_await(
+    uint32_t timeout)
+{
+    (void)timeout;
+
+    return NULL;
+}
+
+void nrf_802154_spinel_response_notifier_free(nrf_802154_spinel_notify_buff_t * p_notify)
+{
+    (void)p_notify;
+}
+
+void nrf_802154_spinel_response_notifier_property_notify(spinel_prop_key_t property,
+                                                         const void      * p_data,
+                                                         size_t            data_len)
+{
+    (void)property;
+    (void)p_data;
+    (void)data_len;
+}
+
+/* The network core sends no notifications, the callouts of the driver only need to be linked. */
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    (void)channel_free;
+}
+
+void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
+{
+    (void)error;
+}
+
+void nrf_802154_energy_detected(uint8_t result)
+{
+    (void)result;
+}
+
+void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    (void)error;
+}
+
+void nrf_802154_tx_ack_started(const uint8_t * p_data)
+{
+    (void)p_data;
+}
+
+void nrf_802154_received_timestamp_raw(uint8_t * p_data, int8_t power, uint8_t lqi, uint32_t time)
+{
+    (void)p_data;
+    (void)power;
+    (void)lqi;
+    (void)time;
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    (void)error;
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)p_ack;
+    (void)power;
+    (void)lqi;
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Simulated network core for host tests of the application side of the serialization.
+ *
+ * The simulation replaces the spinel backend and the platform of the serialization. Spinel frames
+ * sent by the application core reach the simulated network core after the IPC latency. The network
+ * core serves requests one at a time, each for the service time, and answers every request with
+ * SPINEL_PROP_LAST_STATUS carrying the transaction identifier of the request, like the network side
+ * of the serialization does. The response reaches the application core after the IPC latency.
+ * Time is simulated and all functions are called from a single thread.
+ */
+
+#ifndef NRF_802154_SIM_SPINEL_H__
+#define NRF_802154_SIM_SPINEL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Resets the simulation.
+ *
+ * @param[in]  latency_us  One-way IPC latency, in microseconds.
+ * @param[in]  service_us  Time the network core takes to serve a request, in microseconds.
+ */
+void nrf_802154_sim_spinel_reset(uint32_t latency_us, uint32_t service_us);
+
+/**
+ * @brief Gets the current simulated time, in microseconds.
+ */
+uint32_t nrf_802154_sim_spinel_time_get(void);
+
+/**
+ * @brief Advances the simulated time and delivers the responses that arrive in the meantime.
+ *
+ * @param[in]  us  Time to advance, in microseconds.
+ */
+void nrf_802154_sim_spinel_time_advance(uint32_t us);
+
+/**
+ * @brief Advances the simulated time to the arrival of the next response and delivers it.
+ *
+ * @retval true   A response was delivered.
+ * @retval false  No response is in flight.
+ */
+bool nrf_802154_sim_spinel_next_response_deliver(void);
+
+/**
+ * @brief Makes the network core ignore the requests it receives from now on.
+ *
+ * @param[in]  unresponsive  If the network core ignores the requests.
+ */
+void nrf_802154_sim_spinel_unresponsive_set(bool unresponsive);
+
+/**
+ * @brief Gets the number of requests received by the network core.
+ */
+uint32_t nrf_802154_sim_spinel_requests_get(void);
+
+/**
+ * @brief Gets the number of serialization errors reported since the reset.
+ */
+uint32_t nrf_802154_sim_spinel_errors_get(void);
+
+#endif /* NRF_802154_SIM_SPINEL_H__ */
@@ -0,0 +1,516 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the trx module API on top of a simulated transceiver.
+ *
+ */
+
+#include "nrf_802154_sim.h"
+#include "nrf_802154_sim_internal.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_trx.h"
+
+/// Bits of the PHR containing the frame length.
+#define PHR_LENGTH_MASK      0x7fU
+
+/// Duration of a single energy detection iteration, in microseconds.
+#define ED_ITERATION_TIME_US 128U
+
+static trx_state_t                             m_state;
+static uint8_t                                 m_channel;
+static uint8_t                               * mp_rx_buffer;
+static bool                                    m_rx_buffer_missing;
+static uint8_t                                 m_bcc;
+static nrf_802154_trx_receive_notifications_t  m_rx_notifications;
+static const uint8_t                         * mp_tx_frame;
+static const uint8_t                         * mp_tx_ack;
+static bool                                    m_tx_cca;
+static nrf_802154_trx_transmit_notifications_t m_tx_notifications;
+static bool                                    m_psdu_being_received;
+static nrf_802154_sim_stats_t                  m_stats;
+
+void nrf_802154_sim_trx_reset(void)
+{
+    m_state               = TRX_STATE_DISABLED;
+    m_channel             = 0;
+    mp_rx_buffer          = NULL;
+    m_rx_buffer_missing   = false;
+    mp_tx_frame           = NULL;
+    mp_tx_ack             = NULL;
+    m_psdu_being_received = false;
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+bool nrf_802154_sim_trx_idle_pending(void)
+{
+    return m_state == TRX_STATE_GOING_IDLE;
+}
+
+/* Radio events are handled in the critical section, as in nrf_802154_radio_irq_handler. */
+static void idle_finish_handle(void)
+{
+    assert(m_state == TRX_STATE_GOING_IDLE);
+
+    m_state = TRX_STATE_IDLE;
+    nrf_802154_trx_go_idle_finished();
+}
+
+void nrf_802154_sim_trx_idle_finish(void)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    idle_finish_handle();
+    nrf_802154_critical_section_exit();
+}
+
+trx_state_t nrf_802154_sim_trx_state_get(void)
+{
+    return m_state;
+}
+
+uint8_t nrf_802154_sim_channel_get(void)
+{
+    return m_channel;
+}
+
+const uint8_t * nrf_802154_sim_tx_frame_get(void)
+{
+    return mp_tx_frame;
+}
+
+const uint8_t * nrf_802154_sim_tx_ack_get(void)
+{
+    return mp_tx_ack;
+}
+
+const nrf_802154_sim_stats_t * nrf_802154_sim_stats_get(void)
+{
+    return &m_stats;
+}
+
+bool nrf_802154_sim_rx_buffer_is_missing(void)
+{
+    return m_rx_buffer_missing;
+}
+
+static void tx_end_handle(bool channel_idle)
+{
+    assert(m_state == TRX_STATE_TXFRAME);
+
+    if (m_tx_cca)
+    {
+        if (!channel_idle)
+        {
+            m_state = TRX_STATE_FINISHED;
+            nrf_802154_trx_transmit_frame_ccabusy();
+            return;
+        }
+
+        if ((m_tx_notifications & TRX_TRANSMIT_NOTIFICATION_CCAIDLE) != 0U)
+        {
+            nrf_802154_trx_transmit_frame_ccaidle();
+        }
+    }
+
+#if NRF_802154_TX_STARTED_NOTIFY_ENABLED
+    nrf_802154_trx_transmit_frame_started();
+#endif
+
+    m_state = TRX_STATE_FINISHED;
+    nrf_802154_trx_transmit_frame_transmitted();
+}
+
+void nrf_802154_sim_tx_end(bool channel_idle)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    tx_end_handle(channel_idle);
+    nrf_802154_critical_section_exit();
+}
+
+static void tx_ack_end_handle(void)
+{
+    assert(m_state == TRX_STATE_TXACK);
+
+#if NRF_802154_TX_STARTED_NOTIFY_ENABLED
+    nrf_802154_trx_transmit_ack_started();
+#endif
+
+    m_state = TRX_STATE_FINISHED;
+    nrf_802154_trx_transmit_ack_transmitted();
+}
+
+void nrf_802154_sim_tx_ack_end(void)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    tx_ack_end_handle();
+    nrf_802154_critical_section_exit();
+}
+
+static void rx_frame_handle(const uint8_t * p_frame, bool crc_ok)
+{
+    uint8_t length = p_frame[PHR_OFFSET] & PHR_LENGTH_MASK;
+
+    assert(m_state == TRX_STATE_RXFRAME);
+    assert(!m_rx_buffer_missing);
+
+    memcpy(mp_rx_buffer, p_frame, PHR_SIZE + length);
+    m_psdu_being_received = true;
+
+    if ((m_rx_notifications & TRX_RECEIVE_NOTIFICATION_STARTED) != 0U)
+    {
+        nrf_802154_trx_receive_frame_started();
+    }
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+    uint32_t rx_frames = m_stats.rx_frames;
+
+    // The RADIO generates BCMATCH for every new BCC value the handler sets, as long as the frame
+    // is long enough.
+    while (m_bcc <= PHR_SIZE + length)
+    {
+        uint8_t next_bcc = nrf_802154_trx_receive_frame_bcmatched(m_bcc);
+
+        if ((m_state != TRX_STATE_RXFRAME) || (m_stats.rx_frames != rx_frames))
+        {
+            // The frame was rejected by the filter and the receiver was restarted or stopped.
+            return;
+        }
+
+        if (next_bcc <= m_bcc)
+        {
+            break;
+        }
+
+        m_bcc = next_bcc;
+    }
+#endif
+
+    m_psdu_being_received = false;
+
+    if (crc_ok)
+    {
+        m_state = TRX_STATE_RXFRAME_FINISHED;
+        nrf_802154_trx_receive_frame_received();
+    }
+    else
+    {
+#if !NRF_802154_DISABLE_BCC_MATCHING
+        m_state = TRX_STATE_FINISHED;
+#endif
+        nrf_802154_trx_receive_frame_crcerror();
+    }
+}
+
+void nrf_802154_sim_rx_frame(const uint8_t * p_frame, bool crc_ok)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    rx_frame_handle(p_frame, crc_ok);
+    nrf_802154_critical_section_exit();
+}
+
+static void rx_ack_handle(const uint8_t * p_ack, bool crc_ok)
+{
+    assert(m_state == TRX_STATE_RXACK);
+    assert(!m_rx_buffer_missing);
+
+    memcpy(mp_rx_buffer, p_ack, PHR_SIZE + (p_ack[PHR_OFFSET] & PHR_LENGTH_MASK));
+
+    nrf_802154_trx_receive_ack_started();
+
+    m_state = TRX_STATE_FINISHED;
+
+    if (crc_ok)
+    {
+        nrf_802154_trx_receive_ack_received();
+    }
+    else
+    {
+        nrf_802154_trx_receive_ack_crcerror();
+    }
+}
+
+void nrf_802154_sim_rx_ack(const uint8_t * p_ack, bool crc_ok)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    rx_ack_handle(p_ack, crc_ok);
+    nrf_802154_critical_section_exit();
+}
+
+static void ed_end_handle(uint8_t ed_sample)
+{
+    assert(m_state == TRX_STATE_ENERGY_DETECTION);
+
+    m_state = TRX_STATE_FINISHED;
+    nrf_802154_trx_energy_detection_finished(ed_sample);
+}
+
+void nrf_802154_sim_ed_end(uint8_t ed_sample)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    ed_end_handle(ed_sample);
+    nrf_802154_critical_section_exit();
+}
+
+static void cca_end_handle(bool channel_idle)
+{
+    assert(m_state == TRX_STATE_STANDALONE_CCA);
+
+    m_state = TRX_STATE_FINISHED;
+    nrf_802154_trx_standalone_cca_finished(channel_idle);
+}
+
+void nrf_802154_sim_cca_end(bool channel_idle)
+{
+    nrf_802154_critical_section_forcefully_enter();
+    cca_end_handle(channel_idle);
+    nrf_802154_critical_section_exit();
+}
+
+void nrf_802154_trx_init(void)
+{
+    m_state = TRX_STATE_DISABLED;
+}
+
+void nrf_802154_trx_enable(void)
+{
+    assert(m_state == TRX_STATE_DISABLED);
+
+    m_state   = TRX_STATE_IDLE;
+    m_channel = nrf_802154_pib_channel_get();
+}
+
+void nrf_802154_trx_disable(void)
+{
+    m_state             = TRX_STATE_DISABLED;
+    m_rx_buffer_missing = false;
+}
+
+void nrf_802154_trx_antenna_update(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_channel_set(uint8_t channel)
+{
+    m_channel = channel;
+}
+
+void nrf_802154_trx_cca_configuration_update(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_receive_frame(uint8_t                                bcc,
+                                  nrf_802154_trx_receive_notifications_t notifications_mask)
+{
+    m_state               = TRX_STATE_RXFRAME;
+    m_bcc                 = bcc;
+    m_rx_notifications    = notifications_mask;
+    m_rx_buffer_missing   = (mp_rx_buffer == NULL);
+    m_psdu_being_received = false;
+    m_stats.rx_frames++;
+}
+
+void nrf_802154_trx_receive_ack(void)
+{
+    m_state             = TRX_STATE_RXACK;
+    m_rx_buffer_missing = (mp_rx_buffer == NULL);
+    m_stats.rx_acks++;
+}
+
+bool nrf_802154_trx_rssi_measure(void)
+{
+    return m_state == TRX_STATE_RXFRAME;
+}
+
+bool nrf_802154_trx_rssi_measure_is_started(void)
+{
+    return m_state == TRX_STATE_RXFRAME;
+}
+
+bool nrf_802154_trx_rssi_sample_is_available(void)
+{
+    return true;
+}
+
+uint8_t nrf_802154_trx_rssi_last_sample_get(void)
+{
+    return 0;
+}
+
+bool nrf_802154_trx_psdu_is_being_received(void)
+{
+    return m_psdu_being_received;
+}
+
+bool nrf_802154_trx_receive_is_buffer_missing(void)
+{
+    return ((m_state == TRX_STATE_RXFRAME) || (m_state == TRX_STATE_RXACK)) &&
+           m_rx_buffer_missing;
+}
+
+bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer)
+{
+    bool result = false;
+
+    mp_rx_buffer = p_receive_buffer;
+
+    if ((p_receive_buffer != NULL) && nrf_802154_trx_receive_is_buffer_missing())
+    {
+        m_rx_buffer_missing = false;
+        result              = true;
+    }
+
+    return result;
+}
+
+void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
+                                   bool                                    cca,
+                                   nrf_802154_trx_transmit_notifications_t notifications_mask)
+{
+    assert(p_transmit_buffer != NULL);
+
+    m_state            = TRX_STATE_TXFRAME;
+    mp_tx_frame        = p_transmit_buffer;
+    m_tx_cca           = cca;
+    m_tx_notifications = notifications_mask;
+    m_stats.tx_frames++;
+
+    if (cca && ((notifications_mask & TRX_TRANSMIT_NOTIFICATION_CCASTARTED) != 0U))
+    {
+        nrf_802154_trx_transmit_frame_ccastarted();
+    }
+}
+
+bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_us)
+{
+    (void)delay_us;
+
+    assert(m_state == TRX_STATE_RXFRAME_FINISHED);
+    assert(p_transmit_buffer != NULL);
+
+    m_state   = TRX_STATE_TXACK;
+    mp_tx_ack = p_transmit_buffer;
+    m_stats.tx_acks++;
+
+    return true;
+}
+
+bool nrf_802154_trx_go_idle(void)
+{
+    switch (m_state)
+    {
+        case TRX_STATE_IDLE:
+            return false;
+
+        case TRX_STATE_GOING_IDLE:
+        case TRX_STATE_RXFRAME_FINISHED:
+        case TRX_STATE_FINISHED:
+            m_state = TRX_STATE_GOING_IDLE;
+            return true;
+
+        default:
+            assert(false);
+            return false;
+    }
+}
+
+void nrf_802154_trx_standalone_cca(void)
+{
+    m_state = TRX_STATE_STANDALONE_CCA;
+    m_stats.cca_operations++;
+}
+
+void nrf_802154_trx_continuous_carrier(void)
+{
+    m_state = TRX_STATE_CONTINUOUS_CARRIER;
+}
+
+void nrf_802154_trx_continuous_carrier_restart(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_modulated_carrier(const void * p_transmit_buffer)
+{
+    (void)p_transmit_buffer;
+
+    m_state = TRX_STATE_MODULATED_CARRIER;
+}
+
+void nrf_802154_trx_modulated_carrier_restart(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_energy_detection(uint32_t ed_count)
+{
+    assert((m_state == TRX_STATE_FINISHED) || (m_state == TRX_STATE_IDLE));
+    assert(ed_count > 0U);
+
+    m_state = TRX_STATE_ENERGY_DETECTION;
+    m_stats.ed_operations++;
+    m_stats.ed_time_us += ed_count * ED_ITERATION_TIME_US;
+}
+
+void nrf_802154_trx_abort(void)
+{
+    switch (m_state)
+    {
+        case TRX_STATE_DISABLED:
+        case TRX_STATE_IDLE:
+        case TRX_STATE_FINISHED:
+            break;
+
+        default:
+            m_state               = TRX_STATE_FINISHED;
+            m_psdu_being_received = false;
+            m_stats.aborts++;
+            break;
+    }
+}
+
+trx_state_t nrf_802154_trx_state_get(void)
+{
+    return m_state;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file is a host replacement of the nrfx EGU HAL. Triggering a task sets the matching event,
+ *   which the simulation delivers to the SWI handlers in @ref nrf_802154_sim_process.
+ *
+ */
+
+#ifndef NRF_EGU_H__
+#define NRF_EGU_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nrf.h>
+
+typedef enum
+{
+    NRF_EGU_TASK_TRIGGER0,
+    NRF_EGU_TASK_TRIGGER1,
+    NRF_EGU_TASK_TRIGGER2,
+    NRF_EGU_TASK_TRIGGER3,
+} nrf_egu_task_t;
+
+typedef enum
+{
+    NRF_EGU_EVENT_TRIGGERED0,
+    NRF_EGU_EVENT_TRIGGERED1,
+    NRF_EGU_EVENT_TRIGGERED2,
+    NRF_EGU_EVENT_TRIGGERED3,
+} nrf_egu_event_t;
+
+typedef enum
+{
+    NRF_EGU_INT_TRIGGERED0 = 1UL << 0,
+    NRF_EGU_INT_TRIGGERED1 = 1UL << 1,
+    NRF_EGU_INT_TRIGGERED2 = 1UL << 2,
+    NRF_EGU_INT_TRIGGERED3 = 1UL << 3,
+} nrf_egu_int_mask_t;
+
+static inline void nrf_egu_task_trigger(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task)
+{
+    p_reg->EVENTS_TRIGGERED[egu_task] = 1U;
+}
+
+static inline bool nrf_egu_event_check(NRF_EGU_Type const * p_reg, nrf_egu_event_t egu_event)
+{
+    return p_reg->EVENTS_TRIGGERED[egu_event] != 0U;
+}
+
+static inline void nrf_egu_event_clear(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event)
+{
+    p_reg->EVENTS_TRIGGERED[egu_event] = 0U;
+}
+
+static inline void nrf_egu_int_enable(NRF_EGU_Type * p_reg, uint32_t mask)
+{
+    p_reg->INTEN |= mask;
+}
+
+#endif /* NRF_EGU_H__ */
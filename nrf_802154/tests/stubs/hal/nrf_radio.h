@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file is a host replacement of the nrfx RADIO HAL. It provides the types used outside of
+ *   nrf_802154_trx.c, which is replaced by the simulated transceiver.
+ *
+ */
+
+#ifndef NRF_RADIO_H__
+#define NRF_RADIO_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nrf.h>
+
+extern NRF_RADIO_Type g_nrf_radio_sim;
+
+#define NRF_RADIO (&g_nrf_radio_sim)
+
+typedef enum
+{
+    NRF_RADIO_CCA_MODE_ED,
+    NRF_RADIO_CCA_MODE_CARRIER,
+    NRF_RADIO_CCA_MODE_CARRIER_AND_ED,
+    NRF_RADIO_CCA_MODE_CARRIER_OR_ED,
+} nrf_radio_cca_mode_t;
+
+typedef enum
+{
+    NRF_RADIO_TXPOWER_NEG20DBM = -20,
+    NRF_RADIO_TXPOWER_NEG16DBM = -16,
+    NRF_RADIO_TXPOWER_NEG12DBM = -12,
+    NRF_RADIO_TXPOWER_NEG8DBM  = -8,
+    NRF_RADIO_TXPOWER_NEG4DBM  = -4,
+    NRF_RADIO_TXPOWER_0DBM     = 0,
+} nrf_radio_txpower_t;
+
+typedef enum
+{
+    NRF_RADIO_EVENT_READY,
+    NRF_RADIO_EVENT_ADDRESS,
+    NRF_RADIO_EVENT_END,
+    NRF_RADIO_EVENT_PHYEND,
+    NRF_RADIO_EVENT_CRCOK,
+    NRF_RADIO_EVENT_CRCERROR,
+    NRF_RADIO_EVENT_COUNT,
+} nrf_radio_event_t;
+
+/**
+ * @brief Get the address of an event, which the driver uses as a debug log identifier only.
+ */
+static inline uint32_t nrf_radio_event_address_get(NRF_RADIO_Type const * p_reg,
+                                                   nrf_radio_event_t      event)
+{
+    (void)p_reg;
+
+    return (uint32_t)event;
+}
+
+#endif /* NRF_RADIO_H__ */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file is a host replacement of the Zephyr kernel API used by the open-source SL. Time is
+ *   simulated and advanced by @ref nrf_802154_sim_time_advance.
+ *
+ */
+
+#ifndef KERNEL_H__
+#define KERNEL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CONFIG_SYS_CLOCK_TICKS_PER_SEC 32768
+
+#define BUILD_ASSERT(expr, ...) _Static_assert(expr, #expr)
+
+typedef int64_t k_ticks_t;
+
+typedef struct
+{
+    k_ticks_t ticks;
+} k_timeout_t;
+
+#define K_TICKS(t) ((k_timeout_t){ .ticks = (t) })
+#define K_NO_WAIT  K_TICKS(0)
+
+struct k_timer
+{
+    void             (* expiry_fn)(struct k_timer * timer);
+    void             (* stop_fn)(struct k_timer * timer);
+    k_ticks_t        expiry;
+    bool             running;
+    struct k_timer * p_next;
+};
+
+#define K_TIMER_DEFINE(name, expiry, stop) \
+    struct k_timer name = { .expiry_fn = (expiry), .stop_fn = (stop) }
+
+int64_t k_uptime_ticks(void);
+
+void k_timer_start(struct k_timer * timer, k_timeout_t duration, k_timeout_t period);
+
+void k_timer_stop(struct k_timer * timer);
+
+static inline uint32_t k_us_to_ticks_floor32(uint32_t t)
+{
+    return (uint32_t)(((uint64_t)t * CONFIG_SYS_CLOCK_TICKS_PER_SEC) / 1000000U);
+}
+
+static inline uint32_t k_us_to_ticks_ceil32(uint32_t t)
+{
+    return (uint32_t)(((uint64_t)t * CONFIG_SYS_CLOCK_TICKS_PER_SEC + 999999U) / 1000000U);
+}
+
+#endif /* KERNEL_H__ */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file is a host replacement of the MDK device header, with the
+ *   definitions needed to compile the driver on a host.
+ *
+ */
+
+#ifndef NRF_H__
+#define NRF_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t dummy;
+} NRF_TIMER_Type;
+
+typedef struct
+{
+    uint32_t dummy;
+} NRF_RADIO_Type;
+
+typedef struct
+{
+    volatile uint32_t EVENTS_TRIGGERED[16];
+    volatile uint32_t INTEN;
+} NRF_EGU_Type;
+
+/* The EGU instance used by the driver on nRF52840. */
+extern NRF_EGU_Type g_nrf_egu_sim;
+
+#define NRF_EGU3 (&g_nrf_egu_sim)
+
+#define __STATIC_INLINE static inline
+#define __WEAK          __attribute__((weak))
+
+typedef struct
+{
+    uint32_t ICSR;
+} SCB_Type;
+
+extern SCB_Type g_nrf_scb_sim;
+
+#define SCB                     (&g_nrf_scb_sim)
+#define SCB_ICSR_VECTACTIVE_Pos 0U
+#define SCB_ICSR_VECTACTIVE_Msk 0x1FFUL
+
+/* The cycle counter does not run by itself, tests set it to the value they need. */
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type       g_nrf_dwt_sim;
+extern CoreDebug_Type g_nrf_core_debug_sim;
+
+#define DWT                        (&g_nrf_dwt_sim)
+#define DWT_CTRL_CYCCNTENA_Msk     0x1UL
+#define CoreDebug                  (&g_nrf_core_debug_sim)
+#define CoreDebug_DEMCR_TRCENA_Msk 0x1000000UL
+
+typedef enum
+{
+    RADIO_IRQn = 1,
+} IRQn_Type;
+
+/* Interrupts are not simulated, so masking them is a no-op. */
+#define __WFE()
+#define __get_PRIMASK()  0U
+#define __disable_irq()
+#define __enable_irq()
+#define __set_PRIMASK(x) ((void)(x))
+#define __DMB()
+#define __DSB()
+#define __ISB()
+
+/* The simulation runs in a single thread, so exclusive accesses always succeed. */
+static inline uint8_t __LDREXB(volatile uint8_t * p_addr)
+{
+    return *p_addr;
+}
+
+static inline uint32_t __STREXB(uint8_t value, volatile uint8_t * p_addr)
+{
+    *p_addr = value;
+    return 0U;
+}
+
+static inline uint32_t __LDREXW(volatile uint32_t * p_addr)
+{
+    return *p_addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t * p_addr)
+{
+    *p_addr = value;
+    return 0U;
+}
+
+static inline void __CLREX(void)
+{
+}
+
+static inline uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+#endif /* NRF_H__ */
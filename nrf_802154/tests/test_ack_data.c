@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the pending bit list of the ACK generator.
+ *
+ * The RADIO IRQ looks addresses up while the list is being modified by the upper layer. To check
+ * that it never sees a half-updated list, memcpy() and memmove() are wrapped, and every copy made
+ * by a bulk function is followed by a lookup, as if the RADIO IRQ preempted the function there.
+ */
+
+#include "test_common.h"
+
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#define TEST_ADDRESSES NRF_802154_PENDING_SHORT_ADDRESSES
+
+void * __real_memcpy(void * p_dst, const void * p_src, size_t n);
+void * __real_memmove(void * p_dst, const void * p_src, size_t n);
+
+static bool     m_probe_enabled;
+static bool     m_probe_running;
+static uint16_t m_probe_addr;
+static uint32_t m_probe_count;
+static uint32_t m_probe_failures;
+
+static bool pending_bit_is_set(uint16_t src_addr)
+{
+    uint8_t                        frame[MAX_PACKET_SIZE + PHR_SIZE];
+    nrf_802154_frame_parser_data_t frame_data;
+
+    test_data_frame_build(frame, TEST_SHORT_ADDR, src_addr, 0, true, 0);
+    nrf_802154_frame_parser_data_init(frame, &frame_data);
+
+    return nrf_802154_ack_data_pending_bit_should_be_set(&frame_data);
+}
+
+static void probe(void)
+{
+    if (!m_probe_enabled || m_probe_running)
+    {
+        return;
+    }
+
+    m_probe_running = true;
+    m_probe_count++;
+
+    if (!pending_bit_is_set(m_probe_addr))
+    {
+        m_probe_failures++;
+    }
+
+    m_probe_running = false;
+}
+
+void * __wrap_memcpy(void * p_dst, const void * p_src, size_t n)
+{
+    void * p_result = __real_memcpy(p_dst, p_src, n);
+
+    probe();
+
+    return p_result;
+}
+
+void * __wrap_memmove(void * p_dst, const void * p_src, size_t n)
+{
+    void * p_result = __real_memmove(p_dst, p_src, n);
+
+    probe();
+
+    return p_result;
+}
+
+/* Fills a list of short addresses first, first + step, ... in the given order. */
+static void addr_list_build(uint8_t * p_addrs, uint32_t num_addrs, uint16_t first, uint16_t step,
+                            bool ascending)
+{
+    for (uint32_t i = 0; i < num_addrs; i++)
+    {
+        uint16_t addr = first + step * (ascending ? i : (num_addrs - 1 - i));
+
+        p_addrs[SHORT_ADDRESS_SIZE * i]     = addr & 0xff;
+        p_addrs[SHORT_ADDRESS_SIZE * i + 1] = addr >> 8;
+    }
+}
+
+static void setup(void)
+{
+    test_driver_init();
+
+    m_probe_enabled  = false;
+    m_probe_count    = 0;
+    m_probe_failures = 0;
+}
+
+/* Replaces a full list with one that shares every other address and checks the shared ones. */
+static void replace_check(bool ascending)
+{
+    uint8_t old_addrs[TEST_ADDRESSES * SHORT_ADDRESS_SIZE];
+    uint8_t new_addrs[TEST_ADDRESSES * SHORT_ADDRESS_SIZE];
+
+    setup();
+
+    // Old list: 0x100, 0x102, ... New list: 0x0ff, 0x100, 0x101, ... so they share half.
+    addr_list_build(old_addrs, TEST_ADDRESSES, 0x100, 2, true);
+    addr_list_build(new_addrs, TEST_ADDRESSES, 0x100 - 1, 1, ascending);
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(old_addrs, TEST_ADDRESSES, false, true));
+
+    m_probe_addr    = 0x100;
+    m_probe_enabled = true;
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(new_addrs, TEST_ADDRESSES, false, true));
+    m_probe_enabled = false;
+
+    TEST_ASSERT(m_probe_count > 0);
+    TEST_ASSERT(m_probe_failures == 0);
+
+    for (uint16_t addr = 0x100 - 1; addr < 0x100 - 1 + TEST_ADDRESSES; addr++)
+    {
+        TEST_ASSERT(pending_bit_is_set(addr));
+    }
+
+    TEST_ASSERT(!pending_bit_is_set(0x100 + 2 * (TEST_ADDRESSES - 1)));
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_capacity_get(false, false) == 0);
+}
+
+static void test_sorted_replace_is_atomic(void)
+{
+    replace_check(true);
+}
+
+static void test_unsorted_replace_is_atomic(void)
+{
+    replace_check(false);
+}
+
+static void test_reset_is_atomic(void)
+{
+    static const uint8_t ie[] = {0x01, 0x02};
+
+    uint8_t addrs[TEST_ADDRESSES * SHORT_ADDRESS_SIZE];
+    uint8_t ie_addr[SHORT_ADDRESS_SIZE] = {0xff, 0xff};
+
+    setup();
+
+    addr_list_build(addrs, TEST_ADDRESSES, 0x100, 1, true);
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(addrs, TEST_ADDRESSES, false, true));
+
+    // A record with IE data behind the pending bits has to be kept, so the reset copies it.
+    TEST_ASSERT(nrf_802154_ack_data_for_addr_set(ie_addr,
+                                                 false,
+                                                 NRF_802154_ACK_DATA_IE,
+                                                 ie,
+                                                 sizeof(ie)));
+
+    // Until the reset takes effect, the whole list stays in use.
+    m_probe_addr    = 0x100 + TEST_ADDRESSES - 1;
+    m_probe_enabled = true;
+    nrf_802154_pending_bit_for_addr_reset(false);
+    m_probe_enabled = false;
+
+    TEST_ASSERT(m_probe_count > 0);
+    TEST_ASSERT(m_probe_failures == 0);
+    TEST_ASSERT(!pending_bit_is_set(m_probe_addr));
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_capacity_get(false, false) == TEST_ADDRESSES);
+}
+
+static void test_replace_keeps_ie(void)
+{
+    static const uint8_t ie[] = {0x01, 0x02, 0x03, 0x04};
+
+    uint8_t         addrs[TEST_ADDRESSES * SHORT_ADDRESS_SIZE];
+    uint8_t         ie_addr[SHORT_ADDRESS_SIZE] = {0x00, 0x01};
+    uint8_t         ie_length;
+    const uint8_t * p_ie;
+
+    setup();
+
+    TEST_ASSERT(nrf_802154_ack_data_for_addr_set(ie_addr,
+                                                 false,
+                                                 NRF_802154_ACK_DATA_IE,
+                                                 ie,
+                                                 sizeof(ie)));
+
+    // The IE record and the full pending bit list must fit at the same time.
+    addr_list_build(addrs, TEST_ADDRESSES, 0x200, 1, true);
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(addrs, TEST_ADDRESSES, false, true));
+    addr_list_build(addrs, TEST_ADDRESSES, 0x300, 1, false);
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(addrs, TEST_ADDRESSES, false, true));
+
+    p_ie = nrf_802154_ack_data_ie_get(ie_addr, false, &ie_length);
+    TEST_ASSERT(p_ie != NULL);
+    TEST_ASSERT(ie_length == sizeof(ie));
+    TEST_ASSERT(memcmp(p_ie, ie, sizeof(ie)) == 0);
+    TEST_ASSERT(!pending_bit_is_set(0x100));
+    TEST_ASSERT(!pending_bit_is_set(0x200));
+    TEST_ASSERT(pending_bit_is_set(0x300));
+}
+
+static void test_failed_merge_keeps_list(void)
+{
+    uint8_t addrs[TEST_ADDRESSES * SHORT_ADDRESS_SIZE];
+
+    setup();
+
+    addr_list_build(addrs, TEST_ADDRESSES, 0x100, 1, true);
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(addrs, TEST_ADDRESSES - 1, false, true));
+
+    addr_list_build(addrs, 2, 0x200, 1, true);
+    TEST_ASSERT(!nrf_802154_pending_bit_for_addr_list_set(addrs, 2, false, false));
+
+    TEST_ASSERT(pending_bit_is_set(0x100));
+    TEST_ASSERT(!pending_bit_is_set(0x200));
+    TEST_ASSERT(!pending_bit_is_set(0x201));
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_capacity_get(false, false) == 1);
+}
+
+static void test_list_clear_is_atomic(void)
+{
+    uint8_t addrs[TEST_ADDRESSES * SHORT_ADDRESS_SIZE];
+
+    setup();
+
+    addr_list_build(addrs, TEST_ADDRESSES, 0x100, 1, true);
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_set(addrs, TEST_ADDRESSES, false, true));
+
+    // Clear all but the last address, so that every record before it is removed.
+    m_probe_addr    = 0x100 + TEST_ADDRESSES - 1;
+    m_probe_enabled = true;
+    TEST_ASSERT(nrf_802154_pending_bit_for_addr_list_clear(addrs, TEST_ADDRESSES - 1, false));
+    m_probe_enabled = false;
+
+    TEST_ASSERT(m_probe_count > 0);
+    TEST_ASSERT(m_probe_failures == 0);
+    TEST_ASSERT(!pending_bit_is_set(0x100));
+    TEST_ASSERT(pending_bit_is_set(m_probe_addr));
+}
+
+int main(void)
+{
+    TEST_RUN(test_sorted_replace_is_atomic);
+    TEST_RUN(test_unsorted_replace_is_atomic);
+    TEST_RUN(test_reset_is_atomic);
+    TEST_RUN(test_replace_keeps_ie);
+    TEST_RUN(test_failed_merge_keeps_list);
+    TEST_RUN(test_list_clear_is_atomic);
+
+    return 0;
+}
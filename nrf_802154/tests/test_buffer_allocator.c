@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the buffer allocator used by the serialization.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_buffer_allocator.h"
+
+#define TEST_CAPACITY 8U
+
+static uint8_t                       m_memory[NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(
+                                                  TEST_CAPACITY)];
+static nrf_802154_buffer_allocator_t m_allocator;
+
+static void setup(void)
+{
+    nrf_802154_buffer_allocator_init(&m_allocator, m_memory, sizeof(m_memory));
+}
+
+/* Checks the pointer points to the data of one of the buffers of the pool. */
+static void buffer_check(const void * p_buffer)
+{
+    const nrf_802154_buffer_t * p_pool = (const nrf_802154_buffer_t *)m_memory;
+    bool                        found  = false;
+
+    for (size_t i = 0U; i < TEST_CAPACITY; i++)
+    {
+        found |= (p_buffer == p_pool[i].data);
+    }
+
+    TEST_ASSERT(found);
+}
+
+static void test_alloc_until_exhausted(void)
+{
+    void * p_buffers[TEST_CAPACITY];
+
+    setup();
+
+    TEST_ASSERT(nrf_802154_buffer_allocator_capacity(&m_allocator) == TEST_CAPACITY);
+
+    for (size_t i = 0U; i < TEST_CAPACITY; i++)
+    {
+        p_buffers[i] = nrf_802154_buffer_allocator_alloc(&m_allocator);
+        TEST_ASSERT(p_buffers[i] != NULL);
+        buffer_check(p_buffers[i]);
+
+        // Each buffer is given out once
+        for (size_t j = 0U; j < i; j++)
+        {
+            TEST_ASSERT(p_buffers[i] != p_buffers[j]);
+        }
+
+        // Buffers can be written entirely without affecting the allocator
+        memset(p_buffers[i], 0xff, NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN);
+    }
+
+    TEST_ASSERT(nrf_802154_buffer_allocator_alloc(&m_allocator) == NULL);
+    TEST_ASSERT(nrf_802154_buffer_allocator_alloc(&m_allocator) == NULL);
+}
+
+static void test_free_makes_buffer_available(void)
+{
+    void * p_buffers[TEST_CAPACITY];
+
+    setup();
+
+    for (size_t i = 0U; i < TEST_CAPACITY; i++)
+    {
+        p_buffers[i] = nrf_802154_buffer_allocator_alloc(&m_allocator);
+    }
+
+    // The freed buffer is the only one available, so it is allocated again
+    nrf_802154_buffer_allocator_free(&m_allocator, p_buffers[3]);
+    TEST_ASSERT(nrf_802154_buffer_allocator_alloc(&m_allocator) == p_buffers[3]);
+    TEST_ASSERT(nrf_802154_buffer_allocator_alloc(&m_allocator) == NULL);
+}
+
+/* Buffers freed in any order can all be allocated again. */
+static void test_free_in_any_order(void)
+{
+    static const uint8_t order[TEST_CAPACITY] = {5, 0, 7, 2, 6, 1, 4, 3};
+
+    void * p_buffers[TEST_CAPACITY];
+    void * p_again[TEST_CAPACITY];
+
+    setup();
+
+    for (uint32_t round = 0U; round < 3U; round++)
+    {
+        for (size_t i = 0U; i < TEST_CAPACITY; i++)
+        {
+            p_buffers[i] = nrf_802154_buffer_allocator_alloc(&m_allocator);
+            TEST_ASSERT(p_buffers[i] != NULL);
+        }
+
+        TEST_ASSERT(nrf_802154_buffer_allocator_alloc(&m_allocator) == NULL);
+
+        for (size_t i = 0U; i < TEST_CAPACITY; i++)
+        {
+            nrf_802154_buffer_allocator_free(&m_allocator, p_buffers[order[i]]);
+        }
+    }
+
+    for (size_t i = 0U; i < TEST_CAPACITY; i++)
+    {
+        p_again[i] = nrf_802154_buffer_allocator_alloc(&m_allocator);
+        TEST_ASSERT(p_again[i] != NULL);
+
+        for (size_t j = 0U; j < i; j++)
+        {
+            TEST_ASSERT(p_again[i] != p_again[j]);
+        }
+    }
+}
+
+static void test_zero_capacity(void)
+{
+    nrf_802154_buffer_allocator_t allocator;
+
+    nrf_802154_buffer_allocator_init(&allocator, NULL, 0U);
+
+    TEST_ASSERT(nrf_802154_buffer_allocator_capacity(&allocator) == 0U);
+    TEST_ASSERT(nrf_802154_buffer_allocator_alloc(&allocator) == NULL);
+}
+
+int main(void)
+{
+    TEST_RUN(test_alloc_until_exhausted);
+    TEST_RUN(test_free_makes_buffer_available);
+    TEST_RUN(test_free_in_any_order);
+    TEST_RUN(test_zero_capacity);
+
+    return 0;
+}
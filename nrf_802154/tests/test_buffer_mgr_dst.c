@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the destination buffer manager used by the serialization.
+ *
+ * The test is built with and without receiving spinel frames directly into the buffers of
+ * the buffer manager. With it, a frame within the received spinel frame must be used in place.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_buffer_mgr_dst.h"
+
+#define TEST_BUFFERS     4U
+#define TEST_FRAME_LEN   127U
+#define TEST_FRAME_INDEX 10U
+
+NRF_802154_BUFFER_MGR_DST_INST_DECL_STATIC(m_dst_mgr, TEST_BUFFERS);
+
+/* Number of buffers that can still be allocated, the allocator is restored afterwards. */
+static size_t free_buffers_count(void)
+{
+    void * p_buffers[TEST_BUFFERS];
+    size_t count = 0U;
+
+    while ((count < TEST_BUFFERS) &&
+           ((p_buffers[count] = nrf_802154_buffer_allocator_alloc(&m_dst_mgr.allocator)) != NULL))
+    {
+        count++;
+    }
+
+    for (size_t i = 0U; i < count; i++)
+    {
+        nrf_802154_buffer_allocator_free(&m_dst_mgr.allocator, p_buffers[i]);
+    }
+
+    return count;
+}
+
+static void frame_fill(uint8_t * p_frame, uint8_t seed)
+{
+    for (size_t i = 0U; i < TEST_FRAME_LEN; i++)
+    {
+        p_frame[i] = (uint8_t)(seed + i);
+    }
+}
+
+static void test_add_copies_data(void)
+{
+    uint8_t  frame[TEST_FRAME_LEN];
+    void   * p_local;
+    uint32_t handle;
+
+    NRF_802154_BUFFER_MGR_DST_INIT(m_dst_mgr);
+    frame_fill(frame, 1U);
+
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, 0x11U, frame, sizeof(frame), &p_local));
+    TEST_ASSERT(p_local != frame);
+    TEST_ASSERT(memcmp(p_local, frame, sizeof(frame)) == 0);
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS - 1U);
+
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_search_by_local_pointer(&m_dst_mgr, p_local, &handle));
+    TEST_ASSERT(handle == 0x11U);
+
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_local));
+    TEST_ASSERT(!nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_local));
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS);
+}
+
+static void test_pool_exhaustion(void)
+{
+    uint8_t frame[TEST_FRAME_LEN];
+    void  * p_local[TEST_BUFFERS];
+    void  * p_extra;
+
+    NRF_802154_BUFFER_MGR_DST_INIT(m_dst_mgr);
+    frame_fill(frame, 2U);
+
+    for (uint32_t i = 0U; i < TEST_BUFFERS; i++)
+    {
+        TEST_ASSERT(nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, i, frame, sizeof(frame),
+                                                  &p_local[i]));
+    }
+
+    TEST_ASSERT(!nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, 0x99U, frame, sizeof(frame),
+                                               &p_extra));
+
+    for (uint32_t i = 0U; i < TEST_BUFFERS; i++)
+    {
+        TEST_ASSERT(nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_local[i]));
+    }
+
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS);
+}
+
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+/* A frame within the received spinel frame is used in place and its buffer is kept. */
+static void test_rx_buffer_frame_in_place(void)
+{
+    uint8_t * p_rx;
+    void    * p_local;
+    uint32_t  handle;
+
+    NRF_802154_BUFFER_MGR_DST_INIT(m_dst_mgr);
+
+    p_rx = nrf_802154_buffer_mgr_dst_rx_buffer_alloc(&m_dst_mgr);
+    TEST_ASSERT(p_rx != NULL);
+    frame_fill(&p_rx[TEST_FRAME_INDEX], 3U);
+
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_begin(&m_dst_mgr, p_rx);
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, 0x22U, &p_rx[TEST_FRAME_INDEX],
+                                              TEST_FRAME_LEN, &p_local));
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_end(&m_dst_mgr);
+
+    TEST_ASSERT(p_local == &p_rx[TEST_FRAME_INDEX]);
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS - 1U);
+
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_search_by_local_pointer(&m_dst_mgr, p_local, &handle));
+    TEST_ASSERT(handle == 0x22U);
+
+    // Removal frees the whole received buffer
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_local));
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS);
+}
+
+/* A spinel frame without data kept by the driver releases its buffer after decoding. */
+static void test_rx_buffer_released_after_decoding(void)
+{
+    uint8_t * p_rx;
+
+    NRF_802154_BUFFER_MGR_DST_INIT(m_dst_mgr);
+
+    p_rx = nrf_802154_buffer_mgr_dst_rx_buffer_alloc(&m_dst_mgr);
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS - 1U);
+
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_begin(&m_dst_mgr, p_rx);
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_end(&m_dst_mgr);
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS);
+
+    p_rx = nrf_802154_buffer_mgr_dst_rx_buffer_alloc(&m_dst_mgr);
+    nrf_802154_buffer_mgr_dst_rx_buffer_discard(&m_dst_mgr, p_rx);
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS);
+}
+
+/* Only one buffer is kept per spinel frame and data outside of it is copied. */
+static void test_rx_buffer_kept_once(void)
+{
+    uint8_t   frame[TEST_FRAME_LEN];
+    uint8_t * p_rx;
+    void    * p_first;
+    void    * p_second;
+    void    * p_outside;
+
+    NRF_802154_BUFFER_MGR_DST_INIT(m_dst_mgr);
+    frame_fill(frame, 4U);
+
+    p_rx = nrf_802154_buffer_mgr_dst_rx_buffer_alloc(&m_dst_mgr);
+    frame_fill(p_rx, 5U);
+
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_begin(&m_dst_mgr, p_rx);
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, 1U, p_rx, 8U, &p_first));
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, 2U, &p_rx[8], 8U, &p_second));
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_add(&m_dst_mgr, 3U, frame, sizeof(frame), &p_outside));
+    nrf_802154_buffer_mgr_dst_rx_buffer_decode_end(&m_dst_mgr);
+
+    TEST_ASSERT(p_first == p_rx);
+    TEST_ASSERT(p_second != &p_rx[8]);
+    TEST_ASSERT(memcmp(p_second, &p_rx[8], 8U) == 0);
+    TEST_ASSERT(p_outside != frame);
+    TEST_ASSERT(memcmp(p_outside, frame, sizeof(frame)) == 0);
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS - 3U);
+
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_first));
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_second));
+    TEST_ASSERT(nrf_802154_buffer_mgr_dst_remove_by_local_pointer(&m_dst_mgr, p_outside));
+    TEST_ASSERT(free_buffers_count() == TEST_BUFFERS);
+}
+
+#endif // NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+
+int main(void)
+{
+    TEST_RUN(test_add_copies_data);
+    TEST_RUN(test_pool_exhaustion);
+#if NRF_802154_SERIALIZATION_BACKEND_ZERO_COPY
+    TEST_RUN(test_rx_buffer_frame_in_place);
+    TEST_RUN(test_rx_buffer_released_after_decoding);
+    TEST_RUN(test_rx_buffer_kept_once);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the background channel scan on the simulated transceiver.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_rssi.h"
+
+// The interval is a whole number of ticks of the simulated kernel timer.
+#define SCAN_INTERVAL_US   15625U
+#define SCAN_ED_TIME_US    1536U
+#define SCAN_CHANNEL_FIRST 11U
+#define SCAN_CHANNEL_COUNT 4U
+#define SCAN_CHANNEL_MASK  (((1UL << SCAN_CHANNEL_COUNT) - 1U) << SCAN_CHANNEL_FIRST)
+#define SCAN_ED_THRESHOLD  40U
+
+static uint8_t m_ed_samples[NRF_802154_CHANNEL_COUNT]; ///< Raw ED samples reported per channel.
+
+/* Energy level that the driver reports for a raw ED sample. */
+static uint8_t energy_level_get(uint8_t ed_sample)
+{
+    uint32_t result = (uint32_t)nrf_802154_rssi_ed_corrected_get(ed_sample) * ED_RESULT_FACTOR;
+
+    return (result > ED_RESULT_MAX) ? ED_RESULT_MAX : (uint8_t)result;
+}
+
+static void scan_start(void)
+{
+    nrf_802154_cca_cfg_t cca_cfg = {
+        .mode         = NRF_RADIO_CCA_MODE_ED,
+        .ed_threshold = SCAN_ED_THRESHOLD,
+    };
+
+    test_driver_init();
+    nrf_802154_cca_cfg_set(&cca_cfg);
+    test_driver_receive();
+
+    memset(m_ed_samples, 0, sizeof(m_ed_samples));
+
+    TEST_ASSERT(nrf_802154_background_scan_start(SCAN_CHANNEL_MASK,
+                                                 SCAN_ED_TIME_US,
+                                                 SCAN_INTERVAL_US));
+
+    nrf_802154_sim_time_advance(SCAN_INTERVAL_US);
+}
+
+/* Runs one scan interval that starts when the scan timer fires. If the driver starts an energy
+ * detection, it lasts for the requested time and reports the sample set for the channel.
+ * Returns the measured channel, or 0 if nothing was measured.
+ */
+static uint8_t scan_interval_run(void)
+{
+    uint8_t channel = 0;
+
+    if (nrf_802154_sim_trx_state_get() == TRX_STATE_ENERGY_DETECTION)
+    {
+        channel = nrf_802154_sim_channel_get();
+    }
+
+    nrf_802154_sim_time_advance(SCAN_ED_TIME_US);
+
+    if (channel != 0)
+    {
+        nrf_802154_sim_ed_end(m_ed_samples[channel - NRF_802154_CHANNEL_MIN]);
+
+        // Receiving is resumed on the channel from PIB.
+        TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+        TEST_ASSERT(nrf_802154_sim_channel_get() == TEST_CHANNEL);
+    }
+
+    nrf_802154_sim_time_advance(SCAN_INTERVAL_US - SCAN_ED_TIME_US);
+
+    return channel;
+}
+
+/* The scan measures the channels in turn, one per interval, and the radio spends ed_time_us
+ * of each interval on it. */
+static void test_duty_cycle(void)
+{
+    const uint32_t intervals = 16 * SCAN_CHANNEL_COUNT;
+    uint64_t       start;
+    uint32_t       elapsed;
+    uint32_t       ed_operations;
+    uint32_t       ed_time_us;
+
+    scan_start();
+
+    // Each interval starts with a measurement, so the statistics already count the first one.
+    start         = nrf_802154_sim_time_get();
+    ed_operations = nrf_802154_sim_stats_get()->ed_operations;
+    ed_time_us    = nrf_802154_sim_stats_get()->ed_time_us;
+
+    for (uint32_t i = 0; i < intervals; i++)
+    {
+        TEST_ASSERT(scan_interval_run() == SCAN_CHANNEL_FIRST + (i % SCAN_CHANNEL_COUNT));
+    }
+
+    elapsed       = (uint32_t)(nrf_802154_sim_time_get() - start);
+    ed_operations = nrf_802154_sim_stats_get()->ed_operations - ed_operations;
+    ed_time_us    = nrf_802154_sim_stats_get()->ed_time_us - ed_time_us;
+
+    TEST_ASSERT(elapsed == intervals * SCAN_INTERVAL_US);
+    TEST_ASSERT(ed_operations == intervals);
+    TEST_ASSERT(ed_time_us == intervals * SCAN_ED_TIME_US);
+
+    printf("Duty cycle: %u us of %u us (%.2f%%)\n",
+           ed_time_us, elapsed, 100.0 * ed_time_us / elapsed);
+
+    // The measurement in progress completes, but no further one starts.
+    nrf_802154_background_scan_stop();
+    TEST_ASSERT(scan_interval_run() == SCAN_CHANNEL_FIRST);
+
+    ed_operations = nrf_802154_sim_stats_get()->ed_operations;
+    nrf_802154_sim_time_advance(4 * SCAN_INTERVAL_US);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->ed_operations == ed_operations);
+}
+
+/* A measurement due while the driver transmits is skipped, so the scan never adds radio time
+ * to a busy interval. The skipped channel is measured at the next interval. */
+static void test_busy_interval_is_skipped(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    scan_start();
+
+    TEST_ASSERT(nrf_802154_sim_channel_get() == SCAN_CHANNEL_FIRST);
+    nrf_802154_sim_time_advance(SCAN_ED_TIME_US);
+    nrf_802154_sim_ed_end(0);
+
+    // Transmit over the next timer expiry.
+    nrf_802154_sim_time_advance(SCAN_INTERVAL_US - SCAN_ED_TIME_US - 10);
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 10);
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, false));
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+
+    nrf_802154_sim_time_advance(SCAN_ED_TIME_US + 10);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->ed_operations == 1);
+
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+
+    nrf_802154_sim_time_advance(SCAN_INTERVAL_US - SCAN_ED_TIME_US);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->ed_operations == 2);
+    TEST_ASSERT(scan_interval_run() == SCAN_CHANNEL_FIRST + 1);
+
+    nrf_802154_background_scan_stop();
+}
+
+/* The map holds the temperature-corrected energy of each channel, and its occupancy follows
+ * the CCA energy threshold corrected the same way as for the hardware CCA. */
+static void test_map_accuracy(void)
+{
+    const uint32_t           rounds         = 16;
+    const int8_t             temperature    = 60;
+    nrf_802154_channel_map_t map;
+    uint8_t                  threshold;
+    uint8_t                  alternating[2] = {10, 50};
+
+    scan_start();
+    nrf_802154_sim_temperature_set(temperature);
+    nrf_802154_channel_map_reset();
+
+    threshold = nrf_802154_rssi_cca_ed_threshold_corrected_get(SCAN_ED_THRESHOLD);
+    TEST_ASSERT(threshold != SCAN_ED_THRESHOLD);
+
+    for (uint32_t i = 0; i < rounds * SCAN_CHANNEL_COUNT; i++)
+    {
+        // Channel 11 is just below the corrected threshold, channel 12 just at it.
+        m_ed_samples[0] = threshold - 1;
+        m_ed_samples[1] = threshold;
+        m_ed_samples[2] = alternating[(i / SCAN_CHANNEL_COUNT) % 2];
+        m_ed_samples[3] = 0;
+
+        TEST_ASSERT(scan_interval_run() != 0);
+    }
+
+    nrf_802154_channel_map_get(&map);
+
+    for (uint32_t i = 0; i < SCAN_CHANNEL_COUNT; i++)
+    {
+        TEST_ASSERT(map.channels[i].samples == rounds);
+    }
+
+    for (uint32_t i = SCAN_CHANNEL_COUNT; i < NRF_802154_CHANNEL_COUNT; i++)
+    {
+        TEST_ASSERT(map.channels[i].samples == 0);
+    }
+
+    // Energy levels convert back to the measured power corrected by the temperature.
+    TEST_ASSERT(map.channels[0].energy_last == energy_level_get(threshold - 1));
+    TEST_ASSERT(map.channels[0].energy_avg == map.channels[0].energy_last);
+    TEST_ASSERT(map.channels[0].energy_max == map.channels[0].energy_last);
+    TEST_ASSERT(nrf_802154_dbm_from_energy_level_calculate(map.channels[0].energy_last) ==
+                ED_MIN_DBM + nrf_802154_rssi_ed_corrected_get(threshold - 1));
+
+    TEST_ASSERT(map.channels[0].occupancy == 0);
+    TEST_ASSERT(map.channels[1].occupancy == 100);
+
+    TEST_ASSERT(map.channels[2].energy_last == energy_level_get(alternating[1]));
+    TEST_ASSERT(map.channels[2].energy_max == energy_level_get(alternating[1]));
+    TEST_ASSERT(map.channels[2].energy_avg > energy_level_get(alternating[0]));
+    TEST_ASSERT(map.channels[2].energy_avg < energy_level_get(alternating[1]));
+    TEST_ASSERT((map.channels[2].occupancy >= 40) && (map.channels[2].occupancy <= 60));
+
+    TEST_ASSERT(map.channels[3].energy_max == energy_level_get(0));
+    TEST_ASSERT(map.channels[3].occupancy == 0);
+
+    nrf_802154_background_scan_stop();
+}
+
+int main(void)
+{
+    TEST_RUN(test_duty_cycle);
+    TEST_RUN(test_busy_interval_is_skipped);
+    TEST_RUN(test_map_accuracy);
+
+    return 0;
+}
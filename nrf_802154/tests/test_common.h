@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Helpers shared by the host tests of the 802.15.4 driver.
+ *
+ * Each test is a separate executable that returns a non-zero exit code on failure. The helpers
+ * start the driver on the simulated transceiver and build frames used by most of the tests.
+ */
+
+#ifndef TEST_COMMON_H__
+#define TEST_COMMON_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_sim.h"
+#include "test_assert.h"
+
+#define TEST_CHANNEL    11
+#define TEST_PAN_ID     0xabcd
+#define TEST_SHORT_ADDR 0x1234
+#define TEST_PEER_ADDR  0x5678
+
+/**
+ * @brief Resets the simulation, initializes the driver and configures its addresses.
+ *
+ * If the driver was initialized by a previous test, it is put to sleep and deinitialized first,
+ * so that the radio scheduler does not keep the priority requested by the previous test.
+ * The driver stays in the sleep state.
+ */
+static inline void test_driver_init(void)
+{
+    static bool initialized;
+
+    uint8_t pan_id[PAN_ID_SIZE]             = {TEST_PAN_ID & 0xff, TEST_PAN_ID >> 8};
+    uint8_t short_addr[SHORT_ADDRESS_SIZE]  = {TEST_SHORT_ADDR & 0xff, TEST_SHORT_ADDR >> 8};
+    uint8_t ext_addr[EXTENDED_ADDRESS_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    if (initialized)
+    {
+        TEST_ASSERT(nrf_802154_sleep());
+        nrf_802154_sim_process();
+        nrf_802154_deinit();
+    }
+
+    nrf_802154_sim_reset();
+    nrf_802154_init();
+    initialized = true;
+
+    nrf_802154_channel_set(TEST_CHANNEL);
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(short_addr);
+    nrf_802154_extended_address_set(ext_addr);
+}
+
+/**
+ * @brief Starts the reception and waits until the transceiver receives frames.
+ */
+static inline void test_driver_receive(void)
+{
+    TEST_ASSERT(nrf_802154_receive());
+    nrf_802154_sim_process();
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+/**
+ * @brief Builds a data frame with short addresses and PAN ID compression.
+ *
+ * @param[out] p_frame      Buffer for the frame, at least @ref MAX_PACKET_SIZE + 1 bytes long.
+ * @param[in]  dst_addr     Destination short address.
+ * @param[in]  src_addr     Source short address.
+ * @param[in]  seq          Sequence number.
+ * @param[in]  ack_request  If the ACK request bit is set.
+ * @param[in]  payload_len  Length of the payload, filled with a pattern.
+ */
+static inline void test_data_frame_build(uint8_t * p_frame,
+                                         uint16_t  dst_addr,
+                                         uint16_t  src_addr,
+                                         uint8_t   seq,
+                                         bool      ack_request,
+                                         uint8_t   payload_len)
+{
+    uint8_t * p_psdu = &p_frame[PHR_SIZE];
+    uint8_t   index  = 0;
+
+    p_psdu[index++] = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK | (ack_request ? ACK_REQUEST_BIT : 0);
+    p_psdu[index++] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_0;
+    p_psdu[index++] = seq;
+    p_psdu[index++] = TEST_PAN_ID & 0xff;
+    p_psdu[index++] = TEST_PAN_ID >> 8;
+    p_psdu[index++] = dst_addr & 0xff;
+    p_psdu[index++] = dst_addr >> 8;
+    p_psdu[index++] = src_addr & 0xff;
+    p_psdu[index++] = src_addr >> 8;
+
+    for (uint8_t i = 0; i < payload_len; i++)
+    {
+        p_psdu[index++] = i;
+    }
+
+    // The FCS is computed by the RADIO, so its value does not matter.
+    p_psdu[index++] = 0;
+    p_psdu[index++] = 0;
+
+    p_frame[PHR_OFFSET] = index;
+}
+
+/**
+ * @brief Builds an Imm-Ack frame.
+ *
+ * @param[out] p_frame  Buffer for the frame, at least @ref IMM_ACK_LENGTH + 1 bytes long.
+ * @param[in]  seq      Sequence number of the acknowledged frame.
+ */
+static inline void test_imm_ack_build(uint8_t * p_frame, uint8_t seq)
+{
+    memset(p_frame, 0, PHR_SIZE + IMM_ACK_LENGTH);
+
+    p_frame[PHR_OFFSET]        = IMM_ACK_LENGTH;
+    p_frame[FRAME_TYPE_OFFSET] = FRAME_TYPE_ACK;
+    p_frame[DSN_OFFSET]        = seq;
+}
+
+#endif /* TEST_COMMON_H__ */
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Tests of the critical section profiler.
+ *
+ * Hold times are measured with the DWT cycle counter, which does not run on the host. The tests
+ * set it to the values they need before entering and exiting critical sections.
+ */
+
+#include "test_common.h"
+
+#include <nrf.h>
+
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_utils.h"
+
+#define MAX_SITES NRF_802154_STATS_CRIT_SECT_PROFILER_SITES
+
+static nrf_802154_stat_crit_sect_site_t m_sites[MAX_SITES];
+
+static void setup(void)
+{
+    test_driver_init();
+    nrf_802154_stat_crit_sect_sites_reset();
+    DWT->CYCCNT = 0;
+}
+
+/* Returns the only site that held a critical section for a non-zero time. Critical sections
+ * entered by the driver itself while the counter does not change have zero hold times. */
+static const nrf_802154_stat_crit_sect_site_t * site_held_get(void)
+{
+    const nrf_802154_stat_crit_sect_site_t * p_held = NULL;
+    uint32_t                                 count;
+
+    count = nrf_802154_stat_crit_sect_sites_get(m_sites, MAX_SITES);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (m_sites[i].max_time != 0)
+        {
+            TEST_ASSERT(p_held == NULL);
+            p_held = &m_sites[i];
+        }
+    }
+
+    TEST_ASSERT(p_held != NULL);
+
+    return p_held;
+}
+
+/* Returns the site that held a critical section for exactly the given time. */
+static const nrf_802154_stat_crit_sect_site_t * site_by_time_get(uint32_t max_time)
+{
+    uint32_t count = nrf_802154_stat_crit_sect_sites_get(m_sites, MAX_SITES);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (m_sites[i].max_time == max_time)
+        {
+            return &m_sites[i];
+        }
+    }
+
+    TEST_ASSERT(false);
+
+    return NULL;
+}
+
+static void test_init_enables_cycle_counter(void)
+{
+    g_nrf_dwt_sim.CTRL         = 0;
+    g_nrf_core_debug_sim.DEMCR = 0;
+
+    test_driver_init();
+
+    TEST_ASSERT(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk);
+    TEST_ASSERT(CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk);
+}
+
+static void test_driver_crit_sect_hold_time(void)
+{
+    const nrf_802154_stat_crit_sect_site_t * p_site;
+
+    setup();
+
+    DWT->CYCCNT = 1000;
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+    DWT->CYCCNT = 1500;
+    nrf_802154_critical_section_exit();
+
+    p_site = site_held_get();
+    TEST_ASSERT(p_site->count == 1);
+    TEST_ASSERT(p_site->max_time == 500);
+    TEST_ASSERT(p_site->total_time == 500);
+    TEST_ASSERT(p_site->max_depth == 1);
+}
+
+/* Entries at the same call site are accumulated. */
+static void test_mcu_crit_sect_accumulates(void)
+{
+    static const uint32_t                    hold_times[] = {10, 30, 20};
+    const nrf_802154_stat_crit_sect_site_t * p_site;
+
+    setup();
+
+    for (uint32_t i = 0; i < sizeof(hold_times) / sizeof(hold_times[0]); i++)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        DWT->CYCCNT += hold_times[i];
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    p_site = site_held_get();
+    TEST_ASSERT(p_site->count == 3);
+    TEST_ASSERT(p_site->max_time == 30);
+    TEST_ASSERT(p_site->total_time == 60);
+    TEST_ASSERT(p_site->max_depth == 1);
+}
+
+/* A nested critical section is measured separately and the outer one includes it. Levels deeper
+ * than NRF_802154_STATS_CRIT_SECT_PROFILER_MAX_DEPTH are not measured, but do not disturb
+ * the measurement of the outer levels. */
+static void test_mcu_crit_sect_nesting(void)
+{
+    nrf_802154_mcu_critical_state_t          outer_cs;
+    nrf_802154_mcu_critical_state_t          inner_cs;
+    nrf_802154_mcu_critical_state_t          unmeasured_cs;
+    const nrf_802154_stat_crit_sect_site_t * p_site;
+
+    setup();
+
+    nrf_802154_mcu_critical_enter(outer_cs);
+    DWT->CYCCNT = 100;
+    nrf_802154_mcu_critical_enter(inner_cs);
+    DWT->CYCCNT = 110;
+    nrf_802154_mcu_critical_enter(unmeasured_cs);
+    DWT->CYCCNT = 130;
+    nrf_802154_mcu_critical_exit(unmeasured_cs);
+    DWT->CYCCNT = 150;
+    nrf_802154_mcu_critical_exit(inner_cs);
+    DWT->CYCCNT = 400;
+    nrf_802154_mcu_critical_exit(outer_cs);
+
+    TEST_ASSERT(nrf_802154_stat_crit_sect_sites_get(m_sites, MAX_SITES) == 2);
+
+    p_site = site_by_time_get(50);
+    TEST_ASSERT(p_site->count == 1);
+    TEST_ASSERT(p_site->max_depth == 2);
+
+    p_site = site_by_time_get(400);
+    TEST_ASSERT(p_site->count == 1);
+    TEST_ASSERT(p_site->max_depth == 1);
+}
+
+static void test_hold_time_counter_wrap(void)
+{
+    nrf_802154_mcu_critical_state_t          mcu_cs;
+    const nrf_802154_stat_crit_sect_site_t * p_site;
+
+    setup();
+
+    DWT->CYCCNT = UINT32_MAX - 0xf;
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    DWT->CYCCNT = 0x10;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    p_site = site_held_get();
+    TEST_ASSERT(p_site->max_time == 0x20);
+}
+
+/* A critical section held while the sites are reset is not attributed to a removed site. */
+static void test_reset_while_held(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    setup();
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    nrf_802154_stat_crit_sect_sites_reset();
+    DWT->CYCCNT = 100;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    TEST_ASSERT(nrf_802154_stat_crit_sect_sites_get(m_sites, MAX_SITES) == 0);
+}
+
+static void test_sites_get_limit(void)
+{
+    nrf_802154_mcu_critical_state_t outer_cs;
+    nrf_802154_mcu_critical_state_t inner_cs;
+
+    setup();
+
+    nrf_802154_mcu_critical_enter(outer_cs);
+    nrf_802154_mcu_critical_enter(inner_cs);
+    nrf_802154_mcu_critical_exit(inner_cs);
+    nrf_802154_mcu_critical_exit(outer_cs);
+
+    TEST_ASSERT(nrf_802154_stat_crit_sect_sites_get(m_sites, MAX_SITES) == 2);
+    TEST_ASSERT(nrf_802154_stat_crit_sect_sites_get(m_sites, 1) == 1);
+    TEST_ASSERT(nrf_802154_stat_crit_sect_sites_get(m_sites, 0) == 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_init_enables_cycle_counter);
+    TEST_RUN(test_driver_crit_sect_hold_time);
+    TEST_RUN(test_mcu_crit_sect_accumulates);
+    TEST_RUN(test_mcu_crit_sect_nesting);
+    TEST_RUN(test_hold_time_counter_wrap);
+    TEST_RUN(test_reset_while_held);
+    TEST_RUN(test_sites_get_limit);
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the queue of delayed transmissions and receive windows.
+ *
+ * Timeslots are granted by the simulated radio scheduler at the requested time, or denied when
+ * the requested time has already passed.
+ */
+
+#include "test_common.h"
+
+#define MAX_EVENTS        16
+#define TX_DT_BASE        10000 ///< Delay of the first delayed transmission [us].
+#define TX_STEP_US        10
+#define TIME_TOLERANCE_US 500 ///< Maximum distance between an operation and its target time [us].
+#define RX_FRAME_SEQ      0x70
+#define RX_PAYLOAD_LEN    100
+
+typedef struct
+{
+    nrf_802154_rx_error_t error; ///< Error reported by @ref nrf_802154_receive_failed.
+    uint32_t              time;  ///< Time of the notification [us].
+} rx_event_t;
+
+static uint32_t   m_received_count;
+static uint32_t   m_transmitted_count;
+static uint32_t   m_transmit_failed_count;
+static rx_event_t m_rx_events[MAX_EVENTS];
+static uint32_t   m_rx_event_count;
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    m_received_count++;
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    TEST_ASSERT(m_rx_event_count < MAX_EVENTS);
+
+    m_rx_events[m_rx_event_count].error = error;
+    m_rx_events[m_rx_event_count].time  = nrf_802154_time_get();
+    m_rx_event_count++;
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+
+    m_transmit_failed_count++;
+}
+
+/* Checks that the time of an event is within the tolerance from the expected time. */
+static bool time_is_near(uint32_t time, uint32_t expected)
+{
+    return (uint32_t)(time - expected + TIME_TOLERANCE_US) < 2 * TIME_TOLERANCE_US;
+}
+
+static void setup(void)
+{
+    m_received_count        = 0;
+    m_transmitted_count     = 0;
+    m_transmit_failed_count = 0;
+    m_rx_event_count        = 0;
+
+    test_driver_init();
+    test_driver_receive();
+}
+
+/*
+ * Advances the time until the next delayed transmission starts, checks that it starts just before
+ * its target time and ends it. Returns the sequence number of the transmitted frame.
+ */
+static uint8_t delayed_tx_run(uint32_t target)
+{
+    uint8_t seq;
+
+    while (nrf_802154_sim_trx_state_get() != TRX_STATE_TXFRAME)
+    {
+        TEST_ASSERT((int32_t)(nrf_802154_time_get() - target) < 0);
+        nrf_802154_sim_time_advance(TX_STEP_US);
+    }
+
+    TEST_ASSERT((int32_t)(target - nrf_802154_time_get()) > 0);
+    TEST_ASSERT((int32_t)(target - nrf_802154_time_get()) < TIME_TOLERANCE_US);
+
+    seq = nrf_802154_sim_tx_frame_get()[DSN_OFFSET];
+
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+
+    return seq;
+}
+
+/* A second delayed transmission is queued instead of being rejected, and all run by start time. */
+static void test_transmissions_run_in_start_time_order(void)
+{
+    static const uint32_t dts[] = {3 * TX_DT_BASE, 5 * TX_DT_BASE, 2 * TX_DT_BASE, 4 * TX_DT_BASE};
+
+    uint8_t  frames[sizeof(dts) / sizeof(dts[0])][MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t t0;
+
+    setup();
+
+    t0 = nrf_802154_time_get();
+
+    for (uint8_t i = 0; i < sizeof(dts) / sizeof(dts[0]); i++)
+    {
+        test_data_frame_build(frames[i], TEST_PEER_ADDR, TEST_SHORT_ADDR, i, false, 10);
+        TEST_ASSERT(nrf_802154_transmit_raw_at(frames[i], false, t0, dts[i], TEST_CHANNEL));
+    }
+
+    TEST_ASSERT(delayed_tx_run(t0 + dts[2]) == 2);
+    TEST_ASSERT(delayed_tx_run(t0 + dts[0]) == 0);
+    TEST_ASSERT(delayed_tx_run(t0 + dts[3]) == 3);
+    TEST_ASSERT(delayed_tx_run(t0 + dts[1]) == 1);
+
+    TEST_ASSERT(m_transmitted_count == sizeof(dts) / sizeof(dts[0]));
+    TEST_ASSERT(m_transmit_failed_count == 0);
+    TEST_ASSERT(!nrf_802154_transmit_at_cancel());
+}
+
+/* An earlier transmission takes over the pending request of a later one, which still runs. */
+static void test_earlier_transmission_preempts_pending_one(void)
+{
+    uint8_t  late[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  early[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t t0;
+
+    setup();
+
+    test_data_frame_build(late, TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 10);
+    test_data_frame_build(early, TEST_PEER_ADDR, TEST_SHORT_ADDR, 2, false, 10);
+
+    t0 = nrf_802154_time_get();
+    TEST_ASSERT(nrf_802154_transmit_raw_at(late, false, t0, 2 * TX_DT_BASE, TEST_CHANNEL));
+
+    // The timeslot of the late frame is requested, but it has not started yet.
+    nrf_802154_sim_time_advance(TX_DT_BASE / 2);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+
+    TEST_ASSERT(nrf_802154_transmit_raw_at(early, false, t0, TX_DT_BASE, TEST_CHANNEL));
+
+    TEST_ASSERT(delayed_tx_run(t0 + TX_DT_BASE) == 2);
+    TEST_ASSERT(delayed_tx_run(t0 + 2 * TX_DT_BASE) == 1);
+    TEST_ASSERT(m_transmit_failed_count == 0);
+}
+
+/* The queue holds a limited number of transmissions and is cleared by a single cancel. */
+static void test_full_queue_rejects_transmission(void)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t t0;
+
+    setup();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 10);
+    t0 = nrf_802154_time_get();
+
+    // One transmission holds the timeslot request and the others wait in the queue.
+    for (uint32_t i = 0; i <= NRF_802154_DELAYED_TRX_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT(nrf_802154_transmit_raw_at(frame, false, t0, (i + 1) * TX_DT_BASE,
+                                               TEST_CHANNEL));
+    }
+
+    TEST_ASSERT(!nrf_802154_transmit_raw_at(frame, false, t0, TX_DT_BASE / 2, TEST_CHANNEL));
+
+    TEST_ASSERT(nrf_802154_transmit_at_cancel());
+    nrf_802154_sim_time_advance((NRF_802154_DELAYED_TRX_QUEUE_SIZE + 2) * TX_DT_BASE);
+
+    TEST_ASSERT(nrf_802154_sim_stats_get()->tx_frames == 0);
+    TEST_ASSERT(m_transmit_failed_count == 0);
+    TEST_ASSERT(!nrf_802154_transmit_at_cancel());
+}
+
+/* A window of a periodic reception that starts before the previous one ends is skipped. */
+static void test_periodic_window_skipped_after_extended_window(void)
+{
+    const uint32_t dt      = 10000;
+    const uint32_t period  = 5000;
+    const uint32_t timeout = 3000;
+
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t t0;
+
+    setup();
+    TEST_ASSERT(nrf_802154_sleep());
+    nrf_802154_sim_process();
+
+    t0 = nrf_802154_time_get();
+    TEST_ASSERT(nrf_802154_receive_at_periodic(t0, dt, period, timeout, TEST_CHANNEL));
+
+    // The first window ends without a frame.
+    nrf_802154_sim_time_advance(dt + timeout + TIME_TOLERANCE_US);
+    TEST_ASSERT(m_rx_event_count == 1);
+    TEST_ASSERT(m_rx_events[0].error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+    TEST_ASSERT(time_is_near(m_rx_events[0].time, t0 + dt + timeout));
+
+    // A long frame starts just before the end of the second window and extends it past the start
+    // of the third one.
+    nrf_802154_sim_time_advance(t0 + dt + period + timeout - TIME_TOLERANCE_US -
+                                nrf_802154_time_get());
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+
+    test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, RX_FRAME_SEQ, false,
+                          RX_PAYLOAD_LEN);
+    nrf_802154_sim_rx_frame(frame, true);
+    nrf_802154_sim_process();
+    TEST_ASSERT(m_received_count == 1);
+
+    nrf_802154_sim_time_advance(3 * period);
+
+    // The second window ends after the frame, the third one is skipped and the fourth one runs.
+    TEST_ASSERT(m_rx_event_count == 4);
+    TEST_ASSERT(m_rx_events[1].error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+    TEST_ASSERT((int32_t)(m_rx_events[1].time - (t0 + dt + 2 * period)) > 0);
+    TEST_ASSERT(m_rx_events[2].error == NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+    TEST_ASSERT(m_rx_events[2].time == m_rx_events[1].time);
+    TEST_ASSERT(m_rx_events[3].error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+    TEST_ASSERT(time_is_near(m_rx_events[3].time, t0 + dt + 3 * period + timeout));
+
+    TEST_ASSERT(nrf_802154_receive_at_cancel());
+    nrf_802154_sim_time_advance(2 * period);
+    TEST_ASSERT(m_rx_event_count == 4);
+}
+
+int main(void)
+{
+    TEST_RUN(test_transmissions_run_in_start_time_order);
+    TEST_RUN(test_earlier_transmission_preempts_pending_one);
+    TEST_RUN(test_full_queue_rejects_transmission);
+    TEST_RUN(test_periodic_window_skipped_after_extended_window);
+
+    return 0;
+}
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the key-value map used by the serialization.
+ *
+ * The test is built with both the linear and the hashed implementation. Keys that collide in
+ * the hash table are found with the same FNV-1a hash as the one used by the map, so that
+ * the backward-shift deletion is tested across the end of the table as well.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_kvmap.h"
+
+#define TEST_CAPACITY     16U
+#define TEST_RANDOM_KEYS  64U
+#define TEST_RANDOM_STEPS 20000U
+
+typedef uint32_t test_key_t;
+typedef uint16_t test_val_t;
+
+static uint8_t            m_memory[NRF_802154_KVMAP_MEMORY_SIZE(TEST_CAPACITY,
+                                                                sizeof(test_key_t),
+                                                                sizeof(test_val_t))];
+static nrf_802154_kvmap_t m_kvmap;
+
+static void setup(void)
+{
+    memset(m_memory, 0xa5, sizeof(m_memory));
+    nrf_802154_kvmap_init(&m_kvmap, m_memory, sizeof(m_memory), sizeof(test_key_t),
+                          sizeof(test_val_t));
+}
+
+static test_val_t value_of(test_key_t key)
+{
+    return (test_val_t)(key * 7U + 3U);
+}
+
+/* Checks the map holds exactly the keys marked as present, with their values. */
+static void contents_check(const bool * p_present, test_key_t keys)
+{
+    size_t count = 0U;
+
+    for (test_key_t key = 0U; key < keys; key++)
+    {
+        test_val_t value = 0U;
+        bool       found = nrf_802154_kvmap_search(&m_kvmap, &key, &value);
+
+        TEST_ASSERT(found == p_present[key]);
+
+        if (found)
+        {
+            TEST_ASSERT(value == value_of(key));
+            count++;
+        }
+    }
+
+    TEST_ASSERT(nrf_802154_kvmap_count(&m_kvmap) == count);
+}
+
+#if NRF_802154_SERIALIZATION_KVMAP_HASH
+/* Returns the slot where the map starts to probe for the key. */
+static size_t home_slot_get(test_key_t key)
+{
+    const uint8_t * p_byte = (const uint8_t *)&key;
+    uint32_t        hash   = 2166136261UL;
+
+    for (size_t i = 0U; i < sizeof(key); i++)
+    {
+        hash ^= p_byte[i];
+        hash *= 16777619UL;
+    }
+
+    return hash % (TEST_CAPACITY * NRF_802154_KVMAP_SLOTS_PER_ITEM);
+}
+
+#endif
+
+/* Returns the first key not smaller than the given one whose home is the given slot. */
+static test_key_t key_with_home_find(test_key_t first, size_t slot)
+{
+#if NRF_802154_SERIALIZATION_KVMAP_HASH
+    while (home_slot_get(first) != slot)
+    {
+        first++;
+    }
+#else
+    (void)slot;
+#endif
+
+    return first;
+}
+
+static void test_add_search(void)
+{
+    test_val_t value;
+
+    setup();
+
+    TEST_ASSERT(nrf_802154_kvmap_capacity(&m_kvmap) == TEST_CAPACITY);
+
+    for (test_key_t key = 0U; key < TEST_CAPACITY; key++)
+    {
+        value = value_of(key);
+        TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    }
+
+    for (test_key_t key = 0U; key < TEST_CAPACITY; key++)
+    {
+        TEST_ASSERT(nrf_802154_kvmap_search(&m_kvmap, &key, &value));
+        TEST_ASSERT(value == value_of(key));
+        TEST_ASSERT(nrf_802154_kvmap_search(&m_kvmap, &key, NULL));
+    }
+
+    // A missing key leaves the value unmodified
+    test_key_t missing = TEST_CAPACITY;
+
+    value = 0x5555U;
+    TEST_ASSERT(!nrf_802154_kvmap_search(&m_kvmap, &missing, &value));
+    TEST_ASSERT(value == 0x5555U);
+}
+
+static void test_add_existing_updates_value(void)
+{
+    test_key_t key   = 42U;
+    test_val_t value = 1U;
+
+    setup();
+
+    TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    value = 2U;
+    TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    TEST_ASSERT(nrf_802154_kvmap_count(&m_kvmap) == 1U);
+
+    value = 0U;
+    TEST_ASSERT(nrf_802154_kvmap_search(&m_kvmap, &key, &value));
+    TEST_ASSERT(value == 2U);
+}
+
+static void test_full_table(void)
+{
+    test_val_t value;
+    test_key_t key;
+
+    setup();
+
+    for (key = 0U; key < TEST_CAPACITY; key++)
+    {
+        value = value_of(key);
+        TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    }
+
+    // A new key is rejected, but keys already present can still be updated
+    key   = TEST_CAPACITY;
+    value = value_of(key);
+    TEST_ASSERT(!nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    TEST_ASSERT(!nrf_802154_kvmap_search(&m_kvmap, &key, NULL));
+    TEST_ASSERT(nrf_802154_kvmap_count(&m_kvmap) == TEST_CAPACITY);
+
+    key   = 0U;
+    value = 0xffffU;
+    TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    TEST_ASSERT(nrf_802154_kvmap_search(&m_kvmap, &key, &value));
+    TEST_ASSERT(value == 0xffffU);
+
+    // A removed item makes room for a new key
+    TEST_ASSERT(nrf_802154_kvmap_remove(&m_kvmap, &key));
+    TEST_ASSERT(!nrf_802154_kvmap_remove(&m_kvmap, &key));
+
+    key   = TEST_CAPACITY;
+    value = value_of(key);
+    TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value));
+    TEST_ASSERT(nrf_802154_kvmap_count(&m_kvmap) == TEST_CAPACITY);
+}
+
+/* Removes the first item of a cluster of colliding keys that wraps around the end of the table.
+ * The remaining items must be moved back, so that they are still found.
+ */
+static void test_remove_reprobe_wrap(void)
+{
+    const size_t last_slot = TEST_CAPACITY * 2U - 1U;
+    test_key_t   keys[4];
+    bool         present[4] = {true, true, true, true};
+    test_val_t   value;
+
+    setup();
+
+    // Three keys with the home in the last slot and one with the home in the first slot
+    keys[0] = key_with_home_find(0U, last_slot);
+    keys[1] = key_with_home_find(keys[0] + 1U, last_slot);
+    keys[2] = key_with_home_find(keys[1] + 1U, last_slot);
+    keys[3] = key_with_home_find(keys[2] + 1U, 0U);
+
+    for (size_t i = 0U; i < 4U; i++)
+    {
+        value = value_of(keys[i]);
+        TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &keys[i], &value));
+    }
+
+    for (size_t i = 0U; i < 4U; i++)
+    {
+        TEST_ASSERT(nrf_802154_kvmap_remove(&m_kvmap, &keys[i]));
+        present[i] = false;
+
+        for (size_t j = 0U; j < 4U; j++)
+        {
+            TEST_ASSERT(nrf_802154_kvmap_search(&m_kvmap, &keys[j], &value) == present[j]);
+
+            if (present[j])
+            {
+                TEST_ASSERT(value == value_of(keys[j]));
+            }
+        }
+    }
+
+    TEST_ASSERT(nrf_802154_kvmap_count(&m_kvmap) == 0U);
+}
+
+/* Random additions and removals compared against a reference set. */
+static void test_random_operations(void)
+{
+    bool       present[TEST_RANDOM_KEYS] = {false};
+    uint32_t   random                    = 12345U;
+    test_key_t key;
+    test_val_t value;
+
+    setup();
+
+    for (uint32_t step = 0U; step < TEST_RANDOM_STEPS; step++)
+    {
+        random = random * 1103515245U + 12345U;
+        key    = (random >> 16) % TEST_RANDOM_KEYS;
+
+        if (present[key])
+        {
+            TEST_ASSERT(nrf_802154_kvmap_remove(&m_kvmap, &key));
+            present[key] = false;
+        }
+        else
+        {
+            bool full = nrf_802154_kvmap_count(&m_kvmap) == TEST_CAPACITY;
+
+            value = value_of(key);
+            TEST_ASSERT(nrf_802154_kvmap_add(&m_kvmap, &key, &value) == !full);
+            present[key] = !full;
+        }
+
+        if ((step % 64U) == 0U)
+        {
+            contents_check(present, TEST_RANDOM_KEYS);
+        }
+    }
+
+    contents_check(present, TEST_RANDOM_KEYS);
+}
+
+static void test_keys_only(void)
+{
+    static uint8_t     memory[NRF_802154_KVMAP_MEMORY_SIZE(4U, sizeof(test_key_t), 0U)];
+    nrf_802154_kvmap_t kvmap;
+    test_key_t         key = 7U;
+
+    nrf_802154_kvmap_init(&kvmap, memory, sizeof(memory), sizeof(test_key_t), 0U);
+
+    TEST_ASSERT(nrf_802154_kvmap_add(&kvmap, &key, NULL));
+    TEST_ASSERT(nrf_802154_kvmap_search(&kvmap, &key, NULL));
+    TEST_ASSERT(nrf_802154_kvmap_remove(&kvmap, &key));
+    TEST_ASSERT(!nrf_802154_kvmap_search(&kvmap, &key, NULL));
+}
+
+static void test_zero_capacity(void)
+{
+    nrf_802154_kvmap_t kvmap;
+    test_key_t         key   = 1U;
+    test_val_t         value = 1U;
+
+    nrf_802154_kvmap_init(&kvmap, NULL, 0U, sizeof(test_key_t), sizeof(test_val_t));
+
+    TEST_ASSERT(nrf_802154_kvmap_capacity(&kvmap) == 0U);
+    TEST_ASSERT(!nrf_802154_kvmap_add(&kvmap, &key, &value));
+    TEST_ASSERT(!nrf_802154_kvmap_search(&kvmap, &key, &value));
+    TEST_ASSERT(!nrf_802154_kvmap_remove(&kvmap, &key));
+}
+
+int main(void)
+{
+    TEST_RUN(test_add_search);
+    TEST_RUN(test_add_existing_updates_value);
+    TEST_RUN(test_full_table);
+    TEST_RUN(test_remove_reprobe_wrap);
+    TEST_RUN(test_random_operations);
+    TEST_RUN(test_keys_only);
+    TEST_RUN(test_zero_capacity);
+
+    return 0;
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Tests of the timestamped debug log and of draining it.
+ *
+ * Usage: test_log [file] [calls_file]
+ *
+ * If a file is given, the log of a short reception is written to it, for the log decoder.
+ * If a calls file is given, the log of nested function calls with known timestamps is written to
+ * it, for the timings of the log decoder.
+ */
+
+#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_APPLICATION
+
+#include "test_common.h"
+
+#include <nrf.h>
+
+#include "nrf_802154_debug_log.h"
+
+#define TEST_EVENT_ID   5
+#define TEST_CALLS_NUM  2
+#define TEST_CALL_START 2000 ///< Time between the starts of the calls of the outer function.
+
+#define LOG_WORD_TYPE(word)  ((word) >> NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS)
+#define LOG_WORD_PARAM(word) ((word) & 0xffffU)
+
+static uint32_t m_words[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
+
+/* Drains the log, so that next drains return only the records of the test. */
+static void log_discard(void)
+{
+    uint32_t lost;
+
+    while (nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost) != 0)
+    {
+    }
+}
+
+static void log_event_record(uint16_t param, uint32_t timestamp)
+{
+    DWT->CYCCNT = timestamp;
+    nrf_802154_sl_log_local_event(NRF_802154_LOG_VERBOSITY_LOW, TEST_EVENT_ID, param);
+}
+
+static void test_init_enables_cycle_counter(void)
+{
+    g_nrf_dwt_sim.CTRL         = 0;
+    g_nrf_core_debug_sim.DEMCR = 0;
+
+    test_driver_init();
+
+    TEST_ASSERT(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk);
+    TEST_ASSERT(CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk);
+}
+
+static void test_records_carry_timestamps(void)
+{
+    uint32_t lost = 1;
+    uint32_t count;
+
+    test_driver_init();
+    log_discard();
+
+    log_event_record(0x1234, 1000);
+    log_event_record(0x5678, 2000);
+
+    count = nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost);
+
+    TEST_ASSERT(count == 4);
+    TEST_ASSERT(lost == 0);
+    TEST_ASSERT(LOG_WORD_TYPE(m_words[0]) == NRF_802154_LOG_TYPE_LOCAL_EVENT);
+    TEST_ASSERT(LOG_WORD_PARAM(m_words[0]) == 0x1234);
+    TEST_ASSERT(m_words[1] == 1000);
+    TEST_ASSERT(LOG_WORD_PARAM(m_words[2]) == 0x5678);
+    TEST_ASSERT(m_words[3] == 2000);
+
+    TEST_ASSERT(nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost) == 0);
+}
+
+/* A buffer that cannot hold a whole record gets nothing, the record is returned later. */
+static void test_drain_copies_whole_records(void)
+{
+    uint32_t lost;
+
+    test_driver_init();
+    log_discard();
+
+    log_event_record(1, 10);
+    log_event_record(2, 20);
+
+    TEST_ASSERT(nrf_802154_sl_log_drain(m_words, 1, &lost) == 0);
+    TEST_ASSERT(nrf_802154_sl_log_drain(m_words, 3, &lost) == 2);
+    TEST_ASSERT(LOG_WORD_PARAM(m_words[0]) == 1);
+    TEST_ASSERT(nrf_802154_sl_log_drain(m_words, 3, &lost) == 2);
+    TEST_ASSERT(LOG_WORD_PARAM(m_words[0]) == 2);
+    TEST_ASSERT(m_words[1] == 20);
+}
+
+/* Records overwritten before they are drained are reported as lost, the rest stay in order. */
+static void test_drain_reports_lost_records(void)
+{
+    const uint32_t records = NRF_802154_SL_DEBUG_LOG_BUFFER_LEN / NRF_802154_SL_DEBUG_LOG_RECORD_LEN;
+    const uint32_t extra   = 10;
+    uint32_t       lost;
+    uint32_t       count;
+
+    test_driver_init();
+    log_discard();
+
+    for (uint32_t i = 0; i < records + extra; i++)
+    {
+        log_event_record((uint16_t)i, i);
+    }
+
+    count = nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost);
+
+    TEST_ASSERT(count == NRF_802154_SL_DEBUG_LOG_BUFFER_LEN);
+    TEST_ASSERT(lost == extra * NRF_802154_SL_DEBUG_LOG_RECORD_LEN);
+
+    for (uint32_t i = 0; i < records; i++)
+    {
+        TEST_ASSERT(LOG_WORD_PARAM(m_words[2 * i]) == extra + i);
+        TEST_ASSERT(m_words[2 * i + 1] == extra + i);
+    }
+}
+
+/* Writes the drained log to a file. */
+static void log_drained_write(const char * p_path)
+{
+    uint32_t lost;
+    uint32_t count;
+    FILE   * p_file;
+
+    count = nrf_802154_sl_log_drain(m_words, NRF_802154_SL_DEBUG_LOG_BUFFER_LEN, &lost);
+
+    p_file = fopen(p_path, "wb");
+    TEST_ASSERT(p_file != NULL);
+    TEST_ASSERT(fwrite(m_words, sizeof(m_words[0]), count, p_file) == count);
+    fclose(p_file);
+}
+
+/* Takes 300 cycles starting at the given time. */
+static void log_call_inner(uint32_t start)
+{
+    DWT->CYCCNT = start;
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    DWT->CYCCNT = start + 300;
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+/* Takes 1000 cycles starting at the given time, 300 of them in the inner function. */
+static void log_call_outer(uint32_t start)
+{
+    DWT->CYCCNT = start;
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    log_call_inner(start + 100);
+
+    DWT->CYCCNT = start + 1000;
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+/* Writes the log of nested function calls to a file, to be decoded by the log decoder. */
+static void log_calls_file_write(const char * p_path)
+{
+    test_driver_init();
+    log_discard();
+
+    for (uint32_t i = 0; i < TEST_CALLS_NUM; i++)
+    {
+        log_call_outer(i * TEST_CALL_START);
+    }
+
+    log_drained_write(p_path);
+}
+
+/* Writes the log of a frame reception to a file, to be decoded by the log decoder. */
+static void log_file_write(const char * p_path)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    test_driver_init();
+    log_discard();
+
+    test_driver_receive();
+    test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, 1, false, 10);
+    nrf_802154_sim_rx_frame(frame, true);
+    nrf_802154_sim_process();
+    log_event_record(0x1234, 0);
+
+    log_drained_write(p_path);
+}
+
+int main(int argc, char ** argv)
+{
+    TEST_RUN(test_init_enables_cycle_counter);
+    TEST_RUN(test_records_carry_timestamps);
+    TEST_RUN(test_drain_copies_whole_records);
+    TEST_RUN(test_drain_reports_lost_records);
+
+    if (argc > 1)
+    {
+        log_file_write(argv[1]);
+    }
+
+    if (argc > 2)
+    {
+        log_calls_file_write(argv[2]);
+    }
+
+    return 0;
+}
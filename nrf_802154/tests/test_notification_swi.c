@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the notification queue of the SWI notification module.
+ *
+ * The SWI is held to model a higher layer that falls behind the radio events. Notifications of
+ * received frames and reception failures can then be dropped, but notifications that complete
+ * a request must always be delivered.
+ */
+
+#include "test_common.h"
+
+#define BAD_FRAMES_NUM      1000
+#define STRESS_STEPS        20000
+#define STRESS_MAX_HOLD     200 ///< Maximum number of steps for which the SWI is held.
+#define STRESS_HOLD_PERCENT 2   ///< Probability of holding the SWI in a step that does not hold it.
+
+static uint32_t m_received_count;
+static uint32_t m_receive_failed_count;
+static uint32_t m_transmitted_count;
+static uint32_t m_transmit_failed_count;
+static uint32_t m_energy_detected_count;
+static uint32_t m_cca_count;
+static uint32_t m_random;
+static uint32_t m_dropped_base; ///< Number of dropped notifications before the current test.
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    m_received_count++;
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    TEST_ASSERT(error == NRF_802154_RX_ERROR_INVALID_FCS);
+    m_receive_failed_count++;
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+
+    m_transmit_failed_count++;
+}
+
+void nrf_802154_energy_detected(uint8_t result)
+{
+    (void)result;
+
+    m_energy_detected_count++;
+}
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    TEST_ASSERT(channel_free);
+    m_cca_count++;
+}
+
+static uint32_t random_get(uint32_t range)
+{
+    m_random = m_random * 1664525UL + 1013904223UL;
+
+    return (m_random >> 8) % range;
+}
+
+/* Returns the number of notifications dropped by the current test. */
+static uint32_t dropped_get(void)
+{
+    nrf_802154_stats_t stats;
+
+    nrf_802154_stats_get(&stats);
+
+    return stats.counters.dropped_notifications - m_dropped_base;
+}
+
+static void setup(void)
+{
+    m_received_count        = 0;
+    m_receive_failed_count  = 0;
+    m_transmitted_count     = 0;
+    m_transmit_failed_count = 0;
+    m_energy_detected_count = 0;
+    m_cca_count             = 0;
+    m_random                = 1;
+
+    test_driver_init();
+    test_driver_receive();
+
+    m_dropped_base = 0;
+    m_dropped_base = dropped_get();
+}
+
+static uint32_t rx_buffers_used_get(void)
+{
+    nrf_802154_stats_t stats;
+
+    nrf_802154_stats_get(&stats);
+
+    return stats.rx_buffers.used;
+}
+
+/* Transmits a frame without an ACK request and returns to reception. */
+static void transmit(const uint8_t * p_frame)
+{
+    TEST_ASSERT(nrf_802154_transmit_raw(p_frame, false));
+    nrf_802154_sim_process();
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+}
+
+/* While the SWI is held, reception failures fill the queue and notifications of received frames
+ * are dropped with their buffers released, but every kind of request still gets its completion. */
+static void test_completions_delivered_to_saturated_queue(void)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  tx_frames[NRF_802154_TX_QUEUE_SIZE + 1][MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  dly_frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t t0;
+
+    setup();
+    nrf_802154_sim_swi_hold(true);
+
+    test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, 1, false, 20);
+
+    for (uint32_t i = 0; i < BAD_FRAMES_NUM; i++)
+    {
+        nrf_802154_sim_rx_frame(frame, false);
+        nrf_802154_sim_process();
+    }
+
+    TEST_ASSERT(dropped_get() > 0);
+
+    // More frames than the driver has buffers are received, so the dropped ones free theirs.
+    for (uint32_t i = 0; i < 2 * NRF_802154_RX_BUFFERS; i++)
+    {
+        TEST_ASSERT(!nrf_802154_sim_rx_buffer_is_missing());
+        nrf_802154_sim_rx_frame(frame, true);
+        nrf_802154_sim_process();
+    }
+
+    TEST_ASSERT(rx_buffers_used_get() == 1);
+
+    // The transmitted frame and the frames in the transmit queue.
+    for (uint8_t i = 0; i < sizeof(tx_frames) / sizeof(tx_frames[0]); i++)
+    {
+        test_data_frame_build(tx_frames[i], TEST_PEER_ADDR, TEST_SHORT_ADDR, i, false, 10);
+        TEST_ASSERT(nrf_802154_transmit_raw_enqueue(tx_frames[i], false));
+    }
+
+    nrf_802154_sim_process();
+
+    for (uint8_t i = 0; i < sizeof(tx_frames) / sizeof(tx_frames[0]); i++)
+    {
+        TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+        nrf_802154_sim_tx_end(true);
+        nrf_802154_sim_process();
+    }
+
+    // The delayed transmissions that can be scheduled at the same time.
+    test_data_frame_build(dly_frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 0x40, false, 10);
+    t0 = nrf_802154_time_get();
+
+    for (uint32_t i = 0; i <= NRF_802154_DELAYED_TRX_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT(nrf_802154_transmit_raw_at(dly_frame, false, t0, (i + 1) * 10000,
+                                               TEST_CHANNEL));
+    }
+
+    for (uint32_t i = 0; i <= NRF_802154_DELAYED_TRX_QUEUE_SIZE; i++)
+    {
+        while (nrf_802154_sim_trx_state_get() != TRX_STATE_TXFRAME)
+        {
+            nrf_802154_sim_time_advance(100);
+        }
+
+        nrf_802154_sim_tx_end(true);
+        nrf_802154_sim_process();
+    }
+
+    TEST_ASSERT(nrf_802154_energy_detection(128));
+    nrf_802154_sim_process();
+    nrf_802154_sim_ed_end(0);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(nrf_802154_cca());
+    nrf_802154_sim_process();
+    nrf_802154_sim_cca_end(true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_received_count == 0);
+    TEST_ASSERT(m_transmitted_count == 0);
+
+    nrf_802154_sim_swi_hold(false);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmitted_count ==
+                sizeof(tx_frames) / sizeof(tx_frames[0]) + NRF_802154_DELAYED_TRX_QUEUE_SIZE + 1);
+    TEST_ASSERT(m_transmit_failed_count == 0);
+    TEST_ASSERT(m_energy_detected_count == 1);
+    TEST_ASSERT(m_cca_count == 1);
+    TEST_ASSERT(m_receive_failed_count + m_received_count + dropped_get() ==
+                BAD_FRAMES_NUM + 2 * NRF_802154_RX_BUFFERS);
+
+    // The queue has room for received frames again.
+    TEST_ASSERT(nrf_802154_receive());
+    nrf_802154_sim_process();
+    nrf_802154_sim_rx_frame(frame, true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_received_count == 1);
+    TEST_ASSERT(rx_buffers_used_get() == 1);
+}
+
+/* Random frames and transmissions while the SWI is held for random periods. */
+static void test_stress(void)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  tx_frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t frames_count = 0;
+    uint32_t tx_count     = 0;
+    uint32_t hold_left    = 0;
+
+    setup();
+
+    test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, 2, false, 20);
+    test_data_frame_build(tx_frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 3, false, 10);
+
+    for (uint32_t step = 0; step < STRESS_STEPS; step++)
+    {
+        uint32_t event = random_get(100);
+
+        if (hold_left > 0)
+        {
+            hold_left--;
+        }
+        else if (random_get(100) < STRESS_HOLD_PERCENT)
+        {
+            hold_left = random_get(STRESS_MAX_HOLD);
+        }
+
+        nrf_802154_sim_swi_hold(hold_left > 0);
+
+        if (event < 80)
+        {
+            // The receiver waits for a buffer until the higher layer frees one.
+            if (!nrf_802154_sim_rx_buffer_is_missing())
+            {
+                nrf_802154_sim_rx_frame(frame, event < 50);
+                frames_count++;
+            }
+        }
+        else if ((event < 90) && (m_transmitted_count == tx_count))
+        {
+            // Like a MAC layer, the test waits for the result of a transmission before the next one.
+            transmit(tx_frame);
+            tx_count++;
+        }
+
+        nrf_802154_sim_process();
+    }
+
+    nrf_802154_sim_swi_hold(false);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(dropped_get() > 0);
+    TEST_ASSERT(m_transmitted_count == tx_count);
+    TEST_ASSERT(m_transmit_failed_count == 0);
+    TEST_ASSERT(m_received_count + m_receive_failed_count + dropped_get() == frames_count);
+    TEST_ASSERT(rx_buffers_used_get() == 1);
+}
+
+int main(void)
+{
+    TEST_RUN(test_completions_delivered_to_saturated_queue);
+    TEST_RUN(test_stress);
+
+    return 0;
+}
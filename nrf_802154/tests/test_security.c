@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Tests of the frame security on the simulated transceiver.
+ */
+
+#include "test_common.h"
+
+#include "platform/nrf_802154_aes.h"
+
+#define MAX_FAILURES       4
+#define TEST_KEY_INDEX     1
+#define TEST_PAYLOAD_LEN   10
+#define TEST_MHR_SIZE      9 ///< Size of the MAC header without the auxiliary security header.
+#define TEST_SEC_CTRL_SIZE (SECURITY_CONTROL_SIZE + FRAME_COUNTER_SIZE + KEY_ID_MODE_1_SIZE)
+#define CCM_NONCE_SIZE     13
+#define CCM_MAX_BLOCKS     ((2 + MAX_PACKET_SIZE + NRF_802154_AES_BLOCK_SIZE - 1) / \
+                            NRF_802154_AES_BLOCK_SIZE + 2)
+
+static uint32_t        m_transmitted_count;
+static uint32_t        m_failed_count;
+static const uint8_t * mp_failed[MAX_FAILURES];
+
+static nrf_802154_tx_error_t m_failed_error[MAX_FAILURES];
+
+static const uint8_t m_key_value[NRF_802154_SECURITY_KEY_SIZE] =
+{
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+};
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    TEST_ASSERT(m_failed_count < MAX_FAILURES);
+    mp_failed[m_failed_count]      = p_frame;
+    m_failed_error[m_failed_count] = error;
+    m_failed_count++;
+}
+
+static void setup(void)
+{
+    uint8_t          key_index = TEST_KEY_INDEX;
+    nrf_802154_key_t key       =
+    {
+        .id = {.mode = 1, .p_key_id = &key_index},
+    };
+
+    m_transmitted_count = 0;
+    m_failed_count      = 0;
+
+    test_driver_init();
+
+    memcpy(key.value, m_key_value, sizeof(key.value));
+    TEST_ASSERT(nrf_802154_security_key_store(&key) == NRF_802154_SECURITY_ERROR_NONE);
+
+    test_driver_receive();
+}
+
+/* Returns the length of the MIC of the given security level. */
+static uint8_t mic_size_get(uint8_t level)
+{
+    return (level & 0x03) ? (2 << (level & 0x03)) : 0;
+}
+
+/* Builds a data frame secured with the given security level and the test key. The frame counter
+ * and the MIC are filled in by the driver. */
+static void secured_frame_build(uint8_t * p_frame, uint8_t seq, uint8_t level, uint8_t payload_len)
+{
+    uint8_t * p_psdu = &p_frame[PHR_SIZE];
+    uint8_t   index  = 0;
+
+    p_psdu[index++] = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK | SECURITY_ENABLED_BIT;
+    p_psdu[index++] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_1;
+    p_psdu[index++] = seq;
+    p_psdu[index++] = TEST_PAN_ID & 0xff;
+    p_psdu[index++] = TEST_PAN_ID >> 8;
+    p_psdu[index++] = TEST_PEER_ADDR & 0xff;
+    p_psdu[index++] = TEST_PEER_ADDR >> 8;
+    p_psdu[index++] = TEST_SHORT_ADDR & 0xff;
+    p_psdu[index++] = TEST_SHORT_ADDR >> 8;
+    p_psdu[index++] = level | KEY_ID_MODE_1;
+
+    for (uint8_t i = 0; i < FRAME_COUNTER_SIZE; i++)
+    {
+        p_psdu[index++] = 0;
+    }
+
+    p_psdu[index++] = TEST_KEY_INDEX;
+
+    for (uint8_t i = 0; i < payload_len; i++)
+    {
+        p_psdu[index++] = i;
+    }
+
+    for (uint8_t i = 0; i < mic_size_get(level) + FCS_SIZE; i++)
+    {
+        p_psdu[index++] = 0;
+    }
+
+    p_frame[PHR_OFFSET] = index;
+}
+
+/* Reference CCM* transformation written after RFC 3610: the authentication blocks are built in
+ * a single buffer, authenticated with CBC-MAC and encrypted in the CTR mode. */
+static void ccm_reference(const uint8_t * p_key,
+                          const uint8_t * p_nonce,
+                          const uint8_t * p_a,
+                          uint8_t         a_len,
+                          uint8_t       * p_m,
+                          uint8_t         m_len,
+                          uint8_t       * p_mic,
+                          uint8_t         mic_len,
+                          bool            encrypt)
+{
+    uint8_t  b[CCM_MAX_BLOCKS * NRF_802154_AES_BLOCK_SIZE] = {0};
+    uint8_t  x[NRF_802154_AES_BLOCK_SIZE]                  = {0};
+    uint8_t  a_i[NRF_802154_AES_BLOCK_SIZE];
+    uint8_t  s_i[NRF_802154_AES_BLOCK_SIZE];
+    uint32_t len = NRF_802154_AES_BLOCK_SIZE;
+
+    if (mic_len != 0)
+    {
+        b[0] = ((a_len != 0) ? 0x40 : 0) | (((mic_len - 2) / 2) << 3) | 0x01;
+        memcpy(&b[1], p_nonce, CCM_NONCE_SIZE);
+        b[14] = 0;
+        b[15] = m_len;
+
+        if (a_len != 0)
+        {
+            b[len++] = 0;
+            b[len++] = a_len;
+            memcpy(&b[len], p_a, a_len);
+            len += a_len;
+            len  = (len + NRF_802154_AES_BLOCK_SIZE - 1) / NRF_802154_AES_BLOCK_SIZE *
+                   NRF_802154_AES_BLOCK_SIZE;
+        }
+
+        memcpy(&b[len], p_m, m_len);
+        len += m_len;
+        len  = (len + NRF_802154_AES_BLOCK_SIZE - 1) / NRF_802154_AES_BLOCK_SIZE *
+               NRF_802154_AES_BLOCK_SIZE;
+
+        for (uint32_t i = 0; i < len; i += NRF_802154_AES_BLOCK_SIZE)
+        {
+            for (uint32_t j = 0; j < NRF_802154_AES_BLOCK_SIZE; j++)
+            {
+                x[j] ^= b[i + j];
+            }
+
+            nrf_802154_aes_ecb_encrypt(p_key, x, x);
+        }
+    }
+
+    a_i[0] = 0x01;
+    memcpy(&a_i[1], p_nonce, CCM_NONCE_SIZE);
+    a_i[14] = 0;
+
+    for (uint8_t i = 0; i <= (m_len + NRF_802154_AES_BLOCK_SIZE - 1) / NRF_802154_AES_BLOCK_SIZE; i++)
+    {
+        a_i[15] = i;
+        nrf_802154_aes_ecb_encrypt(p_key, a_i, s_i);
+
+        if (i == 0)
+        {
+            for (uint8_t j = 0; j < mic_len; j++)
+            {
+                p_mic[j] = x[j] ^ s_i[j];
+            }
+        }
+        else if (encrypt)
+        {
+            for (uint8_t j = 0; j < NRF_802154_AES_BLOCK_SIZE; j++)
+            {
+                uint32_t pos = (i - 1) * NRF_802154_AES_BLOCK_SIZE + j;
+
+                if (pos < m_len)
+                {
+                    p_m[pos] ^= s_i[j];
+                }
+            }
+        }
+    }
+}
+
+/* Secures a frame built by secured_frame_build with the reference CCM* transformation. */
+static void secured_frame_reference(uint8_t * p_frame, uint8_t level, uint32_t frame_counter)
+{
+    static const uint8_t ext_addr[EXTENDED_ADDRESS_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    uint8_t   header_len = TEST_MHR_SIZE + TEST_SEC_CTRL_SIZE;
+    uint8_t   mic_len    = mic_size_get(level);
+    uint8_t   data_len   = p_frame[PHR_OFFSET] - header_len - mic_len - FCS_SIZE;
+    uint8_t * p_psdu     = &p_frame[PHR_SIZE];
+    uint8_t   nonce[CCM_NONCE_SIZE];
+    bool      encrypt    = (level & 0x04) ? true : false;
+
+    for (uint8_t i = 0; i < FRAME_COUNTER_SIZE; i++)
+    {
+        p_psdu[TEST_MHR_SIZE + SECURITY_CONTROL_SIZE + i] = (uint8_t)(frame_counter >> (8 * i));
+    }
+
+    for (uint8_t i = 0; i < EXTENDED_ADDRESS_SIZE; i++)
+    {
+        nonce[i] = ext_addr[EXTENDED_ADDRESS_SIZE - 1 - i];
+    }
+
+    for (uint8_t i = 0; i < FRAME_COUNTER_SIZE; i++)
+    {
+        nonce[EXTENDED_ADDRESS_SIZE + i] = (uint8_t)(frame_counter >> (24 - 8 * i));
+    }
+
+    nonce[EXTENDED_ADDRESS_SIZE + FRAME_COUNTER_SIZE] = level;
+
+    // Without encryption the payload is a part of the authenticated data.
+    ccm_reference(m_key_value,
+                  nonce,
+                  p_psdu,
+                  encrypt ? header_len : header_len + data_len,
+                  &p_psdu[header_len],
+                  encrypt ? data_len : 0,
+                  &p_psdu[header_len + data_len],
+                  mic_len,
+                  encrypt);
+}
+
+/* Software AES-128 against the example vector of FIPS-197, Appendix C.1. */
+static void test_aes_fips_197(void)
+{
+    static const uint8_t key[NRF_802154_AES_BLOCK_SIZE] =
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    static const uint8_t clear[NRF_802154_AES_BLOCK_SIZE] =
+    {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+    static const uint8_t cipher[NRF_802154_AES_BLOCK_SIZE] =
+    {
+        0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+    };
+
+    uint8_t block[NRF_802154_AES_BLOCK_SIZE];
+
+    nrf_802154_aes_ecb_encrypt(key, clear, block);
+    TEST_ASSERT(memcmp(block, cipher, sizeof(block)) == 0);
+
+    // Encryption in place is used by the CBC-MAC.
+    memcpy(block, clear, sizeof(block));
+    nrf_802154_aes_ecb_encrypt(key, block, block);
+    TEST_ASSERT(memcmp(block, cipher, sizeof(block)) == 0);
+}
+
+/* Reference CCM* against the packet vector #1 of RFC 3610. */
+static void test_ccm_reference_rfc_3610(void)
+{
+    static const uint8_t nonce[CCM_NONCE_SIZE] =
+    {
+        0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+    };
+    static const uint8_t expected[] =
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63,
+        0xd2, 0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3,
+        0x84, 0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0
+    };
+
+    uint8_t packet[sizeof(expected)];
+
+    for (uint8_t i = 0; i < 31; i++)
+    {
+        packet[i] = i;
+    }
+
+    ccm_reference(m_key_value, nonce, packet, 8, &packet[8], 23, &packet[31], 8, true);
+    TEST_ASSERT(memcmp(packet, expected, sizeof(expected)) == 0);
+}
+
+static void test_secured_frame_is_transmitted(void)
+{
+    uint8_t         frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t         original[MAX_PACKET_SIZE + PHR_SIZE];
+    const uint8_t * p_tx_frame;
+
+    setup();
+
+    secured_frame_build(frame, 1, SECURITY_LEVEL_ENC_MIC_32, TEST_PAYLOAD_LEN);
+    memcpy(original, frame, sizeof(frame));
+
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, false));
+    nrf_802154_sim_process();
+
+    // The frame is secured in a copy, so the frame passed to the driver is not modified.
+    p_tx_frame = nrf_802154_sim_tx_frame_get();
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+    TEST_ASSERT(p_tx_frame != frame);
+    TEST_ASSERT(memcmp(frame, original, sizeof(frame)) == 0);
+    TEST_ASSERT(p_tx_frame[PHR_OFFSET] == frame[PHR_OFFSET]);
+    TEST_ASSERT(nrf_802154_security_global_frame_counter_get() == 1);
+
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmitted_count == 1);
+    TEST_ASSERT(m_failed_count == 0);
+}
+
+/* Frames secured by the driver match the reference CCM* transformation at all security levels. */
+static void test_secured_frame_matches_reference(void)
+{
+    static const uint8_t levels[] =
+    {
+        SECURITY_LEVEL_MIC_32, SECURITY_LEVEL_MIC_64, SECURITY_LEVEL_MIC_128,
+        SECURITY_LEVEL_ENC_MIC_32, SECURITY_LEVEL_ENC_MIC_64, SECURITY_LEVEL_ENC_MIC_128
+    };
+
+    // A payload longer than an AES block tests the CTR mode with more than one counter value.
+    uint8_t  payload_lens[] = {0, 1, NRF_802154_AES_BLOCK_SIZE, 40};
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  expected[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t frame_counter = 0x12345678;
+
+    setup();
+
+    nrf_802154_security_global_frame_counter_set(frame_counter);
+
+    for (uint8_t i = 0; i < sizeof(levels); i++)
+    {
+        for (uint8_t j = 0; j < sizeof(payload_lens); j++)
+        {
+            const uint8_t * p_tx_frame;
+
+            secured_frame_build(frame, j, levels[i], payload_lens[j]);
+            memcpy(expected, frame, sizeof(frame));
+            secured_frame_reference(expected, levels[i], frame_counter);
+
+            TEST_ASSERT(nrf_802154_transmit_raw(frame, false));
+            nrf_802154_sim_process();
+
+            p_tx_frame = nrf_802154_sim_tx_frame_get();
+            TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+
+            // The FCS is computed by the RADIO.
+            TEST_ASSERT(memcmp(p_tx_frame, expected, PHR_SIZE + frame[PHR_OFFSET] - FCS_SIZE) == 0);
+
+            nrf_802154_sim_tx_end(true);
+            nrf_802154_sim_process();
+
+            frame_counter++;
+        }
+    }
+
+    TEST_ASSERT(m_transmitted_count == sizeof(levels) * sizeof(payload_lens));
+    TEST_ASSERT(m_failed_count == 0);
+}
+
+/* A frame that cannot be secured is reported once, without further CSMA-CA attempts. */
+static void test_security_error_is_not_retried(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    nrf_802154_security_global_frame_counter_set(UINT32_MAX);
+    secured_frame_build(frame, 1, SECURITY_LEVEL_ENC_MIC_32, TEST_PAYLOAD_LEN);
+
+    nrf_802154_transmit_csma_ca_raw(frame);
+    nrf_802154_sim_process();
+
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        nrf_802154_sim_time_advance(320);
+    }
+
+    TEST_ASSERT(m_failed_count == 1);
+    TEST_ASSERT(mp_failed[0] == frame);
+    TEST_ASSERT(m_failed_error[0] == NRF_802154_TX_ERROR_SECURITY);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->tx_frames == 0);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+    TEST_ASSERT(nrf_802154_security_global_frame_counter_get() == UINT32_MAX);
+}
+
+/* A frame whose PHR is larger than the maximum frame length is rejected before it is copied. */
+static void test_oversized_frame_is_rejected(void)
+{
+    uint8_t frame[UINT8_MAX + PHR_SIZE];
+
+    setup();
+
+    secured_frame_build(frame, 1, SECURITY_LEVEL_ENC_MIC_32, TEST_PAYLOAD_LEN);
+    frame[PHR_OFFSET] = MAX_PACKET_SIZE + 1;
+
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, false));
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_failed_count == 1);
+    TEST_ASSERT(mp_failed[0] == frame);
+    TEST_ASSERT(m_failed_error[0] == NRF_802154_TX_ERROR_SECURITY);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->tx_frames == 0);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+    TEST_ASSERT(nrf_802154_security_global_frame_counter_get() == 0);
+}
+
+/* Frames queued after a frame that cannot be secured are aborted, as after any other failure. */
+static void test_security_error_flushes_queue(void)
+{
+    uint8_t frames[3][MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    nrf_802154_security_global_frame_counter_set(UINT32_MAX);
+    test_data_frame_build(frames[0], TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 10);
+    secured_frame_build(frames[1], 2, SECURITY_LEVEL_ENC_MIC_32, TEST_PAYLOAD_LEN);
+    test_data_frame_build(frames[2], TEST_PEER_ADDR, TEST_SHORT_ADDR, 3, false, 10);
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        TEST_ASSERT(nrf_802154_transmit_raw_enqueue(frames[i], false));
+    }
+
+    nrf_802154_sim_process();
+    TEST_ASSERT(nrf_802154_sim_tx_frame_get() == frames[0]);
+
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmitted_count == 1);
+    TEST_ASSERT(m_failed_count == 2);
+    TEST_ASSERT(mp_failed[0] == frames[1]);
+    TEST_ASSERT(m_failed_error[0] == NRF_802154_TX_ERROR_SECURITY);
+    TEST_ASSERT(mp_failed[1] == frames[2]);
+    TEST_ASSERT(m_failed_error[1] == NRF_802154_TX_ERROR_ABORTED);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->tx_frames == 1);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+int main(void)
+{
+    TEST_RUN(test_aes_fips_197);
+    TEST_RUN(test_ccm_reference_rfc_3610);
+    TEST_RUN(test_secured_frame_is_transmitted);
+    TEST_RUN(test_secured_frame_matches_reference);
+    TEST_RUN(test_security_error_is_not_retried);
+    TEST_RUN(test_oversized_frame_is_rejected);
+    TEST_RUN(test_security_error_flushes_queue);
+
+    return 0;
+}
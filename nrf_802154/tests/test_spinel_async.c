@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of asynchronous requests of the application side of the serialization.
+ *
+ * The requests are answered by the simulated network core. Requests time out after
+ * TEST_TIMEOUT_US, see CMakeLists.txt.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "test_assert.h"
+
+#include "nrf_802154_serialization_async.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_spinel_async.h"
+#include "nrf_802154_sim_spinel.h"
+
+#define TEST_TIMEOUT_US NRF_802154_SERIALIZATION_ASYNC_TIMEOUT
+#define TEST_LATENCY_US 20U
+#define TEST_SERVICE_US 10U
+
+/* Record of the completions of the requests started with it as the context. */
+typedef struct
+{
+    uint32_t             completions;
+    uint32_t             order;
+    nrf_802154_ser_err_t error;
+    bool                 result;
+} test_completion_t;
+
+static uint32_t m_completions;
+
+static void completion_callback(nrf_802154_ser_err_t error, bool result, void * p_context)
+{
+    test_completion_t * p_completion = (test_completion_t *)p_context;
+
+    p_completion->completions++;
+    p_completion->order  = m_completions++;
+    p_completion->error  = error;
+    p_completion->result = result;
+}
+
+static nrf_802154_ser_err_t request_start(test_completion_t * p_completion)
+{
+    static const uint8_t pan_id[2] = {0xcd, 0xab};
+
+    return nrf_802154_pan_id_set_async(pan_id, completion_callback, p_completion);
+}
+
+static void setup(uint32_t latency_us)
+{
+    nrf_802154_sim_spinel_reset(latency_us, TEST_SERVICE_US);
+
+    // The buffer managers initialized by nrf_802154_init() need 32-bit pointers, and asynchronous
+    // requests do not use them
+    nrf_802154_spinel_async_init();
+    m_completions = 0U;
+}
+
+/* Delivers all responses in flight. */
+static void responses_deliver(void)
+{
+    while (nrf_802154_sim_spinel_next_response_deliver())
+    {
+    }
+}
+
+static void test_pipelined_requests_complete_in_order(void)
+{
+    test_completion_t completions[NRF_802154_SERIALIZATION_ASYNC_REQUESTS] = {0};
+    test_completion_t rejected                                             = {0};
+
+    setup(TEST_LATENCY_US);
+
+    for (uint32_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(request_start(&completions[i]) > 0);
+    }
+
+    TEST_ASSERT(request_start(&rejected) == NRF_802154_SERIALIZATION_ERROR_NO_MEMORY);
+    TEST_ASSERT(nrf_802154_sim_spinel_requests_get() == NRF_802154_SERIALIZATION_ASYNC_REQUESTS);
+
+    responses_deliver();
+
+    for (uint32_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(completions[i].completions == 1U);
+        TEST_ASSERT(completions[i].order == i);
+        TEST_ASSERT(completions[i].error == NRF_802154_SERIALIZATION_ERROR_OK);
+        TEST_ASSERT(completions[i].result);
+    }
+
+    // Requests are pipelined: the last response arrives one service time after the previous one
+    TEST_ASSERT(nrf_802154_sim_spinel_time_get() ==
+                2U * TEST_LATENCY_US + NRF_802154_SERIALIZATION_ASYNC_REQUESTS * TEST_SERVICE_US);
+
+    TEST_ASSERT(rejected.completions == 0U);
+    TEST_ASSERT(request_start(&rejected) > 0);
+    TEST_ASSERT(nrf_802154_sim_spinel_errors_get() == 0U);
+}
+
+static void test_requests_time_out(void)
+{
+    test_completion_t completions[NRF_802154_SERIALIZATION_ASYNC_REQUESTS] = {0};
+    test_completion_t next                                                 = {0};
+
+    setup(TEST_LATENCY_US);
+    nrf_802154_sim_spinel_unresponsive_set(true);
+
+    for (uint32_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(request_start(&completions[i]) > 0);
+    }
+
+    nrf_802154_sim_spinel_time_advance(TEST_TIMEOUT_US - 1U);
+    TEST_ASSERT(nrf_802154_serialization_async_timeouts_process() == 0U);
+    TEST_ASSERT(completions[0].completions == 0U);
+
+    nrf_802154_sim_spinel_time_advance(1U);
+    TEST_ASSERT(nrf_802154_serialization_async_timeouts_process() ==
+                NRF_802154_SERIALIZATION_ASYNC_REQUESTS);
+    TEST_ASSERT(nrf_802154_serialization_async_timeouts_process() == 0U);
+
+    for (uint32_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(completions[i].completions == 1U);
+        TEST_ASSERT(completions[i].error == NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT);
+        TEST_ASSERT(!completions[i].result);
+    }
+
+    // Identifiers of the requests that timed out are kept reserved for another timeout period
+    TEST_ASSERT(request_start(&next) == NRF_802154_SERIALIZATION_ERROR_NO_MEMORY);
+
+    nrf_802154_sim_spinel_time_advance(TEST_TIMEOUT_US);
+    TEST_ASSERT(request_start(&next) > 0);
+}
+
+static void test_timeout_reported_when_request_started(void)
+{
+    test_completion_t first  = {0};
+    test_completion_t second = {0};
+
+    setup(TEST_LATENCY_US);
+    nrf_802154_sim_spinel_unresponsive_set(true);
+
+    TEST_ASSERT(request_start(&first) > 0);
+
+    nrf_802154_sim_spinel_time_advance(TEST_TIMEOUT_US);
+    nrf_802154_sim_spinel_unresponsive_set(false);
+
+    TEST_ASSERT(request_start(&second) > 0);
+    TEST_ASSERT(first.completions == 1U);
+    TEST_ASSERT(first.error == NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT);
+
+    responses_deliver();
+    TEST_ASSERT(second.completions == 1U);
+    TEST_ASSERT(second.error == NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+static void test_late_response_dropped(void)
+{
+    test_completion_t late = {0};
+    test_completion_t next = {0};
+
+    // The response arrives after the request times out, but before its identifier is released
+    setup(TEST_TIMEOUT_US * 3U / 4U);
+
+    TEST_ASSERT(request_start(&late) > 0);
+
+    nrf_802154_sim_spinel_time_advance(TEST_TIMEOUT_US);
+    TEST_ASSERT(nrf_802154_serialization_async_timeouts_process() == 1U);
+    TEST_ASSERT(late.error == NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT);
+
+    responses_deliver();
+    TEST_ASSERT(late.completions == 1U);
+    TEST_ASSERT(nrf_802154_sim_spinel_errors_get() == 0U);
+
+    // The slot of the request is released by the late response
+    nrf_802154_sim_spinel_unresponsive_set(true);
+
+    for (uint32_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(request_start(&next) > 0);
+    }
+}
+
+static void test_cancel(void)
+{
+    test_completion_t cancelled = {0};
+    test_completion_t kept      = {0};
+
+    setup(TEST_LATENCY_US);
+
+    TEST_ASSERT(request_start(&cancelled) > 0);
+    TEST_ASSERT(request_start(&kept) > 0);
+    TEST_ASSERT(request_start(&cancelled) > 0);
+
+    TEST_ASSERT(nrf_802154_serialization_async_cancel(completion_callback, &cancelled) == 2U);
+    TEST_ASSERT(nrf_802154_serialization_async_cancel(completion_callback, &cancelled) == 0U);
+    TEST_ASSERT(nrf_802154_serialization_async_cancel(NULL, &kept) == 0U);
+
+    responses_deliver();
+
+    TEST_ASSERT(cancelled.completions == 0U);
+    TEST_ASSERT(kept.completions == 1U);
+    TEST_ASSERT(kept.error == NRF_802154_SERIALIZATION_ERROR_OK);
+    TEST_ASSERT(nrf_802154_sim_spinel_errors_get() == 0U);
+
+    // A cancelled request does not time out
+    nrf_802154_sim_spinel_time_advance(2U * TEST_TIMEOUT_US);
+    TEST_ASSERT(nrf_802154_serialization_async_timeouts_process() == 0U);
+    TEST_ASSERT(cancelled.completions == 0U);
+}
+
+static void test_cancelled_slot_released_by_response(void)
+{
+    test_completion_t cancelled = {0};
+    test_completion_t next      = {0};
+
+    setup(TEST_LATENCY_US);
+
+    for (uint32_t i = 0U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(request_start(&cancelled) > 0);
+    }
+
+    TEST_ASSERT(nrf_802154_serialization_async_cancel(completion_callback, &cancelled) ==
+                NRF_802154_SERIALIZATION_ASYNC_REQUESTS);
+    TEST_ASSERT(request_start(&next) == NRF_802154_SERIALIZATION_ERROR_NO_MEMORY);
+
+    TEST_ASSERT(nrf_802154_sim_spinel_next_response_deliver());
+    TEST_ASSERT(request_start(&next) > 0);
+
+    responses_deliver();
+    TEST_ASSERT(cancelled.completions == 0U);
+    TEST_ASSERT(next.completions == 1U);
+}
+
+static void test_cancelled_slot_released_after_timeout(void)
+{
+    test_completion_t cancelled = {0};
+    test_completion_t next      = {0};
+
+    setup(TEST_LATENCY_US);
+    nrf_802154_sim_spinel_unresponsive_set(true);
+
+    TEST_ASSERT(request_start(&cancelled) > 0);
+    TEST_ASSERT(nrf_802154_serialization_async_cancel(completion_callback, &cancelled) == 1U);
+
+    for (uint32_t i = 1U; i < NRF_802154_SERIALIZATION_ASYNC_REQUESTS; i++)
+    {
+        TEST_ASSERT(request_start(&next) > 0);
+    }
+
+    TEST_ASSERT(nrf_802154_serialization_async_cancel(completion_callback, &next) ==
+                NRF_802154_SERIALIZATION_ASYNC_REQUESTS - 1U);
+    TEST_ASSERT(request_start(&next) == NRF_802154_SERIALIZATION_ERROR_NO_MEMORY);
+
+    nrf_802154_sim_spinel_time_advance(TEST_TIMEOUT_US);
+    TEST_ASSERT(request_start(&next) > 0);
+    TEST_ASSERT(cancelled.completions == 0U);
+}
+
+int main(void)
+{
+    TEST_RUN(test_pipelined_requests_complete_in_order);
+    TEST_RUN(test_requests_time_out);
+    TEST_RUN(test_timeout_reported_when_request_started);
+    TEST_RUN(test_late_response_dropped);
+    TEST_RUN(test_cancel);
+    TEST_RUN(test_cancelled_slot_released_by_response);
+    TEST_RUN(test_cancelled_slot_released_after_timeout);
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the straight-line spinel codec of the serialization.
+ *
+ * Every writer must encode exactly what spinel_datatype_pack() encodes for the same format,
+ * because the peer can decode frames with either of them.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "test_assert.h"
+
+#include "nrf_802154_spinel_codec.h"
+#include "nrf_802154_spinel_datatypes.h"
+
+#define TEST_BUFFER_SIZE 300U
+#define TEST_PROP        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW
+
+/* Frame long enough for the 4 bytes read past its end by NRF_802154_HDATA_ENCODE. */
+static uint8_t m_frame[127 + 1 + 4];
+
+static void frame_fill(uint8_t len)
+{
+    for (size_t i = 0U; i < sizeof(m_frame); i++)
+    {
+        m_frame[i] = (uint8_t)(i * 7U + 3U);
+    }
+
+    m_frame[0] = len;
+}
+
+/* Starts a writer with the header of a frame with the property command. */
+static void writer_begin(nrf_802154_spinel_writer_t * p_writer, uint8_t * p_buffer)
+{
+    nrf_802154_spinel_writer_init(p_writer, p_buffer, TEST_BUFFER_SIZE);
+    nrf_802154_spinel_write_uint8(p_writer, SPINEL_HEADER_FLAG);
+    nrf_802154_spinel_write_uint_packed(p_writer, SPINEL_CMD_PROP_VALUE_IS);
+    nrf_802154_spinel_write_uint_packed(p_writer, TEST_PROP);
+}
+
+static void encoding_check(const nrf_802154_spinel_writer_t * p_writer,
+                           const uint8_t                    * p_written,
+                           spinel_ssize_t                     packed_len,
+                           const uint8_t                    * p_packed)
+{
+    TEST_ASSERT(nrf_802154_spinel_writer_ok(p_writer));
+    TEST_ASSERT(packed_len > 0);
+    TEST_ASSERT(nrf_802154_spinel_writer_length(p_writer) == (size_t)packed_len);
+    TEST_ASSERT(memcmp(p_written, p_packed, (size_t)packed_len) == 0);
+}
+
+static void test_uint_packed_matches_pack(void)
+{
+    static const uint32_t values[] = {0U, 1U, 0x7fU, 0x80U, 0x3fffU, 0x4000U, 0xfffffU,
+                                      SPINEL_MAX_UINT_PACKED - 1U};
+
+    for (size_t i = 0U; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        uint8_t                    written[8];
+        uint8_t                    packed[8];
+        nrf_802154_spinel_writer_t writer;
+        spinel_ssize_t             packed_len;
+
+        nrf_802154_spinel_writer_init(&writer, written, sizeof(written));
+        nrf_802154_spinel_write_uint_packed(&writer, values[i]);
+        packed_len = spinel_datatype_pack(packed,
+                                          sizeof(packed),
+                                          SPINEL_DATATYPE_UINT_PACKED_S,
+                                          values[i]);
+
+        encoding_check(&writer, written, packed_len, packed);
+    }
+}
+
+static void test_transmit_raw_matches_pack(void)
+{
+    static const uint8_t lengths[] = {5U, 32U, 127U};
+
+    for (size_t i = 0U; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+    {
+        uint8_t                    written[TEST_BUFFER_SIZE];
+        uint8_t                    packed[TEST_BUFFER_SIZE];
+        nrf_802154_spinel_writer_t writer;
+        spinel_ssize_t             packed_len;
+
+        frame_fill(lengths[i]);
+
+        writer_begin(&writer, written);
+        nrf_802154_spinel_write_transmit_raw(&writer, 0x12345678U, m_frame, true);
+        packed_len = spinel_datatype_pack(packed,
+                                          sizeof(packed),
+                                          SPINEL_DATATYPE_COMMAND_PROP_S
+                                          SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                          SPINEL_HEADER_FLAG,
+                                          SPINEL_CMD_PROP_VALUE_IS,
+                                          TEST_PROP,
+                                          NRF_802154_HDATA_ENCODE(0x12345678U, m_frame,
+                                                                  m_frame[0]),
+                                          true);
+
+        encoding_check(&writer, written, packed_len, packed);
+
+        writer_begin(&writer, written);
+        nrf_802154_spinel_write_transmit_csma_ca_raw(&writer, 0xa5U, m_frame);
+        packed_len = spinel_datatype_pack(packed,
+                                          sizeof(packed),
+                                          SPINEL_DATATYPE_COMMAND_PROP_S
+                                          SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
+                                          SPINEL_HEADER_FLAG,
+                                          SPINEL_CMD_PROP_VALUE_IS,
+                                          TEST_PROP,
+                                          NRF_802154_HDATA_ENCODE(0xa5U, m_frame, m_frame[0]));
+
+        encoding_check(&writer, written, packed_len, packed);
+    }
+}
+
+static void test_received_timestamp_raw_matches_pack(void)
+{
+    uint8_t                    written[TEST_BUFFER_SIZE];
+    uint8_t                    packed[TEST_BUFFER_SIZE];
+    nrf_802154_spinel_writer_t writer;
+    spinel_ssize_t             packed_len;
+
+    frame_fill(20U);
+
+    writer_begin(&writer, written);
+    nrf_802154_spinel_write_received_timestamp_raw(&writer, 7U, m_frame, -60, 200U, 0xdeadbeefU);
+    packed_len = spinel_datatype_pack(packed,
+                                      sizeof(packed),
+                                      SPINEL_DATATYPE_COMMAND_PROP_S
+                                      SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                                      SPINEL_HEADER_FLAG,
+                                      SPINEL_CMD_PROP_VALUE_IS,
+                                      TEST_PROP,
+                                      NRF_802154_HDATA_ENCODE(7U, m_frame, m_frame[0]),
+                                      -60,
+                                      200U,
+                                      0xdeadbeefU);
+
+    encoding_check(&writer, written, packed_len, packed);
+}
+
+static void test_transmitted_raw_matches_pack(void)
+{
+    uint8_t                    written[TEST_BUFFER_SIZE];
+    uint8_t                    packed[TEST_BUFFER_SIZE];
+    nrf_802154_spinel_writer_t writer;
+    spinel_ssize_t             packed_len;
+
+    frame_fill(5U);
+
+    writer_begin(&writer, written);
+    nrf_802154_spinel_write_transmitted_raw(&writer, 3U, 4U, m_frame, m_frame[0], -30, 99U);
+    packed_len = spinel_datatype_pack(packed,
+                                      sizeof(packed),
+                                      SPINEL_DATATYPE_COMMAND_PROP_S
+                                      SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                                      SPINEL_HEADER_FLAG,
+                                      SPINEL_CMD_PROP_VALUE_IS,
+                                      TEST_PROP,
+                                      3U,
+                                      NRF_802154_HDATA_ENCODE(4U, m_frame, m_frame[0]),
+                                      -30,
+                                      99U);
+
+    encoding_check(&writer, written, packed_len, packed);
+
+    // Without an ACK the data is not copied by spinel_datatype_pack, so compare zeroed buffers
+    memset(packed, 0, sizeof(packed));
+
+    writer_begin(&writer, written);
+    nrf_802154_spinel_write_transmitted_raw(&writer, 3U, 0U, NULL, 0U, 0, 0U);
+    packed_len = spinel_datatype_pack(packed,
+                                      sizeof(packed),
+                                      SPINEL_DATATYPE_COMMAND_PROP_S
+                                      SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                                      SPINEL_HEADER_FLAG,
+                                      SPINEL_CMD_PROP_VALUE_IS,
+                                      TEST_PROP,
+                                      3U,
+                                      NRF_802154_HDATA_ENCODE(0U, NULL, 0U),
+                                      0,
+                                      0U);
+
+    encoding_check(&writer, written, packed_len, packed);
+}
+
+static void test_round_trip(void)
+{
+    uint8_t                    buffer[TEST_BUFFER_SIZE];
+    nrf_802154_spinel_writer_t writer;
+    nrf_802154_spinel_reader_t reader;
+    uint32_t                   handle;
+    size_t                     hdata_len;
+    const uint8_t            * p_data;
+
+    frame_fill(40U);
+
+    nrf_802154_spinel_writer_init(&writer, buffer, sizeof(buffer));
+    nrf_802154_spinel_write_received_timestamp_raw(&writer, 11U, m_frame, -5, 17U, 123456U);
+    TEST_ASSERT(nrf_802154_spinel_writer_ok(&writer));
+
+    nrf_802154_spinel_reader_init(&reader, buffer, nrf_802154_spinel_writer_length(&writer));
+    p_data = nrf_802154_spinel_read_hdata(&reader, &handle, &hdata_len);
+    TEST_ASSERT(nrf_802154_spinel_read_int8(&reader) == -5);
+    TEST_ASSERT(nrf_802154_spinel_read_uint8(&reader) == 17U);
+    TEST_ASSERT(nrf_802154_spinel_read_uint32(&reader) == 123456U);
+    TEST_ASSERT(nrf_802154_spinel_reader_ok(&reader));
+    TEST_ASSERT(reader.len == 0U);
+
+    TEST_ASSERT(handle == 11U);
+    TEST_ASSERT(NRF_802154_DATA_LEN_FROM_HDATA_LEN(hdata_len) == m_frame[0]);
+    TEST_ASSERT(memcmp(p_data, m_frame, m_frame[0] + 1U) == 0);
+}
+
+static void test_overflow_fails(void)
+{
+    uint8_t                    buffer[TEST_BUFFER_SIZE];
+    nrf_802154_spinel_writer_t writer;
+
+    frame_fill(127U);
+
+    // A frame that does not fit the buffer
+    nrf_802154_spinel_writer_init(&writer, buffer, 100U);
+    nrf_802154_spinel_write_transmit_raw(&writer, 1U, m_frame, false);
+    TEST_ASSERT(!nrf_802154_spinel_writer_ok(&writer));
+
+    // A field after the failed one does not clear the error
+    nrf_802154_spinel_writer_init(&writer, buffer, 1U);
+    nrf_802154_spinel_write_uint16(&writer, 1U);
+    nrf_802154_spinel_write_uint8(&writer, 1U);
+    TEST_ASSERT(!nrf_802154_spinel_writer_ok(&writer));
+
+    // A value out of range of the packed encoding
+    nrf_802154_spinel_writer_init(&writer, buffer, sizeof(buffer));
+    nrf_802154_spinel_write_uint_packed(&writer, SPINEL_MAX_UINT_PACKED);
+    TEST_ASSERT(!nrf_802154_spinel_writer_ok(&writer));
+}
+
+int main(void)
+{
+    TEST_RUN(test_uint_packed_matches_pack);
+    TEST_RUN(test_transmit_raw_matches_pack);
+    TEST_RUN(test_received_timestamp_raw_matches_pack);
+    TEST_RUN(test_transmitted_raw_matches_pack);
+    TEST_RUN(test_round_trip);
+    TEST_RUN(test_overflow_fails);
+
+    return 0;
+}
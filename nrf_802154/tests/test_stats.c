@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Tests of the statistics of the driver on the simulated transceiver.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_stats.h"
+
+#define HISTOGRAM_COUNT (sizeof(nrf_802154_stat_histograms_t) / sizeof(nrf_802154_stat_histogram_t))
+
+static uint32_t m_transmitted_count;
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+static uint32_t histogram_total(const nrf_802154_stat_histogram_t * p_histogram)
+{
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < NRF_802154_STAT_HISTOGRAM_BUCKETS; i++)
+    {
+        total += p_histogram->buckets[i];
+    }
+
+    return total;
+}
+
+/* A value lands in the bucket given by its bit length, the last bucket collects the rest. */
+static void test_histogram_buckets(void)
+{
+    nrf_802154_stat_histogram_t histogram;
+
+    memset(&histogram, 0, sizeof(histogram));
+
+    nrf_802154_stat_histogram_update(&histogram, 0);
+    nrf_802154_stat_histogram_update(&histogram, 1);
+    nrf_802154_stat_histogram_update(&histogram, 2);
+    nrf_802154_stat_histogram_update(&histogram, 3);
+    nrf_802154_stat_histogram_update(&histogram, 320);
+    nrf_802154_stat_histogram_update(&histogram, UINT32_MAX);
+
+    TEST_ASSERT(histogram.buckets[0] == 1);
+    TEST_ASSERT(histogram.buckets[1] == 1);
+    TEST_ASSERT(histogram.buckets[2] == 2);
+    TEST_ASSERT(histogram.buckets[9] == 1);
+    TEST_ASSERT(histogram.buckets[NRF_802154_STAT_HISTOGRAM_BUCKETS - 1] == 1);
+    TEST_ASSERT(histogram_total(&histogram) == 6);
+}
+
+/* A CSMA-CA transmission records its access delay and its request-to-air latency. */
+static void test_histograms_csma_ca_transmit(void)
+{
+    nrf_802154_stat_histograms_t histograms;
+    uint8_t                      frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint64_t                     start;
+    uint32_t                     delay;
+    uint32_t                     bucket;
+
+    m_transmitted_count = 0;
+
+    test_driver_init();
+    test_driver_receive();
+    nrf_802154_stat_histograms_reset();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 10);
+
+    start = nrf_802154_sim_time_get();
+    nrf_802154_transmit_csma_ca_raw(frame);
+
+    for (uint32_t i = 0; i < 100 && nrf_802154_sim_trx_state_get() != TRX_STATE_TXFRAME; i++)
+    {
+        nrf_802154_sim_time_advance(320);
+    }
+
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+    delay = (uint32_t)(nrf_802154_sim_time_get() - start);
+
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+    TEST_ASSERT(m_transmitted_count == 1);
+
+    nrf_802154_stat_histograms_get(&histograms);
+
+    bucket = (delay == 0) ? 0 : (32 - __builtin_clz(delay));
+    TEST_ASSERT(histogram_total(&histograms.csmaca_access_delay) == 1);
+    TEST_ASSERT(histograms.csmaca_access_delay.buckets[bucket] == 1);
+    TEST_ASSERT(histogram_total(&histograms.request_to_air_latency) == 1);
+
+    nrf_802154_stat_histograms_reset();
+    nrf_802154_stat_histograms_get(&histograms);
+
+    for (uint32_t i = 0; i < HISTOGRAM_COUNT; i++)
+    {
+        TEST_ASSERT(histogram_total(&((const nrf_802154_stat_histogram_t *)&histograms)[i]) == 0);
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_histogram_buckets);
+    TEST_RUN(test_histograms_csma_ca_transmit);
+
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the timer scheduler of the open-source SL with many concurrent timers.
+ *
+ * Thousands of timers with random and equal expiration times are run on the simulated k_timer.
+ * The tests check the order in which they fire, the removal of running timers and the wrap of
+ * the 32-bit microsecond time, and report the delay of each callback after its expiration time.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_sl_utils.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#define TEST_TIMERS      4000
+#define TEST_MAX_DT      1000000 ///< Maximum expiration delta of a random timer [us].
+#define TEST_EQUAL_DT    50      ///< Number of distinct deltas shared by the timers with equal ones.
+#define TEST_STEP_US     1000
+#define TEST_WRAP_MARGIN (TEST_MAX_DT / 2)
+
+static nrf_802154_timer_t m_timers[TEST_TIMERS];
+static uint32_t           m_indices[TEST_TIMERS];
+static uint32_t           m_expected[TEST_TIMERS]; ///< Requested expiration time [us].
+static uint32_t           m_fired_order[TEST_TIMERS];
+static uint32_t           m_fired_time[TEST_TIMERS];
+static uint32_t           m_fired_count;
+static uint32_t           m_random;
+
+static uint32_t random_get(uint32_t range)
+{
+    m_random = m_random * 1103515245U + 12345U;
+
+    return (m_random >> 8) % range;
+}
+
+static void timer_callback(void * p_context)
+{
+    uint32_t index = *(const uint32_t *)p_context;
+
+    TEST_ASSERT(m_fired_count < TEST_TIMERS);
+
+    m_fired_order[m_fired_count] = index;
+    m_fired_time[m_fired_count]  = nrf_802154_timer_sched_time_get();
+    m_fired_count++;
+}
+
+static void setup(void)
+{
+    test_driver_init();
+
+    m_fired_count = 0;
+    m_random      = 1U;
+}
+
+/* Adds the timers in the order of their indices. Every other timer shares its delta with others. */
+static void timers_add(void)
+{
+    for (uint32_t i = 0; i < TEST_TIMERS; i++)
+    {
+        uint32_t dt = (i % 2) ? random_get(TEST_MAX_DT) : (i % TEST_EQUAL_DT) * TEST_STEP_US;
+
+        m_indices[i]          = i;
+        m_timers[i].t0        = nrf_802154_timer_sched_time_get();
+        m_timers[i].dt        = dt;
+        m_timers[i].callback  = timer_callback;
+        m_timers[i].p_context = &m_indices[i];
+        m_timers[i].p_next    = NULL;
+        m_expected[i]         = m_timers[i].t0 + dt;
+
+        nrf_802154_timer_sched_add(&m_timers[i], true);
+        TEST_ASSERT(nrf_802154_timer_sched_is_running(&m_timers[i]));
+    }
+}
+
+static void timers_run(void)
+{
+    for (uint32_t t = 0; t <= TEST_MAX_DT + TEST_STEP_US; t += TEST_STEP_US)
+    {
+        nrf_802154_sim_time_advance(TEST_STEP_US);
+    }
+}
+
+/* Checks the order of the fired timers and prints the delays of their callbacks. */
+static void fired_check(const bool * p_removed)
+{
+    uint32_t max_delay   = 0;
+    uint64_t total_delay = 0;
+    uint32_t expected    = 0;
+
+    for (uint32_t i = 0; i < TEST_TIMERS; i++)
+    {
+        expected += p_removed[i] ? 0 : 1;
+        TEST_ASSERT(!nrf_802154_timer_sched_is_running(&m_timers[i]));
+    }
+
+    TEST_ASSERT(m_fired_count == expected);
+
+    for (uint32_t i = 0; i < m_fired_count; i++)
+    {
+        uint32_t index = m_fired_order[i];
+        int32_t  delay = (int32_t)(m_fired_time[i] - m_expected[index]);
+
+        TEST_ASSERT(!p_removed[index]);
+
+        // A timer fires at the first tick after its expiration time, never before.
+        TEST_ASSERT(delay >= 0);
+        TEST_ASSERT((uint32_t)delay < 2 * NRF_802154_SL_US_PER_TICK);
+
+        if (i > 0)
+        {
+            uint32_t prev  = m_fired_order[i - 1];
+            int32_t  order = (int32_t)((m_timers[index].t0 + m_timers[index].dt) -
+                                       (m_timers[prev].t0 + m_timers[prev].dt));
+
+            // Timers fire by expiration time, the ones expiring at the same tick in add order.
+            TEST_ASSERT((order > 0) || ((order == 0) && (index > prev)));
+            TEST_ASSERT((int32_t)(m_fired_time[i] - m_fired_time[i - 1]) >= 0);
+        }
+
+        max_delay    = (delay > (int32_t)max_delay) ? (uint32_t)delay : max_delay;
+        total_delay += delay;
+    }
+
+    printf("  %u timers fired, callback delay: mean %.1f us, max %u us\n",
+           m_fired_count,
+           (double)total_delay / m_fired_count,
+           max_delay);
+}
+
+static void test_timers_fire_in_order(void)
+{
+    static bool removed[TEST_TIMERS];
+
+    setup();
+
+    timers_add();
+    timers_run();
+
+    fired_check(removed);
+}
+
+static void test_removed_timers_do_not_fire(void)
+{
+    static bool removed[TEST_TIMERS];
+    bool        was_running;
+
+    setup();
+
+    timers_add();
+
+    // Every third timer is removed, including the ones at the head of the list.
+    for (uint32_t i = 0; i < TEST_TIMERS; i += 3)
+    {
+        nrf_802154_timer_sched_remove(&m_timers[i], &was_running);
+        TEST_ASSERT(was_running);
+        removed[i] = true;
+    }
+
+    nrf_802154_timer_sched_remove(&m_timers[0], &was_running);
+    TEST_ASSERT(!was_running);
+
+    timers_run();
+
+    fired_check(removed);
+}
+
+static void test_timers_fire_across_time_wrap(void)
+{
+    static bool removed[TEST_TIMERS];
+    uint32_t    now;
+
+    setup();
+
+    // The 32-bit microsecond time wraps while the timers are running.
+    nrf_802154_sim_time_advance(UINT32_MAX - TEST_WRAP_MARGIN);
+    now = nrf_802154_timer_sched_time_get();
+    TEST_ASSERT(now > UINT32_MAX - TEST_WRAP_MARGIN - NRF_802154_SL_US_PER_TICK);
+
+    TEST_ASSERT(nrf_802154_timer_sched_time_is_in_future(now, now, TEST_MAX_DT));
+    TEST_ASSERT(!nrf_802154_timer_sched_time_is_in_future(now + TEST_MAX_DT, now, TEST_MAX_DT));
+    TEST_ASSERT(!nrf_802154_timer_sched_time_is_in_future(now + TEST_MAX_DT + 1, now, TEST_MAX_DT));
+
+    timers_add();
+    timers_run();
+
+    TEST_ASSERT(nrf_802154_timer_sched_time_get() < TEST_MAX_DT);
+    fired_check(removed);
+}
+
+int main(void)
+{
+    TEST_RUN(test_timers_fire_in_order);
+    TEST_RUN(test_removed_timers_do_not_fire);
+    TEST_RUN(test_timers_fire_across_time_wrap);
+
+    return 0;
+}
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of basic reception and transmission on the simulated transceiver.
+ */
+
+#include "test_common.h"
+
+static uint32_t m_received_count;
+static uint8_t  m_received_seq;
+static uint32_t m_transmitted_count;
+static bool     m_transmitted_with_ack;
+static uint32_t m_transmit_failed_count;
+
+static nrf_802154_tx_error_t m_transmit_error;
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    m_received_count++;
+    m_received_seq = p_data[DSN_OFFSET];
+
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_transmitted_count++;
+    m_transmitted_with_ack = (p_ack != NULL);
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+
+    m_transmit_failed_count++;
+    m_transmit_error = error;
+}
+
+static void setup(void)
+{
+    m_received_count        = 0;
+    m_transmitted_count     = 0;
+    m_transmit_failed_count = 0;
+
+    test_driver_init();
+    test_driver_receive();
+
+    TEST_ASSERT(nrf_802154_sim_channel_get() == TEST_CHANNEL);
+}
+
+static void test_receive_ack_requested(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, 0x42, true, 10);
+    nrf_802154_sim_rx_frame(frame, true);
+
+    // The frame is reported after the ACK is sent.
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXACK);
+    TEST_ASSERT(m_received_count == 0);
+    TEST_ASSERT(nrf_802154_sim_tx_ack_get()[DSN_OFFSET] == 0x42);
+
+    nrf_802154_sim_tx_ack_end();
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_received_count == 1);
+    TEST_ASSERT(m_received_seq == 0x42);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+static void test_receive_filtered(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_PEER_ADDR, 0x43, true, 10);
+    nrf_802154_sim_rx_frame(frame, true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_received_count == 0);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->tx_acks == 0);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+/* Receives a 2015 frame to this node with the given addressing modes and PAN ID compression. */
+static void frame_2015_receive(uint8_t addr_types, bool pan_id_compr, uint8_t seq)
+{
+    uint8_t   frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t * p_psdu = &frame[PHR_SIZE];
+
+    test_data_frame_build(frame, TEST_SHORT_ADDR, TEST_PEER_ADDR, seq, true, 10);
+
+    p_psdu[0] = FRAME_TYPE_DATA | ACK_REQUEST_BIT | (pan_id_compr ? PAN_ID_COMPR_MASK : 0);
+    p_psdu[1] = addr_types | FRAME_VERSION_2;
+
+    nrf_802154_sim_rx_frame(frame, true);
+
+    if (nrf_802154_sim_trx_state_get() == TRX_STATE_TXACK)
+    {
+        nrf_802154_sim_tx_ack_end();
+    }
+
+    nrf_802154_sim_process();
+}
+
+static void test_receive_2015_reserved_addressing_mode_filtered(void)
+{
+    // 0b01 is the reserved addressing mode.
+    static const uint8_t reserved_addr_types[] =
+    {
+        0x04 | SRC_ADDR_TYPE_SHORT,
+        0x04 | SRC_ADDR_TYPE_NONE,
+        DEST_ADDR_TYPE_SHORT | 0x40,
+        0x04 | 0x40,
+    };
+
+    setup();
+
+    // The same frame with valid addressing modes is accepted.
+    frame_2015_receive(DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT, true, 0x50);
+    TEST_ASSERT(m_received_count == 1);
+    TEST_ASSERT(nrf_802154_sim_stats_get()->tx_acks == 1);
+
+    for (uint8_t i = 0; i < sizeof(reserved_addr_types); i++)
+    {
+        for (uint8_t pan_id_compr = 0; pan_id_compr < 2; pan_id_compr++)
+        {
+            frame_2015_receive(reserved_addr_types[i], pan_id_compr, 0x51 + i);
+
+            TEST_ASSERT(m_received_count == 1);
+            TEST_ASSERT(nrf_802154_sim_stats_get()->tx_acks == 1);
+            TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+        }
+    }
+}
+
+static void test_transmit_no_ack(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 20);
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, true));
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+    TEST_ASSERT(nrf_802154_sim_tx_frame_get()[DSN_OFFSET] == 1);
+
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmitted_count == 1);
+    TEST_ASSERT(!m_transmitted_with_ack);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+static void test_transmit_ack_received(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t ack[IMM_ACK_LENGTH + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 2, true, 20);
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, true));
+    nrf_802154_sim_process();
+    nrf_802154_sim_tx_end(true);
+
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXACK);
+
+    test_imm_ack_build(ack, 2);
+    nrf_802154_sim_rx_ack(ack, true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmitted_count == 1);
+    TEST_ASSERT(m_transmitted_with_ack);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+static void test_transmit_ack_timeout(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 3, true, 20);
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, true));
+    nrf_802154_sim_process();
+    nrf_802154_sim_tx_end(true);
+
+    nrf_802154_sim_time_advance(NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT + 1000);
+
+    TEST_ASSERT(m_transmitted_count == 0);
+    TEST_ASSERT(m_transmit_failed_count == 1);
+    TEST_ASSERT(m_transmit_error == NRF_802154_TX_ERROR_NO_ACK);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+static void test_transmit_busy_channel(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 4, false, 20);
+    TEST_ASSERT(nrf_802154_transmit_raw(frame, true));
+    nrf_802154_sim_process();
+    nrf_802154_sim_tx_end(false);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmit_failed_count == 1);
+    TEST_ASSERT(m_transmit_error == NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+int main(void)
+{
+    TEST_RUN(test_receive_ack_requested);
+    TEST_RUN(test_receive_filtered);
+    TEST_RUN(test_receive_2015_reserved_addressing_mode_filtered);
+    TEST_RUN(test_transmit_no_ack);
+    TEST_RUN(test_transmit_ack_received);
+    TEST_RUN(test_transmit_ack_timeout);
+    TEST_RUN(test_transmit_busy_channel);
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Tests of the transmit queue on the simulated transceiver.
+ */
+
+#include "test_common.h"
+
+#include "nrf_802154_request.h"
+
+#define MAX_FAILURES 8
+
+static uint32_t        m_transmitted_count;
+static const uint8_t * mp_transmitted[NRF_802154_TX_QUEUE_SIZE + 2];
+static uint32_t        m_failed_count;
+static const uint8_t * mp_failed[MAX_FAILURES];
+
+static nrf_802154_tx_error_t m_failed_error[MAX_FAILURES];
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    TEST_ASSERT(m_transmitted_count < sizeof(mp_transmitted) / sizeof(mp_transmitted[0]));
+    mp_transmitted[m_transmitted_count++] = p_frame;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    TEST_ASSERT(m_failed_count < MAX_FAILURES);
+    mp_failed[m_failed_count]      = p_frame;
+    m_failed_error[m_failed_count] = error;
+    m_failed_count++;
+}
+
+static void setup(void)
+{
+    m_transmitted_count = 0;
+    m_failed_count      = 0;
+
+    test_driver_init();
+    test_driver_receive();
+}
+
+/* Advances the time until the CSMA-CA procedure starts the next transmission attempt. */
+static void csma_ca_attempt_wait(void)
+{
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        if (nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME)
+        {
+            return;
+        }
+
+        nrf_802154_sim_time_advance(320);
+    }
+
+    TEST_ASSERT(false);
+}
+
+static void test_queued_frames_follow_in_order(void)
+{
+    uint8_t frames[3][MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        test_data_frame_build(frames[i], TEST_PEER_ADDR, TEST_SHORT_ADDR, i, false, 10);
+        TEST_ASSERT(nrf_802154_transmit_raw_enqueue(frames[i], false));
+    }
+
+    nrf_802154_sim_process();
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_TXFRAME);
+        TEST_ASSERT(nrf_802154_sim_tx_frame_get() == frames[i]);
+
+        nrf_802154_sim_tx_end(true);
+        nrf_802154_sim_process();
+    }
+
+    TEST_ASSERT(m_transmitted_count == 3);
+    TEST_ASSERT(m_failed_count == 0);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+/* A frame queued after a CSMA-CA frame stays queued while the CSMA-CA procedure retries, and is
+ * aborted when an unrelated frame is transmitted instead, so that it does not follow that frame. */
+static void test_non_queued_transmit_flushes_queue(void)
+{
+    uint8_t csma_frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t queued_frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+    setup();
+
+    test_data_frame_build(csma_frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 1, false, 10);
+    test_data_frame_build(queued_frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 2, false, 10);
+    test_data_frame_build(frame, TEST_PEER_ADDR, TEST_SHORT_ADDR, 3, false, 10);
+
+    nrf_802154_transmit_csma_ca_raw(csma_frame);
+    csma_ca_attempt_wait();
+    TEST_ASSERT(nrf_802154_transmit_raw_enqueue(queued_frame, false));
+
+    // The channel is busy, so the CSMA-CA procedure backs off and retries the same frame.
+    nrf_802154_sim_tx_end(false);
+    nrf_802154_sim_process();
+    csma_ca_attempt_wait();
+    TEST_ASSERT(nrf_802154_sim_tx_frame_get() == csma_frame);
+    nrf_802154_sim_tx_end(false);
+    nrf_802154_sim_process();
+    TEST_ASSERT(m_failed_count == 0);
+
+    // A transmission that terminates the CSMA-CA procedure during the backoff, as a delayed
+    // transmission does.
+    TEST_ASSERT(nrf_802154_request_transmit(NRF_802154_TERM_802154,
+                                            REQ_ORIG_HIGHER_LAYER,
+                                            frame,
+                                            false,
+                                            false,
+                                            NULL));
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_failed_count == 1);
+    TEST_ASSERT(mp_failed[0] == queued_frame);
+    TEST_ASSERT(m_failed_error[0] == NRF_802154_TX_ERROR_ABORTED);
+
+    TEST_ASSERT(nrf_802154_sim_tx_frame_get() == frame);
+    nrf_802154_sim_tx_end(true);
+    nrf_802154_sim_process();
+
+    TEST_ASSERT(m_transmitted_count == 1);
+    TEST_ASSERT(mp_transmitted[0] == frame);
+    TEST_ASSERT(nrf_802154_sim_trx_state_get() == TRX_STATE_RXFRAME);
+}
+
+int main(void)
+{
+    TEST_RUN(test_queued_frames_follow_in_order);
+    TEST_RUN(test_non_queued_transmit_flushes_queue);
+
+    return 0;
+}
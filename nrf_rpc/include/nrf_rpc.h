@@ -44,6 +44,7 @@ enum nrf_rpc_packet_type {
 	NRF_RPC_PACKET_TYPE_ACK  = 0x02, /**< @brief Event acknowledge */
 	NRF_RPC_PACKET_TYPE_ERR  = 0x03, /**< @brief Error report from remote */
 	NRF_RPC_PACKET_TYPE_INIT = 0x04, /**< @brief Initialization packet */
+	NRF_RPC_PACKET_TYPE_BATCH = 0x05, /**< @brief Batch of events or ACKs */
 	NRF_RPC_PACKET_TYPE_CMD  = 0x80, /**< @brief Command */
 };
 
@@ -98,6 +99,15 @@ struct _nrf_rpc_decoder {
 	void *handler_data;
 };
 
+/* Structure used internally to hold queue of packets waiting for execution
+ * in a group.
+ */
+struct _nrf_rpc_group_data {
+	struct _nrf_rpc_group_work *queue_head;
+	struct _nrf_rpc_group_work *queue_tail;
+	bool busy;
+};
+
 /** @brief Defines a group of commands and events.
  *
  * Created by @ref NRF_RPC_GROUP_DEFINE.
@@ -113,8 +123,23 @@ struct nrf_rpc_group {
 	void *ack_handler_data;
 	const char *strid;
 	nrf_rpc_err_handler_t err_handler;
+#if defined(CONFIG_NRF_RPC_GROUP_ORDERING)
+	struct _nrf_rpc_group_data *data;
+#endif
 };
 
+#if defined(CONFIG_NRF_RPC_GROUP_ORDERING)
+#define _NRF_RPC_GROUP_DATA_DEFINE(_name)				       \
+	static struct _nrf_rpc_group_data NRF_RPC_CONCAT(_name, _group_data)
+#define _NRF_RPC_GROUP_DATA_INIT(_name)					       \
+	.data = &NRF_RPC_CONCAT(_name, _group_data),
+#else
+/* Declaration only, so no memory is used if group ordering is disabled. */
+#define _NRF_RPC_GROUP_DATA_DEFINE(_name)				       \
+	extern struct _nrf_rpc_group_data NRF_RPC_CONCAT(_name, _group_data)
+#define _NRF_RPC_GROUP_DATA_INIT(_name)
+#endif /* CONFIG_NRF_RPC_GROUP_ORDERING */
+
 /** @brief Error report.
  */
 struct nrf_rpc_err_report {
@@ -158,6 +183,7 @@ struct nrf_rpc_err_report {
 	NRF_RPC_AUTO_ARR(NRF_RPC_CONCAT(_name, _evt_array),		       \
 			 "evt_" NRF_RPC_STRINGIFY(_name));		       \
 	static uint8_t NRF_RPC_CONCAT(_name, _group_id);		       \
+	_NRF_RPC_GROUP_DATA_DEFINE(_name);				       \
 	NRF_RPC_AUTO_ARR_ITEM(const struct nrf_rpc_group, _name, "grp",	       \
 			      _strid) = {				       \
 		.group_id = &NRF_RPC_CONCAT(_name, _group_id),		       \
@@ -167,6 +193,7 @@ struct nrf_rpc_err_report {
 		.ack_handler_data = _ack_data,				       \
 		.strid = _strid,					       \
 		.err_handler = _err_handler,				       \
+		_NRF_RPC_GROUP_DATA_INIT(_name)				       \
 	}
 
 /** @brief Extern declaration of a group.
@@ -231,8 +258,8 @@ struct nrf_rpc_err_report {
  * @param[in]  _len    Requested length of the packet.
  */
 #define NRF_RPC_ALLOC(_packet, _len)					       \
-	nrf_rpc_tr_alloc_tx_buf(&(_packet), _NRF_RPC_HEADER_SIZE + (_len));    \
-	*(uint8_t **)&(_packet) += _NRF_RPC_HEADER_SIZE
+	nrf_rpc_tr_reserve_tx_buf((uint8_t **)&(_packet),		       \
+				  _NRF_RPC_HEADER_SIZE, (_len))
 
 /** @brief Deallocate memory for a packet.
  *
@@ -241,7 +268,8 @@ struct nrf_rpc_err_report {
  *
  * @param _packet Packet that was previously allocated.
  */
-#define NRF_RPC_DISCARD(_packet) nrf_rpc_tr_free_tx_buf((_packet))
+#define NRF_RPC_DISCARD(_packet)					       \
+	nrf_rpc_tr_discard_tx_buf((_packet), _NRF_RPC_HEADER_SIZE)
 
 /** @brief Initialize the nRF RPC
  *
@@ -335,6 +363,56 @@ static inline void nrf_rpc_cmd_rsp_no_err(const struct nrf_rpc_group *group,
 					  const uint8_t **rsp_packet,
 					  size_t *rsp_len);
 
+/** @brief Send a command without waiting for the response.
+ *
+ * Function returns as soon as the command was passed to the transport layer,
+ * so a thread can have many commands in progress at the same time. Each
+ * command uses its own context from the command context pool and reserves one
+ * thread from the remote thread pool until its response arrives, so the number
+ * of commands in progress is limited by
+ * @option{CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE} and the size of the remote thread
+ * pool. If there are no resources available this function waits.
+ *
+ * The response is passed to the `handler` directly from the transport receive
+ * callback. The handler must not block and must not send commands. Response
+ * packet is automatically deallocated after the handler returns.
+ *
+ * @param group        Group that command belongs to.
+ * @param cmd          Command id.
+ * @param packet       Packet allocated by @ref NRF_RPC_ALLOC and filled with
+ *                     an encoded data.
+ * @param len          Length of the packet. Can be smaller than allocated.
+ * @param handler      Callback that handles the response. Can be NULL if
+ *                     the response is not needed.
+ * @param handler_data Opaque pointer that will be passed to `handler`.
+ *
+ * @return             0 on success or negative error code if a transport layer
+ *                     reported a sendig error. The handler will not be called
+ *                     if sending failed.
+ */
+int nrf_rpc_cmd_async(const struct nrf_rpc_group *group, uint8_t cmd,
+		      uint8_t *packet, size_t len, nrf_rpc_handler_t handler,
+		      void *handler_data);
+
+/** @brief Send a command without waiting for the response and pass any error
+ * to an error handler.
+ *
+ * See both @ref nrf_rpc_cmd_async and @ref nrf_rpc_cmd_no_err for more
+ * details on this variant of command send function.
+ *
+ * @param group        Group that command belongs to.
+ * @param cmd          Command id.
+ * @param packet       Packet allocated by @ref NRF_RPC_ALLOC and filled with
+ *                     an encoded data.
+ * @param len          Length of the packet. Can be smaller than allocated.
+ * @param handler      Callback that handles the response. Can be NULL if
+ *                     the response is not needed.
+ * @param handler_data Opaque pointer that will be passed to `handler`.
+ */
+void nrf_rpc_cmd_async_no_err(const struct nrf_rpc_group *group, uint8_t cmd,
+			      uint8_t *packet, size_t len,
+			      nrf_rpc_handler_t handler, void *handler_data);
+
 /** @brief Send an event.
  *
  * @param group  Group that event belongs to.
@@ -364,6 +442,64 @@ int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
 void nrf_rpc_evt_no_err(const struct nrf_rpc_group *group, uint8_t evt,
 			uint8_t *packet, size_t len);
 
+/** @brief Send an event as a part of a batch.
+ *
+ * Event is collected together with other batched events and all of them are
+ * sent in one packet and executed one after another by a single thread from
+ * the remote thread pool. Remote side acknowledges the entire batch with one
+ * packet. Batch is sent when its size reaches
+ * @option{CONFIG_NRF_RPC_BATCH_SIZE}, when it contains
+ * @option{CONFIG_NRF_RPC_BATCH_COUNT} events, when
+ * @option{CONFIG_NRF_RPC_BATCH_TIMEOUT} passes after the first event was added
+ * to it, when a non-batched event, a command or a response is sent or when
+ * @ref nrf_rpc_batch_flush is called.
+ *
+ * If the remote side does not support batching, the event is longer than
+ * 255 bytes (UINT8_MAX) or it does not fit into
+ * @option{CONFIG_NRF_RPC_BATCH_SIZE}, it is sent immediately in the same way
+ * as @ref nrf_rpc_evt does.
+ *
+ * Event decoders receiving batched events must finish decoding before they
+ * return, because the batch is deallocated after the last event is executed.
+ *
+ * @param group  Group that event belongs to.
+ * @param evt    Event id.
+ * @param packet Packet allocated by @ref NRF_RPC_ALLOC and filled with
+ *               an encoded data.
+ * @param len    Length of the packet. Can be smaller than allocated.
+ *
+ * @return       0 on success or negative error code if a transport layer
+ *               reported a sendig error.
+ */
+int nrf_rpc_evt_batched(const struct nrf_rpc_group *group, uint8_t evt,
+			uint8_t *packet, size_t len);
+
+/** @brief Send an event as a part of a batch and pass any error to an error
+ * handler.
+ *
+ * See both @ref nrf_rpc_evt_batched and @ref nrf_rpc_evt_no_err for more
+ * details on this variant of event send function.
+ *
+ * @param group  Group that event belongs to.
+ * @param evt    Event id.
+ * @param packet Packet allocated by @ref NRF_RPC_ALLOC and filled with
+ *               an encoded data.
+ * @param len    Length of the packet. Can be smaller than allocated.
+ */
+void nrf_rpc_evt_batched_no_err(const struct nrf_rpc_group *group, uint8_t evt,
+				uint8_t *packet, size_t len);
+
+/** @brief Send all events collected in the current batch.
+ *
+ * It can be called when the application knows that no more events will be
+ * batched soon, so they do not wait for
+ * @option{CONFIG_NRF_RPC_BATCH_TIMEOUT}.
+ *
+ * @return 0 on success or negative error code if a transport layer
+ *         reported a sendig error.
+ */
+int nrf_rpc_batch_flush(void);
+
 /** @brief Send a response.
  *
  * @param packet Packet allocated by @ref NRF_RPC_ALLOC and filled with
@@ -21,4 +21,22 @@
 
 #endif
 
+#if !defined(NRF_RPC_TR_RESERVE_TX_BUF) || !NRF_RPC_TR_RESERVE_TX_BUF
+
+/* Reserve/commit API on top of the basic transport API. See
+ * template/nrf_rpc_tr_tmpl.h for its documentation. The basic API has no
+ * headroom parameter, so the headroom is allocated as a part of the buffer.
+ */
+
+#define nrf_rpc_tr_reserve_tx_buf(_buf, _headroom, _len)		       \
+	nrf_rpc_tr_alloc_tx_buf((_buf), (_headroom) + (_len));		       \
+	*(_buf) += (_headroom)
+
+#define nrf_rpc_tr_commit_tx_buf(_buf, _len) nrf_rpc_tr_send((_buf), (_len))
+
+#define nrf_rpc_tr_discard_tx_buf(_buf, _headroom)			       \
+	nrf_rpc_tr_free_tx_buf((_buf))
+
+#endif /* NRF_RPC_TR_RESERVE_TX_BUF */
+
 #endif  /* NRF_RPC_TR_H_ */
@@ -34,6 +34,12 @@ struct nrf_rpc_cmd_ctx {
 	uint8_t use_count;	   /* Context usage counter. It increases
 				    * each time context is reused.
 				    */
+	bool async;		   /* Context belongs to an asynchronous
+				    * command. It is not associated with any
+				    * thread and response is passed to the
+				    * handler directly from the receive
+				    * callback.
+				    */
 	nrf_rpc_handler_t handler; /* Response handler provided be the user. */
 	void *handler_data;	   /* Pointer for the response handler. */
 	struct nrf_rpc_os_msg recv_msg;
@@ -70,6 +76,109 @@ static nrf_rpc_err_handler_t global_err_handler;
 /* Array with all defiend groups */
 NRF_RPC_AUTO_ARR(nrf_rpc_groups_array, "grp");
 
+#if defined(CONFIG_NRF_RPC_DISPATCH_TABLE)
+
+/* Value in the dispatch table indicating that there is no decoder for an id. */
+#define DISPATCH_NO_DECODER 0xFF
+
+/* Dispatch tables of a group. Each table maps a command or an event id to an
+ * index of the decoder in the group's decoder array. A table is complete if
+ * it indexes all decoders of the array, so an id missing from it has no
+ * decoder.
+ */
+struct dispatch_table {
+	uint8_t cmd[0x100];
+	uint8_t evt[0x100];
+	bool cmd_complete;
+	bool evt_complete;
+};
+
+/* Dispatch tables of groups, indexed by the group id. */
+static struct dispatch_table
+	dispatch_tables[CONFIG_NRF_RPC_DISPATCH_TABLE_GROUPS];
+
+#endif /* CONFIG_NRF_RPC_DISPATCH_TABLE */
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+
+/* Feature flags exchanged in the initialization packet. */
+#define FEATURE_BATCH 0x01
+
+/* Each item in a batch packet starts with a header of the same size as packet
+ * header, so the item payload can be passed to the decoders as it is. First
+ * byte of the item header is always NRF_RPC_PACKET_TYPE_BATCH, which allows
+ * nrf_rpc_decoding_done() to recognize items of a batch.
+ */
+#define BATCH_ITEM_HEADER_SIZE _NRF_RPC_HEADER_SIZE
+
+/* Supported features are appended after the groups checksum in the
+ * initialization packet. Remote side that does not know them ignores
+ * the additional byte.
+ */
+#define INIT_PAYLOAD_SIZE (sizeof(uint32_t) + 1)
+
+/* Features supported by the remote side. */
+static uint8_t remote_features;
+
+/* Lock protecting the batch that is being collected. */
+static struct nrf_rpc_os_mutex batch_lock;
+
+#if CONFIG_NRF_RPC_BATCH_TIMEOUT > 0
+/* Timer sending the batch if no other event fills it in time. */
+static struct nrf_rpc_os_timer batch_timer;
+#endif
+
+/* Events collected for sending in one batch packet. */
+static uint8_t batch_buf[CONFIG_NRF_RPC_BATCH_SIZE];
+static size_t batch_len;
+static uint8_t batch_count;
+
+#else
+
+#define INIT_PAYLOAD_SIZE sizeof(uint32_t)
+
+#endif /* CONFIG_NRF_RPC_BATCH */
+
+#if defined(CONFIG_NRF_RPC_GROUP_ORDERING)
+
+/* Packet waiting in the group queue for execution. */
+struct _nrf_rpc_group_work {
+	struct _nrf_rpc_group_work *next;
+	const uint8_t *packet;
+	size_t len;
+	struct nrf_rpc_os_event *handoff; /* If not NULL, a thread executing
+					   * a batch waits for the group.
+					   * The group is passed to it
+					   * instead of executing a packet.
+					   */
+#if CONFIG_NRF_RPC_GROUP_QUEUE_BUF_SIZE > 0
+	uint8_t buf[CONFIG_NRF_RPC_GROUP_QUEUE_BUF_SIZE];
+				    /* Copy of a packet received from
+				     * a transport that frees the buffer
+				     * when the receive handler returns.
+				     */
+#endif
+};
+
+/* Maximum number of items in all group queues. Each packet passed to the
+ * thread pool has a local thread reserved by the remote side or is a command
+ * sent recursively to an asynchronous command context. Additionally, each
+ * thread from the pool may wait for a group while executing a batch.
+ */
+#define GROUP_WORK_COUNT (2 * CONFIG_NRF_RPC_THREAD_POOL_SIZE +		       \
+			  CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE)
+
+/* Pool of group queue items. */
+static struct _nrf_rpc_group_work group_work_pool[GROUP_WORK_COUNT];
+
+/* List of free group queue items. */
+static struct _nrf_rpc_group_work *group_work_free;
+
+/* Lock protecting group queues. */
+static struct nrf_rpc_os_mutex group_lock;
+
+#endif /* CONFIG_NRF_RPC_GROUP_ORDERING */
+
 /* ======================== Common utilities ======================== */
 
 static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
@@ -85,6 +194,7 @@ static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
 	ctx->handler = NULL;
 	ctx->remote_id = NRF_RPC_ID_UNKNOWN;
 	ctx->use_count = 1;
+	ctx->async = false;
 
 	nrf_rpc_os_tls_set(ctx);
 
@@ -122,6 +232,38 @@ static void cmd_ctx_release(struct nrf_rpc_cmd_ctx *ctx)
 	}
 }
 
+static struct nrf_rpc_cmd_ctx *cmd_ctx_async_alloc(nrf_rpc_handler_t handler,
+						   void *handler_data)
+{
+	struct nrf_rpc_cmd_ctx *ctx;
+	uint32_t index;
+
+	nrf_rpc_os_remote_reserve();
+
+	index = nrf_rpc_os_ctx_pool_reserve();
+
+	NRF_RPC_ASSERT(index < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE);
+
+	ctx = &cmd_ctx_pool[index];
+	ctx->handler = handler;
+	ctx->handler_data = handler_data;
+	ctx->remote_id = NRF_RPC_ID_UNKNOWN;
+	ctx->use_count = 1;
+	ctx->async = true;
+
+	NRF_RPC_DBG("Asynchronous command context %d allocated", ctx->id);
+
+	return ctx;
+}
+
+static void cmd_ctx_async_free(struct nrf_rpc_cmd_ctx *ctx)
+{
+	ctx->async = false;
+	ctx->handler = NULL;
+	nrf_rpc_os_ctx_pool_release(ctx->id);
+	nrf_rpc_os_remote_release();
+}
+
 static struct nrf_rpc_cmd_ctx *cmd_ctx_get_by_id(uint8_t id)
 {
 	if (id >= CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE) {
@@ -182,27 +324,46 @@ static inline void header_cmd_encode(uint8_t *packet, struct header *hdr)
 	packet[3] = hdr->group_id;
 }
 
-/* Function simplifying sending a short packets */
-static int simple_send(uint8_t dst, uint8_t type, uint8_t id, uint8_t group_id,
-			const uint8_t *packet, size_t len)
+/* Encode the header in front of the payload allocated with NRF_RPC_ALLOC()
+ * and send the packet. Payload is written in place, so the packet must be
+ * allocated in the calling function, because transport may allocate it on
+ * the stack.
+ */
+static int packet_commit(uint8_t dst, uint8_t type, uint8_t id,
+			 uint8_t group_id, uint8_t *packet, size_t len)
 {
 	struct header hdr;
-	uint8_t *tx_buf;
+	uint8_t *full_packet = &packet[-_NRF_RPC_HEADER_SIZE];
 
 	hdr.dst = dst;
 	hdr.type = type;
 	hdr.id = id;
 	hdr.group_id = group_id;
 
-	nrf_rpc_tr_alloc_tx_buf(&tx_buf, _NRF_RPC_HEADER_SIZE + len);
+	header_encode(full_packet, &hdr);
+
+	return nrf_rpc_tr_commit_tx_buf(full_packet,
+					_NRF_RPC_HEADER_SIZE + len);
+}
 
-	header_encode(tx_buf, &hdr);
+/* Function simplifying sending a packets without payload */
+static int simple_send(uint8_t dst, uint8_t type, uint8_t id, uint8_t group_id)
+{
+	uint8_t *packet;
 
-	if (packet != NULL && len > 0) {
-		memcpy(&tx_buf[_NRF_RPC_HEADER_SIZE], packet, len);
-	}
+	NRF_RPC_ALLOC(packet, 0);
 
-	return nrf_rpc_tr_send(tx_buf, _NRF_RPC_HEADER_SIZE + len);
+	return packet_commit(dst, type, id, group_id, packet, 0);
+}
+
+/* Release received packet buffer or inform that it can be released. */
+static void rx_buf_release(const uint8_t *full_packet)
+{
+	if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
+		nrf_rpc_os_event_set(&decode_done_event);
+	} else {
+		nrf_rpc_tr_free_rx_buf(full_packet);
+	}
 }
 
 static inline bool packet_validate(const uint8_t *packet)
@@ -216,28 +377,158 @@ static inline bool packet_validate(const uint8_t *packet)
 		       (uintptr_t)_NRF_RPC_HEADER_SIZE);
 }
 
+/* ======================== Dispatch tables ======================== */
+
+#if defined(CONFIG_NRF_RPC_DISPATCH_TABLE)
+
+/* Fill dispatch table with indexes of decoders from the array. Returns true if
+ * all decoders from the array were indexed.
+ */
+static bool dispatch_table_fill(uint8_t *table, const void *array)
+{
+	void *iter;
+	const struct _nrf_rpc_decoder *decoder;
+	uint32_t index = 0;
+
+	memset(table, DISPATCH_NO_DECODER, 0x100);
+
+	for (NRF_RPC_AUTO_ARR_FOR(iter, decoder, array,
+				 const struct _nrf_rpc_decoder)) {
+
+		/* Decoders that cannot be indexed are found by searching the
+		 * array.
+		 */
+		if (index >= DISPATCH_NO_DECODER) {
+			return false;
+		}
+
+		/* Keep the first decoder with the id, the same as searching
+		 * does.
+		 */
+		if (table[decoder->id] == DISPATCH_NO_DECODER) {
+			table[decoder->id] = index;
+		}
+
+		index++;
+	}
+
+	return true;
+}
+
+static void dispatch_tables_init(void)
+{
+	uint32_t i;
+	const struct nrf_rpc_group *group;
+
+	for (i = 0; i < group_count &&
+		    i < CONFIG_NRF_RPC_DISPATCH_TABLE_GROUPS; i++) {
+		group = &NRF_RPC_AUTO_ARR_GET(&nrf_rpc_groups_array, i,
+					     const struct nrf_rpc_group);
+		dispatch_tables[i].cmd_complete =
+			dispatch_table_fill(dispatch_tables[i].cmd,
+					    group->cmd_array);
+		dispatch_tables[i].evt_complete =
+			dispatch_table_fill(dispatch_tables[i].evt,
+					    group->evt_array);
+	}
+}
+
+/* Find decoder using group's dispatch table. Returns false if the group has
+ * no complete table and the array has to be searched when the decoder is not
+ * found in the table.
+ */
+static bool dispatch_table_find(uint8_t id, const void *array,
+				const struct nrf_rpc_group *group,
+				const struct _nrf_rpc_decoder **decoder)
+{
+	uint8_t group_id = *group->group_id;
+	const uint8_t *table;
+	bool complete;
+	uint8_t index;
+
+	*decoder = NULL;
+
+	if (group_id >= CONFIG_NRF_RPC_DISPATCH_TABLE_GROUPS) {
+		return false;
+	}
+
+	if (array == group->evt_array) {
+		table = dispatch_tables[group_id].evt;
+		complete = dispatch_tables[group_id].evt_complete;
+	} else {
+		table = dispatch_tables[group_id].cmd;
+		complete = dispatch_tables[group_id].cmd_complete;
+	}
+
+	index = table[id];
+
+	if (index == DISPATCH_NO_DECODER) {
+		return complete;
+	}
+
+	*decoder = &NRF_RPC_AUTO_ARR_GET(array, index,
+					const struct _nrf_rpc_decoder);
+
+	return true;
+}
+
+#else
+
+static inline void dispatch_tables_init(void)
+{
+}
+
+static inline bool dispatch_table_find(uint8_t id, const void *array,
+				       const struct nrf_rpc_group *group,
+				       const struct _nrf_rpc_decoder **decoder)
+{
+	*decoder = NULL;
+
+	return false;
+}
+
+#endif /* CONFIG_NRF_RPC_DISPATCH_TABLE */
+
 /* ======================== Receiving Packets ======================== */
 
-/* Find in array and execute command or event handler */
-static void handler_execute(uint8_t id, const uint8_t *packet, size_t len,
-			    const void *array,
-			    const struct nrf_rpc_group *group)
+/* Find command or event decoder in array */
+static const struct _nrf_rpc_decoder *decoder_find(
+	uint8_t id, const void *array, const struct nrf_rpc_group *group)
 {
 	void *iter;
 	const struct _nrf_rpc_decoder *decoder;
 
-	NRF_RPC_ASSERT(packet_validate(packet));
-	NRF_RPC_ASSERT(array != NULL);
+	if (dispatch_table_find(id, array, group, &decoder)) {
+		return decoder;
+	}
 
 	for (NRF_RPC_AUTO_ARR_FOR(iter, decoder, array,
 				 const struct _nrf_rpc_decoder)) {
 
 		if (id == decoder->id) {
-			decoder->handler(packet, len, decoder->handler_data);
-			return;
+			return decoder;
 		}
 	}
 
+	return NULL;
+}
+
+/* Find in array and execute command or event handler */
+static void handler_execute(uint8_t id, const uint8_t *packet, size_t len,
+			    const void *array,
+			    const struct nrf_rpc_group *group)
+{
+	const struct _nrf_rpc_decoder *decoder;
+
+	NRF_RPC_ASSERT(packet_validate(packet));
+	NRF_RPC_ASSERT(array != NULL);
+
+	decoder = decoder_find(id, array, group);
+	if (decoder != NULL) {
+		decoder->handler(packet, len, decoder->handler_data);
+		return;
+	}
+
 	nrf_rpc_decoding_done(packet);
 
 	NRF_RPC_ERR("Unknown command or event received");
@@ -258,6 +549,414 @@ static const struct nrf_rpc_group *group_from_id(uint8_t group_id)
 				    const struct nrf_rpc_group);
 }
 
+/* ======================== Group ordering ======================== */
+
+static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
+				     const uint8_t *packet, size_t len);
+
+#if defined(CONFIG_NRF_RPC_GROUP_ORDERING)
+
+static int group_queues_init(void)
+{
+	int err;
+	uint32_t i;
+	void *iter;
+	const struct nrf_rpc_group *group;
+
+	err = nrf_rpc_os_mutex_init(&group_lock);
+	if (err < 0) {
+		return err;
+	}
+
+	group_work_free = NULL;
+	for (i = 0; i < GROUP_WORK_COUNT; i++) {
+		group_work_pool[i].next = group_work_free;
+		group_work_free = &group_work_pool[i];
+	}
+
+	for (NRF_RPC_AUTO_ARR_FOR(iter, group, &nrf_rpc_groups_array,
+				 const struct nrf_rpc_group)) {
+		group->data->queue_head = NULL;
+		group->data->queue_tail = NULL;
+		group->data->busy = false;
+	}
+
+	return 0;
+}
+
+/* Add item to the group queue. Must be called with group_lock taken. */
+static struct _nrf_rpc_group_work *group_work_add(
+	struct _nrf_rpc_group_data *data)
+{
+	struct _nrf_rpc_group_work *work = group_work_free;
+
+	NRF_RPC_ASSERT(work != NULL);
+	group_work_free = work->next;
+
+	work->next = NULL;
+	work->handoff = NULL;
+
+	if (data->queue_tail == NULL) {
+		data->queue_head = work;
+	} else {
+		data->queue_tail->next = work;
+	}
+	data->queue_tail = work;
+
+	return work;
+}
+
+/* Check if packet is a copy made by packet_schedule(). */
+static bool group_work_owns(const uint8_t *full_packet)
+{
+	return (full_packet >= (const uint8_t *)&group_work_pool[0]) &&
+	       (full_packet < (const uint8_t *)&group_work_pool[
+			GROUP_WORK_COUNT]);
+}
+
+/* Pass packet to the thread pool if no other packet from the same group is
+ * being executed. Otherwise, add it to the group queue. It will be executed
+ * later by the thread that executes the group.
+ *
+ * Returns true if the packet buffer was passed further, so a transport that
+ * frees it automatically must wait until decoding is done. A queued packet
+ * is copied if the buffer is freed automatically and the packet fits into
+ * the queue item, so the receive thread does not wait for a busy group.
+ */
+static bool packet_schedule(const struct nrf_rpc_group *group,
+			    const uint8_t *packet, size_t len)
+{
+	struct _nrf_rpc_group_data *data = group->data;
+	struct _nrf_rpc_group_work *work;
+	bool passed = true;
+
+	nrf_rpc_os_mutex_lock(&group_lock);
+
+	if (!data->busy) {
+		data->busy = true;
+		nrf_rpc_os_mutex_unlock(&group_lock);
+		nrf_rpc_os_thread_pool_send(packet, len);
+		return true;
+	}
+
+	work = group_work_add(data);
+	work->packet = packet;
+	work->len = len;
+
+#if CONFIG_NRF_RPC_GROUP_QUEUE_BUF_SIZE > 0
+	if (NRF_RPC_TR_AUTO_FREE_RX_BUF &&
+	    len <= CONFIG_NRF_RPC_GROUP_QUEUE_BUF_SIZE) {
+		memcpy(work->buf, packet, len);
+		work->packet = work->buf;
+		passed = false;
+	}
+#endif
+
+	nrf_rpc_os_mutex_unlock(&group_lock);
+
+	NRF_RPC_DBG("Packet queued in group %s", group->strid);
+
+	return passed;
+}
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+
+/* Take the group for execution of a batched event in the current thread. If
+ * the group is busy, wait until the thread executing it reaches this request
+ * in the group queue and passes the group.
+ */
+static void group_acquire(const struct nrf_rpc_group *group)
+{
+	struct _nrf_rpc_group_data *data = group->data;
+	struct _nrf_rpc_group_work *work;
+	struct nrf_rpc_os_event handoff;
+
+	nrf_rpc_os_mutex_lock(&group_lock);
+
+	if (!data->busy) {
+		data->busy = true;
+		nrf_rpc_os_mutex_unlock(&group_lock);
+		return;
+	}
+
+	if (nrf_rpc_os_event_init(&handoff) < 0) {
+		NRF_RPC_ASSERT(0);
+	}
+
+	work = group_work_add(data);
+	work->handoff = &handoff;
+
+	nrf_rpc_os_mutex_unlock(&group_lock);
+
+	NRF_RPC_DBG("Waiting for group %s", group->strid);
+
+	nrf_rpc_os_event_wait(&handoff);
+}
+
+#endif /* CONFIG_NRF_RPC_BATCH */
+
+/* Execute packets from the group queue until it is empty or the group is
+ * passed to a thread waiting in group_acquire(). Must be called by the thread
+ * that has the group.
+ */
+static void group_release(const struct nrf_rpc_group *group)
+{
+	struct _nrf_rpc_group_data *data = group->data;
+	struct _nrf_rpc_group_work *work;
+	struct nrf_rpc_os_event *handoff;
+
+	while (true) {
+		nrf_rpc_os_mutex_lock(&group_lock);
+
+		work = data->queue_head;
+
+		if (work == NULL) {
+			data->busy = false;
+			nrf_rpc_os_mutex_unlock(&group_lock);
+			return;
+		}
+
+		data->queue_head = work->next;
+		if (data->queue_head == NULL) {
+			data->queue_tail = NULL;
+		}
+
+		handoff = work->handoff;
+		if (handoff != NULL) {
+			work->next = group_work_free;
+			group_work_free = work;
+		}
+
+		nrf_rpc_os_mutex_unlock(&group_lock);
+
+		if (handoff != NULL) {
+			/* Group stays busy and belongs to the waiting thread
+			 * now.
+			 */
+			nrf_rpc_os_event_set(handoff);
+			return;
+		}
+
+		parse_incoming_packet(NULL, work->packet, work->len);
+
+		/* Item is released after execution, because its buffer may
+		 * hold the packet.
+		 */
+		nrf_rpc_os_mutex_lock(&group_lock);
+		work->next = group_work_free;
+		group_work_free = work;
+		nrf_rpc_os_mutex_unlock(&group_lock);
+	}
+}
+
+#else
+
+static inline int group_queues_init(void)
+{
+	return 0;
+}
+
+static inline bool group_work_owns(const uint8_t *full_packet)
+{
+	return false;
+}
+
+static inline bool packet_schedule(const struct nrf_rpc_group *group,
+				   const uint8_t *packet, size_t len)
+{
+	nrf_rpc_os_thread_pool_send(packet, len);
+
+	return true;
+}
+
+static inline void group_acquire(const struct nrf_rpc_group *group)
+{
+}
+
+static inline void group_release(const struct nrf_rpc_group *group)
+{
+}
+
+#endif /* CONFIG_NRF_RPC_GROUP_ORDERING */
+
+/* ======================== Batching ======================== */
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+
+/* Execute all events from a batch packet and send back a batch of ACKs. */
+static void batch_execute(const uint8_t *packet, size_t len)
+{
+	int err;
+	const uint8_t *item = &packet[_NRF_RPC_HEADER_SIZE];
+	const uint8_t *end = &packet[len];
+	const struct nrf_rpc_group *group;
+	uint8_t count = packet[3];
+	uint8_t acked = 0;
+	uint8_t item_len;
+	uint8_t *ack;
+	bool malformed = false;
+
+	NRF_RPC_ALLOC(ack, count * BATCH_ITEM_HEADER_SIZE);
+
+	while (item < end) {
+
+		if (item + BATCH_ITEM_HEADER_SIZE > end ||
+		    item[0] != NRF_RPC_PACKET_TYPE_BATCH || acked >= count) {
+			malformed = true;
+			break;
+		}
+
+		item_len = item[3];
+		group = group_from_id(item[2]);
+
+		if (item + BATCH_ITEM_HEADER_SIZE + item_len > end ||
+		    group == NULL) {
+			malformed = true;
+			break;
+		}
+
+		NRF_RPC_DBG("Executing batched event 0x%02X from group 0x%02X",
+			    item[1], *group->group_id);
+
+		/* Keep order with events of the group received earlier. */
+		group_acquire(group);
+		handler_execute(item[1], &item[BATCH_ITEM_HEADER_SIZE],
+				item_len, group->evt_array, group);
+		group_release(group);
+
+		memcpy(&ack[acked * BATCH_ITEM_HEADER_SIZE], item,
+		       BATCH_ITEM_HEADER_SIZE - 1);
+		ack[acked * BATCH_ITEM_HEADER_SIZE + 3] = 0;
+		acked++;
+
+		item += BATCH_ITEM_HEADER_SIZE + item_len;
+	}
+
+	rx_buf_release(packet);
+
+	/* ACK is always sent, because it releases remote thread reserved
+	 * for the entire batch.
+	 */
+	err = packet_commit(NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_BATCH,
+			    NRF_RPC_PACKET_TYPE_ACK, acked, ack,
+			    acked * BATCH_ITEM_HEADER_SIZE);
+	if (err < 0) {
+		NRF_RPC_ERR("ACK send error");
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, NULL,
+			    NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_BATCH);
+	}
+
+	if (malformed) {
+		NRF_RPC_ERR("Malformed batch packet");
+		nrf_rpc_err(-NRF_EBADMSG, NRF_RPC_ERR_SRC_RECV, NULL,
+			    NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_BATCH);
+	}
+}
+
+/* Handle a batch of ACKs received for previously sent batch of events. */
+static void batch_ack_handle(const uint8_t *packet, size_t len)
+{
+	const uint8_t *item = &packet[_NRF_RPC_HEADER_SIZE];
+	const uint8_t *end = &packet[len];
+	const struct nrf_rpc_group *group;
+
+	nrf_rpc_os_remote_release();
+
+	for (; item + BATCH_ITEM_HEADER_SIZE <= end;
+	     item += BATCH_ITEM_HEADER_SIZE) {
+		group = group_from_id(item[2]);
+		if (group != NULL && group->ack_handler != NULL) {
+			group->ack_handler(item[1], group->ack_handler_data);
+		}
+	}
+}
+
+/* Send collected batch. Must be called with batch_lock taken. */
+static int batch_flush_locked(void)
+{
+	int err;
+	uint8_t *packet;
+	size_t len = batch_len;
+	uint8_t count = batch_count;
+
+	if (count == 0) {
+		return 0;
+	}
+
+	NRF_RPC_DBG("Sending batch of %d events", count);
+
+	NRF_RPC_ALLOC(packet, len);
+	memcpy(packet, batch_buf, len);
+
+	/* Batch is emptied before sending, because the lock is recursive and
+	 * the transport may call a decoder that batches another event.
+	 */
+	batch_len = 0;
+	batch_count = 0;
+
+#if CONFIG_NRF_RPC_BATCH_TIMEOUT > 0
+	nrf_rpc_os_timer_stop(&batch_timer);
+#endif
+
+	err = packet_commit(NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_BATCH,
+			    NRF_RPC_PACKET_TYPE_EVT, count, packet, len);
+	if (err < 0) {
+		nrf_rpc_os_remote_release();
+	}
+
+	return err;
+}
+
+static int batch_flush(void)
+{
+	int err;
+
+	nrf_rpc_os_mutex_lock(&batch_lock);
+	err = batch_flush_locked();
+	nrf_rpc_os_mutex_unlock(&batch_lock);
+
+	return err;
+}
+
+#if CONFIG_NRF_RPC_BATCH_TIMEOUT > 0
+static void batch_timeout(struct nrf_rpc_os_timer *timer)
+{
+	int err;
+
+	err = batch_flush();
+	if (err < 0) {
+		NRF_RPC_ERR("Batch send error %d", err);
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, NULL, NRF_RPC_ID_UNKNOWN,
+			    NRF_RPC_PACKET_TYPE_BATCH);
+	}
+}
+#endif /* CONFIG_NRF_RPC_BATCH_TIMEOUT > 0 */
+
+#else
+
+static inline int batch_flush(void)
+{
+	return 0;
+}
+
+#endif /* CONFIG_NRF_RPC_BATCH */
+
+/* Send the collected batch before a packet that must not overtake it. Error
+ * of sending the batch is reported to the error handler, because it does not
+ * belong to the packet being sent.
+ */
+static void batch_flush_before_send(void)
+{
+	int err;
+
+	err = batch_flush();
+	if (err < 0) {
+		NRF_RPC_ERR("Batch send error %d", err);
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, NULL, NRF_RPC_ID_UNKNOWN,
+			    NRF_RPC_PACKET_TYPE_BATCH);
+	}
+}
+
 /* Parse incoming packet and execute if needed. */
 static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 				     const uint8_t *packet, size_t len)
@@ -284,6 +983,14 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 		return hdr.type;
 	}
 
+#if defined(CONFIG_NRF_RPC_BATCH)
+	if (hdr.type == NRF_RPC_PACKET_TYPE_BATCH) {
+		NRF_RPC_ASSERT(cmd_ctx == NULL);
+		batch_execute(packet, len);
+		return hdr.type;
+	}
+#endif /* CONFIG_NRF_RPC_BATCH */
+
 	group = group_from_id(hdr.group_id);
 
 	/* It was already validated in receive handler, so ASSERT is enough. */
@@ -314,7 +1021,7 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 				len - _NRF_RPC_HEADER_SIZE, group->evt_array,
 				group);
 		err = simple_send(NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_ACK,
-				  hdr.id, *group->group_id, NULL, 0);
+				  hdr.id, *group->group_id);
 		if (err < 0) {
 			NRF_RPC_ERR("ACK send error");
 			nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, group, hdr.id,
@@ -334,7 +1041,35 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 /* Thread pool callback */
 static void execute_packet(const uint8_t *packet, size_t len)
 {
+	const struct nrf_rpc_group *group = NULL;
+
+	/* Batch may contain events from many groups, so the group of each
+	 * event is taken separately during execution of the batch.
+	 */
+	if (packet[0] != NRF_RPC_PACKET_TYPE_BATCH) {
+		group = group_from_id(packet[3]);
+	}
+
 	parse_incoming_packet(NULL, packet, len);
+
+	if (group != NULL) {
+		group_release(group);
+	}
+}
+
+/* Pass response to the handler of asynchronous command and complete it. */
+static void async_response_handle(struct nrf_rpc_cmd_ctx *cmd_ctx,
+				  const uint8_t *packet, size_t len)
+{
+	NRF_RPC_DBG("Asynchronous response received");
+
+	if (cmd_ctx->handler != NULL) {
+		cmd_ctx->handler(&packet[_NRF_RPC_HEADER_SIZE],
+				 len - _NRF_RPC_HEADER_SIZE,
+				 cmd_ctx->handler_data);
+	}
+
+	cmd_ctx_async_free(cmd_ctx);
 }
 
 /* Callback from transport layer that handles incoming. */
@@ -366,7 +1101,7 @@ static void receive_handler(const uint8_t *packet, size_t len)
 	}
 
 	NRF_RPC_DBG("Received %d bytes packet from %d to %d, type 0x%02X, "
-		    "cmd/evt/cnt 0x%02X, grp %d (%s)", len, hdr.src, hdr.dst,
+		    "cmd/evt/cnt 0x%02X, grp %d (%s)", (int)len, hdr.src, hdr.dst,
 		    hdr.type, hdr.id, hdr.group_id,
 		    (group != NULL) ? group->strid : "unknown");
 
@@ -392,6 +1127,22 @@ static void receive_handler(const uint8_t *packet, size_t len)
 			goto cleanup_and_exit;
 		}
 
+		if (cmd_ctx->async) {
+			if (hdr.type == NRF_RPC_PACKET_TYPE_RSP) {
+				async_response_handle(cmd_ctx, packet, len);
+				goto cleanup_and_exit;
+			}
+
+			/* No thread is waiting on asynchronous context, so
+			 * command is executed by the thread pool.
+			 */
+			if (packet_schedule(group, packet, len) &&
+			    NRF_RPC_TR_AUTO_FREE_RX_BUF) {
+				nrf_rpc_os_event_wait(&decode_done_event);
+			}
+			return;
+		}
+
 		if (cmd_ctx->handler != NULL &&
 		    hdr.type == NRF_RPC_PACKET_TYPE_RSP &&
 		    NRF_RPC_TR_AUTO_FREE_RX_BUF) {
@@ -415,8 +1166,8 @@ static void receive_handler(const uint8_t *packet, size_t len)
 
 	case NRF_RPC_PACKET_TYPE_EVT:
 		/* or NRF_RPC_PACKET_TYPE_CMD with unknown destination. */
-		nrf_rpc_os_thread_pool_send(packet, len);
-		if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
+		if (packet_schedule(group, packet, len) &&
+		    NRF_RPC_TR_AUTO_FREE_RX_BUF) {
 			nrf_rpc_os_event_wait(&decode_done_event);
 		}
 		return;
@@ -453,8 +1204,29 @@ static void receive_handler(const uint8_t *packet, size_t len)
 			NRF_RPC_DBG("Groups checksum matching");
 
 		}
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+		if (len >= _NRF_RPC_HEADER_SIZE + sizeof(uint32_t) + 1) {
+			remote_features = packet[_NRF_RPC_HEADER_SIZE +
+						 sizeof(uint32_t)];
+		}
+#endif /* CONFIG_NRF_RPC_BATCH */
 		break;
 
+#if defined(CONFIG_NRF_RPC_BATCH)
+	case NRF_RPC_PACKET_TYPE_BATCH:
+		if (hdr.id == NRF_RPC_PACKET_TYPE_ACK) {
+			batch_ack_handle(packet, len);
+			break;
+		}
+
+		nrf_rpc_os_thread_pool_send(packet, len);
+		if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
+			nrf_rpc_os_event_wait(&decode_done_event);
+		}
+		return;
+#endif /* CONFIG_NRF_RPC_BATCH */
+
 	default:
 		NRF_RPC_ERR("Invalid type of packet received");
 		err = -NRF_EBADMSG;
@@ -477,11 +1249,17 @@ void nrf_rpc_decoding_done(const uint8_t *packet)
 	const uint8_t *full_packet = &packet[-_NRF_RPC_HEADER_SIZE];
 
 	if (packet != NULL) {
-		if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
-			nrf_rpc_os_event_set(&decode_done_event);
-		} else {
-			nrf_rpc_tr_free_rx_buf(full_packet);
+		/* Copy of a queued packet is released with its queue item. */
+		if (group_work_owns(full_packet)) {
+			return;
+		}
+#if defined(CONFIG_NRF_RPC_BATCH)
+		/* Batch is released after all its events are executed. */
+		if (full_packet[0] == NRF_RPC_PACKET_TYPE_BATCH) {
+			return;
 		}
+#endif /* CONFIG_NRF_RPC_BATCH */
+		rx_buf_release(full_packet);
 	}
 }
 
@@ -583,7 +1361,11 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 	NRF_RPC_DBG("Sending command 0x%02X from group 0x%02X", cmd,
 		    *group->group_id);
 
-	err = nrf_rpc_tr_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+	/* Keep order with events that were batched before the command. */
+	batch_flush_before_send();
+
+	err = nrf_rpc_tr_commit_tx_buf(full_packet,
+				       len + _NRF_RPC_HEADER_SIZE);
 
 	if (err >= 0) {
 		wait_for_response(cmd_ctx, rsp_packet, rsp_len);
@@ -612,6 +1394,60 @@ void nrf_rpc_cmd_common_no_err(const struct nrf_rpc_group *group, uint32_t cmd,
 }
 
 
+int nrf_rpc_cmd_async(const struct nrf_rpc_group *group, uint8_t cmd,
+		      uint8_t *packet, size_t len, nrf_rpc_handler_t handler,
+		      void *handler_data)
+{
+	int err;
+	struct header hdr;
+	uint8_t *full_packet = &packet[-_NRF_RPC_HEADER_SIZE];
+	struct nrf_rpc_cmd_ctx *cmd_ctx;
+
+	NRF_RPC_ASSERT(group != NULL);
+	NRF_RPC_ASSERT(cmd != NRF_RPC_ID_UNKNOWN);
+	NRF_RPC_ASSERT(packet_validate(packet));
+
+	cmd_ctx = cmd_ctx_async_alloc(handler, handler_data);
+
+	/* Asynchronous command is always executed by a new thread from the
+	 * remote thread pool.
+	 */
+	hdr.dst = NRF_RPC_ID_UNKNOWN;
+	hdr.src = cmd_ctx->id;
+	hdr.id = cmd;
+	hdr.group_id = *group->group_id;
+	header_cmd_encode(full_packet, &hdr);
+
+	NRF_RPC_DBG("Sending asynchronous command 0x%02X from group 0x%02X",
+		    cmd, *group->group_id);
+
+	batch_flush_before_send();
+
+	err = nrf_rpc_tr_commit_tx_buf(full_packet,
+				       len + _NRF_RPC_HEADER_SIZE);
+
+	if (err < 0) {
+		cmd_ctx_async_free(cmd_ctx);
+	}
+
+	return err;
+}
+
+void nrf_rpc_cmd_async_no_err(const struct nrf_rpc_group *group, uint8_t cmd,
+			      uint8_t *packet, size_t len,
+			      nrf_rpc_handler_t handler, void *handler_data)
+{
+	int err;
+
+	err = nrf_rpc_cmd_async(group, cmd, packet, len, handler,
+				handler_data);
+	if (err < 0) {
+		NRF_RPC_ERR("Unhandled command send error %d", err);
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, group, cmd,
+			    NRF_RPC_PACKET_TYPE_CMD);
+	}
+}
+
 /* ======================== Event sending ======================== */
 
 int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
@@ -634,9 +1470,13 @@ int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
 	NRF_RPC_DBG("Sending event 0x%02X from group 0x%02X", evt,
 		    *group->group_id);
 
+	/* Keep order of events if some of them were batched. */
+	batch_flush_before_send();
+
 	nrf_rpc_os_remote_reserve();
 
-	err = nrf_rpc_tr_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+	err = nrf_rpc_tr_commit_tx_buf(full_packet,
+				       len + _NRF_RPC_HEADER_SIZE);
 
 	if (err < 0) {
 		nrf_rpc_os_remote_release();
@@ -658,6 +1498,90 @@ void nrf_rpc_evt_no_err(const struct nrf_rpc_group *group, uint8_t evt,
 	}
 }
 
+/* ======================== Event batching ======================== */
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+
+int nrf_rpc_evt_batched(const struct nrf_rpc_group *group, uint8_t evt,
+			uint8_t *packet, size_t len)
+{
+	int err = 0;
+	uint8_t *item;
+
+	NRF_RPC_ASSERT(group != NULL);
+	NRF_RPC_ASSERT(evt != NRF_RPC_ID_UNKNOWN);
+	NRF_RPC_ASSERT(packet_validate(packet));
+
+	if (!(remote_features & FEATURE_BATCH) || len > UINT8_MAX ||
+	    len + BATCH_ITEM_HEADER_SIZE > CONFIG_NRF_RPC_BATCH_SIZE) {
+		return nrf_rpc_evt(group, evt, packet, len);
+	}
+
+	nrf_rpc_os_mutex_lock(&batch_lock);
+
+	if (batch_len + BATCH_ITEM_HEADER_SIZE + len >
+	    CONFIG_NRF_RPC_BATCH_SIZE) {
+		err = batch_flush_locked();
+		if (err < 0) {
+			NRF_RPC_DISCARD(packet);
+			goto unlock_and_exit;
+		}
+	}
+
+	/* Entire batch is executed by one thread from the remote pool. */
+	if (batch_count == 0) {
+		nrf_rpc_os_remote_reserve();
+#if CONFIG_NRF_RPC_BATCH_TIMEOUT > 0
+		nrf_rpc_os_timer_start(&batch_timer,
+				       CONFIG_NRF_RPC_BATCH_TIMEOUT);
+#endif
+	}
+
+	NRF_RPC_DBG("Batching event 0x%02X from group 0x%02X", evt,
+		    *group->group_id);
+
+	item = &batch_buf[batch_len];
+	item[0] = NRF_RPC_PACKET_TYPE_BATCH;
+	item[1] = evt;
+	item[2] = *group->group_id;
+	item[3] = len;
+	memcpy(&item[BATCH_ITEM_HEADER_SIZE], packet, len);
+
+	batch_len += BATCH_ITEM_HEADER_SIZE + len;
+	batch_count++;
+
+	NRF_RPC_DISCARD(packet);
+
+	if (batch_count >= CONFIG_NRF_RPC_BATCH_COUNT) {
+		err = batch_flush_locked();
+	}
+
+unlock_and_exit:
+	nrf_rpc_os_mutex_unlock(&batch_lock);
+
+	return err;
+}
+
+void nrf_rpc_evt_batched_no_err(const struct nrf_rpc_group *group, uint8_t evt,
+				uint8_t *packet, size_t len)
+{
+	int err;
+
+	err = nrf_rpc_evt_batched(group, evt, packet, len);
+	if (err < 0) {
+		NRF_RPC_ERR("Unhandled event send error %d", err);
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, group, evt,
+			    NRF_RPC_PACKET_TYPE_EVT);
+	}
+}
+
+int nrf_rpc_batch_flush(void)
+{
+	return batch_flush();
+}
+
+#endif /* CONFIG_NRF_RPC_BATCH */
+
 /* ======================== Response sending ======================== */
 
 int nrf_rpc_rsp(uint8_t *packet, size_t len)
@@ -679,7 +1603,10 @@ int nrf_rpc_rsp(uint8_t *packet, size_t len)
 
 	NRF_RPC_DBG("Sending response");
 
-	err = nrf_rpc_tr_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+	batch_flush_before_send();
+
+	err = nrf_rpc_tr_commit_tx_buf(full_packet,
+				       len + _NRF_RPC_HEADER_SIZE);
 
 	return err;
 }
@@ -706,6 +1633,7 @@ int nrf_rpc_init(nrf_rpc_err_handler_t err_handler)
 	const struct nrf_rpc_group *group;
 	uint8_t group_id = 0;
 	const char *strid_ptr;
+	uint8_t *packet;
 
 	NRF_RPC_DBG("Initializing nRF RPC module");
 
@@ -732,6 +1660,14 @@ int nrf_rpc_init(nrf_rpc_err_handler_t err_handler)
 
 	memset(&cmd_ctx_pool, 0, sizeof(cmd_ctx_pool));
 
+	dispatch_tables_init();
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+	remote_features = 0;
+	batch_len = 0;
+	batch_count = 0;
+#endif /* CONFIG_NRF_RPC_BATCH */
+
 	err = nrf_rpc_os_init(execute_packet);
 	if (err < 0) {
 		return err;
@@ -744,6 +1680,25 @@ int nrf_rpc_init(nrf_rpc_err_handler_t err_handler)
 		}
 	}
 
+	err = group_queues_init();
+	if (err < 0) {
+		return err;
+	}
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+	err = nrf_rpc_os_mutex_init(&batch_lock);
+	if (err < 0) {
+		return err;
+	}
+
+#if CONFIG_NRF_RPC_BATCH_TIMEOUT > 0
+	err = nrf_rpc_os_timer_init(&batch_timer, batch_timeout);
+	if (err < 0) {
+		return err;
+	}
+#endif
+#endif /* CONFIG_NRF_RPC_BATCH */
+
 	for (i = 0; i < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE; i++) {
 		cmd_ctx_pool[i].id = i;
 		err = nrf_rpc_os_msg_init(&cmd_ctx_pool[i].recv_msg);
@@ -757,10 +1712,15 @@ int nrf_rpc_init(nrf_rpc_err_handler_t err_handler)
 		return err;
 	}
 
-	err = simple_send(NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_INIT,
-			  CONFIG_NRF_RPC_THREAD_POOL_SIZE, NRF_RPC_ID_UNKNOWN,
-			  (uint8_t *)(&groups_check_sum),
-			  sizeof(groups_check_sum));
+	NRF_RPC_ALLOC(packet, INIT_PAYLOAD_SIZE);
+	*(uint32_t *)packet = groups_check_sum;
+#if defined(CONFIG_NRF_RPC_BATCH)
+	packet[sizeof(groups_check_sum)] = FEATURE_BATCH;
+#endif /* CONFIG_NRF_RPC_BATCH */
+
+	err = packet_commit(NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_INIT,
+			    CONFIG_NRF_RPC_THREAD_POOL_SIZE, NRF_RPC_ID_UNKNOWN,
+			    packet, INIT_PAYLOAD_SIZE);
 
 	NRF_RPC_DBG("Done initializing nRF RPC module");
 
@@ -773,6 +1733,7 @@ void nrf_rpc_err(int code, enum nrf_rpc_err_src src,
 		 uint8_t packet_type)
 {
 	struct nrf_rpc_err_report report;
+	uint8_t *packet;
 	uint8_t group_id = (group != NULL) ? *group->group_id :
 			   NRF_RPC_ID_UNKNOWN;
 
@@ -783,8 +1744,10 @@ void nrf_rpc_err(int code, enum nrf_rpc_err_src src,
 		    packet_type);
 
 	if (src == NRF_RPC_ERR_SRC_RECV) {
-		simple_send(packet_type, NRF_RPC_PACKET_TYPE_ERR, id, group_id,
-			    (const uint8_t *)&code, sizeof(code));
+		NRF_RPC_ALLOC(packet, sizeof(code));
+		*(int *)packet = code;
+		packet_commit(packet_type, NRF_RPC_PACKET_TYPE_ERR, id,
+			      group_id, packet, sizeof(code));
 	}
 
 	report.code = code;
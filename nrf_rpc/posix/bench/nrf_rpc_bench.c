@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Benchmark of nRF RPC command round trip.
+ *
+ * With the loopback transport local and remote side are the same process, so
+ * the measured time contains overhead of both sides without any transport
+ * latency. With the socket transport the process forks and the child process
+ * executes the commands received over a socket pair. The benchmark reports
+ * operations per second, 50th and 99th percentile of the operation time and
+ * the number of transport buffer allocations per operation.
+ *
+ * Operations are split between the given number of threads sending in
+ * parallel. Mode selects what an operation is:
+ * - cmd - command with the payload, response echoes the payload back,
+ * - rsp - empty command, response carries the payload,
+ * - evt - event with the payload. Time of sending it is measured and
+ *         the total time includes waiting until all events are executed.
+ *
+ * BENCH_GROUP_DECODERS adds decoders that are never called to the benchmark
+ * group, so that the dispatch latency can be compared against the group size.
+ * The echo decoder is placed after them in the decoder array, which is the
+ * worst case for searching the array.
+ *
+ * Usage: nrf_rpc_bench [number_of_operations] [payload_size] [threads]
+ *                      [cmd|rsp|evt]
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+
+#define BENCH_CMD_ECHO          0x01
+#define BENCH_CMD_PULL          0x02
+#define BENCH_CMD_COUNT         0x03
+#define BENCH_EVT_DATA          0x01
+#define BENCH_DEFAULT_COUNT     10000
+#define BENCH_DEFAULT_PAYLOAD   16
+#define BENCH_DEFAULT_THREADS   1
+#define BENCH_MAX_PAYLOAD       65536
+
+/* Each command in flight takes a context on both sides of the loopback,
+ * which share the pool.
+ */
+#if defined(NRF_RPC_TR_SOCKET_H_)
+#define BENCH_MAX_THREADS CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE
+#else
+#define BENCH_MAX_THREADS (CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE / 2)
+#endif
+
+enum bench_mode {
+	BENCH_MODE_CMD,
+	BENCH_MODE_RSP,
+	BENCH_MODE_EVT,
+};
+
+static const char *const mode_names[] = {
+	[BENCH_MODE_CMD] = "cmd",
+	[BENCH_MODE_RSP] = "rsp",
+	[BENCH_MODE_EVT] = "evt",
+};
+
+struct bench_thread {
+	pthread_t thread;
+	uint32_t first;
+	uint32_t last;
+	int err;
+};
+
+static enum bench_mode mode = BENCH_MODE_CMD;
+static uint32_t payload_size = BENCH_DEFAULT_PAYLOAD;
+static uint64_t *samples;
+
+/* Number of events executed by the remote side. */
+static uint32_t received_events;
+
+NRF_RPC_GROUP_DEFINE(bench_group, "bench", NULL, NULL, NULL);
+
+static void echo_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint8_t *rsp;
+
+	(void)handler_data;
+
+	NRF_RPC_ALLOC(rsp, len);
+	memcpy(rsp, packet, len);
+	nrf_rpc_decoding_done(packet);
+
+	nrf_rpc_rsp_no_err(rsp, len);
+}
+
+NRF_RPC_CMD_DECODER(bench_group, bench_echo, BENCH_CMD_ECHO, echo_handler,
+		    NULL);
+
+/* Responds with the number of bytes requested in the command. */
+static void pull_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint32_t size;
+	uint8_t *rsp;
+
+	(void)handler_data;
+
+	memcpy(&size, packet, sizeof(size));
+	nrf_rpc_decoding_done(packet);
+
+	NRF_RPC_ALLOC(rsp, size);
+	memset(rsp, (uint8_t)size, size);
+
+	nrf_rpc_rsp_no_err(rsp, size);
+}
+
+NRF_RPC_CMD_DECODER(bench_group, bench_pull, BENCH_CMD_PULL, pull_handler,
+		    NULL);
+
+static void data_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	(void)len;
+	(void)handler_data;
+
+	nrf_rpc_decoding_done(packet);
+
+	__atomic_fetch_add(&received_events, 1, __ATOMIC_RELEASE);
+}
+
+NRF_RPC_EVT_DECODER(bench_group, bench_data, BENCH_EVT_DATA, data_handler,
+		    NULL);
+
+/* Waits until the given number of events is executed and responds with the
+ * number of executed events. Events are executed by other threads from the
+ * pool.
+ */
+static void count_handler(const uint8_t *packet, size_t len,
+			  void *handler_data)
+{
+	uint32_t expected;
+	uint32_t count;
+	uint8_t *rsp;
+
+	(void)handler_data;
+
+	memcpy(&expected, packet, sizeof(expected));
+	nrf_rpc_decoding_done(packet);
+
+	while ((count = __atomic_load_n(&received_events, __ATOMIC_ACQUIRE)) <
+	       expected) {
+		usleep(100);
+	}
+
+	NRF_RPC_ALLOC(rsp, sizeof(count));
+	memcpy(rsp, &count, sizeof(count));
+
+	nrf_rpc_rsp_no_err(rsp, sizeof(count));
+}
+
+NRF_RPC_CMD_DECODER(bench_group, bench_count, BENCH_CMD_COUNT, count_handler,
+		    NULL);
+
+#if !defined(BENCH_GROUP_DECODERS)
+#define BENCH_GROUP_DECODERS 0
+#endif
+
+#if BENCH_GROUP_DECODERS >= 16
+static void filler_handler(const uint8_t *packet, size_t len,
+			   void *handler_data)
+{
+	(void)len;
+	(void)handler_data;
+
+	nrf_rpc_decoding_done(packet);
+}
+
+/* Decoder names sort before "bench_echo", so the fillers come first. */
+#define BENCH_FILLER(_id)						       \
+	NRF_RPC_CMD_DECODER(bench_group, bench_a_##_id, 0x##_id,	       \
+			    filler_handler, NULL)
+
+#define BENCH_FILLER_16(_hi)						       \
+	BENCH_FILLER(_hi##0); BENCH_FILLER(_hi##1); BENCH_FILLER(_hi##2);      \
+	BENCH_FILLER(_hi##3); BENCH_FILLER(_hi##4); BENCH_FILLER(_hi##5);      \
+	BENCH_FILLER(_hi##6); BENCH_FILLER(_hi##7); BENCH_FILLER(_hi##8);      \
+	BENCH_FILLER(_hi##9); BENCH_FILLER(_hi##a); BENCH_FILLER(_hi##b);      \
+	BENCH_FILLER(_hi##c); BENCH_FILLER(_hi##d); BENCH_FILLER(_hi##e);      \
+	BENCH_FILLER(_hi##f)
+
+BENCH_FILLER_16(1);
+#endif
+#if BENCH_GROUP_DECODERS >= 32
+BENCH_FILLER_16(2);
+#endif
+#if BENCH_GROUP_DECODERS >= 64
+BENCH_FILLER_16(3);
+BENCH_FILLER_16(4);
+#endif
+#if BENCH_GROUP_DECODERS >= 128
+BENCH_FILLER_16(5);
+BENCH_FILLER_16(6);
+BENCH_FILLER_16(7);
+BENCH_FILLER_16(8);
+#endif
+#if BENCH_GROUP_DECODERS >= 224
+BENCH_FILLER_16(9);
+BENCH_FILLER_16(a);
+BENCH_FILLER_16(b);
+BENCH_FILLER_16(c);
+BENCH_FILLER_16(d);
+BENCH_FILLER_16(e);
+#endif
+
+static uint64_t time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static int run_one(uint32_t i)
+{
+	int err;
+	uint8_t *packet;
+	const uint8_t *rsp;
+	size_t rsp_len;
+	uint32_t size = payload_size;
+
+	switch (mode) {
+	case BENCH_MODE_CMD:
+		NRF_RPC_ALLOC(packet, size);
+		memset(packet, (uint8_t)i, size);
+		err = nrf_rpc_cmd_rsp(&bench_group, BENCH_CMD_ECHO, packet,
+				      size, &rsp, &rsp_len);
+		if (err >= 0 && (rsp_len != size ||
+				 (size > 0 && rsp[0] != (uint8_t)i))) {
+			err = -NRF_EBADMSG;
+		}
+		break;
+
+	case BENCH_MODE_RSP:
+		NRF_RPC_ALLOC(packet, sizeof(size));
+		memcpy(packet, &size, sizeof(size));
+		err = nrf_rpc_cmd_rsp(&bench_group, BENCH_CMD_PULL, packet,
+				      sizeof(size), &rsp, &rsp_len);
+		if (err >= 0 && rsp_len != size) {
+			err = -NRF_EBADMSG;
+		}
+		break;
+
+	case BENCH_MODE_EVT:
+		NRF_RPC_ALLOC(packet, size);
+		memset(packet, (uint8_t)i, size);
+		return nrf_rpc_evt(&bench_group, BENCH_EVT_DATA, packet, size);
+
+	default:
+		return -NRF_EINVAL;
+	}
+
+	if (err >= 0) {
+		nrf_rpc_decoding_done(rsp);
+	}
+
+	return err;
+}
+
+static void *thread_entry(void *arg)
+{
+	struct bench_thread *ctx = arg;
+	uint32_t i;
+	uint64_t start;
+
+	for (i = ctx->first; i < ctx->last; i++) {
+		start = time_ns();
+
+		ctx->err = run_one(i);
+		if (ctx->err < 0) {
+			fprintf(stderr, "Operation %u failed: %d\n", i, ctx->err);
+			break;
+		}
+
+		samples[i] = time_ns() - start;
+	}
+
+	return NULL;
+}
+
+/* Waits until the remote side executes all sent events. */
+static int wait_for_events(uint32_t expected)
+{
+	int err;
+	uint8_t *packet;
+	const uint8_t *rsp;
+	size_t rsp_len;
+	uint32_t count;
+
+	NRF_RPC_ALLOC(packet, sizeof(expected));
+	memcpy(packet, &expected, sizeof(expected));
+
+	err = nrf_rpc_cmd_rsp(&bench_group, BENCH_CMD_COUNT, packet,
+			      sizeof(expected), &rsp, &rsp_len);
+	if (err < 0) {
+		return err;
+	}
+
+	memcpy(&count, rsp, sizeof(count));
+	nrf_rpc_decoding_done(rsp);
+
+	return (count == expected) ? 0 : -NRF_EBADMSG;
+}
+
+static int parse_mode(const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(mode_names) / sizeof(mode_names[0]); i++) {
+		if (strcmp(name, mode_names[i]) == 0) {
+			mode = (enum bench_mode)i;
+			return 0;
+		}
+	}
+
+	return -NRF_EINVAL;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [number_of_operations] [payload_size] [threads] "
+		"[cmd|rsp|evt]\n"
+		"  payload_size: 0..%u, threads: 1..%u\n",
+		name, BENCH_MAX_PAYLOAD, BENCH_MAX_THREADS);
+}
+
+int main(int argc, char **argv)
+{
+	int err;
+	uint32_t i;
+	uint32_t count = BENCH_DEFAULT_COUNT;
+	uint32_t threads = BENCH_DEFAULT_THREADS;
+	struct bench_thread ctx[BENCH_MAX_THREADS];
+	uint64_t total;
+	struct nrf_rpc_tr_stats stats;
+
+	if (argc > 1) {
+		count = strtoul(argv[1], NULL, 0);
+	}
+
+	if (argc > 2) {
+		payload_size = strtoul(argv[2], NULL, 0);
+	}
+
+	if (argc > 3) {
+		threads = strtoul(argv[3], NULL, 0);
+	}
+
+	if (argc > 4 && parse_mode(argv[4]) < 0) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (count == 0 || payload_size > BENCH_MAX_PAYLOAD || threads == 0 ||
+	    threads > BENCH_MAX_THREADS || threads > count) {
+		usage(argv[0]);
+		return 1;
+	}
+
+#if defined(NRF_RPC_TR_SOCKET_H_)
+	int fds[2];
+	pid_t remote;
+
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+		return 1;
+	}
+
+	remote = fork();
+	if (remote == 0) {
+		/* Remote side executes commands until the parent kills it. */
+		close(fds[0]);
+		nrf_rpc_tr_socket_set(fds[1]);
+		if (nrf_rpc_init(NULL) < 0) {
+			return 1;
+		}
+		while (true) {
+			pause();
+		}
+	}
+
+	close(fds[1]);
+	nrf_rpc_tr_socket_set(fds[0]);
+#endif
+
+	samples = malloc(count * sizeof(samples[0]));
+	if (samples == NULL) {
+		return 1;
+	}
+
+	err = nrf_rpc_init(NULL);
+	if (err < 0) {
+		fprintf(stderr, "nrf_rpc_init failed: %d\n", err);
+		return 1;
+	}
+
+	nrf_rpc_tr_stats_reset();
+
+	total = time_ns();
+
+	for (i = 0; i < threads; i++) {
+		ctx[i].first = (uint64_t)count * i / threads;
+		ctx[i].last = (uint64_t)count * (i + 1) / threads;
+		ctx[i].err = 0;
+		if (pthread_create(&ctx[i].thread, NULL, thread_entry,
+				   &ctx[i]) != 0) {
+			return 1;
+		}
+	}
+
+	for (i = 0; i < threads; i++) {
+		pthread_join(ctx[i].thread, NULL);
+		if (ctx[i].err < 0) {
+			return 1;
+		}
+	}
+
+	if (mode == BENCH_MODE_EVT) {
+		err = wait_for_events(count);
+		if (err < 0) {
+			fprintf(stderr, "Events lost: %d\n", err);
+			return 1;
+		}
+	}
+
+	total = time_ns() - total;
+
+	nrf_rpc_tr_stats_get(&stats);
+
+	qsort(samples, count, sizeof(samples[0]), compare_u64);
+
+	printf("mode:                %s\n", mode_names[mode]);
+	printf("payload size:        %u\n", payload_size);
+	printf("threads:             %u\n", threads);
+	printf("group decoders:      %u\n", BENCH_GROUP_DECODERS + 3);
+	printf("operations:          %u\n", count);
+	printf("operations/s:        %.0f\n", count * 1e9 / total);
+	printf("p50 operation time:  %.2f us\n", samples[count / 2] / 1e3);
+	printf("p99 operation time:  %.2f us\n",
+	       samples[(uint64_t)count * 99 / 100] / 1e3);
+	printf("allocs/operation:    %.2f\n", (double)stats.allocs / count);
+	printf("packets/operation:   %.2f\n", (double)stats.packets / count);
+	printf("bytes/operation:     %.2f\n", (double)stats.bytes / count);
+
+	free(samples);
+
+#if defined(NRF_RPC_TR_SOCKET_H_)
+	/* Stop receiving before the remote side exits, so that closing of
+	 * the socket is not reported as an error on any side.
+	 */
+	nrf_rpc_tr_socket_stop();
+	kill(remote, SIGTERM);
+	waitpid(remote, NULL, 0);
+	close(fds[0]);
+#endif
+
+	return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Benchmark of pipelined asynchronous commands.
+ *
+ * A single thread keeps up to `depth` asynchronous commands in flight and
+ * sends the next one as soon as a response frees a slot. The benchmark
+ * reports commands per second for each pipeline depth from 1 up to the
+ * given maximum, doubling it every step, so that the throughput can be
+ * compared against depth 1, which is equivalent to a blocking command.
+ *
+ * Usage: nrf_rpc_bench_async [number_of_commands] [max_depth]
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+
+#define BENCH_CMD_ECHO      0x01
+#define BENCH_PAYLOAD_SIZE  16
+#define BENCH_DEFAULT_COUNT 10000
+#define BENCH_DEFAULT_DEPTH 8
+
+NRF_RPC_GROUP_DEFINE(bench_group, "bench", NULL, NULL, NULL);
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static uint32_t in_flight;
+static uint32_t completed;
+
+static void echo_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint8_t *rsp;
+
+	(void)handler_data;
+
+	NRF_RPC_ALLOC(rsp, len);
+	memcpy(rsp, packet, len);
+	nrf_rpc_decoding_done(packet);
+
+	nrf_rpc_rsp_no_err(rsp, len);
+}
+
+NRF_RPC_CMD_DECODER(bench_group, bench_echo, BENCH_CMD_ECHO, echo_handler,
+		    NULL);
+
+static void response_handler(const uint8_t *packet, size_t len,
+			     void *handler_data)
+{
+	if (len != BENCH_PAYLOAD_SIZE ||
+	    packet[0] != (uint8_t)(uintptr_t)handler_data) {
+		fprintf(stderr, "Invalid response\n");
+		exit(1);
+	}
+
+	pthread_mutex_lock(&lock);
+	in_flight--;
+	completed++;
+	pthread_cond_signal(&cond);
+	pthread_mutex_unlock(&lock);
+}
+
+static uint64_t time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double run(uint32_t count, uint32_t depth)
+{
+	int err;
+	uint32_t i;
+	uint64_t total;
+	uint8_t *packet;
+
+	completed = 0;
+	total = time_ns();
+
+	for (i = 0; i < count; i++) {
+		pthread_mutex_lock(&lock);
+		while (in_flight >= depth) {
+			pthread_cond_wait(&cond, &lock);
+		}
+		in_flight++;
+		pthread_mutex_unlock(&lock);
+
+		NRF_RPC_ALLOC(packet, BENCH_PAYLOAD_SIZE);
+		memset(packet, (uint8_t)i, BENCH_PAYLOAD_SIZE);
+
+		err = nrf_rpc_cmd_async(&bench_group, BENCH_CMD_ECHO, packet,
+					BENCH_PAYLOAD_SIZE, response_handler,
+					(void *)(uintptr_t)(uint8_t)i);
+		if (err < 0) {
+			fprintf(stderr, "Command %u failed: %d\n", i, err);
+			exit(1);
+		}
+	}
+
+	pthread_mutex_lock(&lock);
+	while (completed < count) {
+		pthread_cond_wait(&cond, &lock);
+	}
+	pthread_mutex_unlock(&lock);
+
+	total = time_ns() - total;
+
+	return count * 1e9 / total;
+}
+
+int main(int argc, char **argv)
+{
+	int err;
+	uint32_t depth;
+	uint32_t count = BENCH_DEFAULT_COUNT;
+	uint32_t max_depth = BENCH_DEFAULT_DEPTH;
+	double base = 0;
+	double rate;
+
+	if (argc > 1) {
+		count = strtoul(argv[1], NULL, 0);
+	}
+
+	if (argc > 2) {
+		max_depth = strtoul(argv[2], NULL, 0);
+	}
+
+	if (count == 0 || max_depth == 0) {
+		return 1;
+	}
+
+	err = nrf_rpc_init(NULL);
+	if (err < 0) {
+		fprintf(stderr, "nrf_rpc_init failed: %d\n", err);
+		return 1;
+	}
+
+	printf("commands:          %u\n", count);
+
+	for (depth = 1; depth <= max_depth; depth *= 2) {
+		rate = run(count, depth);
+		if (depth == 1) {
+			base = rate;
+		}
+
+		printf("depth %2u:          %.0f commands/s (x%.2f)\n", depth,
+		       rate, rate / base);
+	}
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_LOG_H_
+#define NRF_RPC_LOG_H_
+
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+ * @defgroup nrf_rpc_log_posix Logging functionality for nRF PRC on POSIX
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief Logging functionality for nRF PRC that prints to the standard error
+ * output.
+ *
+ * Logs are filtered with @c NRF_RPC_POSIX_LOG_LEVEL: 0 - none, 1 - errors,
+ * 2 - warnings, 3 - information, 4 - debug. Documentation of the API is in
+ * template/nrf_rpc_log_tmpl.h.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef NRF_RPC_POSIX_LOG_LEVEL
+#define NRF_RPC_POSIX_LOG_LEVEL 1
+#endif
+
+#define _NRF_RPC_POSIX_STR(_x) #_x
+#define _NRF_RPC_POSIX_XSTR(_x) _NRF_RPC_POSIX_STR(_x)
+
+#define _NRF_RPC_POSIX_LOG(_level, _prefix, ...)			       \
+	do {								       \
+		if (NRF_RPC_POSIX_LOG_LEVEL >= (_level)) {		       \
+			fprintf(stderr, "<" _prefix "> "		       \
+				_NRF_RPC_POSIX_XSTR(NRF_RPC_LOG_MODULE) ": "); \
+			fprintf(stderr, __VA_ARGS__);			       \
+			fputc('\n', stderr);				       \
+		}							       \
+	} while (0)
+
+#define _NRF_RPC_POSIX_DUMP(_level, _prefix, _memory, _length, _text)	       \
+	do {								       \
+		if (NRF_RPC_POSIX_LOG_LEVEL >= (_level)) {		       \
+			size_t _i;					       \
+									       \
+			_NRF_RPC_POSIX_LOG(_level, _prefix, "%s", (_text));    \
+			for (_i = 0; _i < (size_t)(_length); _i++) {	       \
+				fprintf(stderr, " %02X",		       \
+					((const uint8_t *)(_memory))[_i]);     \
+			}						       \
+			fputc('\n', stderr);				       \
+		}							       \
+	} while (0)
+
+#define NRF_RPC_ERR(...) _NRF_RPC_POSIX_LOG(1, "err", __VA_ARGS__)
+#define NRF_RPC_WRN(...) _NRF_RPC_POSIX_LOG(2, "wrn", __VA_ARGS__)
+#define NRF_RPC_INF(...) _NRF_RPC_POSIX_LOG(3, "inf", __VA_ARGS__)
+#define NRF_RPC_DBG(...) _NRF_RPC_POSIX_LOG(4, "dbg", __VA_ARGS__)
+
+#define NRF_RPC_DUMP_ERR(memory, length, text) \
+	_NRF_RPC_POSIX_DUMP(1, "err", memory, length, text)
+#define NRF_RPC_DUMP_WRN(memory, length, text) \
+	_NRF_RPC_POSIX_DUMP(2, "wrn", memory, length, text)
+#define NRF_RPC_DUMP_INF(memory, length, text) \
+	_NRF_RPC_POSIX_DUMP(3, "inf", memory, length, text)
+#define NRF_RPC_DUMP_DBG(memory, length, text) \
+	_NRF_RPC_POSIX_DUMP(4, "dbg", memory, length, text)
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NRF_RPC_LOG_H_ */
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_OS_H_
+#define NRF_RPC_OS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <time.h>
+#include <pthread.h>
+
+/* Attribute used by the automatically registered arrays. It is provided by
+ * the toolchain headers on Zephyr, but not by the host C library.
+ */
+#ifndef __used
+#define __used __attribute__((__used__))
+#endif
+
+/**
+ * @defgroup nrf_rpc_os_posix POSIX implementation of OS-dependent
+ * functionality for nRF PRC
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief POSIX implementation of OS-dependent functionality for nRF PRC.
+ *
+ * It allows running nRF RPC as a regular Linux process, e.g. to measure
+ * overhead of nRF RPC on a host. Documentation of the API is in
+ * template/nrf_rpc_os_tmpl.h.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct nrf_rpc_os_event {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	bool set;
+};
+
+struct nrf_rpc_os_msg {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	const uint8_t *data;
+	size_t len;
+	bool set;
+};
+
+struct nrf_rpc_os_mutex {
+	pthread_mutex_t mutex;
+};
+
+struct nrf_rpc_os_timer;
+
+typedef void (*nrf_rpc_os_timer_handler_t)(struct nrf_rpc_os_timer *timer);
+
+struct nrf_rpc_os_timer {
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	struct timespec deadline;
+	bool active;
+	nrf_rpc_os_timer_handler_t handler;
+};
+
+typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
+
+int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
+
+int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event);
+
+void nrf_rpc_os_event_set(struct nrf_rpc_os_event *event);
+
+void nrf_rpc_os_event_wait(struct nrf_rpc_os_event *event);
+
+int nrf_rpc_os_msg_init(struct nrf_rpc_os_msg *msg);
+
+void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
+			size_t len);
+
+void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, const uint8_t **data,
+			size_t *len);
+
+int nrf_rpc_os_mutex_init(struct nrf_rpc_os_mutex *mutex);
+
+void nrf_rpc_os_mutex_lock(struct nrf_rpc_os_mutex *mutex);
+
+void nrf_rpc_os_mutex_unlock(struct nrf_rpc_os_mutex *mutex);
+
+int nrf_rpc_os_timer_init(struct nrf_rpc_os_timer *timer,
+			  nrf_rpc_os_timer_handler_t handler);
+
+void nrf_rpc_os_timer_start(struct nrf_rpc_os_timer *timer,
+			    uint32_t timeout_ms);
+
+void nrf_rpc_os_timer_stop(struct nrf_rpc_os_timer *timer);
+
+void *nrf_rpc_os_tls_get(void);
+
+void nrf_rpc_os_tls_set(void *data);
+
+uint32_t nrf_rpc_os_ctx_pool_reserve(void);
+
+void nrf_rpc_os_ctx_pool_release(uint32_t index);
+
+void nrf_rpc_os_remote_count(int count);
+
+void nrf_rpc_os_remote_reserve(void);
+
+void nrf_rpc_os_remote_release(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* NRF_RPC_OS_H_ */
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#define NRF_RPC_LOG_MODULE NRF_RPC_OS
+#include <nrf_rpc_log.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+
+NRF_RPC_STATIC_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE <= 32,
+		      "Context pool is implemented as a 32-bit mask");
+
+/* Work item passed to the thread pool. */
+struct pool_item {
+	const uint8_t *data;
+	size_t len;
+};
+
+/* Lock protecting all thread pool, context pool and remote thread
+ * counters.
+ */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Signaled when work is added to the thread pool queue. */
+static pthread_cond_t pool_work_cond = PTHREAD_COND_INITIALIZER;
+
+/* Signaled when a thread from the thread pool becomes free. */
+static pthread_cond_t pool_free_cond = PTHREAD_COND_INITIALIZER;
+
+/* Signaled when a command context is released. */
+static pthread_cond_t ctx_cond = PTHREAD_COND_INITIALIZER;
+
+/* Signaled when a remote thread is released. */
+static pthread_cond_t remote_cond = PTHREAD_COND_INITIALIZER;
+
+static pthread_t pool_threads[CONFIG_NRF_RPC_THREAD_POOL_SIZE];
+static struct pool_item pool_queue[CONFIG_NRF_RPC_THREAD_POOL_SIZE];
+static uint32_t pool_queue_head;
+static uint32_t pool_queue_count;
+static uint32_t pool_free;
+static nrf_rpc_os_work_t pool_callback;
+
+static uint32_t ctx_free_mask;
+
+static int remote_free;
+
+static pthread_key_t tls_key;
+
+static void *pool_thread(void *arg)
+{
+	struct pool_item item;
+
+	(void)arg;
+
+	while (true) {
+		pthread_mutex_lock(&lock);
+		while (pool_queue_count == 0) {
+			pthread_cond_wait(&pool_work_cond, &lock);
+		}
+		item = pool_queue[pool_queue_head];
+		pool_queue_head = (pool_queue_head + 1) %
+				  CONFIG_NRF_RPC_THREAD_POOL_SIZE;
+		pool_queue_count--;
+		pthread_mutex_unlock(&lock);
+
+		pool_callback(item.data, item.len);
+
+		pthread_mutex_lock(&lock);
+		pool_free++;
+		pthread_cond_signal(&pool_free_cond);
+		pthread_mutex_unlock(&lock);
+	}
+
+	return NULL;
+}
+
+int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
+{
+	int i;
+
+	NRF_RPC_ASSERT(callback != NULL);
+
+	if (pthread_key_create(&tls_key, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	pool_callback = callback;
+	pool_queue_head = 0;
+	pool_queue_count = 0;
+	pool_free = CONFIG_NRF_RPC_THREAD_POOL_SIZE;
+	ctx_free_mask = (uint32_t)((1ULL << CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE) -
+				   1);
+	remote_free = 0;
+
+	for (i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
+		if (pthread_create(&pool_threads[i], NULL, pool_thread,
+				   NULL) != 0) {
+			NRF_RPC_ERR("Cannot create thread pool thread");
+			return -NRF_ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
+{
+	uint32_t tail;
+
+	pthread_mutex_lock(&lock);
+	while (pool_free == 0) {
+		pthread_cond_wait(&pool_free_cond, &lock);
+	}
+	pool_free--;
+	tail = (pool_queue_head + pool_queue_count) %
+	       CONFIG_NRF_RPC_THREAD_POOL_SIZE;
+	pool_queue[tail].data = data;
+	pool_queue[tail].len = len;
+	pool_queue_count++;
+	pthread_cond_signal(&pool_work_cond);
+	pthread_mutex_unlock(&lock);
+}
+
+int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
+{
+	if (pthread_mutex_init(&event->mutex, NULL) != 0 ||
+	    pthread_cond_init(&event->cond, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	event->set = false;
+
+	return 0;
+}
+
+void nrf_rpc_os_event_set(struct nrf_rpc_os_event *event)
+{
+	pthread_mutex_lock(&event->mutex);
+	event->set = true;
+	pthread_cond_signal(&event->cond);
+	pthread_mutex_unlock(&event->mutex);
+}
+
+void nrf_rpc_os_event_wait(struct nrf_rpc_os_event *event)
+{
+	pthread_mutex_lock(&event->mutex);
+	while (!event->set) {
+		pthread_cond_wait(&event->cond, &event->mutex);
+	}
+	event->set = false;
+	pthread_mutex_unlock(&event->mutex);
+}
+
+int nrf_rpc_os_msg_init(struct nrf_rpc_os_msg *msg)
+{
+	if (pthread_mutex_init(&msg->mutex, NULL) != 0 ||
+	    pthread_cond_init(&msg->cond, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	msg->data = NULL;
+	msg->len = 0;
+	msg->set = false;
+
+	return 0;
+}
+
+void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
+			size_t len)
+{
+	pthread_mutex_lock(&msg->mutex);
+	msg->data = data;
+	msg->len = len;
+	msg->set = true;
+	pthread_cond_signal(&msg->cond);
+	pthread_mutex_unlock(&msg->mutex);
+}
+
+void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, const uint8_t **data,
+			size_t *len)
+{
+	pthread_mutex_lock(&msg->mutex);
+	while (!msg->set) {
+		pthread_cond_wait(&msg->cond, &msg->mutex);
+	}
+	*data = msg->data;
+	*len = msg->len;
+	msg->set = false;
+	pthread_mutex_unlock(&msg->mutex);
+}
+
+int nrf_rpc_os_mutex_init(struct nrf_rpc_os_mutex *mutex)
+{
+	int err;
+	pthread_mutexattr_t attr;
+
+	if (pthread_mutexattr_init(&attr) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	err = pthread_mutex_init(&mutex->mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	return (err == 0) ? 0 : -NRF_ENOMEM;
+}
+
+void nrf_rpc_os_mutex_lock(struct nrf_rpc_os_mutex *mutex)
+{
+	pthread_mutex_lock(&mutex->mutex);
+}
+
+void nrf_rpc_os_mutex_unlock(struct nrf_rpc_os_mutex *mutex)
+{
+	pthread_mutex_unlock(&mutex->mutex);
+}
+
+static bool timespec_passed(const struct timespec *deadline)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec > deadline->tv_sec) ||
+	       (now.tv_sec == deadline->tv_sec &&
+		now.tv_nsec >= deadline->tv_nsec);
+}
+
+static void *timer_thread(void *arg)
+{
+	struct nrf_rpc_os_timer *timer = arg;
+
+	pthread_mutex_lock(&timer->mutex);
+
+	while (true) {
+		if (!timer->active) {
+			pthread_cond_wait(&timer->cond, &timer->mutex);
+			continue;
+		}
+
+		if (!timespec_passed(&timer->deadline)) {
+			pthread_cond_timedwait(&timer->cond, &timer->mutex,
+					       &timer->deadline);
+			continue;
+		}
+
+		timer->active = false;
+		pthread_mutex_unlock(&timer->mutex);
+
+		timer->handler(timer);
+
+		pthread_mutex_lock(&timer->mutex);
+	}
+
+	return NULL;
+}
+
+int nrf_rpc_os_timer_init(struct nrf_rpc_os_timer *timer,
+			  nrf_rpc_os_timer_handler_t handler)
+{
+	pthread_condattr_t attr;
+
+	NRF_RPC_ASSERT(handler != NULL);
+
+	timer->handler = handler;
+	timer->active = false;
+
+	if (pthread_condattr_init(&attr) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+
+	if (pthread_mutex_init(&timer->mutex, NULL) != 0 ||
+	    pthread_cond_init(&timer->cond, &attr) != 0) {
+		pthread_condattr_destroy(&attr);
+		return -NRF_ENOMEM;
+	}
+
+	pthread_condattr_destroy(&attr);
+
+	if (pthread_create(&timer->thread, NULL, timer_thread, timer) != 0) {
+		NRF_RPC_ERR("Cannot create timer thread");
+		return -NRF_ENOMEM;
+	}
+
+	return 0;
+}
+
+void nrf_rpc_os_timer_start(struct nrf_rpc_os_timer *timer,
+			    uint32_t timeout_ms)
+{
+	struct timespec deadline;
+
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L) {
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&timer->mutex);
+	timer->deadline = deadline;
+	timer->active = true;
+	pthread_cond_signal(&timer->cond);
+	pthread_mutex_unlock(&timer->mutex);
+}
+
+void nrf_rpc_os_timer_stop(struct nrf_rpc_os_timer *timer)
+{
+	pthread_mutex_lock(&timer->mutex);
+	timer->active = false;
+	pthread_cond_signal(&timer->cond);
+	pthread_mutex_unlock(&timer->mutex);
+}
+
+void *nrf_rpc_os_tls_get(void)
+{
+	return pthread_getspecific(tls_key);
+}
+
+void nrf_rpc_os_tls_set(void *data)
+{
+	pthread_setspecific(tls_key, data);
+}
+
+uint32_t nrf_rpc_os_ctx_pool_reserve(void)
+{
+	uint32_t index;
+
+	pthread_mutex_lock(&lock);
+	while (ctx_free_mask == 0) {
+		pthread_cond_wait(&ctx_cond, &lock);
+	}
+	index = __builtin_ctz(ctx_free_mask);
+	ctx_free_mask &= ~(1UL << index);
+	pthread_mutex_unlock(&lock);
+
+	return index;
+}
+
+void nrf_rpc_os_ctx_pool_release(uint32_t index)
+{
+	NRF_RPC_ASSERT(index < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE);
+
+	pthread_mutex_lock(&lock);
+	ctx_free_mask |= 1UL << index;
+	pthread_cond_signal(&ctx_cond);
+	pthread_mutex_unlock(&lock);
+}
+
+void nrf_rpc_os_remote_count(int count)
+{
+	NRF_RPC_DBG("Remote thread count changed to %d", count);
+
+	pthread_mutex_lock(&lock);
+	remote_free = count;
+	pthread_cond_broadcast(&remote_cond);
+	pthread_mutex_unlock(&lock);
+}
+
+void nrf_rpc_os_remote_reserve(void)
+{
+	pthread_mutex_lock(&lock);
+	while (remote_free <= 0) {
+		pthread_cond_wait(&remote_cond, &lock);
+	}
+	remote_free--;
+	pthread_mutex_unlock(&lock);
+}
+
+void nrf_rpc_os_remote_release(void)
+{
+	pthread_mutex_lock(&lock);
+	remote_free++;
+	pthread_cond_signal(&remote_cond);
+	pthread_mutex_unlock(&lock);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#define NRF_RPC_LOG_MODULE NRF_RPC_TR
+#include <nrf_rpc_log.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_tr.h"
+
+/* Packet buffer with a link to the next packet in the receive queue. */
+struct loopback_packet {
+	struct loopback_packet *next;
+	size_t len;
+	uint8_t data[];
+};
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_cond = PTHREAD_COND_INITIALIZER;
+static struct loopback_packet *queue_head;
+static struct loopback_packet *queue_tail;
+
+static pthread_t rx_thread;
+static nrf_rpc_tr_receive_handler_t receive_callback;
+
+static struct nrf_rpc_tr_stats stats;
+
+static void *rx_thread_entry(void *arg)
+{
+	struct loopback_packet *packet;
+
+	(void)arg;
+
+	while (true) {
+		pthread_mutex_lock(&lock);
+		while (queue_head == NULL) {
+			pthread_cond_wait(&queue_cond, &lock);
+		}
+		packet = queue_head;
+		queue_head = packet->next;
+		if (queue_head == NULL) {
+			queue_tail = NULL;
+		}
+		pthread_mutex_unlock(&lock);
+
+		receive_callback(packet->data, packet->len);
+
+		if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
+			memset(packet->data, 0xAA, packet->len);
+			free(packet);
+		}
+	}
+
+	return NULL;
+}
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback)
+{
+	NRF_RPC_ASSERT(callback != NULL);
+
+	receive_callback = callback;
+	queue_head = NULL;
+	queue_tail = NULL;
+	nrf_rpc_tr_stats_reset();
+
+	if (pthread_create(&rx_thread, NULL, rx_thread_entry, NULL) != 0) {
+		NRF_RPC_ERR("Cannot create receive thread");
+		return -NRF_ENOMEM;
+	}
+
+	return 0;
+}
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet)
+{
+	free(NRF_RPC_CONTAINER_OF(packet, struct loopback_packet, data));
+}
+
+void nrf_rpc_tr_reserve_tx_buf(uint8_t **buf, size_t headroom, size_t len)
+{
+	struct loopback_packet *packet;
+
+	packet = malloc(sizeof(struct loopback_packet) + headroom + len);
+	NRF_RPC_ASSERT(packet != NULL);
+
+	__atomic_fetch_add(&stats.allocs, 1, __ATOMIC_RELAXED);
+
+	*buf = &packet->data[headroom];
+}
+
+void nrf_rpc_tr_discard_tx_buf(uint8_t *buf, size_t headroom)
+{
+	free(NRF_RPC_CONTAINER_OF(&buf[-headroom], struct loopback_packet,
+				  data));
+}
+
+int nrf_rpc_tr_commit_tx_buf(uint8_t *buf, size_t len)
+{
+	struct loopback_packet *packet =
+		NRF_RPC_CONTAINER_OF(buf, struct loopback_packet, data);
+
+	__atomic_fetch_add(&stats.packets, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&stats.bytes, len, __ATOMIC_RELAXED);
+
+	packet->next = NULL;
+	packet->len = len;
+
+	pthread_mutex_lock(&lock);
+	if (queue_tail == NULL) {
+		queue_head = packet;
+	} else {
+		queue_tail->next = packet;
+	}
+	queue_tail = packet;
+	pthread_cond_signal(&queue_cond);
+	pthread_mutex_unlock(&lock);
+
+	return 0;
+}
+
+void nrf_rpc_tr_stats_get(struct nrf_rpc_tr_stats *out)
+{
+	out->allocs = __atomic_load_n(&stats.allocs, __ATOMIC_RELAXED);
+	out->packets = __atomic_load_n(&stats.packets, __ATOMIC_RELAXED);
+	out->bytes = __atomic_load_n(&stats.bytes, __ATOMIC_RELAXED);
+}
+
+void nrf_rpc_tr_stats_reset(void)
+{
+	__atomic_store_n(&stats.allocs, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&stats.packets, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&stats.bytes, 0, __ATOMIC_RELAXED);
+}
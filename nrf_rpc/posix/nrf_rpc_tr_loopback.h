@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_TR_LOOPBACK_H_
+#define NRF_RPC_TR_LOOPBACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @defgroup nrf_rpc_tr_loopback nRF RPC in-process loopback transport
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief nRF RPC transport that passes each sent packet back to the receive
+ * handler of the same process.
+ *
+ * Packets are not copied. Buffer allocated for sending is passed as it is to
+ * the receive handler from a dedicated receive thread. Local and remote side
+ * are the same nRF RPC instance, so it measures overhead of both sides.
+ * Documentation of the API is in template/nrf_rpc_tr_tmpl.h.
+ *
+ * If @c CONFIG_NRF_RPC_TR_LOOPBACK_AUTO_FREE is defined, the received buffer
+ * is overwritten and freed as soon as the receive handler returns, the same
+ * as transports with @c NRF_RPC_TR_AUTO_FREE_RX_BUF set do. It allows testing
+ * that nRF RPC does not use the buffer after that.
+ *
+ * Select it with @option{CONFIG_NRF_RPC_TR_CUSTOM} and
+ * @option{CONFIG_NRF_RPC_TR_CUSTOM_INCLUDE} set to "nrf_rpc_tr_loopback.h".
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_RPC_TR_MAX_HEADER_SIZE 0
+
+#define NRF_RPC_TR_RESERVE_TX_BUF 1
+
+#if defined(CONFIG_NRF_RPC_TR_LOOPBACK_AUTO_FREE)
+#define NRF_RPC_TR_AUTO_FREE_RX_BUF 1
+#else
+#define NRF_RPC_TR_AUTO_FREE_RX_BUF 0
+#endif
+
+/** @brief Transport statistics. */
+struct nrf_rpc_tr_stats {
+	/** @brief Number of allocated transmit buffers. */
+	uint32_t allocs;
+
+	/** @brief Number of sent packets. */
+	uint32_t packets;
+
+	/** @brief Number of sent bytes. */
+	uint64_t bytes;
+};
+
+typedef void (*nrf_rpc_tr_receive_handler_t)(const uint8_t *packet, size_t len);
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback);
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet);
+
+void nrf_rpc_tr_reserve_tx_buf(uint8_t **buf, size_t headroom, size_t len);
+
+int nrf_rpc_tr_commit_tx_buf(uint8_t *buf, size_t len);
+
+void nrf_rpc_tr_discard_tx_buf(uint8_t *buf, size_t headroom);
+
+/** @brief Get transport statistics.
+ *
+ * @param[out] stats Statistics collected since initialization or the last
+ *                   @ref nrf_rpc_tr_stats_reset.
+ */
+void nrf_rpc_tr_stats_get(struct nrf_rpc_tr_stats *stats);
+
+/** @brief Reset transport statistics. */
+void nrf_rpc_tr_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NRF_RPC_TR_LOOPBACK_H_ */
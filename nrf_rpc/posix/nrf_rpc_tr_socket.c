@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#define NRF_RPC_LOG_MODULE NRF_RPC_TR
+#include <nrf_rpc_log.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_tr.h"
+
+static int socket_fd = -1;
+
+/* Lock serializing writes of packets from different threads. */
+static pthread_mutex_t tx_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t rx_thread;
+static bool stopping;
+static nrf_rpc_tr_receive_handler_t receive_callback;
+
+static struct nrf_rpc_tr_stats stats;
+
+static int read_all(uint8_t *buf, size_t len)
+{
+	ssize_t res;
+
+	while (len > 0) {
+		res = read(socket_fd, buf, len);
+		if (res < 0 && errno == EINTR) {
+			continue;
+		} else if (res <= 0) {
+			return -NRF_EIO;
+		}
+		buf += res;
+		len -= res;
+	}
+
+	return 0;
+}
+
+static int write_all(const uint8_t *buf, size_t len)
+{
+	ssize_t res;
+
+	while (len > 0) {
+		res = write(socket_fd, buf, len);
+		if (res < 0 && errno == EINTR) {
+			continue;
+		} else if (res <= 0) {
+			return -NRF_EIO;
+		}
+		buf += res;
+		len -= res;
+	}
+
+	return 0;
+}
+
+static void *rx_thread_entry(void *arg)
+{
+	uint32_t len;
+	uint8_t *packet;
+
+	(void)arg;
+
+	while (true) {
+		if (read_all((uint8_t *)&len, sizeof(len)) < 0) {
+			break;
+		}
+
+		packet = malloc(len > 0 ? len : 1);
+		NRF_RPC_ASSERT(packet != NULL);
+
+		if (read_all(packet, len) < 0) {
+			free(packet);
+			break;
+		}
+
+		receive_callback(packet, len);
+	}
+
+	if (__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+		NRF_RPC_DBG("Receiving stopped");
+	} else {
+		NRF_RPC_ERR("Socket closed");
+	}
+
+	return NULL;
+}
+
+void nrf_rpc_tr_socket_set(int fd)
+{
+	socket_fd = fd;
+}
+
+void nrf_rpc_tr_socket_stop(void)
+{
+	__atomic_store_n(&stopping, true, __ATOMIC_RELEASE);
+
+	/* Shutting down only the receiving direction wakes up the receive
+	 * thread without signaling the end of stream to the remote side.
+	 */
+	shutdown(socket_fd, SHUT_RD);
+	pthread_join(rx_thread, NULL);
+}
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback)
+{
+	NRF_RPC_ASSERT(callback != NULL);
+
+	if (socket_fd < 0) {
+		NRF_RPC_ERR("Socket not set");
+		return -NRF_EINVAL;
+	}
+
+	receive_callback = callback;
+	nrf_rpc_tr_stats_reset();
+
+	if (pthread_create(&rx_thread, NULL, rx_thread_entry, NULL) != 0) {
+		NRF_RPC_ERR("Cannot create receive thread");
+		return -NRF_ENOMEM;
+	}
+
+	return 0;
+}
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet)
+{
+	free((uint8_t *)packet);
+}
+
+void nrf_rpc_tr_reserve_tx_buf(uint8_t **buf, size_t headroom, size_t len)
+{
+	uint8_t *frame;
+
+	frame = malloc(NRF_RPC_TR_MAX_HEADER_SIZE + headroom + len);
+	NRF_RPC_ASSERT(frame != NULL);
+
+	__atomic_fetch_add(&stats.allocs, 1, __ATOMIC_RELAXED);
+
+	*buf = &frame[NRF_RPC_TR_MAX_HEADER_SIZE + headroom];
+}
+
+void nrf_rpc_tr_discard_tx_buf(uint8_t *buf, size_t headroom)
+{
+	free(&buf[-headroom - NRF_RPC_TR_MAX_HEADER_SIZE]);
+}
+
+int nrf_rpc_tr_commit_tx_buf(uint8_t *buf, size_t len)
+{
+	int err;
+	uint32_t frame_len = len;
+	uint8_t *frame = &buf[-NRF_RPC_TR_MAX_HEADER_SIZE];
+
+	memcpy(frame, &frame_len, sizeof(frame_len));
+
+	pthread_mutex_lock(&tx_lock);
+	err = write_all(frame, NRF_RPC_TR_MAX_HEADER_SIZE + len);
+	pthread_mutex_unlock(&tx_lock);
+
+	free(frame);
+
+	if (err >= 0) {
+		__atomic_fetch_add(&stats.packets, 1, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&stats.bytes, len, __ATOMIC_RELAXED);
+	}
+
+	return err;
+}
+
+void nrf_rpc_tr_stats_get(struct nrf_rpc_tr_stats *out)
+{
+	out->allocs = __atomic_load_n(&stats.allocs, __ATOMIC_RELAXED);
+	out->packets = __atomic_load_n(&stats.packets, __ATOMIC_RELAXED);
+	out->bytes = __atomic_load_n(&stats.bytes, __ATOMIC_RELAXED);
+}
+
+void nrf_rpc_tr_stats_reset(void)
+{
+	__atomic_store_n(&stats.allocs, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&stats.packets, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&stats.bytes, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_TR_SOCKET_H_
+#define NRF_RPC_TR_SOCKET_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @defgroup nrf_rpc_tr_socket nRF RPC stream socket transport
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief nRF RPC transport over a connected stream socket, e.g. one end of
+ * a `socketpair()` shared by two processes.
+ *
+ * Each packet is preceded by its 32-bit length in host byte order. The length
+ * is written into the headroom reserved by @ref nrf_rpc_tr_reserve_tx_buf in
+ * front of the nRF RPC header, so packets are sent with one `write()` without
+ * copying. Documentation of the
+ * API is in template/nrf_rpc_tr_tmpl.h.
+ *
+ * Select it with @option{CONFIG_NRF_RPC_TR_CUSTOM} and
+ * @option{CONFIG_NRF_RPC_TR_CUSTOM_INCLUDE} set to "nrf_rpc_tr_socket.h".
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_RPC_TR_MAX_HEADER_SIZE 4
+
+#define NRF_RPC_TR_RESERVE_TX_BUF 1
+
+#define NRF_RPC_TR_AUTO_FREE_RX_BUF 0
+
+/** @brief Transport statistics. */
+struct nrf_rpc_tr_stats {
+	/** @brief Number of allocated transmit buffers. */
+	uint32_t allocs;
+
+	/** @brief Number of sent packets. */
+	uint32_t packets;
+
+	/** @brief Number of sent bytes. */
+	uint64_t bytes;
+};
+
+typedef void (*nrf_rpc_tr_receive_handler_t)(const uint8_t *packet, size_t len);
+
+/** @brief Set socket used by the transport.
+ *
+ * It must be called before @ref nrf_rpc_init.
+ *
+ * @param fd Connected stream socket file descriptor.
+ */
+void nrf_rpc_tr_socket_set(int fd);
+
+/** @brief Stop receiving packets from the socket.
+ *
+ * Stops and joins the receive thread without reporting an error, so it can be
+ * used during a normal teardown. The socket is not closed, because it is owned
+ * by the caller. No packet can be sent or received after this call.
+ */
+void nrf_rpc_tr_socket_stop(void);
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback);
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet);
+
+void nrf_rpc_tr_reserve_tx_buf(uint8_t **buf, size_t headroom, size_t len);
+
+int nrf_rpc_tr_commit_tx_buf(uint8_t *buf, size_t len);
+
+void nrf_rpc_tr_discard_tx_buf(uint8_t *buf, size_t headroom);
+
+/** @brief Get transport statistics.
+ *
+ * @param[out] stats Statistics collected since initialization or the last
+ *                   @ref nrf_rpc_tr_stats_reset.
+ */
+void nrf_rpc_tr_stats_get(struct nrf_rpc_tr_stats *stats);
+
+/** @brief Reset transport statistics. */
+void nrf_rpc_tr_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NRF_RPC_TR_SOCKET_H_ */
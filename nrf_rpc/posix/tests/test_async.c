@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of asynchronous commands over the loopback transport. */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+#include "test_common.h"
+
+#define TEST_CMD_GATED 0x01
+#define TEST_MAX_SEQ   16
+
+NRF_RPC_GROUP_DEFINE(test_group, "test", NULL, NULL, NULL);
+
+/* Remote side holds each command until its gate is opened, so the test
+ * decides in which order the responses are sent.
+ */
+static volatile bool gate_open[TEST_MAX_SEQ];
+static uint32_t executing_count;
+
+static uint32_t completed_count;
+static uint32_t completed_seq[TEST_MAX_SEQ];
+
+static void gated_handler(const uint8_t *packet, size_t len,
+			  void *handler_data)
+{
+	uint32_t seq;
+	uint8_t *rsp;
+
+	TEST_ASSERT(len == sizeof(seq));
+	memcpy(&seq, packet, sizeof(seq));
+	nrf_rpc_decoding_done(packet);
+
+	TEST_ASSERT(seq < TEST_MAX_SEQ);
+
+	__atomic_fetch_add(&executing_count, 1, __ATOMIC_RELEASE);
+
+	while (!gate_open[seq]) {
+		test_sleep_ms(1);
+	}
+
+	__atomic_fetch_sub(&executing_count, 1, __ATOMIC_RELEASE);
+
+	NRF_RPC_ALLOC(rsp, sizeof(seq));
+	memcpy(rsp, &seq, sizeof(seq));
+	nrf_rpc_rsp_no_err(rsp, sizeof(seq));
+}
+
+NRF_RPC_CMD_DECODER(test_group, test_gated, TEST_CMD_GATED, gated_handler,
+		    NULL);
+
+/* Response handler gets the sequence number of its own command as the
+ * handler data.
+ */
+static void response_handler(const uint8_t *packet, size_t len,
+			     void *handler_data)
+{
+	uint32_t seq;
+	uint32_t index;
+
+	TEST_ASSERT(len == sizeof(seq));
+	memcpy(&seq, packet, sizeof(seq));
+	TEST_ASSERT(seq == (uint32_t)(uintptr_t)handler_data);
+
+	index = __atomic_load_n(&completed_count, __ATOMIC_ACQUIRE);
+	TEST_ASSERT(index < TEST_MAX_SEQ);
+	completed_seq[index] = seq;
+	__atomic_store_n(&completed_count, index + 1, __ATOMIC_RELEASE);
+}
+
+static void reset(void)
+{
+	memset((void *)gate_open, 0, sizeof(gate_open));
+	__atomic_store_n(&completed_count, 0, __ATOMIC_RELEASE);
+}
+
+static void send_cmd(uint32_t seq)
+{
+	uint8_t *packet;
+
+	NRF_RPC_ALLOC(packet, sizeof(seq));
+	memcpy(packet, &seq, sizeof(seq));
+	TEST_ASSERT(nrf_rpc_cmd_async(&test_group, TEST_CMD_GATED, packet,
+				      sizeof(seq), response_handler,
+				      (void *)(uintptr_t)seq) == 0);
+}
+
+static uint32_t completed_get(void)
+{
+	return __atomic_load_n(&completed_count, __ATOMIC_ACQUIRE);
+}
+
+static uint32_t executing_get(void)
+{
+	return __atomic_load_n(&executing_count, __ATOMIC_ACQUIRE);
+}
+
+/* Several commands are in flight from one thread and their responses are
+ * delivered in the order the remote side sends them, each to its own
+ * handler data.
+ */
+static void test_out_of_order(void)
+{
+	static const uint32_t order[] = { 2, 0, 3, 1 };
+	uint32_t i;
+
+	reset();
+
+	for (i = 0; i < 4; i++) {
+		send_cmd(i);
+	}
+
+	TEST_WAIT_FOR(executing_get() == 4, 1000);
+	TEST_ASSERT(completed_get() == 0);
+
+	for (i = 0; i < 4; i++) {
+		gate_open[order[i]] = true;
+		TEST_WAIT_FOR(completed_get() == i + 1, 1000);
+	}
+
+	for (i = 0; i < 4; i++) {
+		TEST_ASSERT(completed_seq[i] == order[i]);
+	}
+}
+
+static void *sender_thread(void *arg)
+{
+	send_cmd((uint32_t)(uintptr_t)arg);
+
+	return NULL;
+}
+
+/* When all command contexts are taken, sending waits until a response frees
+ * one. Each command in flight holds a context on the local side and one on
+ * the remote side, which share the pool in the loopback configuration.
+ */
+static void test_pool_exhaustion(void)
+{
+	const uint32_t in_flight = CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE / 2;
+	pthread_t thread;
+	uint32_t i;
+
+	reset();
+
+	for (i = 0; i < in_flight; i++) {
+		send_cmd(i);
+	}
+
+	TEST_WAIT_FOR(executing_get() == in_flight, 1000);
+
+	TEST_ASSERT(pthread_create(&thread, NULL, sender_thread,
+				   (void *)(uintptr_t)in_flight) == 0);
+
+	test_sleep_ms(20);
+	TEST_ASSERT(executing_get() == in_flight);
+	TEST_ASSERT(completed_get() == 0);
+
+	/* Completing one command lets the waiting one through. */
+	gate_open[0] = true;
+	TEST_WAIT_FOR(completed_get() == 1, 1000);
+	TEST_WAIT_FOR(executing_get() == in_flight, 1000);
+	TEST_ASSERT(pthread_join(thread, NULL) == 0);
+
+	for (i = 1; i <= in_flight; i++) {
+		gate_open[i] = true;
+	}
+
+	TEST_WAIT_FOR(completed_get() == in_flight + 1, 1000);
+	TEST_WAIT_FOR(executing_get() == 0, 1000);
+}
+
+int main(void)
+{
+	TEST_ASSERT(nrf_rpc_init(NULL) == 0);
+
+	TEST_RUN(test_out_of_order);
+	TEST_RUN(test_pool_exhaustion);
+
+	return 0;
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of event batching over the loopback transport. */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+#include "test_common.h"
+
+#define TEST_CMD_SYNC    0x01
+#define TEST_CMD_BATCHED 0x02
+#define TEST_EVT_SEQ     0x01
+#define TEST_EVT_FORWARD 0x02
+
+NRF_RPC_GROUP_DEFINE(test_group, "test", NULL, NULL, NULL);
+
+static uint32_t received_count;
+static uint32_t received_seq[64];
+static uint64_t received_time;
+
+static void sync_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint8_t *rsp;
+
+	nrf_rpc_decoding_done(packet);
+
+	NRF_RPC_ALLOC(rsp, 0);
+	nrf_rpc_rsp_no_err(rsp, 0);
+}
+
+NRF_RPC_CMD_DECODER(test_group, test_sync, TEST_CMD_SYNC, sync_handler, NULL);
+
+static void seq_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint32_t seq;
+	uint32_t index;
+
+	TEST_ASSERT(len == sizeof(seq));
+	memcpy(&seq, packet, sizeof(seq));
+	nrf_rpc_decoding_done(packet);
+
+	index = __atomic_load_n(&received_count, __ATOMIC_ACQUIRE);
+	TEST_ASSERT(index < sizeof(received_seq) / sizeof(received_seq[0]));
+	received_seq[index] = seq;
+	received_time = test_time_ms();
+	__atomic_store_n(&received_count, index + 1, __ATOMIC_RELEASE);
+}
+
+NRF_RPC_EVT_DECODER(test_group, test_seq, TEST_EVT_SEQ, seq_handler, NULL);
+
+static void send_seq(uint32_t seq)
+{
+	uint8_t *packet;
+
+	NRF_RPC_ALLOC(packet, sizeof(seq));
+	memcpy(packet, &seq, sizeof(seq));
+	TEST_ASSERT(nrf_rpc_evt_batched(&test_group, TEST_EVT_SEQ, packet,
+					sizeof(seq)) == 0);
+}
+
+/* Decoder that batches an event and responds immediately after it. */
+static void batched_handler(const uint8_t *packet, size_t len,
+			    void *handler_data)
+{
+	uint32_t seq;
+	uint8_t *rsp;
+
+	memcpy(&seq, packet, sizeof(seq));
+	nrf_rpc_decoding_done(packet);
+
+	send_seq(seq);
+
+	NRF_RPC_ALLOC(rsp, 0);
+	nrf_rpc_rsp_no_err(rsp, 0);
+}
+
+NRF_RPC_CMD_DECODER(test_group, test_batched, TEST_CMD_BATCHED,
+		    batched_handler, NULL);
+
+/* Decoder that sends another batched event from the thread pool. */
+static void forward_handler(const uint8_t *packet, size_t len,
+			    void *handler_data)
+{
+	uint32_t seq;
+
+	memcpy(&seq, packet, sizeof(seq));
+	nrf_rpc_decoding_done(packet);
+
+	send_seq(seq);
+}
+
+NRF_RPC_EVT_DECODER(test_group, test_forward, TEST_EVT_FORWARD,
+		    forward_handler, NULL);
+
+static void sync(void)
+{
+	uint8_t *packet;
+	const uint8_t *rsp;
+	size_t rsp_len;
+
+	NRF_RPC_ALLOC(packet, 0);
+	TEST_ASSERT(nrf_rpc_cmd_rsp(&test_group, TEST_CMD_SYNC, packet, 0,
+				    &rsp, &rsp_len) == 0);
+	nrf_rpc_decoding_done(rsp);
+}
+
+static void reset(void)
+{
+	sync();
+	__atomic_store_n(&received_count, 0, __ATOMIC_RELEASE);
+	nrf_rpc_tr_stats_reset();
+}
+
+/* Lone event is sent by the timer, without any other traffic. */
+static void test_batch_timeout(void)
+{
+	uint64_t start;
+
+	reset();
+
+	start = test_time_ms();
+	send_seq(100);
+
+	TEST_WAIT_FOR(__atomic_load_n(&received_count, __ATOMIC_ACQUIRE) == 1,
+		      1000);
+	TEST_ASSERT(received_seq[0] == 100);
+	TEST_ASSERT(received_time - start >= CONFIG_NRF_RPC_BATCH_TIMEOUT - 1);
+}
+
+/* Full batch is sent at once in one packet and acknowledged with one packet.
+ */
+static void test_batch_count(void)
+{
+	uint32_t i;
+	struct nrf_rpc_tr_stats stats;
+
+	reset();
+
+	for (i = 0; i < CONFIG_NRF_RPC_BATCH_COUNT; i++) {
+		send_seq(i);
+	}
+
+	TEST_WAIT_FOR(__atomic_load_n(&received_count, __ATOMIC_ACQUIRE) ==
+		      CONFIG_NRF_RPC_BATCH_COUNT, 1000);
+
+	for (i = 0; i < CONFIG_NRF_RPC_BATCH_COUNT; i++) {
+		TEST_ASSERT(received_seq[i] == i);
+	}
+
+	TEST_WAIT_FOR((nrf_rpc_tr_stats_get(&stats), stats.packets == 2),
+		      1000);
+}
+
+/* Command flushes the pending batch, so batched events are not delayed by
+ * the batch timer and do not arrive after the command.
+ */
+static void test_batch_before_cmd(void)
+{
+	uint64_t start;
+
+	reset();
+
+	start = test_time_ms();
+	send_seq(200);
+	send_seq(201);
+	sync();
+
+	TEST_WAIT_FOR(__atomic_load_n(&received_count, __ATOMIC_ACQUIRE) == 2,
+		      1000);
+	TEST_ASSERT(received_seq[0] == 200);
+	TEST_ASSERT(received_seq[1] == 201);
+	TEST_ASSERT(received_time - start < CONFIG_NRF_RPC_BATCH_TIMEOUT);
+}
+
+/* Response flushes events batched by the decoder before it responded. */
+static void test_batch_before_rsp(void)
+{
+	uint32_t seq = 300;
+	uint64_t start;
+	uint8_t *packet;
+	const uint8_t *rsp;
+	size_t rsp_len;
+
+	reset();
+
+	start = test_time_ms();
+	NRF_RPC_ALLOC(packet, sizeof(seq));
+	memcpy(packet, &seq, sizeof(seq));
+	TEST_ASSERT(nrf_rpc_cmd_rsp(&test_group, TEST_CMD_BATCHED, packet,
+				    sizeof(seq), &rsp, &rsp_len) == 0);
+	nrf_rpc_decoding_done(rsp);
+
+	TEST_WAIT_FOR(__atomic_load_n(&received_count, __ATOMIC_ACQUIRE) == 1,
+		      1000);
+	TEST_ASSERT(received_seq[0] == 300);
+	TEST_ASSERT(received_time - start < CONFIG_NRF_RPC_BATCH_TIMEOUT);
+}
+
+/* Events batched from decoders running in parallel with the batch timer.
+ * Local and remote thread pool is the same, so only two events are sent at
+ * a time to leave a remote thread for the batch sent by the decoders.
+ */
+static void test_batch_from_decoder(void)
+{
+	uint32_t i;
+	uint32_t seq;
+	uint8_t *packet;
+
+	reset();
+
+	for (i = 0; i < 20; i++) {
+		seq = i;
+		NRF_RPC_ALLOC(packet, sizeof(seq));
+		memcpy(packet, &seq, sizeof(seq));
+		TEST_ASSERT(nrf_rpc_evt(&test_group, TEST_EVT_FORWARD, packet,
+					sizeof(seq)) == 0);
+
+		if (i % 2 == 1) {
+			TEST_WAIT_FOR(__atomic_load_n(&received_count,
+						      __ATOMIC_ACQUIRE) == i + 1,
+				      1000);
+		}
+	}
+}
+
+int main(void)
+{
+	TEST_ASSERT(nrf_rpc_init(NULL) == 0);
+
+	TEST_RUN(test_batch_timeout);
+	TEST_RUN(test_batch_count);
+	TEST_RUN(test_batch_before_cmd);
+	TEST_RUN(test_batch_before_rsp);
+	TEST_RUN(test_batch_from_decoder);
+
+	return 0;
+}
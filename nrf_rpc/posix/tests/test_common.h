@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TEST_COMMON_H_
+#define TEST_COMMON_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Minimal helpers shared by nRF RPC host tests. Each test is a separate
+ * executable that returns non-zero exit code on failure.
+ */
+
+#define TEST_ASSERT(_expr)						       \
+	do {								       \
+		if (!(_expr)) {						       \
+			fprintf(stderr, "%s:%d: assertion failed: %s\n",       \
+				__FILE__, __LINE__, #_expr);		       \
+			exit(1);					       \
+		}							       \
+	} while (0)
+
+#define TEST_RUN(_test)							       \
+	do {								       \
+		printf("Running %s\n", #_test);				       \
+		_test();						       \
+	} while (0)
+
+static inline uint64_t test_time_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static inline void test_sleep_ms(uint32_t ms)
+{
+	struct timespec ts = {
+		.tv_sec = ms / 1000,
+		.tv_nsec = (long)(ms % 1000) * 1000000L,
+	};
+
+	nanosleep(&ts, NULL);
+}
+
+/* Wait until a condition becomes true or fail after a timeout. */
+#define TEST_WAIT_FOR(_expr, _timeout_ms)				       \
+	do {								       \
+		uint64_t _end = test_time_ms() + (_timeout_ms);		       \
+									       \
+		while (!(_expr)) {					       \
+			TEST_ASSERT(test_time_ms() < _end);		       \
+			test_sleep_ms(1);				       \
+		}							       \
+	} while (0)
+
+#endif /* TEST_COMMON_H_ */
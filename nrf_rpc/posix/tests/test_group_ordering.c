@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of per-group ordering over the loopback transport. They are built
+ * with and without automatic freeing of received buffers.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+#include "test_common.h"
+
+#define TEST_EVT_SEQ   0x01
+#define TEST_LARGE_LEN (2 * CONFIG_NRF_RPC_GROUP_QUEUE_BUF_SIZE)
+
+NRF_RPC_GROUP_DEFINE(slow_group, "slow", NULL, NULL, NULL);
+NRF_RPC_GROUP_DEFINE(fast_group, "fast", NULL, NULL, NULL);
+
+/* Handlers of the slow group wait until the gate is opened. They decode the
+ * packet first, as decoders should, so the received buffer can be released.
+ */
+static volatile bool gate_open;
+
+static uint32_t slow_count;
+static uint32_t slow_seq[16];
+static uint32_t fast_count;
+
+/* Payload starts with a sequence number followed by a byte pattern, which
+ * is checked to detect use of a freed buffer.
+ */
+static void payload_check(const uint8_t *packet, size_t len, uint32_t *seq)
+{
+	size_t i;
+
+	TEST_ASSERT(len >= sizeof(*seq));
+	memcpy(seq, packet, sizeof(*seq));
+
+	for (i = sizeof(*seq); i < len; i++) {
+		TEST_ASSERT(packet[i] == (uint8_t)(*seq + i));
+	}
+}
+
+static void slow_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint32_t seq;
+	uint32_t index;
+
+	payload_check(packet, len, &seq);
+	nrf_rpc_decoding_done(packet);
+
+	while (!gate_open) {
+		test_sleep_ms(1);
+	}
+
+	index = __atomic_load_n(&slow_count, __ATOMIC_ACQUIRE);
+	TEST_ASSERT(index < sizeof(slow_seq) / sizeof(slow_seq[0]));
+	slow_seq[index] = seq;
+	__atomic_store_n(&slow_count, index + 1, __ATOMIC_RELEASE);
+}
+
+NRF_RPC_EVT_DECODER(slow_group, slow_seq_dec, TEST_EVT_SEQ, slow_handler,
+		    NULL);
+
+static void fast_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint32_t seq;
+
+	payload_check(packet, len, &seq);
+	nrf_rpc_decoding_done(packet);
+
+	__atomic_fetch_add(&fast_count, 1, __ATOMIC_RELEASE);
+}
+
+NRF_RPC_EVT_DECODER(fast_group, fast_seq_dec, TEST_EVT_SEQ, fast_handler,
+		    NULL);
+
+static uint8_t *payload_alloc(uint32_t seq, size_t len)
+{
+	size_t i;
+	uint8_t *packet;
+
+	NRF_RPC_ALLOC(packet, len);
+	memcpy(packet, &seq, sizeof(seq));
+	for (i = sizeof(seq); i < len; i++) {
+		packet[i] = (uint8_t)(seq + i);
+	}
+
+	return packet;
+}
+
+static void send_evt(const struct nrf_rpc_group *group, uint32_t seq,
+		     size_t len)
+{
+	TEST_ASSERT(nrf_rpc_evt(group, TEST_EVT_SEQ, payload_alloc(seq, len),
+				len) == 0);
+}
+
+static void reset(void)
+{
+	gate_open = false;
+	__atomic_store_n(&slow_count, 0, __ATOMIC_RELEASE);
+	__atomic_store_n(&fast_count, 0, __ATOMIC_RELEASE);
+}
+
+static void slow_wait_for(uint32_t count)
+{
+	uint32_t i;
+
+	TEST_WAIT_FOR(__atomic_load_n(&slow_count, __ATOMIC_ACQUIRE) == count,
+		      1000);
+
+	for (i = 0; i < count; i++) {
+		TEST_ASSERT(slow_seq[i] == i);
+	}
+}
+
+/* A busy group delays neither the receive thread nor other groups. */
+static void test_head_of_line(void)
+{
+	reset();
+
+	send_evt(&slow_group, 0, 8);
+	send_evt(&slow_group, 1, 8);
+	send_evt(&slow_group, 2, 8);
+	send_evt(&fast_group, 0, 8);
+
+	TEST_WAIT_FOR(__atomic_load_n(&fast_count, __ATOMIC_ACQUIRE) == 1,
+		      1000);
+	TEST_ASSERT(__atomic_load_n(&slow_count, __ATOMIC_ACQUIRE) == 0);
+
+	gate_open = true;
+	slow_wait_for(3);
+}
+
+/* Packet too large to be copied is still executed in order. */
+static void test_large_packet(void)
+{
+	reset();
+
+	send_evt(&slow_group, 0, 8);
+	send_evt(&slow_group, 1, TEST_LARGE_LEN);
+	send_evt(&slow_group, 2, 8);
+
+	test_sleep_ms(10);
+	gate_open = true;
+	slow_wait_for(3);
+}
+
+/* Events from a batch keep order with events of their groups received
+ * earlier and do not wait for groups that are not busy.
+ */
+static void test_batch(void)
+{
+	reset();
+
+	send_evt(&slow_group, 0, 8);
+
+	TEST_ASSERT(nrf_rpc_evt_batched(&fast_group, TEST_EVT_SEQ,
+					payload_alloc(0, 8), 8) == 0);
+	TEST_ASSERT(nrf_rpc_evt_batched(&slow_group, TEST_EVT_SEQ,
+					payload_alloc(1, 8), 8) == 0);
+	TEST_ASSERT(nrf_rpc_batch_flush() == 0);
+
+	TEST_WAIT_FOR(__atomic_load_n(&fast_count, __ATOMIC_ACQUIRE) == 1,
+		      1000);
+	TEST_ASSERT(__atomic_load_n(&slow_count, __ATOMIC_ACQUIRE) == 0);
+
+	gate_open = true;
+	slow_wait_for(2);
+}
+
+int main(void)
+{
+	TEST_ASSERT(nrf_rpc_init(NULL) == 0);
+
+	/* Wait until initialization packet is received, so the batching
+	 * support of the remote side is known.
+	 */
+	send_evt(&fast_group, 0, 8);
+	TEST_WAIT_FOR(__atomic_load_n(&fast_count, __ATOMIC_ACQUIRE) == 1,
+		      1000);
+
+	TEST_RUN(test_head_of_line);
+	TEST_RUN(test_large_packet);
+	TEST_RUN(test_batch);
+
+	return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Test that packets are not copied on their way through nRF RPC and the
+ * loopback transport.
+ *
+ * The test is linked with "-Wl,--wrap=memcpy" and compiled with
+ * "-fno-builtin-memcpy", so every memcpy() outside of the C library goes
+ * through a wrapper that counts copied bytes. The test itself fills and
+ * checks payloads without memcpy().
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+#include "test_common.h"
+
+#define TEST_CMD_ECHO    0x01
+#define TEST_EVT_CHECK   0x01
+#define TEST_PAYLOAD_LEN 1024
+#define TEST_COUNT       100
+
+NRF_RPC_GROUP_DEFINE(test_group, "test", NULL, NULL, NULL);
+
+static uint64_t copied_bytes;
+static uint32_t checked_count;
+
+void *__real_memcpy(void *dst, const void *src, size_t n);
+
+void *__wrap_memcpy(void *dst, const void *src, size_t n)
+{
+	__atomic_fetch_add(&copied_bytes, n, __ATOMIC_RELAXED);
+
+	return __real_memcpy(dst, src, n);
+}
+
+static void payload_fill(uint8_t *packet, uint8_t seed)
+{
+	size_t i;
+
+	for (i = 0; i < TEST_PAYLOAD_LEN; i++) {
+		packet[i] = (uint8_t)(seed + i);
+	}
+}
+
+static void payload_check(const uint8_t *packet, size_t len, uint8_t seed)
+{
+	size_t i;
+
+	TEST_ASSERT(len == TEST_PAYLOAD_LEN);
+
+	for (i = 0; i < TEST_PAYLOAD_LEN; i++) {
+		TEST_ASSERT(packet[i] == (uint8_t)(seed + i));
+	}
+}
+
+static void echo_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	uint8_t seed = packet[0];
+	uint8_t *rsp;
+
+	payload_check(packet, len, seed);
+	nrf_rpc_decoding_done(packet);
+
+	NRF_RPC_ALLOC(rsp, TEST_PAYLOAD_LEN);
+	payload_fill(rsp, seed + 1);
+	nrf_rpc_rsp_no_err(rsp, TEST_PAYLOAD_LEN);
+}
+
+NRF_RPC_CMD_DECODER(test_group, test_echo, TEST_CMD_ECHO, echo_handler,
+		    NULL);
+
+static void check_handler(const uint8_t *packet, size_t len,
+			  void *handler_data)
+{
+	payload_check(packet, len, packet[0]);
+	nrf_rpc_decoding_done(packet);
+
+	__atomic_fetch_add(&checked_count, 1, __ATOMIC_RELEASE);
+}
+
+NRF_RPC_EVT_DECODER(test_group, test_check, TEST_EVT_CHECK, check_handler,
+		    NULL);
+
+static uint64_t copied_get(void)
+{
+	return __atomic_load_n(&copied_bytes, __ATOMIC_RELAXED);
+}
+
+/* The wrapper sees memcpy() calls, so a zero count below is meaningful. */
+static void test_counter(void)
+{
+	uint8_t src[8] = { 0 };
+	uint8_t dst[8];
+	uint64_t copied;
+
+	copied = copied_get();
+	memcpy(dst, src, sizeof(dst));
+	TEST_ASSERT(copied_get() - copied == sizeof(dst));
+}
+
+/* Command and its response are written once by the sender and read in place
+ * by the receiver.
+ */
+static void test_cmd_is_not_copied(void)
+{
+	uint32_t i;
+	uint8_t *packet;
+	const uint8_t *rsp;
+	size_t rsp_len;
+	uint64_t copied;
+
+	copied = copied_get();
+
+	for (i = 0; i < TEST_COUNT; i++) {
+		NRF_RPC_ALLOC(packet, TEST_PAYLOAD_LEN);
+		payload_fill(packet, (uint8_t)i);
+
+		TEST_ASSERT(nrf_rpc_cmd_rsp(&test_group, TEST_CMD_ECHO, packet,
+					    TEST_PAYLOAD_LEN, &rsp,
+					    &rsp_len) == 0);
+		payload_check(rsp, rsp_len, (uint8_t)(i + 1));
+		nrf_rpc_decoding_done(rsp);
+	}
+
+	copied = copied_get() - copied;
+
+	printf("Copied bytes per command: %.2f\n",
+	       (double)copied / TEST_COUNT);
+	TEST_ASSERT(copied == 0);
+}
+
+static void test_evt_is_not_copied(void)
+{
+	uint32_t i;
+	uint8_t *packet;
+	uint64_t copied;
+
+	copied = copied_get();
+
+	for (i = 0; i < TEST_COUNT; i++) {
+		NRF_RPC_ALLOC(packet, TEST_PAYLOAD_LEN);
+		payload_fill(packet, (uint8_t)i);
+
+		TEST_ASSERT(nrf_rpc_evt(&test_group, TEST_EVT_CHECK, packet,
+					TEST_PAYLOAD_LEN) == 0);
+	}
+
+	TEST_WAIT_FOR(__atomic_load_n(&checked_count, __ATOMIC_ACQUIRE) ==
+		      TEST_COUNT, 1000);
+
+	copied = copied_get() - copied;
+
+	printf("Copied bytes per event: %.2f\n", (double)copied / TEST_COUNT);
+	TEST_ASSERT(copied == 0);
+}
+
+int main(void)
+{
+	TEST_ASSERT(nrf_rpc_init(NULL) == 0);
+
+	TEST_RUN(test_counter);
+	TEST_RUN(test_cmd_is_not_copied);
+	TEST_RUN(test_evt_is_not_copied);
+
+	return 0;
+}
@@ -32,6 +32,12 @@ struct nrf_rpc_os_event;
 /** @brief Structure to pass messages between threads. */
 struct nrf_rpc_os_msg;
 
+/** @brief Mutex structure. */
+struct nrf_rpc_os_mutex;
+
+/** @brief Timer structure. */
+struct nrf_rpc_os_timer;
+
 /** @brief Work callback that will be called from thread pool.
  *
  * @param data Data passed from @ref nrf_rpc_os_thread_pool_send.
@@ -39,6 +45,12 @@ struct nrf_rpc_os_msg;
  */
 typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
 
+/** @brief Callback called when a timer expires.
+ *
+ * @param timer Timer that expired.
+ */
+typedef void (*nrf_rpc_os_timer_handler_t)(struct nrf_rpc_os_timer *timer);
+
 /** @brief nRF RPC OS-dependent initialization.
  *
  * @param callback Work callback that will be called when something was send
@@ -119,6 +131,65 @@ void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
 void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, const uint8_t **data,
 			size_t *len);
 
+/** @brief Initialize a mutex.
+ *
+ * Mutex is required only if @option{CONFIG_NRF_RPC_BATCH} or
+ * @option{CONFIG_NRF_RPC_GROUP_ORDERING} is enabled.
+ *
+ * @param mutex Mutex to initialize.
+ *
+ * @return      0 on success or negative error code.
+ */
+int nrf_rpc_os_mutex_init(struct nrf_rpc_os_mutex *mutex);
+
+/** @brief Lock a mutex.
+ *
+ * Mutex must be recursive, because nRF RPC may lock it again from the same
+ * thread, e.g. when a transport passes a packet to the receive handler
+ * directly from the send function.
+ *
+ * @param mutex Mutex to lock.
+ */
+void nrf_rpc_os_mutex_lock(struct nrf_rpc_os_mutex *mutex);
+
+/** @brief Unlock a mutex.
+ *
+ * @param mutex Mutex to unlock. It must be locked by the calling thread.
+ */
+void nrf_rpc_os_mutex_unlock(struct nrf_rpc_os_mutex *mutex);
+
+/** @brief Initialize a timer.
+ *
+ * Timer is required only if @option{CONFIG_NRF_RPC_BATCH_TIMEOUT} is not zero.
+ *
+ * @param timer   Timer to initialize.
+ * @param handler Callback called when the timer expires. It is called from
+ *                a thread, so it can block and send packets.
+ *
+ * @return        0 on success or negative error code.
+ */
+int nrf_rpc_os_timer_init(struct nrf_rpc_os_timer *timer,
+			  nrf_rpc_os_timer_handler_t handler);
+
+/** @brief Start a timer.
+ *
+ * If the timer is already running, it is restarted with the new timeout.
+ *
+ * @param timer      Timer to start.
+ * @param timeout_ms Time in milliseconds after which the handler is called.
+ */
+void nrf_rpc_os_timer_start(struct nrf_rpc_os_timer *timer,
+			    uint32_t timeout_ms);
+
+/** @brief Stop a timer.
+ *
+ * The handler may still be called once if the timer expired just before it
+ * was stopped.
+ *
+ * @param timer Timer to stop.
+ */
+void nrf_rpc_os_timer_stop(struct nrf_rpc_os_timer *timer);
+
 /** @brief Get TLS (Thread Local Storage) for nRF RPC.
  *
  * nRF PRC need one pointer to associate with a thread.
@@ -36,9 +36,26 @@ extern "C" {
 
 /** @brief Defines maximum size of a header that transport layer can add to
  * a packet.
+ *
+ * Transport that adds a header should reserve this many bytes in front of
+ * the buffer returned by @ref nrf_rpc_tr_alloc_tx_buf or
+ * @ref nrf_rpc_tr_reserve_tx_buf. The header can be then written in place by
+ * @ref nrf_rpc_tr_send or @ref nrf_rpc_tr_commit_tx_buf, so the packet is
+ * never copied.
  */
 #define NRF_RPC_TR_MAX_HEADER_SIZE 0
 
+/** @brief Defines whether the transport implements the reserve/commit API.
+ *
+ * If defined as `1` nRF RPC allocates, sends and discards packets with
+ * @ref nrf_rpc_tr_reserve_tx_buf, @ref nrf_rpc_tr_commit_tx_buf and
+ * @ref nrf_rpc_tr_discard_tx_buf. Otherwise, they are implemented in
+ * nrf_rpc_tr.h on top of @ref nrf_rpc_tr_alloc_tx_buf, @ref nrf_rpc_tr_send
+ * and @ref nrf_rpc_tr_free_tx_buf, and the transport does not need to
+ * provide them.
+ */
+#define NRF_RPC_TR_RESERVE_TX_BUF 0
+
 /** @brief Defines whether receive buffer is automatically dellocated when
  * @ref nrf_rpc_tr_receive_handler_t exits.
  *
@@ -86,6 +103,9 @@ void nrf_rpc_tr_free_rx_buf(const uint8_t *packet);
  *
  * This can be macro that allocates memory on the stack as a local variable.
  *
+ * nRF RPC writes its own header and encodes the payload directly into the
+ * returned buffer, so it is sent without any additional copying.
+ *
  * Memory is deallocated by @ref nrf_rpc_tr_send or @ref nrf_rpc_tr_free_tx_buf.
  *
  * @param[out] buf  Buffer containing allocated memory.
@@ -109,6 +129,53 @@ void nrf_rpc_tr_free_tx_buf(uint8_t *buf);
  */
 int nrf_rpc_tr_send(uint8_t *buf, size_t len);
 
+/** @brief Reserve memory for packet sending with headroom for headers.
+ *
+ * The transport allocates `headroom + len` bytes preceded by
+ * @ref NRF_RPC_TR_MAX_HEADER_SIZE bytes for its own header and returns
+ * a pointer to the first byte after `headroom`. The caller encodes the payload
+ * there and its headers into the headroom, and sends the packet with
+ * @ref nrf_rpc_tr_commit_tx_buf. The packet is never copied on the way to the
+ * transport.
+ *
+ * Requirements are the same as for @ref nrf_rpc_tr_alloc_tx_buf. This can be
+ * macro that allocates memory on the stack as a local variable.
+ *
+ * Only needed if @ref NRF_RPC_TR_RESERVE_TX_BUF is `1`.
+ *
+ * @param[out] buf       Buffer for the payload.
+ * @param[in]  headroom  Number of bytes reserved for the caller in front of
+ *                       the payload.
+ * @param[in]  len       Requested payload length.
+ */
+void nrf_rpc_tr_reserve_tx_buf(uint8_t **buf, size_t headroom, size_t len);
+
+/** @brief Send a packet from reserved memory.
+ *
+ * The transport may write its header into @ref NRF_RPC_TR_MAX_HEADER_SIZE
+ * bytes in front of `buf`. Memory is deallocated when it is no longer needed.
+ *
+ * Only needed if @ref NRF_RPC_TR_RESERVE_TX_BUF is `1`.
+ *
+ * @param buf  Start of the headroom of a buffer reserved by
+ *             @ref nrf_rpc_tr_reserve_tx_buf, i.e. its payload pointer minus
+ *             the headroom.
+ * @param len  Length of the packet including the headroom. Can be smaller
+ *             than reserved.
+ *
+ * @return     0 on success or negative error code.
+ */
+int nrf_rpc_tr_commit_tx_buf(uint8_t *buf, size_t len);
+
+/** @brief Deallocate reserved memory that was not sent.
+ *
+ * Only needed if @ref NRF_RPC_TR_RESERVE_TX_BUF is `1`.
+ *
+ * @param buf       Payload pointer returned by @ref nrf_rpc_tr_reserve_tx_buf.
+ * @param headroom  Headroom passed to @ref nrf_rpc_tr_reserve_tx_buf.
+ */
+void nrf_rpc_tr_discard_tx_buf(uint8_t *buf, size_t headroom);
+
 #ifdef __cplusplus
 }
 #endif